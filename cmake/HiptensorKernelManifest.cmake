@@ -0,0 +1,218 @@
+###############################################################################
+ #
+ # MIT License
+ #
+ # Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ #
+ # Permission is hereby granted, free of charge, to any person obtaining a copy
+ # of this software and associated documentation files (the "Software"), to deal
+ # in the Software without restriction, including without limitation the rights
+ # to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ # copies of the Software, and to permit persons to whom the Software is
+ # furnished to do so, subject to the following conditions:
+ #
+ # The above copyright notice and this permission notice shall be included in
+ # all copies or substantial portions of the Software.
+ #
+ # THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ # IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ # FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ # AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ # LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ # THE SOFTWARE.
+ #
+ ###############################################################################
+
+# Kernel manifest support.
+#
+# The manifest is a plain text list of kernel groups to build, one group per line:
+#   <operation> <types> <variant> <rank>
+# See library/src/manifests/default.txt for the field definitions.
+#
+# Instance sources are filtered against the manifest, and the registration code for
+# the solution registries is generated from the sources that remain.
+
+# Reads the manifest file into the global HIPTENSOR_KERNEL_MANIFEST_ENTRIES property.
+# Each entry is stored as "<operation>|<types>|<variant>|<rank>".
+function(hiptensor_load_kernel_manifest MANIFEST_FILE)
+    if(NOT EXISTS "${MANIFEST_FILE}")
+        message(FATAL_ERROR "Kernel manifest not found: ${MANIFEST_FILE}")
+    endif()
+
+    file(STRINGS "${MANIFEST_FILE}" MANIFEST_LINES)
+    set(ENTRIES)
+    foreach(LINE IN LISTS MANIFEST_LINES)
+        string(STRIP "${LINE}" LINE)
+        if(LINE STREQUAL "" OR LINE MATCHES "^#")
+            continue()
+        endif()
+
+        string(REGEX REPLACE "[ \t]+" ";" FIELDS "${LINE}")
+        list(LENGTH FIELDS NUM_FIELDS)
+        if(NOT NUM_FIELDS EQUAL 4)
+            message(FATAL_ERROR "Malformed kernel manifest entry '${LINE}' in ${MANIFEST_FILE}")
+        endif()
+
+        string(REPLACE ";" "|" ENTRY "${FIELDS}")
+        list(APPEND ENTRIES "${ENTRY}")
+    endforeach()
+
+    set_property(GLOBAL PROPERTY HIPTENSOR_KERNEL_MANIFEST_ENTRIES "${ENTRIES}")
+    list(LENGTH ENTRIES NUM_ENTRIES)
+    message(STATUS "Kernel manifest: ${MANIFEST_FILE} (${NUM_ENTRIES} entries)")
+endfunction()
+
+# Sets RESULT_VAR to TRUE if any manifest entry selects the given kernel group.
+function(hiptensor_manifest_contains RESULT_VAR OPERATION TYPES VARIANT RANK)
+    get_property(ENTRIES GLOBAL PROPERTY HIPTENSOR_KERNEL_MANIFEST_ENTRIES)
+    set(KEY "${OPERATION};${TYPES};${VARIANT};${RANK}")
+    foreach(ENTRY IN LISTS ENTRIES)
+        string(REPLACE "|" ";" FIELDS "${ENTRY}")
+        set(MATCHED TRUE)
+        foreach(IDX RANGE 3)
+            list(GET FIELDS ${IDX} PATTERN)
+            list(GET KEY ${IDX} VALUE)
+            if(NOT PATTERN STREQUAL "*" AND NOT PATTERN STREQUAL VALUE)
+                set(MATCHED FALSE)
+                break()
+            endif()
+        endforeach()
+        if(MATCHED)
+            set(${RESULT_VAR} TRUE PARENT_SCOPE)
+            return()
+        endif()
+    endforeach()
+    set(${RESULT_VAR} FALSE PARENT_SCOPE)
+endfunction()
+
+# Filters contraction instance sources against the manifest and generates the
+# registration calls for the selected kernel groups into GENERATED_FILE.
+function(hiptensor_manifest_contraction_sources SOURCES_VAR GENERATED_FILE)
+    set(SELECTED)
+    set(REGISTRATIONS)
+    foreach(SOURCE IN LISTS ${SOURCES_VAR})
+        get_filename_component(NAME "${SOURCE}" NAME_WE)
+        if(NOT NAME MATCHES "^device_contraction_(bilinear|scale)_m6_n6_k6_xdl_c_shuffle_(.+)_([a-z]+)_instance$")
+            list(APPEND SELECTED "${SOURCE}")
+            continue()
+        endif()
+
+        set(OP "${CMAKE_MATCH_1}")
+        set(TYPES "${CMAKE_MATCH_2}")
+        set(LAYOUT "${CMAKE_MATCH_3}")
+        hiptensor_manifest_contains(IS_SELECTED "contraction_${OP}" "${TYPES}" "${LAYOUT}" "6")
+        if(NOT IS_SELECTED)
+            continue()
+        endif()
+        list(APPEND SELECTED "${SOURCE}")
+
+        string(APPEND REGISTRATIONS
+            "// contraction_${OP} ${TYPES} ${LAYOUT} 6\n"
+            "registerSolutions(enumerateContractionSolutions(\n"
+            "    ck::tensor_operation::device::instance::add_${NAME}));\n\n")
+    endforeach()
+
+    _hiptensor_manifest_write("${GENERATED_FILE}" "${REGISTRATIONS}")
+    set(${SOURCES_VAR} "${SELECTED}" PARENT_SCOPE)
+endfunction()
+
+# Filters permutation instance sources against the manifest and generates the
+# registration calls for the selected kernel groups into GENERATED_FILE.
+function(hiptensor_manifest_permutation_sources SOURCES_VAR GENERATED_FILE)
+    set(SELECTED)
+    set(REGISTRATIONS)
+    foreach(SOURCE IN LISTS ${SOURCES_VAR})
+        get_filename_component(NAME "${SOURCE}" NAME_WE)
+        if(NOT NAME MATCHES "^permutation_solution_rank([0-9]+)_(float|half|bhalf|double|convert)_([a-z_]+)_instances$")
+            list(APPEND SELECTED "${SOURCE}")
+            continue()
+        endif()
+
+        set(RANK "${CMAKE_MATCH_1}")
+        set(TYPE_NAME "${CMAKE_MATCH_2}")
+        set(VARIANT "${CMAKE_MATCH_3}")
+        if(TYPE_NAME STREQUAL "float")
+            set(TYPES "f32")
+        elseif(TYPE_NAME STREQUAL "half")
+            set(TYPES "f16")
+        elseif(TYPE_NAME STREQUAL "bhalf")
+            set(TYPES "bf16")
+        elseif(TYPE_NAME STREQUAL "double")
+            set(TYPES "f64")
+        else()
+            # Conversions between f16, bf16 or f64 and f32
+            set(TYPES "mixed")
+        endif()
+
+        hiptensor_manifest_contains(IS_SELECTED "permutation" "${TYPES}" "${VARIANT}" "${RANK}")
+        if(NOT IS_SELECTED)
+            continue()
+        endif()
+        list(APPEND SELECTED "${SOURCE}")
+
+        # E.g. rank2_float_square_through -> PermutationSolution2DFloatSquareThroughInstances
+        set(FUNC_NAME "")
+        string(REPLACE "_" ";" WORDS "${TYPE_NAME}_${VARIANT}")
+        foreach(WORD IN LISTS WORDS)
+            string(SUBSTRING "${WORD}" 0 1 FIRST)
+            string(SUBSTRING "${WORD}" 1 -1 REST)
+            string(TOUPPER "${FIRST}" FIRST)
+            string(APPEND FUNC_NAME "${FIRST}${REST}")
+        endforeach()
+
+        string(APPEND REGISTRATIONS
+            "// permutation ${TYPES} ${VARIANT} ${RANK}\n"
+            "PermutationSolution${RANK}D${FUNC_NAME}Instances();\n\n")
+    endforeach()
+
+    _hiptensor_manifest_write("${GENERATED_FILE}" "${REGISTRATIONS}")
+    set(${SOURCES_VAR} "${SELECTED}" PARENT_SCOPE)
+endfunction()
+
+# Filters reduction instance sources against the manifest and generates the
+# registration calls for the selected kernel groups into GENERATED_FILE.
+function(hiptensor_manifest_reduction_sources SOURCES_VAR GENERATED_FILE)
+    set(SELECTED)
+    set(REGISTRATIONS)
+    foreach(SOURCE IN LISTS ${SOURCES_VAR})
+        get_filename_component(NAME "${SOURCE}" NAME_WE)
+        if(NOT NAME MATCHES "^reduction_solution_([0-9]+)_([0-9]+)_([a-z0-9]+)_([a-z0-9]+)_instance$")
+            list(APPEND SELECTED "${SOURCE}")
+            continue()
+        endif()
+
+        set(RANK "${CMAKE_MATCH_1}")
+        set(NUM_REDUCED "${CMAKE_MATCH_2}")
+        set(IN_TOKEN "${CMAKE_MATCH_3}")
+        set(COMPUTE_TOKEN "${CMAKE_MATCH_4}")
+
+        hiptensor_manifest_contains(
+            IS_SELECTED "reduction" "${IN_TOKEN}_${COMPUTE_TOKEN}" "${NUM_REDUCED}" "${RANK}")
+        if(NOT IS_SELECTED)
+            continue()
+        endif()
+        list(APPEND SELECTED "${SOURCE}")
+
+        # E.g. 2_1_bf16_f32 -> genReductionSolution2x1BF16F32Instances
+        string(TOUPPER "${IN_TOKEN}${COMPUTE_TOKEN}" TYPE_NAME)
+        string(APPEND REGISTRATIONS
+            "// reduction ${IN_TOKEN}_${COMPUTE_TOKEN} ${NUM_REDUCED} ${RANK}\n"
+            "genReductionSolution${RANK}x${NUM_REDUCED}${TYPE_NAME}Instances();\n\n")
+    endforeach()
+
+    _hiptensor_manifest_write("${GENERATED_FILE}" "${REGISTRATIONS}")
+    set(${SOURCES_VAR} "${SELECTED}" PARENT_SCOPE)
+endfunction()
+
+# Writes generated registration code, only touching the file when it changes
+function(_hiptensor_manifest_write GENERATED_FILE CONTENT)
+    set(CONTENT "// Generated from the kernel manifest. Do not edit.\n\n${CONTENT}")
+    if(EXISTS "${GENERATED_FILE}")
+        file(READ "${GENERATED_FILE}" CURRENT)
+        if(CURRENT STREQUAL CONTENT)
+            return()
+        endif()
+    endif()
+    file(WRITE "${GENERATED_FILE}" "${CONTENT}")
+endfunction()
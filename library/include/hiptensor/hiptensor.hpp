@@ -36,6 +36,8 @@
 //! device to be used by calling hipInit(0) and then create another hipTensor
 //! handle, which will be associated with the new device, by calling
 //! hiptensorCreate().
+//! The initial backend of the handle is HIPTENSOR_BACKEND_AUTO, unless overridden
+//! by the HIPTENSOR_DEFAULT_BACKEND environment variable (GPU, CPU or AUTO).
 //! @param[out] handle Pointer to hiptensorHandle_t pointer
 //! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
 hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle);
@@ -45,6 +47,27 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle);
 //! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
 hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle);
 
+//! @brief Selects the execution backend of the handle
+//! @details With the CPU backend, or the AUTO backend when no supported device is
+//! present, hiptensorContraction, hiptensorPermutation, hiptensorReduction and the
+//! elementwise operations run the multithreaded host solutions on host pointers.
+//! Contraction finds and plans must be initialized after the backend is selected.
+//! @param[in,out] handle Opaque handle holding hipTensor's library context.
+//! @param[in] backend The backend to execute subsequent operations on.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the backend is not a valid enumeration.
+//! @retval HIPTENSOR_STATUS_ARCH_MISMATCH if the GPU backend is requested without a device.
+hiptensorStatus_t hiptensorSetBackend(hiptensorHandle_t* handle, hiptensorBackend_t backend);
+
+//! @brief Queries the execution backend of the handle
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] backend The backend selected for the handle.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or backend is not initialized.
+hiptensorStatus_t hiptensorGetBackend(const hiptensorHandle_t* handle,
+                                      hiptensorBackend_t*      backend);
+
 //! @brief Initializes a tensor descriptor
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[out] desc Pointer to the allocated tensor descriptor object.
@@ -71,6 +94,15 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
 const char* hiptensorGetErrorString(const hiptensorStatus_t error);
 
 //! @brief Tensor permutation
+//! @details A and B are HIP_R_16F, HIP_R_16BF, HIP_R_32F, HIP_R_64F, HIP_C_32F or
+//! HIP_C_64F. B may have a different data type than A when one of them is HIP_R_32F
+//! and the other is HIP_R_16F, HIP_R_16BF or HIP_R_64F, or when both are complex;
+//! the conversion is fused into the permutation. Unary operators are supported for
+//! HIP_R_16F and HIP_R_32F tensors of the same type only.
+//! alpha is applied in single precision. For complex tensors alpha may be complex,
+//! but its imaginary part must be zero.
+//! B may be A for the permutations that hiptensorPermutationInPlace() runs
+//! without a workspace.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] alpha Scaling factor for A of the type typeScalar. Pointer to the host memory.
 //! If alpha is zero, A is not read and the corresponding unary operator is not applied.
@@ -97,6 +129,402 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
                                        const hipDataType                  typeScalar,
                                        const hipStream_t                  stream);
 
+//! @brief Initializes a permutation plan for a given tensor permutation problem
+//! @details The plan selects the kernel and resolves the tensor layout once, so
+//! that hiptensorPermutationExecute() only supplies the data pointers and alpha.
+//! The plan can be reused multiple times for the same permutation problem and is
+//! created for the active HIP device.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan Opaque handle holding the permutation plan.
+//! @param[in] descA A descriptor that holds information about the data type, modes, and strides of A.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of A.
+//! @param[in] descB A descriptor that holds information about the data type, modes, and strides of B.
+//! @param[in] modeB Array of size descB->numModes that holds the names of the modes of B
+//! @param[in] typeScalar data type of alpha
+//! @retval HIPTENSOR_STATUS_SUCCESS If a viable candidate has been found.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or tensor descriptors are not initialized.
+hiptensorStatus_t hiptensorInitPermutationPlan(const hiptensorHandle_t*           handle,
+                                               hiptensorPermutationPlan_t*        plan,
+                                               const hiptensorTensorDescriptor_t* descA,
+                                               const int32_t                      modeA[],
+                                               const hiptensorTensorDescriptor_t* descB,
+                                               const int32_t                      modeB[],
+                                               const hipDataType                  typeScalar);
+
+//! @brief Executes a permutation plan \f[ B = alpha * A \f]
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! HIP Device associated with the handle must be same/active at the time
+//! the plan was created.
+//! @param[in] plan Opaque handle holding the permutation plan.
+//! @param[in] alpha Scaling factor for A of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] A Multi-mode tensor described by the plan's descA. Pointer to the GPU-accessible memory.
+//! @param[in,out] B Multi-mode tensor described by the plan's descB. Pointer to the GPU-accessible memory.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the plan was built for another backend than the
+//! backend of the handle.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if A or B is not aligned to the vectors of the plan's
+//! kernel and the kernel manifest has no kernel with scalar accesses for the problem.
+//! @retval HIPTENSOR_STATUS_ARCH_MISMATCH if the active device is not the device of the handle.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if the kernel fails to run.
+hiptensorStatus_t hiptensorPermutationExecute(const hiptensorHandle_t*          handle,
+                                              const hiptensorPermutationPlan_t* plan,
+                                              const void*                       alpha,
+                                              const void*                       A,
+                                              void*                             B,
+                                              const hipStream_t                 stream);
+
+//! @brief Permutes a batch of tensors with a constant stride in one launch
+//! \f[ B_i = alpha * A_i \f]
+//! @details Tensor i of the batch starts strideA elements after tensor i - 1 of A,
+//! and strideB elements after tensor i - 1 of B. The batch is permuted as one tensor
+//! with an extra, slowest changing mode, so small tensors still fill the device.
+//! The data types and operators supported are those of hiptensorPermutation(), and
+//! the rank of A plus one must be supported after the modes are folded.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] alpha Scaling factor for A of the type typeScalar. Pointer to the host memory.
+//! @param[in] A First tensor of the batch of A. Pointer to the GPU-accessible memory.
+//! @param[in] descA A descriptor that holds information about the data type, modes, and strides of every tensor of A.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of A.
+//! @param[in] strideA Distance in elements between consecutive tensors of A (must be larger than zero).
+//! @param[in,out] B First tensor of the batch of B. Pointer to the GPU-accessible memory.
+//! @param[in] descB A descriptor that holds information about the data type, modes, and strides of every tensor of B.
+//! @param[in] modeB Array of size descB->numModes that holds the names of the modes of B
+//! @param[in] strideB Distance in elements between consecutive tensors of B. The tensors of B must not overlap.
+//! @param[in] batchCount Number of tensors in the batch (must be larger than zero).
+//! @param[in] typeScalar data type of alpha
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the batch, tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+hiptensorStatus_t hiptensorPermutationStridedBatched(const hiptensorHandle_t*           handle,
+                                                     const void*                        alpha,
+                                                     const void*                        A,
+                                                     const hiptensorTensorDescriptor_t* descA,
+                                                     const int32_t                      modeA[],
+                                                     const int64_t                      strideA,
+                                                     void*                              B,
+                                                     const hiptensorTensorDescriptor_t* descB,
+                                                     const int32_t                      modeB[],
+                                                     const int64_t                      strideB,
+                                                     const int64_t                      batchCount,
+                                                     const hipDataType                  typeScalar,
+                                                     const hipStream_t                  stream);
+
+//! @brief Permutes a batch of tensors sharing the same descriptors \f[ B[i] = alpha * A[i] \f]
+//! @details When the tensors of A, and those of B, are equally spaced in memory and
+//! the tensors of B do not overlap, the batch is permuted in one launch as by
+//! hiptensorPermutationStridedBatched(). Otherwise the batch is still permuted in one
+//! launch, reading the base pointers of the tensors from a device copy of A and B, and
+//! the tensors of B must not overlap each other nor the tensors of A. Tensors permuted
+//! in place (B[i] == A[i]) are permuted one at a time as by hiptensorPermutationInPlace()
+//! without a workspace, and the other tensors of the batch in one launch.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] alpha Scaling factor for A of the type typeScalar. Pointer to the host memory.
+//! @param[in] A Host array of batchCount pointers to the GPU-accessible tensors of A.
+//! @param[in] descA A descriptor that holds information about the data type, modes, and strides of every tensor of A.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of A.
+//! @param[in,out] B Host array of batchCount pointers to the GPU-accessible tensors of B.
+//! @param[in] descB A descriptor that holds information about the data type, modes, and strides of every tensor of B.
+//! @param[in] modeB Array of size descB->numModes that holds the names of the modes of B
+//! @param[in] batchCount Number of tensors in the batch (must be larger than zero).
+//! @param[in] typeScalar data type of alpha
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the batch, tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or a tensor pointer is not initialized.
+hiptensorStatus_t hiptensorPermutationBatched(const hiptensorHandle_t*           handle,
+                                              const void*                        alpha,
+                                              const void* const                  A[],
+                                              const hiptensorTensorDescriptor_t* descA,
+                                              const int32_t                      modeA[],
+                                              void* const                        B[],
+                                              const hiptensorTensorDescriptor_t* descB,
+                                              const int32_t                      modeB[],
+                                              const int64_t                      batchCount,
+                                              const hipDataType                  typeScalar,
+                                              const hipStream_t                  stream);
+
+//! @brief Determines the workspace size of an in-place permutation (see \ref hiptensorPermutationInPlace)
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] descA same as in hiptensorPermutationInPlace
+//! @param[in] modeA same as in hiptensorPermutationInPlace
+//! @param[in] descB same as in hiptensorPermutationInPlace
+//! @param[in] modeB same as in hiptensorPermutationInPlace
+//! @param[in] pref HIPTENSOR_WORKSPACE_MIN for the smallest workspace the permutation
+//! runs with, HIPTENSOR_WORKSPACE_MAX for a workspace holding the whole tensor, or
+//! HIPTENSOR_WORKSPACE_RECOMMENDED in between. When the slowest changing mode moves,
+//! e.g. in a transpose of non-square matrices, one slice is the whole tensor, so the
+//! recommended size is up to 64 MiB and the maximum size is the size of the tensor.
+//! @param[out] workspaceSize The workspace size (in bytes), zero if the permutation needs no workspace.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the permutation cannot run in place.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+hiptensorStatus_t hiptensorPermutationGetWorkspaceSize(const hiptensorHandle_t*            handle,
+                                                       const hiptensorTensorDescriptor_t*  descA,
+                                                       const int32_t                       modeA[],
+                                                       const hiptensorTensorDescriptor_t*  descB,
+                                                       const int32_t                       modeB[],
+                                                       const hiptensorWorksizePreference_t pref,
+                                                       uint64_t* workspaceSize);
+
+//! @brief Permutes a tensor in place \f[ A = alpha * A \f]
+//! @details descA and descB describe the tensor before and after the permutation.
+//! They must have the same data type and packed strides, and their modes must be
+//! the same. Permutations keeping the memory layout, such as scaling, and
+//! transposes of square matrices, or of batches of them, need no workspace. Other
+//! permutations copy slices of the tensor to the workspace and permute them back
+//! into place, as many slices at a time as the workspace holds. A slice is the whole
+//! tensor when the slowest changing mode moves. When the workspace cannot hold one
+//! slice, the elements are moved in place along the cycles of the permutation
+//! instead, which needs no workspace but is slower, and a HIPTENSOR_LOG_LEVEL_PERF_HINT
+//! message gives the recommended workspace size.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] alpha Scaling factor of the type typeScalar. Pointer to the host memory.
+//! @param[in,out] A Multi-mode tensor. Pointer to the GPU-accessible memory.
+//! @param[in] descA A descriptor of A before the permutation.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of descA.
+//! @param[in] descB A descriptor of A after the permutation.
+//! @param[in] modeB Array of size descB->numModes that holds the names of the modes of descB.
+//! @param[in] typeScalar data type of alpha
+//! @param[out] workspace Workspace in GPU-accessible memory, or nullptr if workspaceSize is zero.
+//! @param[in] workspaceSize Size of the workspace (in bytes), at least the HIPTENSOR_WORKSPACE_MIN
+//! size of hiptensorPermutationGetWorkspaceSize().
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the permutation cannot run in place, or the
+//! combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE if the workspace is too small.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+hiptensorStatus_t hiptensorPermutationInPlace(const hiptensorHandle_t*           handle,
+                                              const void*                        alpha,
+                                              void*                              A,
+                                              const hiptensorTensorDescriptor_t* descA,
+                                              const int32_t                      modeA[],
+                                              const hiptensorTensorDescriptor_t* descB,
+                                              const int32_t                      modeB[],
+                                              const hipDataType                  typeScalar,
+                                              void*                              workspace,
+                                              uint64_t                           workspaceSize,
+                                              const hipStream_t                  stream);
+
+//! @brief Elementwise binary tensor operation \f[ D = opAC(alpha * opA(A), gamma * opC(C)) \f]
+//! @details A, C and D have the same data type, HIP_R_16F or HIP_R_32F, and any
+//! permutation of modes between them; the permutations are fused into the kernel.
+//! Every mode of A and C must be a mode of D of the same extent. A and C are
+//! broadcast along the modes of D they do not have. opA and opC are the unary
+//! operators of descA and descC, HIPTENSOR_OP_IDENTITY or HIPTENSOR_OP_SQRT; the
+//! unary operator of descD is not applied. All arithmetic is in single precision.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] alpha Scaling factor for A of the type typeScalar. Pointer to the host memory.
+//! @param[in] A Multi-mode tensor. Pointer to the GPU-accessible memory.
+//! @param[in] descA A descriptor that holds information about the data type, modes, and strides of A.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of A.
+//! @param[in] gamma Scaling factor for C of the type typeScalar. Pointer to the host memory.
+//! @param[in] C Multi-mode tensor. Pointer to the GPU-accessible memory.
+//! @param[in] descC A descriptor that holds information about the data type, modes, and strides of C.
+//! @param[in] modeC Array of size descC->numModes that holds the names of the modes of C.
+//! @param[out] D Multi-mode tensor. Pointer to the GPU-accessible memory. D may be C
+//! when both have the same descriptor and modes.
+//! @param[in] descD A descriptor that holds information about the data type, modes, and strides of D.
+//! @param[in] modeD Array of size descD->numModes that holds the names of the modes of D.
+//! @param[in] opAC Binary operator combining A and C: HIPTENSOR_OP_ADD, HIPTENSOR_OP_MUL,
+//! HIPTENSOR_OP_MAX or HIPTENSOR_OP_MIN.
+//! @param[in] typeScalar Data type of alpha and gamma: HIP_R_16F, HIP_R_32F or HIP_R_64F.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+hiptensorStatus_t hiptensorElementwiseBinary(const hiptensorHandle_t*           handle,
+                                             const void*                        alpha,
+                                             const void*                        A,
+                                             const hiptensorTensorDescriptor_t* descA,
+                                             const int32_t                      modeA[],
+                                             const void*                        gamma,
+                                             const void*                        C,
+                                             const hiptensorTensorDescriptor_t* descC,
+                                             const int32_t                      modeC[],
+                                             void*                              D,
+                                             const hiptensorTensorDescriptor_t* descD,
+                                             const int32_t                      modeD[],
+                                             hiptensorOperator_t                opAC,
+                                             const hipDataType                  typeScalar,
+                                             const hipStream_t                  stream);
+
+//! @brief Elementwise trinary tensor operation
+//! \f[ D = opABC(opAB(alpha * opA(A), beta * opB(B)), gamma * opC(C)) \f]
+//! @details The tensors and operators follow the rules of hiptensorElementwiseBinary().
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] alpha Scaling factor for A of the type typeScalar. Pointer to the host memory.
+//! @param[in] A Multi-mode tensor. Pointer to the GPU-accessible memory.
+//! @param[in] descA A descriptor that holds information about the data type, modes, and strides of A.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of A.
+//! @param[in] beta Scaling factor for B of the type typeScalar. Pointer to the host memory.
+//! @param[in] B Multi-mode tensor. Pointer to the GPU-accessible memory.
+//! @param[in] descB A descriptor that holds information about the data type, modes, and strides of B.
+//! @param[in] modeB Array of size descB->numModes that holds the names of the modes of B.
+//! @param[in] gamma Scaling factor for C of the type typeScalar. Pointer to the host memory.
+//! @param[in] C Multi-mode tensor. Pointer to the GPU-accessible memory.
+//! @param[in] descC A descriptor that holds information about the data type, modes, and strides of C.
+//! @param[in] modeC Array of size descC->numModes that holds the names of the modes of C.
+//! @param[out] D Multi-mode tensor. Pointer to the GPU-accessible memory. D may be C
+//! when both have the same descriptor and modes.
+//! @param[in] descD A descriptor that holds information about the data type, modes, and strides of D.
+//! @param[in] modeD Array of size descD->numModes that holds the names of the modes of D.
+//! @param[in] opAB Binary operator combining A and B.
+//! @param[in] opABC Binary operator combining the result of opAB and C.
+//! @param[in] typeScalar Data type of alpha, beta and gamma: HIP_R_16F, HIP_R_32F or HIP_R_64F.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+hiptensorStatus_t hiptensorElementwiseTrinary(const hiptensorHandle_t*           handle,
+                                              const void*                        alpha,
+                                              const void*                        A,
+                                              const hiptensorTensorDescriptor_t* descA,
+                                              const int32_t                      modeA[],
+                                              const void*                        beta,
+                                              const void*                        B,
+                                              const hiptensorTensorDescriptor_t* descB,
+                                              const int32_t                      modeB[],
+                                              const void*                        gamma,
+                                              const void*                        C,
+                                              const hiptensorTensorDescriptor_t* descC,
+                                              const int32_t                      modeC[],
+                                              void*                              D,
+                                              const hiptensorTensorDescriptor_t* descD,
+                                              const int32_t                      modeD[],
+                                              hiptensorOperator_t                opAB,
+                                              hiptensorOperator_t                opABC,
+                                              const hipDataType                  typeScalar,
+                                              const hipStream_t                  stream);
+
+//! @brief Initializes a plan for an elementwise binary operation (see \ref hiptensorElementwiseBinary)
+//! @details The plan selects the kernel and resolves the tensor layout once, so
+//! that hiptensorElementwiseBinaryExecute() only supplies the data pointers and
+//! scalars. The plan can be reused multiple times for the same problem and is
+//! created for the active HIP device.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan Opaque handle holding the elementwise plan.
+//! @param[in] descA same as in hiptensorElementwiseBinary
+//! @param[in] modeA same as in hiptensorElementwiseBinary
+//! @param[in] descC same as in hiptensorElementwiseBinary
+//! @param[in] modeC same as in hiptensorElementwiseBinary
+//! @param[in] descD same as in hiptensorElementwiseBinary
+//! @param[in] modeD same as in hiptensorElementwiseBinary
+//! @param[in] opAC same as in hiptensorElementwiseBinary
+//! @param[in] typeScalar same as in hiptensorElementwiseBinary
+//! @retval HIPTENSOR_STATUS_SUCCESS If a viable candidate has been found.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or tensor descriptors are not initialized.
+hiptensorStatus_t hiptensorInitElementwiseBinaryPlan(const hiptensorHandle_t*           handle,
+                                                     hiptensorElementwisePlan_t*        plan,
+                                                     const hiptensorTensorDescriptor_t* descA,
+                                                     const int32_t                      modeA[],
+                                                     const hiptensorTensorDescriptor_t* descC,
+                                                     const int32_t                      modeC[],
+                                                     const hiptensorTensorDescriptor_t* descD,
+                                                     const int32_t                      modeD[],
+                                                     hiptensorOperator_t                opAC,
+                                                     const hipDataType                  typeScalar);
+
+//! @brief Initializes a plan for an elementwise trinary operation (see \ref hiptensorElementwiseTrinary)
+//! @details The plan is executed with hiptensorElementwiseTrinaryExecute().
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan Opaque handle holding the elementwise plan.
+//! @param[in] descA same as in hiptensorElementwiseTrinary
+//! @param[in] modeA same as in hiptensorElementwiseTrinary
+//! @param[in] descB same as in hiptensorElementwiseTrinary
+//! @param[in] modeB same as in hiptensorElementwiseTrinary
+//! @param[in] descC same as in hiptensorElementwiseTrinary
+//! @param[in] modeC same as in hiptensorElementwiseTrinary
+//! @param[in] descD same as in hiptensorElementwiseTrinary
+//! @param[in] modeD same as in hiptensorElementwiseTrinary
+//! @param[in] opAB same as in hiptensorElementwiseTrinary
+//! @param[in] opABC same as in hiptensorElementwiseTrinary
+//! @param[in] typeScalar same as in hiptensorElementwiseTrinary
+//! @retval HIPTENSOR_STATUS_SUCCESS If a viable candidate has been found.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or operations is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if tensor dimensions or modes have an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or tensor descriptors are not initialized.
+hiptensorStatus_t hiptensorInitElementwiseTrinaryPlan(const hiptensorHandle_t*           handle,
+                                                      hiptensorElementwisePlan_t*        plan,
+                                                      const hiptensorTensorDescriptor_t* descA,
+                                                      const int32_t                      modeA[],
+                                                      const hiptensorTensorDescriptor_t* descB,
+                                                      const int32_t                      modeB[],
+                                                      const hiptensorTensorDescriptor_t* descC,
+                                                      const int32_t                      modeC[],
+                                                      const hiptensorTensorDescriptor_t* descD,
+                                                      const int32_t                      modeD[],
+                                                      hiptensorOperator_t                opAB,
+                                                      hiptensorOperator_t                opABC,
+                                                      const hipDataType                  typeScalar);
+
+//! @brief Executes an elementwise binary plan
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! HIP Device associated with the handle must be same/active at the time
+//! the plan was created.
+//! @param[in] plan Opaque handle holding a plan of hiptensorInitElementwiseBinaryPlan().
+//! @param[in] alpha Scaling factor for A of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] A Multi-mode tensor described by the plan's descA. Pointer to the GPU-accessible memory.
+//! @param[in] gamma Scaling factor for C of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] C Multi-mode tensor described by the plan's descC. Pointer to the GPU-accessible memory.
+//! @param[out] D Multi-mode tensor described by the plan's descD. Pointer to the GPU-accessible memory.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the plan is not a binary plan, or was built for
+//! another backend than the backend of the handle.
+//! @retval HIPTENSOR_STATUS_ARCH_MISMATCH if the active device is not the device of the handle.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if the kernel fails to run.
+hiptensorStatus_t hiptensorElementwiseBinaryExecute(const hiptensorHandle_t*          handle,
+                                                    const hiptensorElementwisePlan_t* plan,
+                                                    const void*                       alpha,
+                                                    const void*                       A,
+                                                    const void*                       gamma,
+                                                    const void*                       C,
+                                                    void*                             D,
+                                                    const hipStream_t                 stream);
+
+//! @brief Executes an elementwise trinary plan
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! HIP Device associated with the handle must be same/active at the time
+//! the plan was created.
+//! @param[in] plan Opaque handle holding a plan of hiptensorInitElementwiseTrinaryPlan().
+//! @param[in] alpha Scaling factor for A of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] A Multi-mode tensor described by the plan's descA. Pointer to the GPU-accessible memory.
+//! @param[in] beta Scaling factor for B of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] B Multi-mode tensor described by the plan's descB. Pointer to the GPU-accessible memory.
+//! @param[in] gamma Scaling factor for C of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] C Multi-mode tensor described by the plan's descC. Pointer to the GPU-accessible memory.
+//! @param[out] D Multi-mode tensor described by the plan's descD. Pointer to the GPU-accessible memory.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the plan is not a trinary plan, or was built for
+//! another backend than the backend of the handle.
+//! @retval HIPTENSOR_STATUS_ARCH_MISMATCH if the active device is not the device of the handle.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if the kernel fails to run.
+hiptensorStatus_t hiptensorElementwiseTrinaryExecute(const hiptensorHandle_t*          handle,
+                                                     const hiptensorElementwisePlan_t* plan,
+                                                     const void*                       alpha,
+                                                     const void*                       A,
+                                                     const void*                       beta,
+                                                     const void*                       B,
+                                                     const void*                       gamma,
+                                                     const void*                       C,
+                                                     void*                             D,
+                                                     const hipStream_t                 stream);
+
 //! @brief Computes the alignment requirement for a given pointer and descriptor.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] ptr Pointer to the respective tensor data.
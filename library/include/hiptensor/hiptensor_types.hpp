@@ -163,6 +163,21 @@ typedef enum
 
 } hiptensorLogLevel_t;
 
+//! @brief Execution backend of a hipTensor handle
+//! @details Selects where the operations issued through a handle are executed.
+//! The CPU backend accepts host pointers and runs on the library's host thread pool,
+//! whose size may be set with the HIPTENSOR_CPU_THREADS environment variable.
+typedef enum
+{
+    //! Operations run on the HIP device that was current when the handle was created
+    HIPTENSOR_BACKEND_GPU = 0,
+    //! Operations run on the host; tensor pointers must be host-accessible
+    HIPTENSOR_BACKEND_CPU = 1,
+    //! Operations run on the device if a supported one is present, otherwise on the host
+    HIPTENSOR_BACKEND_AUTO = 2,
+
+} hiptensorBackend_t;
+
 //! @brief hipTensor's library context
 struct hiptensorHandle_t
 {
@@ -226,6 +241,66 @@ struct hiptensorContractionPlan_t
     hiptensorContractionDescriptor_t mContractionDesc;
 };
 
+//! @brief hipTensor structure representing a permutation plan.
+//! Constructed with the hiptensorInitPermutationPlan() function.
+struct hiptensorPermutationPlan_t
+{
+    //! Solution applying alpha
+    void* mSolution;
+    //! Data-movement solution used when alpha is one, or nullptr
+    void* mCopySolution;
+    //! Prepared runtime arguments of mSolution
+    std::shared_ptr<void> mArgs;
+    //! Prepared runtime arguments of mCopySolution
+    std::shared_ptr<void> mCopyArgs;
+    //! Solution with scalar accesses, used when A or B is not aligned for the vectors
+    //! of mSolution and mCopySolution, or nullptr
+    void* mNarrowSolution;
+    //! Prepared runtime arguments of mNarrowSolution
+    std::shared_ptr<void> mNarrowArgs;
+    //! Byte alignment of A that mSolution and mCopySolution require
+    std::size_t mAlignmentA;
+    //! Byte alignment of B that mSolution and mCopySolution require
+    std::size_t mAlignmentB;
+    //! Data type of alpha
+    hipDataType mTypeScalar;
+    //! Element count when the permutation folds to a flat copy or scale, else 0
+    std::size_t mFlatCount;
+    //! Data type of A of a flat permutation
+    hipDataType mFlatTypeA;
+    //! Data type of B of a flat permutation
+    hipDataType mFlatTypeB;
+    //! Backend the plan was built for, HIPTENSOR_BACKEND_GPU or HIPTENSOR_BACKEND_CPU
+    hiptensorBackend_t mBackend;
+};
+
+//! @brief hipTensor structure representing an elementwise binary or trinary plan.
+//! Constructed with the hiptensorInitElementwiseBinaryPlan() or
+//! hiptensorInitElementwiseTrinaryPlan() function.
+struct hiptensorElementwisePlan_t
+{
+    //! Selected solution
+    void* mSolution;
+    //! Prepared runtime arguments of mSolution
+    std::shared_ptr<void> mArgs;
+    //! Number of input tensors: 2 for binary and 3 for trinary plans
+    int32_t mNumInputs;
+    //! Unary operator of A
+    hiptensorOperator_t mOpA;
+    //! Unary operator of B
+    hiptensorOperator_t mOpB;
+    //! Unary operator of C
+    hiptensorOperator_t mOpC;
+    //! Binary operator combining A and B
+    hiptensorOperator_t mOpAB;
+    //! Binary operator combining the result with C (opAC of binary plans)
+    hiptensorOperator_t mOpABC;
+    //! Data type of the scalars
+    hipDataType mTypeScalar;
+    //! Backend the plan was built for, HIPTENSOR_BACKEND_GPU or HIPTENSOR_BACKEND_CPU
+    hiptensorBackend_t mBackend;
+};
+
 //! @brief Logging callback
 //! The specified callback is invoked whenever logging is enabled and a message is generated.
 //! @param logContext The logging context enum
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "api_helpers.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
+
+namespace hiptensor
+{
+    hiptensorStatus_t
+        checkNotNull(const char*                                                  apiName,
+                     std::initializer_list<std::pair<const char*, const void*>> params)
+    {
+        auto& logger = Logger::instance();
+
+        auto errorCode = HIPTENSOR_STATUS_SUCCESS;
+        for(auto const& param : params)
+        {
+            if(param.second == nullptr)
+            {
+                errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+
+                char msg[512];
+                snprintf(msg,
+                         sizeof(msg),
+                         "Initialization Error : %s = nullptr (%s)",
+                         param.first,
+                         hiptensorGetErrorString(errorCode));
+                logger->logError(apiName, msg);
+            }
+        }
+        return errorCode;
+    }
+
+    hiptensorStatus_t checkHandleDevice(const char* apiName, const hiptensorHandle_t* handle)
+    {
+        auto realHandle = Handle::toHandle((int64_t*)handle->fields);
+        if(realHandle->isHostBackend())
+        {
+            return HIPTENSOR_STATUS_SUCCESS;
+        }
+
+        auto currentDeviceId = HipDevice::currentDeviceId();
+        if(currentDeviceId != realHandle->getDevice().getDeviceId())
+        {
+            auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                     (int)currentDeviceId,
+                     (int)realHandle->getDevice().getDeviceId(),
+                     hiptensorGetErrorString(errorCode));
+            Logger::instance()->logError(apiName, msg);
+            return errorCode;
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    hiptensorStatus_t logPlanNotInitialized(const char* apiName)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+
+        char msg[512];
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : plan is not initialized (%s)",
+                 hiptensorGetErrorString(errorCode));
+        Logger::instance()->logError(apiName, msg);
+        return errorCode;
+    }
+
+    hiptensorBackend_t handleBackend(const hiptensorHandle_t* handle)
+    {
+        auto realHandle = Handle::toHandle((int64_t*)handle->fields);
+        return realHandle->isHostBackend() ? HIPTENSOR_BACKEND_CPU : HIPTENSOR_BACKEND_GPU;
+    }
+
+    hiptensorStatus_t checkPlanBackend(const char*              apiName,
+                                       const hiptensorHandle_t* handle,
+                                       hiptensorBackend_t       planBackend)
+    {
+        auto backend = handleBackend(handle);
+        if(backend != planBackend)
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Backend mismatch error: the plan was built for the %s backend, the "
+                     "handle runs on the %s backend (%s)",
+                     planBackend == HIPTENSOR_BACKEND_CPU ? "CPU" : "GPU",
+                     backend == HIPTENSOR_BACKEND_CPU ? "CPU" : "GPU",
+                     hiptensorGetErrorString(errorCode));
+            Logger::instance()->logError(apiName, msg);
+            return errorCode;
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    void logKernelPerformance(const char* apiName, PerfMetrics const& metrics)
+    {
+        // log perf metrics (not name/id)
+        char msg[2048];
+        snprintf(msg,
+                 sizeof(msg),
+                 "KernelId: %lu KernelName: %s, %0.3f ms, %0.3f TFlops, %0.3f GB/s",
+                 metrics.mKernelUid,
+                 metrics.mKernelName.c_str(),
+                 metrics.mAvgTimeMs,
+                 metrics.mTflops,
+                 metrics.mBandwidth);
+        Logger::instance()->logPerformanceTrace(apiName, msg);
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,388 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "contraction_cpu_engine.hpp"
+#include "thread_pool.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define HIPTENSOR_CPU_ENGINE_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Drops length-1 modes and folds adjacent modes that are contiguous,
+        // in the same direction, in every tensor sharing them.
+        void foldModes(std::vector<int64_t>&                     lengths,
+                       std::vector<std::vector<int64_t>*> const& strides)
+        {
+            std::vector<int64_t>              foldedLengths;
+            std::vector<std::vector<int64_t>> foldedStrides(strides.size());
+
+            for(std::size_t d = 0; d < lengths.size(); d++)
+            {
+                if(lengths[d] == 1)
+                {
+                    continue;
+                }
+
+                if(!foldedLengths.empty())
+                {
+                    bool innerFirst = true;
+                    bool outerFirst = true;
+                    for(std::size_t t = 0; t < strides.size(); t++)
+                    {
+                        auto prevStride = foldedStrides[t].back();
+                        auto stride     = (*strides[t])[d];
+                        innerFirst &= stride == prevStride * foldedLengths.back();
+                        outerFirst &= prevStride == stride * lengths[d];
+                    }
+
+                    if(innerFirst || outerFirst)
+                    {
+                        foldedLengths.back() *= lengths[d];
+                        if(!innerFirst)
+                        {
+                            for(std::size_t t = 0; t < strides.size(); t++)
+                            {
+                                foldedStrides[t].back() = (*strides[t])[d];
+                            }
+                        }
+                        continue;
+                    }
+                }
+
+                foldedLengths.push_back(lengths[d]);
+                for(std::size_t t = 0; t < strides.size(); t++)
+                {
+                    foldedStrides[t].push_back((*strides[t])[d]);
+                }
+            }
+
+            lengths = std::move(foldedLengths);
+            for(std::size_t t = 0; t < strides.size(); t++)
+            {
+                *strides[t] = std::move(foldedStrides[t]);
+            }
+        }
+
+        // Offset of every flattened index, first mode fastest
+        std::vector<int64_t> flatOffsets(std::vector<int64_t> const& lengths,
+                                         std::vector<int64_t> const& strides)
+        {
+            std::vector<int64_t> offsets{0};
+            for(std::size_t d = 0; d < lengths.size(); d++)
+            {
+                auto inner = offsets.size();
+                offsets.resize(inner * lengths[d]);
+                for(int64_t i = 1; i < lengths[d]; i++)
+                {
+                    for(std::size_t j = 0; j < inner; j++)
+                    {
+                        offsets[i * inner + j] = offsets[j] + i * strides[d];
+                    }
+                }
+            }
+            return offsets;
+        }
+
+#if HIPTENSOR_CPU_ENGINE_AVX2
+        bool hasAvx2Fma()
+        {
+            static const bool sSupported
+                = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            return sSupported;
+        }
+
+        // 6 x 16 f32 tile held in 12 ymm accumulators
+        __attribute__((target("avx2,fma"))) void microKernelAvx2(
+            int64_t kc, float const* aPanel, float const* bPanel, float* c, int64_t ldc)
+        {
+            __m256 accum[6][2];
+            for(int i = 0; i < 6; i++)
+            {
+                accum[i][0] = _mm256_setzero_ps();
+                accum[i][1] = _mm256_setzero_ps();
+            }
+
+            for(int64_t k = 0; k < kc; k++)
+            {
+                auto b0 = _mm256_loadu_ps(bPanel + k * 16);
+                auto b1 = _mm256_loadu_ps(bPanel + k * 16 + 8);
+                for(int i = 0; i < 6; i++)
+                {
+                    auto a      = _mm256_broadcast_ss(aPanel + k * 6 + i);
+                    accum[i][0] = _mm256_fmadd_ps(a, b0, accum[i][0]);
+                    accum[i][1] = _mm256_fmadd_ps(a, b1, accum[i][1]);
+                }
+            }
+
+            for(int i = 0; i < 6; i++)
+            {
+                auto row = c + i * ldc;
+                _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), accum[i][0]));
+                _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), accum[i][1]));
+            }
+        }
+
+        // 6 x 8 f64 tile held in 12 ymm accumulators
+        __attribute__((target("avx2,fma"))) void microKernelAvx2(
+            int64_t kc, double const* aPanel, double const* bPanel, double* c, int64_t ldc)
+        {
+            __m256d accum[6][2];
+            for(int i = 0; i < 6; i++)
+            {
+                accum[i][0] = _mm256_setzero_pd();
+                accum[i][1] = _mm256_setzero_pd();
+            }
+
+            for(int64_t k = 0; k < kc; k++)
+            {
+                auto b0 = _mm256_loadu_pd(bPanel + k * 8);
+                auto b1 = _mm256_loadu_pd(bPanel + k * 8 + 4);
+                for(int i = 0; i < 6; i++)
+                {
+                    auto a      = _mm256_broadcast_sd(aPanel + k * 6 + i);
+                    accum[i][0] = _mm256_fmadd_pd(a, b0, accum[i][0]);
+                    accum[i][1] = _mm256_fmadd_pd(a, b1, accum[i][1]);
+                }
+            }
+
+            for(int i = 0; i < 6; i++)
+            {
+                auto row = c + i * ldc;
+                _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), accum[i][0]));
+                _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), accum[i][1]));
+            }
+        }
+#endif // HIPTENSOR_CPU_ENGINE_AVX2
+    } // namespace
+
+    static_assert(ContractionCpuKernelTraits<float>::MR == 6
+                      && ContractionCpuKernelTraits<float>::NR == 16,
+                  "f32 micro-kernel tile mismatch");
+    static_assert(ContractionCpuKernelTraits<double>::MR == 6
+                      && ContractionCpuKernelTraits<double>::NR == 8,
+                  "f64 micro-kernel tile mismatch");
+
+    ContractionCpuPlan makeContractionCpuPlan(int32_t                     numDimsM,
+                                              int32_t                     numDimsN,
+                                              int32_t                     numDimsK,
+                                              std::vector<int64_t> const& a_ms_ks_lengths,
+                                              std::vector<int64_t> const& a_ms_ks_strides,
+                                              std::vector<int64_t> const& b_ns_ks_lengths,
+                                              std::vector<int64_t> const& b_ns_ks_strides,
+                                              std::vector<int64_t> const& e_ms_ns_strides,
+                                              std::vector<int64_t> const& d_ms_ns_strides)
+    {
+        ContractionCpuPlan plan;
+
+        auto slice = [](std::vector<int64_t> const& v, int32_t begin, int32_t count) {
+            return std::vector<int64_t>(v.begin() + begin, v.begin() + begin + count);
+        };
+
+        bool hasD = !d_ms_ns_strides.empty();
+
+        plan.mLengthsM = slice(a_ms_ks_lengths, 0, numDimsM);
+        plan.mLengthsN = slice(b_ns_ks_lengths, 0, numDimsN);
+        plan.mLengthsK = slice(a_ms_ks_lengths, numDimsM, numDimsK);
+
+        plan.mStridesAM = slice(a_ms_ks_strides, 0, numDimsM);
+        plan.mStridesAK = slice(a_ms_ks_strides, numDimsM, numDimsK);
+        plan.mStridesBN = slice(b_ns_ks_strides, 0, numDimsN);
+        plan.mStridesBK = slice(b_ns_ks_strides, numDimsN, numDimsK);
+        plan.mStridesEM = slice(e_ms_ns_strides, 0, numDimsM);
+        plan.mStridesEN = slice(e_ms_ns_strides, numDimsM, numDimsN);
+        if(hasD)
+        {
+            plan.mStridesDM = slice(d_ms_ns_strides, 0, numDimsM);
+            plan.mStridesDN = slice(d_ms_ns_strides, numDimsM, numDimsN);
+        }
+
+        std::vector<std::vector<int64_t>*> stridesM{&plan.mStridesAM, &plan.mStridesEM};
+        std::vector<std::vector<int64_t>*> stridesN{&plan.mStridesBN, &plan.mStridesEN};
+        if(hasD)
+        {
+            stridesM.push_back(&plan.mStridesDM);
+            stridesN.push_back(&plan.mStridesDN);
+        }
+        foldModes(plan.mLengthsM, stridesM);
+        foldModes(plan.mLengthsN, stridesN);
+        foldModes(plan.mLengthsK, {&plan.mStridesAK, &plan.mStridesBK});
+
+        plan.mOffsetsAM = flatOffsets(plan.mLengthsM, plan.mStridesAM);
+        plan.mOffsetsEM = flatOffsets(plan.mLengthsM, plan.mStridesEM);
+        plan.mOffsetsBN = flatOffsets(plan.mLengthsN, plan.mStridesBN);
+        plan.mOffsetsEN = flatOffsets(plan.mLengthsN, plan.mStridesEN);
+        plan.mOffsetsAK = flatOffsets(plan.mLengthsK, plan.mStridesAK);
+        plan.mOffsetsBK = flatOffsets(plan.mLengthsK, plan.mStridesBK);
+        if(hasD)
+        {
+            plan.mOffsetsDM = flatOffsets(plan.mLengthsM, plan.mStridesDM);
+            plan.mOffsetsDN = flatOffsets(plan.mLengthsN, plan.mStridesDN);
+        }
+
+        plan.mM = plan.mOffsetsAM.size();
+        plan.mN = plan.mOffsetsBN.size();
+        plan.mK = plan.mOffsetsAK.size();
+
+        return plan;
+    }
+
+    ContractionCpuTiling makeContractionCpuTiling(int64_t m, int64_t n, int64_t mr, int64_t nr)
+    {
+        auto const threads = static_cast<int64_t>(ThreadPool::instance()->threadCount());
+
+        auto mPanels = ContractionCpuBlocking::MPanels;
+        auto nPanels = ContractionCpuBlocking::NPanels;
+        auto tiles   = [&]() {
+            return ((m + mPanels * mr - 1) / (mPanels * mr))
+                   * ((n + nPanels * nr - 1) / (nPanels * nr));
+        };
+        while(tiles() < threads && (mPanels > 1 || nPanels > 1))
+        {
+            if(mPanels >= nPanels)
+            {
+                mPanels /= 2;
+            }
+            else
+            {
+                nPanels /= 2;
+            }
+        }
+
+        return {mPanels * mr, nPanels * nr};
+    }
+
+    ContractionCpuCost selectContractionCpuStrategy(ContractionCpuPlan const& plan,
+                                                    std::size_t               elementBytes,
+                                                    int64_t                   mr,
+                                                    int64_t                   nr)
+    {
+        // Largest scratch TTGT may allocate on the host
+        constexpr std::size_t MaxScratchBytes = std::size_t(1) << 30;
+        // TTGT must be clearly cheaper to pay for the extra passes
+        constexpr double TtgtMargin = 0.8;
+
+        // Tensors up to this size are assumed to stay cache resident, where
+        // the access order does not matter
+        constexpr double CacheBytes = 256 << 10;
+
+        auto const M = static_cast<double>(plan.mM);
+        auto const N = static_cast<double>(plan.mN);
+        auto const K = static_cast<double>(plan.mK);
+
+        // Cost of streaming one element of a tensor with the given number of
+        // elements along a stride: unit stride uses whole cache lines, larger
+        // strides touch one line per element at worst
+        auto strideCost = [elementBytes](double elements, std::vector<int64_t> const& strides) {
+            auto lineElements = std::max<double>(1.0, 64.0 / elementBytes);
+            auto stride       = strides.empty() ? 1 : std::abs(strides.front());
+            return elements * elementBytes <= CacheBytes
+                       ? 1.0
+                       : std::clamp<double>(static_cast<double>(stride), 1.0, lineElements);
+        };
+
+        auto const tiling = makeContractionCpuTiling(plan.mM, plan.mN, mr, nr);
+        auto const tilesM = std::ceil(M / tiling.mMC);
+        auto const tilesN = std::ceil(N / tiling.mNC);
+
+        auto const hasD = !plan.mOffsetsDM.empty();
+
+        ContractionCpuCost cost;
+
+        // Both strategies write E along its smaller stride
+        auto const rowsInnerE
+            = detail::innerStride(plan.mStridesEM) < detail::innerStride(plan.mStridesEN);
+        auto const writeE = strideCost(M * N, rowsInnerE ? plan.mStridesEM : plan.mStridesEN);
+        auto const readD
+            = hasD ? strideCost(M * N, rowsInnerE ? plan.mStridesDM : plan.mStridesDN) : 0.0;
+
+        auto const costAM = strideCost(M * K, plan.mStridesAM);
+        auto const costAK = strideCost(M * K, plan.mStridesAK);
+        auto const costBN = strideCost(N * K, plan.mStridesBN);
+        auto const costBK = strideCost(N * K, plan.mStridesBK);
+
+        // Direct packing walks k fastest for MR rows of A (NR columns of B) at a
+        // time, so a unit stride across the panel shares each line between them
+        auto packCost = [elementBytes](double costK, double costPanel, int64_t panelWidth) {
+            auto lineElements = std::max<double>(1.0, 64.0 / elementBytes);
+            return costPanel == 1.0 ? std::max(1.0, std::min(costK, lineElements / panelWidth))
+                                    : costK;
+        };
+
+        // Direct packing repeats once per tile of the other operand
+        cost.mDirect = M * K * tilesN * packCost(costAK, costAM, mr)
+                       + N * K * tilesM * packCost(costBK, costBN, nr) + M * N * (writeE + readD);
+
+        // TTGT transposes each operand once along its better stride, then packs
+        // contiguously. The GEMM result is written to scratch and read back.
+        cost.mTtgt = M * K * (1.0 + std::min(costAM, costAK) + tilesN)
+                     + N * K * (1.0 + std::min(costBN, costBK) + tilesM)
+                     + M * N * (2.0 + writeE + readD);
+
+        cost.mScratchBytes = static_cast<std::size_t>(plan.mM * plan.mK + plan.mN * plan.mK
+                                                      + plan.mM * plan.mN)
+                             * elementBytes;
+
+        cost.mStrategy
+            = (cost.mTtgt < TtgtMargin * cost.mDirect && cost.mScratchBytes <= MaxScratchBytes)
+                  ? ContractionCpuStrategy::TTGT
+                  : ContractionCpuStrategy::DIRECT;
+
+        return cost;
+    }
+
+    void contractionCpuMicroKernel(
+        int64_t kc, float const* aPanel, float const* bPanel, float* c, int64_t ldc)
+    {
+#if HIPTENSOR_CPU_ENGINE_AVX2
+        if(hasAvx2Fma())
+        {
+            return microKernelAvx2(kc, aPanel, bPanel, c, ldc);
+        }
+#endif // HIPTENSOR_CPU_ENGINE_AVX2
+        contractionCpuMicroKernel<float>(kc, aPanel, bPanel, c, ldc);
+    }
+
+    void contractionCpuMicroKernel(
+        int64_t kc, double const* aPanel, double const* bPanel, double* c, int64_t ldc)
+    {
+#if HIPTENSOR_CPU_ENGINE_AVX2
+        if(hasAvx2Fma())
+        {
+            return microKernelAvx2(kc, aPanel, bPanel, c, ldc);
+        }
+#endif // HIPTENSOR_CPU_ENGINE_AVX2
+        contractionCpuMicroKernel<double>(kc, aPanel, bPanel, c, ldc);
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_CPU_ENGINE_HPP
+#define HIPTENSOR_CONTRACTION_CPU_ENGINE_HPP
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+namespace hiptensor
+{
+    // @cond
+    // Host contraction problem E_{m,n} = sum_k A_{m,k} * B_{n,k} with folded modes.
+    // Every flattened m, n and k index is resolved to an element offset up front,
+    // so that packing and the epilogue never decompose multi-indices.
+    struct ContractionCpuPlan
+    {
+        int64_t mM;
+        int64_t mN;
+        int64_t mK;
+
+        // Folded mode lengths and the strides of each tensor along them
+        std::vector<int64_t> mLengthsM;
+        std::vector<int64_t> mLengthsN;
+        std::vector<int64_t> mLengthsK;
+        std::vector<int64_t> mStridesAM;
+        std::vector<int64_t> mStridesAK;
+        std::vector<int64_t> mStridesBN;
+        std::vector<int64_t> mStridesBK;
+        std::vector<int64_t> mStridesEM;
+        std::vector<int64_t> mStridesEN;
+        std::vector<int64_t> mStridesDM;
+        std::vector<int64_t> mStridesDN;
+
+        // Element offsets of every flattened index
+        std::vector<int64_t> mOffsetsAM;
+        std::vector<int64_t> mOffsetsAK;
+        std::vector<int64_t> mOffsetsBN;
+        std::vector<int64_t> mOffsetsBK;
+        std::vector<int64_t> mOffsetsEM;
+        std::vector<int64_t> mOffsetsEN;
+        std::vector<int64_t> mOffsetsDM;
+        std::vector<int64_t> mOffsetsDN;
+    };
+
+    // Builds the plan from the CK ordered lengths and strides (ms_ks, ns_ks, ms_ns).
+    // Length-1 modes are dropped and adjacent modes that are contiguous in every
+    // tensor are folded together. dStrides may be empty when there is no D tensor.
+    ContractionCpuPlan makeContractionCpuPlan(int32_t                     numDimsM,
+                                              int32_t                     numDimsN,
+                                              int32_t                     numDimsK,
+                                              std::vector<int64_t> const& a_ms_ks_lengths,
+                                              std::vector<int64_t> const& a_ms_ks_strides,
+                                              std::vector<int64_t> const& b_ns_ks_lengths,
+                                              std::vector<int64_t> const& b_ns_ks_strides,
+                                              std::vector<int64_t> const& e_ms_ns_strides,
+                                              std::vector<int64_t> const& d_ms_ns_strides);
+
+    // Register tile of the micro-kernel for each accumulation type.
+    // Packed A panels are MR wide and packed B panels are NR wide.
+    template <typename AccT>
+    struct ContractionCpuKernelTraits
+    {
+        static constexpr int64_t MR = 4;
+        static constexpr int64_t NR = 8;
+    };
+
+    template <>
+    struct ContractionCpuKernelTraits<float>
+    {
+        static constexpr int64_t MR = 6;
+        static constexpr int64_t NR = 16;
+    };
+
+    template <>
+    struct ContractionCpuKernelTraits<double>
+    {
+        static constexpr int64_t MR = 6;
+        static constexpr int64_t NR = 8;
+    };
+
+    template <>
+    struct ContractionCpuKernelTraits<std::complex<float>>
+    {
+        static constexpr int64_t MR = 4;
+        static constexpr int64_t NR = 4;
+    };
+
+    template <>
+    struct ContractionCpuKernelTraits<std::complex<double>>
+    {
+        static constexpr int64_t MR = 2;
+        static constexpr int64_t NR = 4;
+    };
+
+    // Cache blocking: KC values of k per packed panel, MC x NC output tile per task
+    struct ContractionCpuBlocking
+    {
+        static constexpr int64_t KC      = 256;
+        static constexpr int64_t MPanels = 16;
+        static constexpr int64_t NPanels = 16;
+    };
+
+    // Output tile of one DIRECT task: MC x NC, shrunk from the default block
+    // until there are enough tiles to occupy the thread pool
+    struct ContractionCpuTiling
+    {
+        int64_t mMC;
+        int64_t mNC;
+    };
+
+    ContractionCpuTiling makeContractionCpuTiling(int64_t m, int64_t n, int64_t mr, int64_t nr);
+
+    // C[MR x NR] += A panel * B panel over kc, where C is row-major with leading dimension ldc.
+    // The f32 and f64 overloads use AVX2/FMA when the host supports it.
+    void contractionCpuMicroKernel(
+        int64_t kc, float const* aPanel, float const* bPanel, float* c, int64_t ldc);
+    void contractionCpuMicroKernel(
+        int64_t kc, double const* aPanel, double const* bPanel, double* c, int64_t ldc);
+
+    template <typename AccT>
+    void contractionCpuMicroKernel(
+        int64_t kc, AccT const* aPanel, AccT const* bPanel, AccT* c, int64_t ldc);
+
+    // Host execution strategies
+    enum struct ContractionCpuStrategy : int32_t
+    {
+        DIRECT = 0, // Blocked contraction packing straight from the strided tensors
+        TTGT   = 1, // Transpose A and B to GEMM layout, GEMM, transpose the result into E
+    };
+
+    // Estimated memory traffic of both strategies, in element-sized units.
+    // Arithmetic is identical for both and is not counted.
+    struct ContractionCpuCost
+    {
+        double                 mDirect;
+        double                 mTtgt;
+        std::size_t            mScratchBytes; // Host scratch needed by TTGT
+        ContractionCpuStrategy mStrategy;
+    };
+
+    // Cost model choosing between DIRECT and TTGT for the plan. Direct packing
+    // re-reads A once per N tile and B once per M tile through the tensor strides,
+    // while TTGT pays one extra pass per operand to make every later read contiguous.
+    ContractionCpuCost selectContractionCpuStrategy(ContractionCpuPlan const& plan,
+                                                    std::size_t               elementBytes,
+                                                    int64_t                   mr,
+                                                    int64_t                   nr);
+
+    // Runs the contraction on the host thread pool.
+    // loadA(offset) / loadB(offset) return the element at the offset converted to AccT,
+    // and are only called while packing. Loaders may also accept (offset, count, dst)
+    // to convert count contiguous elements into dst at once, which DIRECT packing uses
+    // whenever the folded K or M / N mode of the operand is contiguous.
+    // store(eOffset, dOffset, acc) writes one output element; dOffset is 0 when the
+    // plan has no D tensor.
+    // The strategy is picked by selectContractionCpuStrategy.
+    template <typename AccT, typename LoadA, typename LoadB, typename Store>
+    void contractionCpu(ContractionCpuPlan const& plan,
+                        LoadA&&                   loadA,
+                        LoadB&&                   loadB,
+                        Store&&                   store);
+
+    // DIRECT strategy
+    template <typename AccT, typename LoadA, typename LoadB, typename Store>
+    void contractionCpuDirect(ContractionCpuPlan const& plan,
+                              LoadA&&                   loadA,
+                              LoadB&&                   loadB,
+                              Store&&                   store);
+
+    // TTGT strategy: A and B are permuted into row-major M x K and N x K scratch
+    // matrices by the CPU permutation engine, contracted as a GEMM into an M x N
+    // scratch, which the epilogue permutes into E. Scratch is freed on return.
+    template <typename AccT, typename LoadA, typename LoadB, typename Store>
+    void contractionCpuTtgt(ContractionCpuPlan const& plan,
+                            LoadA&&                   loadA,
+                            LoadB&&                   loadB,
+                            Store&&                   store);
+    // @endcond
+
+} // namespace hiptensor
+
+#include "contraction_cpu_engine_impl.hpp"
+
+#endif // HIPTENSOR_CONTRACTION_CPU_ENGINE_HPP
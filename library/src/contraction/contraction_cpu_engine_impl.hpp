@@ -0,0 +1,403 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_CPU_ENGINE_IMPL_HPP
+#define HIPTENSOR_CONTRACTION_CPU_ENGINE_IMPL_HPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+
+#include "../permutation/permutation_cpu_engine.hpp"
+#include "contraction_cpu_engine.hpp"
+#include "thread_pool.hpp"
+
+namespace hiptensor
+{
+    namespace detail
+    {
+        template <typename T>
+        inline void multiplyAccumulate(T& c, T const& a, T const& b)
+        {
+            c += a * b;
+        }
+
+        // Avoids the NaN/Inf recovery of std::complex multiplication
+        template <typename T>
+        inline void multiplyAccumulate(std::complex<T>&       c,
+                                       std::complex<T> const& a,
+                                       std::complex<T> const& b)
+        {
+            c = std::complex<T>(c.real() + a.real() * b.real() - a.imag() * b.imag(),
+                                c.imag() + a.real() * b.imag() + a.imag() * b.real());
+        }
+
+        inline int64_t innerStride(std::vector<int64_t> const& strides)
+        {
+            return strides.empty() ? 0 : std::abs(strides.front());
+        }
+
+        // Contiguous run an operand can be block loaded along while packing
+        enum struct PackRun : int32_t
+        {
+            NONE = 0, // Gather element by element
+            K    = 1, // Each row is a run of kc values
+            ROWS = 2, // Each k of the panel is a run of up to R rows
+        };
+
+        inline PackRun packRun(std::vector<int64_t> const& rowStrides,
+                               std::vector<int64_t> const& kStrides)
+        {
+            auto unit = [](std::vector<int64_t> const& strides) {
+                return strides.size() == 1 && strides.front() == 1;
+            };
+            return unit(kStrides) ? PackRun::K : (unit(rowStrides) ? PackRun::ROWS : PackRun::NONE);
+        }
+
+        // Packs rows (<= R) rows of kc values into a k-major panel of width R, zero padded.
+        // Loaders that also accept load(offset, count, dst) convert whole contiguous runs
+        // at once, otherwise every element goes through load(offset).
+        template <int64_t R, typename AccT, typename Load>
+        void packPanel(AccT*          panel,
+                       Load&          load,
+                       int64_t const* rowOffsets,
+                       int64_t        rows,
+                       int64_t const* kOffsets,
+                       int64_t        kc,
+                       PackRun        run)
+        {
+            if constexpr(std::is_invocable_v<Load&, int64_t, int64_t, AccT*>)
+            {
+                if(run == PackRun::K)
+                {
+                    thread_local std::vector<AccT> row;
+                    row.resize(kc);
+                    for(int64_t i = 0; i < rows; i++)
+                    {
+                        load(rowOffsets[i] + kOffsets[0], kc, row.data());
+                        for(int64_t k = 0; k < kc; k++)
+                        {
+                            panel[k * R + i] = row[k];
+                        }
+                    }
+                }
+                else if(run == PackRun::ROWS)
+                {
+                    for(int64_t k = 0; k < kc; k++)
+                    {
+                        load(rowOffsets[0] + kOffsets[k], rows, panel + k * R);
+                    }
+                }
+
+                if(run != PackRun::NONE)
+                {
+                    for(int64_t k = 0; k < kc; k++)
+                    {
+                        std::fill(panel + k * R + rows, panel + (k + 1) * R, AccT{0});
+                    }
+                    return;
+                }
+            }
+
+            for(int64_t i = 0; i < R; i++)
+            {
+                if(i < rows)
+                {
+                    auto rowOffset = rowOffsets[i];
+                    for(int64_t k = 0; k < kc; k++)
+                    {
+                        panel[k * R + i] = load(rowOffset + kOffsets[k]);
+                    }
+                }
+                else
+                {
+                    for(int64_t k = 0; k < kc; k++)
+                    {
+                        panel[k * R + i] = AccT{0};
+                    }
+                }
+            }
+        }
+        // Permutation between a tensor with (row..., col...) folded modes and the
+        // row-major matrix of its flattened row and column indices, in either direction.
+        // The first mode of each group is the fastest varying in the flat index.
+        inline PermutationCpuPlan ttgtPermutationPlan(std::vector<int64_t> const& rowLengths,
+                                                      std::vector<int64_t> const& rowStrides,
+                                                      std::vector<int64_t> const& colLengths,
+                                                      std::vector<int64_t> const& colStrides,
+                                                      bool                        toMatrix)
+        {
+            auto const cols = std::accumulate(
+                colLengths.begin(), colLengths.end(), int64_t(1), std::multiplies<int64_t>());
+
+            std::vector<int64_t> lengths(rowLengths), tensorStrides(rowStrides), matrixStrides;
+            lengths.insert(lengths.end(), colLengths.begin(), colLengths.end());
+            tensorStrides.insert(tensorStrides.end(), colStrides.begin(), colStrides.end());
+            int64_t stride = cols;
+            for(auto length : rowLengths)
+            {
+                matrixStrides.push_back(stride);
+                stride *= length;
+            }
+            stride = 1;
+            for(auto length : colLengths)
+            {
+                matrixStrides.push_back(stride);
+                stride *= length;
+            }
+
+            return toMatrix ? makePermutationCpuPlan(lengths, tensorStrides, matrixStrides)
+                            : makePermutationCpuPlan(lengths, matrixStrides, tensorStrides);
+        }
+    } // namespace detail
+
+    template <typename AccT>
+    void contractionCpuMicroKernel(
+        int64_t kc, AccT const* aPanel, AccT const* bPanel, AccT* c, int64_t ldc)
+    {
+        constexpr auto MR = ContractionCpuKernelTraits<AccT>::MR;
+        constexpr auto NR = ContractionCpuKernelTraits<AccT>::NR;
+
+        AccT accum[MR][NR] = {};
+        for(int64_t k = 0; k < kc; k++)
+        {
+            auto a = aPanel + k * MR;
+            auto b = bPanel + k * NR;
+            for(int64_t i = 0; i < MR; i++)
+            {
+                for(int64_t j = 0; j < NR; j++)
+                {
+                    detail::multiplyAccumulate(accum[i][j], a[i], b[j]);
+                }
+            }
+        }
+
+        for(int64_t i = 0; i < MR; i++)
+        {
+            for(int64_t j = 0; j < NR; j++)
+            {
+                c[i * ldc + j] += accum[i][j];
+            }
+        }
+    }
+
+    template <typename AccT, typename LoadA, typename LoadB, typename Store>
+    void contractionCpuDirect(ContractionCpuPlan const& plan,
+                              LoadA&&                   loadA,
+                              LoadB&&                   loadB,
+                              Store&&                   store)
+    {
+        constexpr auto MR = ContractionCpuKernelTraits<AccT>::MR;
+        constexpr auto NR = ContractionCpuKernelTraits<AccT>::NR;
+        constexpr auto KC = ContractionCpuBlocking::KC;
+
+        auto const M = plan.mM;
+        auto const N = plan.mN;
+        auto const K = plan.mK;
+
+        auto const tiling = makeContractionCpuTiling(M, N, MR, NR);
+        auto const MC     = tiling.mMC;
+        auto const NC     = tiling.mNC;
+        auto const tilesM = (M + MC - 1) / MC;
+        auto const tilesN = (N + NC - 1) / NC;
+
+        auto const hasD = !plan.mOffsetsDM.empty();
+        auto const rowsInnerE
+            = detail::innerStride(plan.mStridesEM) < detail::innerStride(plan.mStridesEN);
+        auto const runA = detail::packRun(plan.mStridesAM, plan.mStridesAK);
+        auto const runB = detail::packRun(plan.mStridesBN, plan.mStridesBK);
+
+        ThreadPool::instance()->parallelFor(tilesM * tilesN, [&](std::size_t tile) {
+            auto const m0 = static_cast<int64_t>(tile % tilesM) * MC;
+            auto const n0 = static_cast<int64_t>(tile / tilesM) * NC;
+            auto const mc = std::min(MC, M - m0);
+            auto const nc = std::min(NC, N - n0);
+
+            auto const mcPanels = (mc + MR - 1) / MR;
+            auto const ncPanels = (nc + NR - 1) / NR;
+            auto const ldc      = ncPanels * NR;
+
+            // Per-thread buffers are reused across tiles and calls
+            thread_local std::vector<AccT> aPack;
+            thread_local std::vector<AccT> bPack;
+            thread_local std::vector<AccT> cTile;
+            aPack.resize(mcPanels * MR * KC);
+            bPack.resize(ncPanels * NR * KC);
+            cTile.assign(mcPanels * MR * ldc, AccT{0});
+
+            for(int64_t k0 = 0; k0 < K; k0 += KC)
+            {
+                auto const kc = std::min(KC, K - k0);
+
+                // Pack A into MR-row panels and B into NR-column panels
+                for(int64_t p = 0; p < mcPanels; p++)
+                {
+                    auto m = m0 + p * MR;
+                    detail::packPanel<MR>(aPack.data() + p * MR * kc,
+                                          loadA,
+                                          plan.mOffsetsAM.data() + m,
+                                          std::min(MR, M - m),
+                                          plan.mOffsetsAK.data() + k0,
+                                          kc,
+                                          runA);
+                }
+                for(int64_t p = 0; p < ncPanels; p++)
+                {
+                    auto n = n0 + p * NR;
+                    detail::packPanel<NR>(bPack.data() + p * NR * kc,
+                                          loadB,
+                                          plan.mOffsetsBN.data() + n,
+                                          std::min(NR, N - n),
+                                          plan.mOffsetsBK.data() + k0,
+                                          kc,
+                                          runB);
+                }
+
+                for(int64_t pn = 0; pn < ncPanels; pn++)
+                {
+                    for(int64_t pm = 0; pm < mcPanels; pm++)
+                    {
+                        contractionCpuMicroKernel(kc,
+                                                  aPack.data() + pm * MR * kc,
+                                                  bPack.data() + pn * NR * kc,
+                                                  cTile.data() + pm * MR * ldc + pn * NR,
+                                                  ldc);
+                    }
+                }
+            }
+
+            // Epilogue: the tile holds the complete sum over K.
+            // Walk the tile along the smaller stride of E.
+            auto epilogue = [&](int64_t i, int64_t j) {
+                store(plan.mOffsetsEM[m0 + i] + plan.mOffsetsEN[n0 + j],
+                      hasD ? plan.mOffsetsDM[m0 + i] + plan.mOffsetsDN[n0 + j] : 0,
+                      cTile[i * ldc + j]);
+            };
+            if(rowsInnerE)
+            {
+                for(int64_t j = 0; j < nc; j++)
+                {
+                    for(int64_t i = 0; i < mc; i++)
+                    {
+                        epilogue(i, j);
+                    }
+                }
+            }
+            else
+            {
+                for(int64_t i = 0; i < mc; i++)
+                {
+                    for(int64_t j = 0; j < nc; j++)
+                    {
+                        epilogue(i, j);
+                    }
+                }
+            }
+        });
+    }
+
+    template <typename AccT, typename LoadA, typename LoadB, typename Store>
+    void contractionCpuTtgt(ContractionCpuPlan const& plan,
+                            LoadA&&                   loadA,
+                            LoadB&&                   loadB,
+                            Store&&                   store)
+    {
+        auto const M = plan.mM;
+        auto const N = plan.mN;
+        auto const K = plan.mK;
+
+        // Scratch is scoped to the call, so that large problems do not pin
+        // host memory after they complete
+        std::unique_ptr<AccT[]> scratch(new AccT[M * K + N * K + M * N]);
+        auto                    aMatrix = scratch.get();
+        auto                    bMatrix = aMatrix + M * K;
+        auto                    cMatrix = bMatrix + N * K;
+
+        // Transpose A and B into row-major M x K and N x K with the permutation engine
+        auto aTranspose = detail::ttgtPermutationPlan(
+            plan.mLengthsM, plan.mStridesAM, plan.mLengthsK, plan.mStridesAK, true);
+        permutationCpuOffsets(aTranspose, [&](int64_t aOffset, int64_t matrixOffset) {
+            aMatrix[matrixOffset] = loadA(aOffset);
+        });
+        auto bTranspose = detail::ttgtPermutationPlan(
+            plan.mLengthsN, plan.mStridesBN, plan.mLengthsK, plan.mStridesBK, true);
+        permutationCpuOffsets(bTranspose, [&](int64_t bOffset, int64_t matrixOffset) {
+            bMatrix[matrixOffset] = loadB(bOffset);
+        });
+
+        // GEMM on the contiguous operands
+        auto gemm = makeContractionCpuPlan(1, 1, 1, {M, K}, {K, 1}, {N, K}, {K, 1}, {N, 1}, {});
+        contractionCpuDirect<AccT>(
+            gemm,
+            [aMatrix](int64_t offset) { return aMatrix[offset]; },
+            [bMatrix](int64_t offset) { return bMatrix[offset]; },
+            [cMatrix](int64_t eOffset, int64_t, AccT const& accum) { cMatrix[eOffset] = accum; });
+
+        // Transpose the result into E. The row-major C offset gives (m, n) back
+        // for the D offset, which may differ from the E layout.
+        auto eTranspose = detail::ttgtPermutationPlan(
+            plan.mLengthsM, plan.mStridesEM, plan.mLengthsN, plan.mStridesEN, false);
+        if(plan.mOffsetsDM.empty())
+        {
+            permutationCpuOffsets(eTranspose, [&](int64_t matrixOffset, int64_t eOffset) {
+                store(eOffset, 0, cMatrix[matrixOffset]);
+            });
+        }
+        else
+        {
+            permutationCpuOffsets(eTranspose, [&](int64_t matrixOffset, int64_t eOffset) {
+                auto m = matrixOffset / N;
+                auto n = matrixOffset - m * N;
+                store(eOffset, plan.mOffsetsDM[m] + plan.mOffsetsDN[n], cMatrix[matrixOffset]);
+            });
+        }
+    }
+
+    template <typename AccT, typename LoadA, typename LoadB, typename Store>
+    void contractionCpu(ContractionCpuPlan const& plan,
+                        LoadA&&                   loadA,
+                        LoadB&&                   loadB,
+                        Store&&                   store)
+    {
+        auto cost = selectContractionCpuStrategy(plan,
+                                                 sizeof(AccT),
+                                                 ContractionCpuKernelTraits<AccT>::MR,
+                                                 ContractionCpuKernelTraits<AccT>::NR);
+        if(cost.mStrategy == ContractionCpuStrategy::TTGT)
+        {
+            contractionCpuTtgt<AccT>(plan, loadA, loadB, store);
+        }
+        else
+        {
+            contractionCpuDirect<AccT>(plan, loadA, loadB, store);
+        }
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_CPU_ENGINE_IMPL_HPP
@@ -69,7 +69,7 @@ hiptensorStatus_t hiptensorContractionReference(const hiptensorContractionPlan_t
     }
     else
     {
-        auto refCandidate      = candidates.solutions().begin()->second;
+        auto refCandidate      = *candidates.begin();
         auto [errorCode, time] = (*refCandidate)(alpha,
                                                  A,
                                                  B,
@@ -39,8 +39,10 @@
 #include <element_wise_operation.hpp>
 #include <host_tensor.hpp>
 
+#include "contraction_cpu_engine.hpp"
 #include "contraction_meta_traits.hpp"
 #include "contraction_solution.hpp"
+#include "cpu_type_convert.hpp"
 
 namespace hiptensor
 {
@@ -598,6 +600,319 @@ namespace hiptensor
     {
     };
 
+    namespace detail
+    {
+        // Operand and compute type pairs whose conversion to f32 the bulk host kernels
+        // reproduce exactly: widening f16 / bf16, or rounding f32 through f16 / bf16.
+        template <typename DataType, typename ComputeDataType>
+        constexpr bool HasHostBlockConvert
+            = ((std::is_same_v<DataType, ck::half_t> || std::is_same_v<DataType, ck::bhalf_t>)
+               && (std::is_same_v<ComputeDataType, DataType>
+                   || std::is_same_v<ComputeDataType, float>))
+              || (std::is_same_v<DataType, float>
+                  && (std::is_same_v<ComputeDataType, ck::half_t>
+                      || std::is_same_v<ComputeDataType, ck::bhalf_t>));
+
+        // Loader of the host engine converting contiguous runs of an operand to f32 at once.
+        // Equivalent to PassThrough(f32, type_convert<ComputeDataType>(x)) per element.
+        template <typename DataType, typename ComputeDataType>
+        struct HostBlockLoad
+        {
+            DataType const* mData;
+
+            float operator()(int64_t offset) const
+            {
+                return ck::type_convert<float>(ck::type_convert<ComputeDataType>(mData[offset]));
+            }
+
+            void operator()(int64_t offset, int64_t count, float* dst) const
+            {
+                auto src = mData + offset;
+                if constexpr(std::is_same_v<DataType, ck::half_t>)
+                {
+                    cpuHalfToFloat(reinterpret_cast<uint16_t const*>(src), dst, count);
+                }
+                else if constexpr(std::is_same_v<DataType, ck::bhalf_t>)
+                {
+                    cpuBhalfToFloat(reinterpret_cast<uint16_t const*>(src), dst, count);
+                }
+                else if constexpr(std::is_same_v<ComputeDataType, ck::half_t>)
+                {
+                    cpuRoundToHalf(src, dst, count);
+                }
+                else
+                {
+                    cpuRoundToBhalf(src, dst, count);
+                }
+            }
+        };
+    } // namespace detail
+
+    // Host contraction solution backed by the blocked, multithreaded CPU engine.
+    // Accepts the same arguments as the reference contraction and reproduces
+    // its element-wise and type conversion semantics.
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename AccDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation,
+              typename ComputeDataType = ADataType>
+    struct HostContraction_M6_N6_K6 : public ReferenceContraction_M2_N2_K2<NumDimM,
+                                                                           NumDimN,
+                                                                           NumDimK,
+                                                                           ADataType,
+                                                                           BDataType,
+                                                                           AccDataType,
+                                                                           DsDataType,
+                                                                           EDataType,
+                                                                           AElementwiseOperation,
+                                                                           BElementwiseOperation,
+                                                                           CDEElementwiseOperation,
+                                                                           ComputeDataType>
+    {
+        using Base = ReferenceContraction_M2_N2_K2<NumDimM,
+                                                   NumDimN,
+                                                   NumDimK,
+                                                   ADataType,
+                                                   BDataType,
+                                                   AccDataType,
+                                                   DsDataType,
+                                                   EDataType,
+                                                   AElementwiseOperation,
+                                                   BElementwiseOperation,
+                                                   CDEElementwiseOperation,
+                                                   ComputeDataType>;
+
+        using BaseArgument = ck::tensor_operation::device::BaseArgument;
+        using BaseInvoker  = ck::tensor_operation::device::BaseInvoker;
+        using Argument     = typename Base::Argument;
+
+        static constexpr ck::index_t NumDTensor = DsDataType::Size();
+
+        static constexpr bool IsComplex = std::is_same_v<EDataType, hipFloatComplex>
+                                          || std::is_same_v<EDataType, hipDoubleComplex>;
+
+        // f16 / bf16 operands and f16 / bf16 compute types of f32 contractions are
+        // converted a packed block at a time instead of element by element
+        template <typename DataType, typename ElementwiseOperation>
+        static constexpr bool UseBlockLoad
+            = std::is_same_v<AccDataType, float>
+              && std::is_same_v<ElementwiseOperation,
+                                ck::tensor_operation::element_wise::PassThrough>
+              && detail::HasHostBlockConvert<DataType, ComputeDataType>;
+
+        // Invoker
+        struct Invoker : public BaseInvoker
+        {
+            float Run(const Argument& arg)
+            {
+                auto toInt64 = [](std::vector<ck::index_t> const& v) {
+                    return std::vector<int64_t>(v.begin(), v.end());
+                };
+
+                // NumDTensor is at most 1 due to SFINAE of the reference contraction
+                std::vector<int64_t> d_ms_ns_strides;
+                EDataType const*     D = nullptr;
+                if constexpr(NumDTensor == 1)
+                {
+                    d_ms_ns_strides = toInt64(arg.mD_ms_ns_strides[0]);
+                    D               = static_cast<EDataType const*>(arg.mD[0]);
+                }
+
+                auto plan = makeContractionCpuPlan(NumDimM,
+                                                   NumDimN,
+                                                   NumDimK,
+                                                   toInt64(arg.mA_ms_ks_lengths),
+                                                   toInt64(arg.mA_ms_ks_strides),
+                                                   toInt64(arg.mB_ns_ks_lengths),
+                                                   toInt64(arg.mB_ns_ks_strides),
+                                                   toInt64(arg.mE_ms_ns_strides),
+                                                   d_ms_ns_strides);
+
+                auto A = static_cast<ADataType const*>(arg.mA);
+                auto B = static_cast<BDataType const*>(arg.mB);
+                auto E = static_cast<EDataType*>(arg.mE);
+
+                if constexpr(IsComplex)
+                {
+                    using AccT = std::complex<AccDataType>;
+
+                    auto toEData = [](AccT const& accum) {
+                        if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
+                        {
+                            return make_hipFloatComplex(accum.real(), accum.imag());
+                        }
+                        else
+                        {
+                            return make_hipDoubleComplex(accum.real(), accum.imag());
+                        }
+                    };
+
+                    contractionCpu<AccT>(
+                        plan,
+                        [A](int64_t offset) { return AccT(A[offset].x, A[offset].y); },
+                        [B](int64_t offset) { return AccT(B[offset].x, B[offset].y); },
+                        [&](int64_t eOffset, int64_t dOffset, AccT const& accum) {
+                            auto value = toEData(accum);
+                            if constexpr(std::is_same_v<
+                                             CDEElementwiseOperation,
+                                             ck::tensor_operation::element_wise::ScaleComplex>)
+                            {
+                                if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
+                                {
+                                    E[eOffset] = hipCmulf(
+                                        hipComplexDoubleToFloat(arg.mOpCDE.scale_), value);
+                                }
+                                else
+                                {
+                                    E[eOffset] = hipCmul(arg.mOpCDE.scale_, value);
+                                }
+                            }
+                            else // BilinearComplex
+                            {
+                                if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
+                                {
+                                    E[eOffset] = hipCaddf(
+                                        hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.alpha_), value),
+                                        hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.beta_),
+                                                 D[dOffset]));
+                                }
+                                else
+                                {
+                                    E[eOffset] = hipCadd(hipCmul(arg.mOpCDE.alpha_, value),
+                                                         hipCmul(arg.mOpCDE.beta_, D[dOffset]));
+                                }
+                            }
+                        });
+                }
+                else
+                {
+                    auto loadA = [&]() {
+                        if constexpr(UseBlockLoad<ADataType, AElementwiseOperation>)
+                        {
+                            return detail::HostBlockLoad<ADataType, ComputeDataType>{A};
+                        }
+                        else
+                        {
+                            return [&](int64_t offset) {
+                                AccDataType value;
+                                arg.mOpA(value, ck::type_convert<ComputeDataType>(A[offset]));
+                                return value;
+                            };
+                        }
+                    }();
+                    auto loadB = [&]() {
+                        if constexpr(UseBlockLoad<BDataType, BElementwiseOperation>)
+                        {
+                            return detail::HostBlockLoad<BDataType, ComputeDataType>{B};
+                        }
+                        else
+                        {
+                            return [&](int64_t offset) {
+                                AccDataType value;
+                                arg.mOpB(value, ck::type_convert<ComputeDataType>(B[offset]));
+                                return value;
+                            };
+                        }
+                    }();
+
+                    contractionCpu<AccDataType>(
+                        plan,
+                        loadA,
+                        loadB,
+                        [&](int64_t eOffset, int64_t dOffset, AccDataType accum) {
+                            if constexpr(std::is_same_v<CDEElementwiseOperation,
+                                                        ck::tensor_operation::element_wise::Scale>)
+                            {
+                                arg.mOpCDE(E[eOffset], ck::type_convert<EDataType>(accum));
+                            }
+                            else // bilinear
+                            {
+                                arg.mOpCDE(
+                                    E[eOffset], ck::type_convert<EDataType>(accum), D[dOffset]);
+                            }
+                        });
+                }
+
+                return 0;
+            }
+
+            float Run(const BaseArgument* p_arg,
+                      const StreamConfig& /* stream_config */ = StreamConfig{}) override
+            {
+                return Run(*dynamic_cast<const Argument*>(p_arg));
+            }
+        };
+
+        static auto MakeInvoker()
+        {
+            return Invoker{};
+        }
+
+        std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+        {
+            return std::make_unique<Invoker>(Invoker{});
+        }
+
+        std::string GetTypeString() const override
+        {
+            auto str = std::stringstream();
+
+            // clang-format off
+            str << "HostContraction_M6_N6_K6"
+                << std::endl;
+            // clang-format on
+
+            return str.str();
+        }
+    };
+
+    // Partial specialize for host contraction
+    template <ck::index_t NumDimsM,
+              ck::index_t NumDimsN,
+              ck::index_t NumDimsK,
+              typename ADataType,
+              typename BDataType,
+              typename AccDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation,
+              typename ComputeDataType>
+    struct MetaTraits<HostContraction_M6_N6_K6<NumDimsM,
+                                               NumDimsN,
+                                               NumDimsK,
+                                               ADataType,
+                                               BDataType,
+                                               AccDataType,
+                                               DsDataType,
+                                               EDataType,
+                                               AElementwiseOperation,
+                                               BElementwiseOperation,
+                                               CDEElementwiseOperation,
+                                               ComputeDataType>>
+        : public MetaTraits<
+              ck::tensor_operation::device::DeviceContractionMultipleD<NumDimsM,
+                                                                       NumDimsN,
+                                                                       NumDimsK,
+                                                                       ADataType,
+                                                                       BDataType,
+                                                                       DsDataType,
+                                                                       EDataType,
+                                                                       AElementwiseOperation,
+                                                                       BElementwiseOperation,
+                                                                       CDEElementwiseOperation,
+                                                                       ComputeDataType>>
+    {
+    };
+
     template <ck::index_t NumDimM,
               ck::index_t NumDimN,
               ck::index_t NumDimK,
@@ -612,18 +927,19 @@ namespace hiptensor
               typename ComputeDataType = ADataType>
     auto enumerateReferenceSolutions()
     {
-        using ReferenceOp = ReferenceContraction_M2_N2_K2<NumDimM,
-                                                          NumDimN,
-                                                          NumDimK,
-                                                          ADataType,
-                                                          BDataType,
-                                                          AccDataType,
-                                                          DsDataType,
-                                                          EDataType,
-                                                          AElementwiseOperation,
-                                                          BElementwiseOperation,
-                                                          CDEElementwiseOperation,
-                                                          ComputeDataType>;
+        // The host engine replaces the direct loop reference as the registered solution
+        using ReferenceOp = HostContraction_M6_N6_K6<NumDimM,
+                                                     NumDimN,
+                                                     NumDimK,
+                                                     ADataType,
+                                                     BDataType,
+                                                     AccDataType,
+                                                     DsDataType,
+                                                     EDataType,
+                                                     AElementwiseOperation,
+                                                     BElementwiseOperation,
+                                                     CDEElementwiseOperation,
+                                                     ComputeDataType>;
 
         auto solution = std::make_unique<ContractionSolutionImpl<ReferenceOp>>(
             std::make_unique<ReferenceOp>());
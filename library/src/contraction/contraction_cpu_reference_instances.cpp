@@ -26,11 +26,14 @@
 
 #include "contraction_cpu_reference_instances.hpp"
 #include "contraction_cpu_reference_impl.hpp"
+#include "registry_profiler.hpp"
 
 namespace hiptensor
 {
     ContractionCpuReferenceInstances::ContractionCpuReferenceInstances()
     {
+        RegistryProfiler::ScopedTimer timer("ContractionCpuReferenceInstances");
+
         // Register all the solutions exactly once
         // Bilinear f16
         registerSolutions(
@@ -295,5 +298,10 @@ namespace hiptensor
                                         ck::tensor_operation::element_wise::PassThrough,
                                         ck::tensor_operation::element_wise::ScaleComplex,
                                         hipDoubleComplex>());
+
+        // Build the immutable query index
+        freeze();
+
+        timer.finish(solutionCount(), hostBytes());
     }
 } // namespace hiptensor
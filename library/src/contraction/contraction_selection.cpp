@@ -204,25 +204,25 @@ namespace hiptensor
                                 float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -295,9 +295,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -316,25 +316,25 @@ namespace hiptensor
                                 float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -416,9 +416,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -437,25 +437,25 @@ namespace hiptensor
                                 float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -528,9 +528,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -549,25 +549,25 @@ namespace hiptensor
                                 float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -648,9 +648,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -664,25 +664,25 @@ namespace hiptensor
     struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::SCALE, _Float16>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -755,9 +755,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -771,25 +771,25 @@ namespace hiptensor
     struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::BILINEAR, _Float16>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -870,9 +870,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -886,25 +886,25 @@ namespace hiptensor
     struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::SCALE, hip_bfloat16>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -977,9 +977,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -998,25 +998,25 @@ namespace hiptensor
                                 hip_bfloat16>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1097,9 +1097,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1113,25 +1113,25 @@ namespace hiptensor
     struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::SCALE, float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1204,9 +1204,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1220,25 +1220,25 @@ namespace hiptensor
     struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::BILINEAR, float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1319,9 +1319,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1335,25 +1335,25 @@ namespace hiptensor
     struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::SCALE, float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1426,9 +1426,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1442,25 +1442,25 @@ namespace hiptensor
     struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::BILINEAR, float>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1541,9 +1541,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1557,25 +1557,25 @@ namespace hiptensor
     struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::SCALE, double>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1648,9 +1648,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1664,25 +1664,25 @@ namespace hiptensor
     struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::BILINEAR, double>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1763,9 +1763,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1784,25 +1784,25 @@ namespace hiptensor
                                 hipFloatComplex>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1875,9 +1875,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -1896,25 +1896,25 @@ namespace hiptensor
                                 hipFloatComplex>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -1995,9 +1995,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -2016,25 +2016,25 @@ namespace hiptensor
                                 hipDoubleComplex>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -2107,9 +2107,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -2128,25 +2128,25 @@ namespace hiptensor
                                 hipDoubleComplex>
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize)
         {
             auto   rank      = getRank(a_ms_ks_strides);
             size_t unique_id = 0;
@@ -2227,9 +2227,9 @@ namespace hiptensor
                 }
             }
 
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+            if(auto candidate = candidates.find(unique_id); candidate != nullptr)
             {
-                *winner = candidate->second;
+                *winner = candidate;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
             else
@@ -2240,26 +2240,26 @@ namespace hiptensor
     };
 
     hiptensorStatus_t
-        actorCriticModel(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         hiptensorComputeType_t                                  computeType,
-                         const uint64_t                                          workspaceSize)
+        actorCriticModel(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         hiptensorComputeType_t                    computeType,
+                         const uint64_t                            workspaceSize)
     {
         if(typeA == HIP_R_16F && typeB == HIP_R_16F && typeD == NONE_TYPE && typeE == HIP_R_16F
            && computeType == HIPTENSOR_COMPUTE_32F)
@@ -28,6 +28,7 @@
 #define HIPTENSOR_CONTRACTION_HEURISTICS_HPP
 
 #include "contraction_solution.hpp"
+#include "contraction_solution_registry.hpp"
 #include <vector>
 
 namespace hiptensor
@@ -65,48 +66,48 @@ namespace hiptensor
     struct ActorCriticSelection
     {
         static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize);
+            selectWinner(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         const uint64_t                            workspaceSize);
     };
 
     hiptensorStatus_t
-        actorCriticModel(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         hiptensorComputeType_t                                  computeType,
-                         const uint64_t                                          workspaceSize);
+        actorCriticModel(ContractionSolution**                     winner,
+                         ContractionSolutionRegistry::Query const& candidates,
+                         hipDataType                               typeA,
+                         std::vector<std::size_t> const&           a_ms_ks_lengths,
+                         std::vector<std::size_t> const&           a_ms_ks_strides,
+                         std::vector<int32_t> const&               a_ms_ks_modes,
+                         hipDataType                               typeB,
+                         std::vector<std::size_t> const&           b_ns_ks_lengths,
+                         std::vector<std::size_t> const&           b_ns_ks_strides,
+                         std::vector<int32_t> const&               b_ns_ks_modes,
+                         hipDataType                               typeD,
+                         std::vector<std::size_t> const&           d_ms_ns_lengths,
+                         std::vector<std::size_t> const&           d_ms_ns_strides,
+                         std::vector<int32_t> const&               d_ms_ns_modes,
+                         hipDataType                               typeE,
+                         std::vector<std::size_t> const&           e_ms_ns_lengths,
+                         std::vector<std::size_t> const&           e_ms_ns_strides,
+                         std::vector<int32_t> const&               e_ms_ns_modes,
+                         hiptensorComputeType_t                    computeType,
+                         const uint64_t                            workspaceSize);
 
 } // namespace hiptensor
 
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include <set>
+#include <sstream>
 
 #include "contraction_solution.hpp"
 #include "util.hpp"
@@ -167,9 +168,13 @@ namespace hiptensor
         , mK(0)
         , mBytes(0)
         , mValid(false)
+        , mUid(0)
         , mDeviceOp(std::move(deviceOp))
         , mParams(std::move(params))
     {
+        // Convert CK uid string into binary.
+        std::istringstream converter(mDeviceOp->GetTypeIdHashCode());
+        converter >> std::hex >> mUid;
     }
 
     ContractionSolution::ContractionSolution(ContractionSolution&& other)
@@ -178,6 +183,7 @@ namespace hiptensor
         , mK(other.mK)
         , mBytes(other.mBytes)
         , mValid(other.mValid)
+        , mUid(other.mUid)
         , mDeviceOp(std::move(other.mDeviceOp))
         , mParams(std::move(other.mParams))
         , mInvokerArgPtr(std::move(other.mInvokerArgPtr))
@@ -195,6 +201,7 @@ namespace hiptensor
 
             mBytes = other.mBytes;
             mValid = other.mValid;
+            mUid   = other.mUid;
 
             mParams        = std::move(other.mParams);
             mDeviceOp      = std::move(other.mDeviceOp);
@@ -273,11 +280,7 @@ namespace hiptensor
 
     size_t ContractionSolution::uid() const
     {
-        // Convert CK uid string into binary.
-        std::istringstream converter(mDeviceOp->GetTypeIdHashCode());
-        size_t             value;
-        converter >> std::hex >> value;
-        return value;
+        return mUid;
     }
 
     std::tuple<ck::index_t, ck::index_t, ck::index_t> ContractionSolution::problemDims() const
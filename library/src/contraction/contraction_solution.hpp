@@ -143,6 +143,9 @@ namespace hiptensor
         ck::index_t mBytes;
         bool        mValid;
 
+        // Unique ID, decoded once from the CK type id hash
+        size_t mUid;
+
         // Kernel Params
         std::unique_ptr<ContractionSolutionParams>                  mParams;
         std::unique_ptr<ck::tensor_operation::device::BaseOperator> mDeviceOp;
@@ -163,6 +166,12 @@ namespace hiptensor
               typename ComputeDataType>
     std::vector<std::unique_ptr<hiptensor::ContractionSolution>> enumerateContractionSolutions();
 
+    // Enumerates the solutions added by a single device instance group, so that
+    // only the groups selected by the kernel manifest are referenced.
+    template <typename ContractionOp>
+    std::vector<std::unique_ptr<hiptensor::ContractionSolution>> enumerateContractionSolutions(
+        void (*addInstances)(std::vector<std::unique_ptr<ContractionOp>>&));
+
 } // namespace hiptensor
 
 #include "contraction_solution_impl.hpp"
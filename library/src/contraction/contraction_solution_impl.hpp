@@ -376,6 +376,22 @@ namespace hiptensor
         return result;
     }
 
+    template <typename ContractionOp>
+    std::vector<std::unique_ptr<hiptensor::ContractionSolution>> enumerateContractionSolutions(
+        void (*addInstances)(std::vector<std::unique_ptr<ContractionOp>>&))
+    {
+        std::vector<std::unique_ptr<ContractionOp>> ops;
+        addInstances(ops);
+
+        std::vector<std::unique_ptr<ContractionSolution>> result;
+        for(auto& opPtr : ops)
+        {
+            result.push_back(
+                std::make_unique<ContractionSolutionImpl<ContractionOp>>(std::move(opPtr)));
+        }
+        return result;
+    }
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_CONTRACTION_SOLUTION_IMPL_HPP
@@ -24,34 +24,62 @@
  *
  *******************************************************************************/
 
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+
 #include "contraction_solution_registry.hpp"
 #include "contraction_solution.hpp"
+#include "registry_profiler.hpp"
 
 namespace hiptensor
 {
-    ////////////////////////////////////////////////
-    /// Class ContractionSolutionRegistry::Query ///
-    ////////////////////////////////////////////////
+    //////////////////////////////////////////////////////////
+    /// Class ContractionSolutionRegistry::Query::Iterator ///
+    //////////////////////////////////////////////////////////
 
     // @cond
-    ContractionSolutionRegistry::Query::Query(Query const& other)
-        : mAllSolutions(other.mAllSolutions)
-        , mSolutionHash(other.mSolutionHash)
+    ContractionSolutionRegistry::Query::Iterator::Iterator(Query const* query, uint32_t index)
+        : mQuery(query)
+        , mIndex(index)
     {
     }
 
-    ContractionSolutionRegistry::Query&
-        ContractionSolutionRegistry::Query::operator=(Query const& other)
+    ContractionSolution* ContractionSolutionRegistry::Query::Iterator::operator*() const
     {
-        if(&other != this)
-        {
-            mAllSolutions = other.mAllSolutions;
-            mSolutionHash = other.mSolutionHash;
-        }
+        return mQuery->mRegistry->mSortedSolutions[mIndex];
+    }
 
+    ContractionSolutionRegistry::Query::Iterator&
+        ContractionSolutionRegistry::Query::Iterator::operator++()
+    {
+        mIndex = mQuery->mSolutionBits.findNext(mIndex + 1u);
         return *this;
     }
 
+    ContractionSolutionRegistry::Query::Iterator
+        ContractionSolutionRegistry::Query::Iterator::operator++(int)
+    {
+        auto result = *this;
+        ++(*this);
+        return result;
+    }
+
+    bool ContractionSolutionRegistry::Query::Iterator::operator==(Iterator const& other) const
+    {
+        return mQuery == other.mQuery && mIndex == other.mIndex;
+    }
+
+    bool ContractionSolutionRegistry::Query::Iterator::operator!=(Iterator const& other) const
+    {
+        return !(*this == other);
+    }
+
+    ////////////////////////////////////////////////
+    /// Class ContractionSolutionRegistry::Query ///
+    ////////////////////////////////////////////////
+
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::query(int32_t                dimsM,
                                                   int32_t                dimsN,
@@ -65,15 +93,8 @@ namespace hiptensor
                                                   ContractionOpId_t      opCDE,
                                                   hiptensorComputeType_t typeCompute) const
     {
-        auto solutionHash = hashSolution(
-            dimsM, dimsN, dimsK, typeA, typeB, typeC, typeD, opA, opB, opCDE, typeCompute);
-
-        if(auto solutions = mSolutionHash.find(solutionHash); solutions != mSolutionHash.end())
-        {
-            return Query(mSolutionHash.at(solutionHash));
-        }
-
-        return Query();
+        return query(hashSolution(
+            dimsM, dimsN, dimsK, typeA, typeB, typeC, typeD, opA, opB, opCDE, typeCompute));
     }
 
     ContractionSolutionRegistry::Query
@@ -105,61 +126,110 @@ namespace hiptensor
         return query(hashContractionOps(opCDE));
     }
 
+    ContractionSolutionRegistry::Query ContractionSolutionRegistry::Query::query(
+        std::vector<ContractionSolution*> const& solutions) const
+    {
+        if(mRegistry == nullptr)
+        {
+            return Query(mRegistry, QueryBits{});
+        }
+
+        auto const& uids   = mRegistry->mSortedUids;
+        auto        result = Query(mRegistry, QueryBits(uids.size()));
+        for(auto* solution : solutions)
+        {
+            if(auto it = std::lower_bound(uids.cbegin(), uids.cend(), solution->uid());
+               it != uids.cend() && *it == solution->uid())
+            {
+                if(auto index = std::distance(uids.cbegin(), it); mSolutionBits.test(index))
+                {
+                    result.mSolutionBits.set(index);
+                }
+            }
+        }
+
+        return result;
+    }
+
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::operator||(Query const& other) const
     {
-        auto newQuery = *this;
-        newQuery.addSolutions(other.mAllSolutions);
-        return newQuery;
+        auto registry = (mRegistry != nullptr) ? mRegistry : other.mRegistry;
+        return Query(registry, QueryBits::unite(mSolutionBits, other.mSolutionBits));
     }
 
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::operator&&(Query const& other) const
     {
-        auto newQuery = Query();
+        auto registry = (mRegistry != nullptr) ? mRegistry : other.mRegistry;
+        return Query(registry, QueryBits::intersect(mSolutionBits, other.mSolutionBits));
+    }
 
-        // Add only if both queries have the solution
-        for(auto& solutionPair : other.mAllSolutions)
+    ContractionSolution* ContractionSolutionRegistry::Query::find(Uid uid) const
+    {
+        if(mRegistry == nullptr)
         {
-            if(auto solution = mAllSolutions.find(solutionPair.first);
-               solution != mAllSolutions.end())
+            return nullptr;
+        }
+
+        auto const& uids = mRegistry->mSortedUids;
+        if(auto it = std::lower_bound(uids.cbegin(), uids.cend(), uid);
+           it != uids.cend() && *it == uid)
+        {
+            auto index = std::distance(uids.cbegin(), it);
+            if(mSolutionBits.test(index))
             {
-                newQuery.addSolution(solutionPair.second);
+                return mRegistry->mSortedSolutions[index];
             }
         }
 
-        return newQuery;
+        return nullptr;
     }
 
-    std::unordered_map<ContractionSolutionRegistry::Query::Uid, ContractionSolution*> const&
-        ContractionSolutionRegistry::Query::solutions() const
+    ContractionSolutionRegistry::Query::Iterator ContractionSolutionRegistry::Query::begin() const
     {
-        return mAllSolutions;
+        return Iterator(this, mRegistry != nullptr ? mSolutionBits.findFirst() : QueryBits::npos);
+    }
+
+    ContractionSolutionRegistry::Query::Iterator ContractionSolutionRegistry::Query::end() const
+    {
+        return Iterator(this, QueryBits::npos);
     }
 
     uint32_t ContractionSolutionRegistry::Query::solutionCount() const
     {
-        return mAllSolutions.size();
+        return mSolutionBits.count();
     }
 
     ///////////////
     /// Private ///
     ///////////////
 
-    ContractionSolutionRegistry::Query::Query(std::vector<ContractionSolution*> const& solutions)
+    ContractionSolutionRegistry::Query::Query(ContractionSolutionRegistry const* registry,
+                                              QueryBits const&                   solutionBits)
+        : mRegistry(registry)
+        , mSolutionBits(solutionBits)
     {
-        addSolutions(solutions);
     }
 
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::query(HashId queryHash) const
     {
-        if(auto solutions = mSolutionHash.find(queryHash); solutions != mSolutionHash.end())
+        if(mRegistry != nullptr)
         {
-            return Query(mSolutionHash.at(queryHash));
+            if(auto* categoryBits = mRegistry->categoryBits(queryHash); categoryBits != nullptr)
+            {
+                // Sub-queries of the root reference the frozen category mask in place
+                auto bits = QueryBits(*categoryBits);
+                if(!mSolutionBits.views(mRegistry->mAllBits))
+                {
+                    bits = QueryBits::intersect(mSolutionBits, bits);
+                }
+                return Query(mRegistry, bits);
+            }
         }
 
-        return Query();
+        return Query(mRegistry, QueryBits{});
     }
 
     /* static */
@@ -213,87 +283,121 @@ namespace hiptensor
         return Hash{}(opCDE);
     }
 
-    void ContractionSolutionRegistry::Query::addSolution(ContractionSolution* solution)
+    /////////////////////////////////////////
+    /// Class ContractionSolutionRegistry ///
+    /////////////////////////////////////////
+
+    void ContractionSolutionRegistry::registerSolutions(
+        std::vector<std::unique_ptr<ContractionSolution>>&& solutions)
     {
-        // Acquire unique ID and category ID per solution
-        auto  solutionUid = solution->uid();
-        auto& params      = solution->params();
+        assert(!mFrozen && "Registry is frozen");
 
-        if(auto const& result = mAllSolutions.emplace(std::make_pair(solutionUid, solution));
-           result.second == true)
+        // Take ownership. Indexing is deferred until freeze().
+        for(auto&& solution : solutions)
         {
-            auto solutionHash = hashSolution(params->dimsM(),
-                                             params->dimsN(),
-                                             params->dimsK(),
-                                             params->typeA(),
-                                             params->typeB(),
-                                             params->typeC(),
-                                             params->typeD(),
-                                             params->opA(),
-                                             params->opB(),
-                                             params->opCDE(),
-                                             params->typeCompute());
-
-            auto dimsMNKHash = hashDimsMNK(params->dimsM(), params->dimsN(), params->dimsK());
-
-            auto typesComputeABCDHash = hashTypesComputeABCD(params->typeA(),
-                                                             params->typeB(),
-                                                             params->typeC(),
-                                                             params->typeD(),
-                                                             params->typeCompute());
-
-            auto elementOpsHash = hashElementOps(params->opA(), params->opB());
-
-            auto contactionOpsHash = hashContractionOps(params->opCDE());
-
-            // Hash contraction solutions into categories and then register
-            // into master list.
-            mAllSolutions[solutionUid] = solution;
-            mSolutionHash[solutionHash].push_back(solution);
-            mSolutionHash[dimsMNKHash].push_back(solution);
-            mSolutionHash[typesComputeABCDHash].push_back(solution);
-            mSolutionHash[elementOpsHash].push_back(solution);
-            mSolutionHash[contactionOpsHash].push_back(solution);
+            mSolutionStorage.push_back(std::move(solution));
         }
-        else
+    }
+
+    void ContractionSolutionRegistry::freeze()
+    {
+        if(mFrozen)
         {
+            return;
+        }
+
+        // Order solutions by unique ID. Stable sort keeps the first registration of duplicates.
+        std::vector<ContractionSolution*> solutions;
+        solutions.reserve(mSolutionStorage.size());
+        for(auto& solution : mSolutionStorage)
+        {
+            solutions.push_back(solution.get());
+        }
+
+        std::stable_sort(solutions.begin(), solutions.end(), [](auto* lhs, auto* rhs) {
+            return lhs->uid() < rhs->uid();
+        });
+
+        mSortedUids.clear();
+        mSortedSolutions.clear();
+        mSortedUids.reserve(solutions.size());
+        mSortedSolutions.reserve(solutions.size());
+
+        for(auto* solution : solutions)
+        {
+            auto solutionUid = solution->uid();
+            if(!mSortedUids.empty() && mSortedUids.back() == solutionUid)
+            {
 #if !NDEBUG
-            std::cout << "Unique solution: " << solutionUid << " already exists!" << std::endl;
+                std::cout << "Unique solution: " << solutionUid << " already exists!" << std::endl;
 #endif // !NDEBUG
+                continue;
+            }
+
+            mSortedUids.push_back(solutionUid);
+            mSortedSolutions.push_back(solution);
         }
-    }
 
-    void ContractionSolutionRegistry::Query::addSolutions(
-        std::vector<ContractionSolution*> const& solutions)
-    {
-        for(auto* soln : solutions)
+        // Hash each solution into its categories exactly once
+        std::vector<std::pair<Query::HashId, uint32_t>> categories;
+        categories.reserve(mSortedSolutions.size() * 5u);
+        for(uint32_t i = 0; i < mSortedSolutions.size(); i++)
         {
-            addSolution(soln);
+            auto& params = mSortedSolutions[i]->params();
+
+            categories.emplace_back(Query::hashSolution(params->dimsM(),
+                                                        params->dimsN(),
+                                                        params->dimsK(),
+                                                        params->typeA(),
+                                                        params->typeB(),
+                                                        params->typeC(),
+                                                        params->typeD(),
+                                                        params->opA(),
+                                                        params->opB(),
+                                                        params->opCDE(),
+                                                        params->typeCompute()),
+                                    i);
+            categories.emplace_back(
+                Query::hashDimsMNK(params->dimsM(), params->dimsN(), params->dimsK()), i);
+            categories.emplace_back(Query::hashTypesComputeABCD(params->typeA(),
+                                                                params->typeB(),
+                                                                params->typeC(),
+                                                                params->typeD(),
+                                                                params->typeCompute()),
+                                    i);
+            categories.emplace_back(Query::hashElementOps(params->opA(), params->opB()), i);
+            categories.emplace_back(Query::hashContractionOps(params->opCDE()), i);
         }
-    }
 
-    void ContractionSolutionRegistry::Query::addSolutions(
-        std::unordered_map<Uid, ContractionSolution*> const& solutions)
-    {
-        for(auto& solutionPair : solutions)
+        std::sort(categories.begin(), categories.end());
+
+        mCategoryBits.clear();
+        for(auto& [hash, index] : categories)
         {
-            addSolution(solutionPair.second);
+            if(mCategoryBits.empty() || mCategoryBits.back().first != hash)
+            {
+                mCategoryBits.emplace_back(hash, SolutionBits(mSortedSolutions.size()));
+            }
+            mCategoryBits.back().second.set(index);
         }
-    }
+        mCategoryBits.shrink_to_fit();
 
-    /////////////////////////////////////////
-    /// Class ContractionSolutionRegistry ///
-    /////////////////////////////////////////
+        // The root query selects every indexed solution
+        mAllBits.setFirst(mSortedSolutions.size());
+        mSolutionQuery = Query(this, QueryBits(mAllBits));
 
-    void ContractionSolutionRegistry::registerSolutions(
-        std::vector<std::unique_ptr<ContractionSolution>>&& solutions)
+        mFrozen = true;
+    }
+
+    ContractionSolutionRegistry::SolutionBits const*
+        ContractionSolutionRegistry::categoryBits(Query::HashId hash) const
     {
-        for(auto&& solution : solutions)
-        {
-            // Register with the query then take ownership
-            mSolutionQuery.addSolution(solution.get());
-            mSolutionStorage.push_back(std::move(solution));
-        }
+        auto it = std::lower_bound(
+            mCategoryBits.cbegin(), mCategoryBits.cend(), hash, [](auto const& entry, auto value) {
+                return entry.first < value;
+            });
+
+        return (it != mCategoryBits.cend() && it->first == hash) ? &(it->second) : nullptr;
     }
 
     ContractionSolutionRegistry::Query const& ContractionSolutionRegistry::allSolutions() const
@@ -303,7 +407,23 @@ namespace hiptensor
 
     uint32_t ContractionSolutionRegistry::solutionCount() const
     {
-        return mSolutionStorage.size();
+        return mSortedSolutions.size();
+    }
+
+    std::size_t ContractionSolutionRegistry::hostBytes() const
+    {
+        return mSolutionStorage.size() * sizeof(ContractionSolution)
+               + RegistryProfiler::containerBytes(mSolutionStorage)
+               + RegistryProfiler::containerBytes(mSortedUids)
+               + RegistryProfiler::containerBytes(mSortedSolutions)
+               + RegistryProfiler::containerBytes(mCategoryBits)
+               + mAllBits.bytes()
+               + std::accumulate(mCategoryBits.begin(),
+                                 mCategoryBits.end(),
+                                 std::size_t(0),
+                                 [](std::size_t sum, auto const& entry) {
+                                     return sum + entry.second.bytes();
+                                 });
     }
     // @endcond
 
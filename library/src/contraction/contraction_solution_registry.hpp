@@ -27,13 +27,15 @@
 #ifndef HIPTENSOR_CONTRACTION_SOLUTION_REGISTRY_HPP
 #define HIPTENSOR_CONTRACTION_SOLUTION_REGISTRY_HPP
 
+#include <iterator>
 #include <memory>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "contraction_types.hpp"
 #include "data_types.hpp"
 #include "singleton.hpp"
+#include "solution_bitset.hpp"
 
 namespace hiptensor
 {
@@ -43,6 +45,17 @@ namespace hiptensor
     class ContractionSolutionRegistry
     {
     public:
+        // Category solution masks, sized to the registry when it is frozen
+        using SolutionBits = SolutionBitset;
+
+        // Query solution masks, viewing the frozen masks where possible
+        using QueryBits = SolutionBitsetView;
+
+        /// Queries are lightweight views over a frozen registry.
+        /// Each query holds a mask of the registry's indexed solutions, such that
+        /// sub-queries, unions and intersections are bitset operations over one
+        /// word per 64 solutions. The root and single category queries reference
+        /// the registry's frozen masks, combined masks are held inline.
         class Query
         {
         public:
@@ -50,10 +63,33 @@ namespace hiptensor
             using Uid    = std::size_t;
             using HashId = std::size_t;
 
-            Query()  = default;
-            ~Query() = default;
-            Query(Query const& other);
-            Query& operator=(Query const& other);
+            // Iterates the solutions selected by the query, in Uid order
+            class Iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = ContractionSolution*;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = ContractionSolution* const*;
+                using reference         = ContractionSolution* const&;
+
+                Iterator(Query const* query, uint32_t index);
+
+                ContractionSolution* operator*() const;
+                Iterator&            operator++();
+                Iterator             operator++(int);
+                bool                 operator==(Iterator const& other) const;
+                bool                 operator!=(Iterator const& other) const;
+
+            private:
+                Query const* mQuery;
+                uint32_t     mIndex;
+            };
+
+            Query()                        = default;
+            ~Query()                       = default;
+            Query(Query const& other)      = default;
+            Query& operator=(Query const&) = default;
 
             /// Subsequent queries that may be performed on the current query object.
             /// E.g. in this context, query further parameters.
@@ -87,21 +123,27 @@ namespace hiptensor
             // By contraction operation
             Query query(ContractionOpId_t opCDE) const;
 
+            // By explicit set of registered solutions
+            Query query(std::vector<ContractionSolution*> const& solutions) const;
+
             // union
             Query operator||(Query const& other) const;
 
             // intersection
             Query operator&&(Query const& other) const;
 
-            // Full map of Uid to ContractionSolution*
-            std::unordered_map<Uid, ContractionSolution*> const& solutions() const;
+            // Solution lookup by Uid, nullptr if not selected by the query
+            ContractionSolution* find(Uid uid) const;
+
+            Iterator begin() const;
+            Iterator end() const;
 
             uint32_t solutionCount() const;
 
+        private:
             // Internal ctor
-            Query(std::vector<ContractionSolution*> const& solutions);
+            Query(ContractionSolutionRegistry const* registry, QueryBits const& solutionBits);
 
-        private:
             // Query by explicit hash
             Query query(HashId queryHash) const;
 
@@ -127,19 +169,13 @@ namespace hiptensor
             static HashId hashElementOps(hiptensorOperator_t opA, hiptensorOperator_t opB);
             static HashId hashContractionOps(ContractionOpId_t opCDE);
 
-            // Adding solutions to the query
-            void addSolution(ContractionSolution* solution);
-            void addSolutions(std::vector<ContractionSolution*> const& solutions);
-            void addSolutions(std::unordered_map<Uid, ContractionSolution*> const& solutions);
-
         private: // members
-            // This is the has of all solutions, by unique Uid
-            // [Key = KernelUid, element = ContractionSolution*]
-            std::unordered_map<Uid, ContractionSolution*> mAllSolutions;
+            // The frozen registry that owns the index
+            ContractionSolutionRegistry const* mRegistry = nullptr;
 
-            // This is the contextual query hash
-            // [Key = Query hash, Element = ContractionSolution*]
-            std::unordered_map<HashId, std::vector<ContractionSolution*>> mSolutionHash;
+            // Solutions selected by this query, by index into the
+            // registry's sorted solution array.
+            QueryBits mSolutionBits;
         };
 
     protected:
@@ -153,11 +189,15 @@ namespace hiptensor
         // Import contraction solutions for the registry to manage
         void registerSolutions(std::vector<std::unique_ptr<ContractionSolution>>&& solutions);
 
+        // Builds the immutable query index once all solutions are registered.
+        // No further solutions may be registered afterwards.
+        void freeze();
+
     public:
         virtual ~ContractionSolutionRegistry() = default;
 
         template <typename... Ts>
-        Query querySolutions(Ts... ts)
+        Query querySolutions(Ts... ts) const
         {
             return mSolutionQuery.query(ts...);
         }
@@ -166,9 +206,28 @@ namespace hiptensor
 
         uint32_t solutionCount() const;
 
+        // Approximate host memory held by the solutions and the query index
+        std::size_t hostBytes() const;
+
+    private:
+        // Category bitset lookup, nullptr if no solution matches the hash
+        SolutionBits const* categoryBits(Query::HashId hash) const;
+
     private:
         std::vector<std::unique_ptr<ContractionSolution>> mSolutionStorage;
-        Query                                             mSolutionQuery;
+
+        // Frozen index: contiguous arrays sorted by Uid
+        std::vector<Query::Uid>           mSortedUids;
+        std::vector<ContractionSolution*> mSortedSolutions;
+
+        // Frozen index: solution mask per category hash, sorted by hash
+        std::vector<std::pair<Query::HashId, SolutionBits>> mCategoryBits;
+
+        // Frozen index: mask of every solution, viewed by the root query
+        SolutionBits mAllBits;
+
+        Query mSolutionQuery;
+        bool  mFrozen = false;
     };
     // @endcond
 
@@ -0,0 +1,276 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstring>
+
+#include "include/cpu_type_convert.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define HIPTENSOR_CPU_CONVERT_X86 1
+#include <immintrin.h>
+#endif
+
+namespace hiptensor
+{
+    namespace
+    {
+        inline uint32_t toBits(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        inline float fromBits(uint32_t bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        float halfToFloat(uint16_t half)
+        {
+            uint32_t sign     = static_cast<uint32_t>(half & 0x8000u) << 16;
+            uint32_t exponent = (half >> 10) & 0x1fu;
+            uint32_t mantissa = half & 0x3ffu;
+
+            if(exponent == 0x1fu)
+            {
+                return fromBits(sign | 0x7f800000u | (mantissa << 13));
+            }
+            if(exponent != 0)
+            {
+                return fromBits(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+            }
+            if(mantissa == 0)
+            {
+                return fromBits(sign);
+            }
+
+            // Subnormal half: normalize into the f32 range
+            uint32_t shifts = 0;
+            while(!(mantissa & 0x400u))
+            {
+                mantissa <<= 1;
+                shifts++;
+            }
+            return fromBits(sign | ((113u - shifts) << 23) | ((mantissa & 0x3ffu) << 13));
+        }
+
+        uint16_t floatToHalf(float value)
+        {
+            uint32_t bits = toBits(value);
+            uint32_t sign = (bits >> 16) & 0x8000u;
+            bits &= 0x7fffffffu;
+
+            if(bits >= 0x7f800000u)
+            {
+                // Inf stays Inf, NaN stays a quiet NaN
+                return sign | 0x7c00u | (bits > 0x7f800000u ? 0x200u | ((bits >> 13) & 0x3ffu) : 0);
+            }
+            if(bits >= 0x477ff000u)
+            {
+                // 65520 and above round to Inf
+                return sign | 0x7c00u;
+            }
+            if(bits < 0x38800000u)
+            {
+                // Subnormal result: let the FPU round at the half subnormal spacing
+                return sign | (toBits(fromBits(bits) + 0.5f) - 0x3f000000u);
+            }
+
+            // Rebias the exponent and round the mantissa to nearest even
+            bits += 0xc8000fffu + ((bits >> 13) & 1u);
+            return sign | (bits >> 13);
+        }
+
+        inline float bhalfToFloat(uint16_t bhalf)
+        {
+            return fromBits(static_cast<uint32_t>(bhalf) << 16);
+        }
+
+        uint16_t floatToBhalf(float value)
+        {
+            uint32_t bits = toBits(value);
+            if((bits & 0x7f800000u) != 0x7f800000u)
+            {
+                bits += 0x7fffu + ((bits >> 16) & 1u);
+            }
+            else if(bits & 0xffffu)
+            {
+                // Keep NaN a NaN when its payload lives in the truncated bits
+                bits |= 0x10000u;
+            }
+            return static_cast<uint16_t>(bits >> 16);
+        }
+
+#if HIPTENSOR_CPU_CONVERT_X86
+        bool hasF16c()
+        {
+            static const bool sSupported
+                = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+            return sSupported;
+        }
+
+        bool hasAvx2()
+        {
+            static const bool sSupported = __builtin_cpu_supports("avx2");
+            return sSupported;
+        }
+
+        __attribute__((target("avx,f16c"))) int64_t
+            halfToFloatF16c(uint16_t const* src, float* dst, int64_t count)
+        {
+            int64_t i = 0;
+            for(; i + 8 <= count; i += 8)
+            {
+                auto half = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+            }
+            return i;
+        }
+
+        __attribute__((target("avx,f16c"))) int64_t
+            roundToHalfF16c(float const* src, float* dst, int64_t count)
+        {
+            int64_t i = 0;
+            for(; i + 8 <= count; i += 8)
+            {
+                auto half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2"))) int64_t
+            bhalfToFloatAvx2(uint16_t const* src, float* dst, int64_t count)
+        {
+            int64_t i = 0;
+            for(; i + 8 <= count; i += 8)
+            {
+                auto bhalf = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+                auto bits  = _mm256_slli_epi32(_mm256_cvtepu16_epi32(bhalf), 16);
+                _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(bits));
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2"))) int64_t
+            roundToBhalfAvx2(float const* src, float* dst, int64_t count)
+        {
+            auto const one      = _mm256_set1_epi32(1);
+            auto const bias     = _mm256_set1_epi32(0x7fff);
+            auto const exponent = _mm256_set1_epi32(0x7f800000);
+            auto const low      = _mm256_set1_epi32(0xffff);
+            auto const nanBit   = _mm256_set1_epi32(0x10000);
+            auto const high     = _mm256_set1_epi32(static_cast<int32_t>(0xffff0000u));
+
+            int64_t i = 0;
+            for(; i + 8 <= count; i += 8)
+            {
+                auto bits = _mm256_castps_si256(_mm256_loadu_ps(src + i));
+
+                // Finite values: add the rounding bias plus the lsb of the result
+                auto odd     = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+                auto rounded = _mm256_add_epi32(bits, _mm256_add_epi32(bias, odd));
+
+                // Inf and NaN: keep the NaN bit set when only the low bits carry it
+                auto lowZero = _mm256_cmpeq_epi32(_mm256_and_si256(bits, low),
+                                                  _mm256_setzero_si256());
+                auto special = _mm256_or_si256(bits, _mm256_andnot_si256(lowZero, nanBit));
+
+                auto isSpecial
+                    = _mm256_cmpeq_epi32(_mm256_and_si256(bits, exponent), exponent);
+                auto result = _mm256_blendv_epi8(rounded, special, isSpecial);
+                _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(_mm256_and_si256(result, high)));
+            }
+            return i;
+        }
+#endif // HIPTENSOR_CPU_CONVERT_X86
+    } // namespace
+
+    void cpuHalfToFloat(uint16_t const* src, float* dst, int64_t count)
+    {
+        int64_t i = 0;
+#if HIPTENSOR_CPU_CONVERT_X86
+        if(hasF16c())
+        {
+            i = halfToFloatF16c(src, dst, count);
+        }
+#endif // HIPTENSOR_CPU_CONVERT_X86
+        for(; i < count; i++)
+        {
+            dst[i] = halfToFloat(src[i]);
+        }
+    }
+
+    void cpuBhalfToFloat(uint16_t const* src, float* dst, int64_t count)
+    {
+        int64_t i = 0;
+#if HIPTENSOR_CPU_CONVERT_X86
+        if(hasAvx2())
+        {
+            i = bhalfToFloatAvx2(src, dst, count);
+        }
+#endif // HIPTENSOR_CPU_CONVERT_X86
+        for(; i < count; i++)
+        {
+            dst[i] = bhalfToFloat(src[i]);
+        }
+    }
+
+    void cpuRoundToHalf(float const* src, float* dst, int64_t count)
+    {
+        int64_t i = 0;
+#if HIPTENSOR_CPU_CONVERT_X86
+        if(hasF16c())
+        {
+            i = roundToHalfF16c(src, dst, count);
+        }
+#endif // HIPTENSOR_CPU_CONVERT_X86
+        for(; i < count; i++)
+        {
+            dst[i] = halfToFloat(floatToHalf(src[i]));
+        }
+    }
+
+    void cpuRoundToBhalf(float const* src, float* dst, int64_t count)
+    {
+        int64_t i = 0;
+#if HIPTENSOR_CPU_CONVERT_X86
+        if(hasAvx2())
+        {
+            i = roundToBhalfAvx2(src, dst, count);
+        }
+#endif // HIPTENSOR_CPU_CONVERT_X86
+        for(; i < count; i++)
+        {
+            dst[i] = bhalfToFloat(floatToBhalf(src[i]));
+        }
+    }
+
+} // namespace hiptensor
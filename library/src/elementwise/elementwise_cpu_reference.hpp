@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_CPU_REFERENCE_HPP
+#define HIPTENSOR_ELEMENTWISE_CPU_REFERENCE_HPP
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <hiptensor/internal/types.hpp>
+
+#include "data_types.hpp"
+#include "elementwise_solution.hpp"
+#include "thread_pool.hpp"
+
+namespace hiptensor
+{
+    // @cond
+    // Host elementwise solution of any rank, evaluating the operators in
+    // single precision like the device kernels
+    template <typename DataT>
+    class ElementwiseCpuReference : public ElementwiseSolution
+    {
+        struct PreparedArgsImpl : public PreparedArgs
+        {
+            ElementwiseProblem mProblem;
+        };
+
+        // Elements per host task
+        static constexpr std::size_t TaskElements = 32768;
+
+    public:
+        ElementwiseCpuReference(int32_t numInputs)
+            : ElementwiseSolution(HipDataType_v<DataT>, numInputs, 0, "HostElementwise")
+        {
+        }
+
+        std::unique_ptr<PreparedArgs> prepareArgs(ElementwiseProblem const& problem) const override
+        {
+            if(problem.mType != type() || problem.mInStrides.size() != numInputs())
+            {
+                return nullptr;
+            }
+
+            auto args      = std::make_unique<PreparedArgsImpl>();
+            args->mProblem = problem;
+            args->mSize    = problem.elementCount();
+            args->mBytes   = (numInputs() + 1) * sizeof(DataT) * args->mSize;
+            return args;
+        }
+
+        float run(PreparedArgs const&             args,
+                  ElementwiseOperators const&     ops,
+                  std::vector<void const*> const& inputs,
+                  void*                           D,
+                  StreamConfig const&             streamConfig) const override
+        {
+            auto* prepared = dynamic_cast<PreparedArgsImpl const*>(&args);
+            if(prepared == nullptr || inputs.size() != numInputs())
+            {
+                return -1.0F;
+            }
+
+            auto const  start      = std::chrono::steady_clock::now();
+            auto const& problem    = prepared->mProblem;
+            auto const  rank       = problem.mLengths.size();
+            auto const  inputCount = inputs.size();
+
+            std::array<DataT const*, 3> in{};
+            for(std::size_t t = 0; t < inputCount; t++)
+            {
+                in[t] = static_cast<DataT const*>(inputs[t]);
+            }
+            auto* out = static_cast<DataT*>(D);
+
+            auto task = [&](std::vector<std::size_t> const& first,
+                            std::size_t                     begin,
+                            std::size_t                     end) {
+                auto                       index = first;
+                std::array<std::size_t, 3> inOffsets{};
+                std::size_t                outOffset = 0;
+                for(std::size_t d = 0; d < rank; d++)
+                {
+                    for(std::size_t t = 0; t < inputCount; t++)
+                    {
+                        inOffsets[t] += index[d] * problem.mInStrides[t][d];
+                    }
+                    outOffset += index[d] * problem.mOutStrides[d];
+                }
+
+                for(auto i = begin; i < end; i++)
+                {
+                    auto a = static_cast<float>(in[0][inOffsets[0]]);
+                    auto c = static_cast<float>(in[inputCount - 1][inOffsets[inputCount - 1]]);
+                    out[outOffset] = static_cast<DataT>(
+                        inputCount == 2 ? ops(a, c)
+                                       : ops(a, static_cast<float>(in[1][inOffsets[1]]), c));
+
+                    // Advance the odometer, first mode fastest
+                    for(std::size_t d = 0; d < rank; d++)
+                    {
+                        index[d]++;
+                        for(std::size_t t = 0; t < inputCount; t++)
+                        {
+                            inOffsets[t] += problem.mInStrides[t][d];
+                        }
+                        outOffset += problem.mOutStrides[d];
+                        if(index[d] < problem.mLengths[d])
+                        {
+                            break;
+                        }
+
+                        for(std::size_t t = 0; t < inputCount; t++)
+                        {
+                            inOffsets[t] -= index[d] * problem.mInStrides[t][d];
+                        }
+                        outOffset -= index[d] * problem.mOutStrides[d];
+                        index[d] = 0;
+                    }
+                }
+            };
+            ThreadPool::instance()->parallelForIndexSpace(problem.mLengths, TaskElements, task);
+
+            if(!streamConfig.time_kernel_)
+            {
+                return 0.0F;
+            }
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now()
+                                                            - start)
+                .count();
+        }
+    };
+
+    // Host solutions of binary and trinary operations
+    template <typename DataT>
+    std::vector<std::unique_ptr<ElementwiseSolution>> enumerateElementwiseCpuReferences()
+    {
+        std::vector<std::unique_ptr<ElementwiseSolution>> result;
+        result.push_back(std::make_unique<ElementwiseCpuReference<DataT>>(2));
+        result.push_back(std::make_unique<ElementwiseCpuReference<DataT>>(3));
+        return result;
+    }
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_CPU_REFERENCE_HPP
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <functional>
+#include <utility>
+
+#include "elementwise_solution.hpp"
+
+namespace hiptensor
+{
+    ElementwiseSolution::ElementwiseSolution(hipDataType type,
+                                             int32_t     numInputs,
+                                             int32_t     dim,
+                                             std::string kernelName)
+        : mType(type)
+        , mNumInputs(numInputs)
+        , mDim(dim)
+        , mKernelName(std::move(kernelName))
+    {
+    }
+
+    hipDataType ElementwiseSolution::type() const
+    {
+        return mType;
+    }
+
+    int32_t ElementwiseSolution::numInputs() const
+    {
+        return mNumInputs;
+    }
+
+    int32_t ElementwiseSolution::dim() const
+    {
+        return mDim;
+    }
+
+    std::size_t ElementwiseSolution::uid() const
+    {
+        return std::hash<std::string>{}(mKernelName);
+    }
+
+    std::string const& ElementwiseSolution::kernelName() const
+    {
+        return mKernelName;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_SOLUTION_HPP
+#define HIPTENSOR_ELEMENTWISE_SOLUTION_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// CK includes
+#include <ck/stream_config.hpp>
+
+#include "elementwise_types.hpp"
+
+namespace hiptensor
+{
+    // @cond
+    // Solution of elementwise binary (inputs A and C) or trinary (inputs A, B
+    // and C) problems of one data type and rank
+    class ElementwiseSolution
+    {
+    public:
+        ElementwiseSolution()                                      = delete;
+        ElementwiseSolution(ElementwiseSolution const&)            = delete;
+        virtual ~ElementwiseSolution()                             = default;
+        ElementwiseSolution& operator=(ElementwiseSolution const&) = delete;
+
+        // A dim of zero supports problems of any rank
+        ElementwiseSolution(hipDataType type,
+                            int32_t     numInputs,
+                            int32_t     dim,
+                            std::string kernelName);
+
+        // Problem layout resolved once, so that execution only supplies the
+        // data pointers and the operators.
+        struct PreparedArgs
+        {
+            virtual ~PreparedArgs() = default;
+
+            std::size_t mSize  = 0;
+            std::size_t mBytes = 0;
+        };
+
+        // Returns nullptr if the kernel does not support the problem
+        virtual std::unique_ptr<PreparedArgs> prepareArgs(ElementwiseProblem const& problem) const
+            = 0;
+
+        // Runs prepared arguments with the inputs A, [B,] C. The solution itself
+        // is not modified, so plans sharing this solution may execute concurrently.
+        // Returns the average time in milli-seconds if the stream config times
+        // the kernel and 0 if not, or a negative value on failure.
+        virtual float run(PreparedArgs const&             args,
+                          ElementwiseOperators const&     ops,
+                          std::vector<void const*> const& inputs,
+                          void*                           D,
+                          StreamConfig const&             streamConfig = StreamConfig{}) const
+            = 0;
+
+        /// Accessors
+
+        hipDataType type() const;
+
+        int32_t numInputs() const;
+
+        int32_t dim() const;
+
+        // Unique ID for the kernel
+        std::size_t uid() const;
+
+        // Kernel's name encoding
+        std::string const& kernelName() const;
+
+    private:
+        hipDataType mType;
+        int32_t     mNumInputs;
+        int32_t     mDim;
+        std::string mKernelName;
+    };
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_SOLUTION_HPP
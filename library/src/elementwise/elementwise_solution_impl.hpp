@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_SOLUTION_IMPL_HPP
+#define HIPTENSOR_ELEMENTWISE_SOLUTION_IMPL_HPP
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+// CK includes
+#include <ck.hpp>
+#include <device_elementwise_dynamic_vector_dims_impl.hpp>
+
+#include "data_types.hpp"
+#include "elementwise_solution.hpp"
+
+namespace hiptensor
+{
+    // @cond
+    // Adapts ElementwiseOperators to CK's element-wise operator signature,
+    // computing in float between the data types of the tensors
+    struct ElementwiseCkOp
+    {
+        ElementwiseOperators mOps;
+
+        template <typename Y, typename X0, typename X1>
+        __host__ __device__ void operator()(Y& d, X0 const& a, X1 const& c) const
+        {
+            d = ck::type_convert<Y>(mOps(ck::type_convert<float>(a), ck::type_convert<float>(c)));
+        }
+
+        template <typename Y, typename X0, typename X1, typename X2>
+        __host__ __device__ void operator()(Y& d, X0 const& a, X1 const& b, X2 const& c) const
+        {
+            d = ck::type_convert<Y>(mOps(ck::type_convert<float>(a),
+                                         ck::type_convert<float>(b),
+                                         ck::type_convert<float>(c)));
+        }
+    };
+
+    // CK elementwise kernel with the default permutation tile, and vectors of
+    // VectorSize elements along the contiguous mode of every tensor
+    template <typename DataT, ck::index_t NumInputs, ck::index_t NumDim, ck::index_t VectorSize>
+    class ElementwiseSolutionImpl : public ElementwiseSolution
+    {
+        using InDataTypes   = std::conditional_t<NumInputs == 2,
+                                               ck::Tuple<DataT, DataT>,
+                                               ck::Tuple<DataT, DataT, DataT>>;
+        using InVectorSizes = std::conditional_t<NumInputs == 2,
+                                                 ck::Sequence<VectorSize, VectorSize>,
+                                                 ck::Sequence<VectorSize, VectorSize, VectorSize>>;
+
+        using DeviceOp
+            = ck::tensor_operation::device::DeviceElementwiseImpl<InDataTypes,
+                                                                  ck::Tuple<DataT>,
+                                                                  ElementwiseCkOp,
+                                                                  NumDim,
+                                                                  256,
+                                                                  64,
+                                                                  64,
+                                                                  4,
+                                                                  4,
+                                                                  ck::Sequence<0, 1>,
+                                                                  InVectorSizes,
+                                                                  ck::Sequence<VectorSize>>;
+
+        using CkArray = std::array<ck::index_t, NumDim>;
+
+        struct PreparedArgsImpl : public PreparedArgs
+        {
+            CkArray                                                    mLengths;
+            std::array<CkArray, NumInputs>                             mInStrides;
+            CkArray                                                    mOutStrides;
+            std::unique_ptr<ck::tensor_operation::device::BaseInvoker> mInvoker;
+        };
+
+    public:
+        ElementwiseSolutionImpl()
+            : ElementwiseSolution(
+                HipDataType_v<DataT>, NumInputs, NumDim, DeviceOp{}.GetTypeString())
+        {
+        }
+
+        std::unique_ptr<PreparedArgs> prepareArgs(ElementwiseProblem const& problem) const override
+        {
+            if(problem.mLengths.size() != NumDim || problem.mInStrides.size() != NumInputs)
+            {
+                return nullptr;
+            }
+
+            auto toCkArray = [](std::vector<std::size_t> const& v, CkArray& a) {
+                std::copy_n(v.begin(), NumDim, a.begin());
+            };
+
+            auto args = std::make_unique<PreparedArgsImpl>();
+            toCkArray(problem.mLengths, args->mLengths);
+            for(ck::index_t i = 0; i < NumInputs; i++)
+            {
+                toCkArray(problem.mInStrides[i], args->mInStrides[i]);
+            }
+            toCkArray(problem.mOutStrides, args->mOutStrides);
+
+            // Support does not depend on the data pointers or on the operators
+            auto probe = makeArgument(*args, {}, nullptr, ElementwiseCkOp{});
+            if(!mDeviceOp.IsSupportedArgument(probe.get()))
+            {
+                return nullptr;
+            }
+
+            args->mInvoker = mDeviceOp.MakeInvokerPointer();
+            args->mSize    = problem.elementCount();
+            args->mBytes   = (NumInputs + 1) * sizeof(DataT) * args->mSize;
+
+            return args;
+        }
+
+        float run(PreparedArgs const&             args,
+                  ElementwiseOperators const&     ops,
+                  std::vector<void const*> const& inputs,
+                  void*                           D,
+                  StreamConfig const&             streamConfig) const override
+        {
+            auto* prepared = dynamic_cast<PreparedArgsImpl const*>(&args);
+            if(prepared == nullptr || !prepared->mInvoker || inputs.size() != NumInputs)
+            {
+                return -1.0F;
+            }
+
+            std::array<void const*, NumInputs> inPointers;
+            std::copy_n(inputs.begin(), NumInputs, inPointers.begin());
+
+            // Only the pointers and the operators change between executions of a plan
+            auto argument = makeArgument(*prepared, inPointers, D, ElementwiseCkOp{ops});
+            return prepared->mInvoker->Run(argument.get(), streamConfig);
+        }
+
+    private:
+        std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(PreparedArgsImpl const&                   args,
+                         std::array<void const*, NumInputs> const& inputs,
+                         void*                                     D,
+                         ElementwiseCkOp const&                    op) const
+        {
+            return mDeviceOp.MakeArgumentPointer(
+                args.mLengths, args.mInStrides, {args.mOutStrides}, inputs, {D}, op);
+        }
+
+        // CK's device operators are stateless, so one is shared by all executions
+        mutable DeviceOp mDeviceOp;
+    };
+
+    // Candidates of one data type, arity and rank, widest vectors first.
+    // The scalar instance supports any strides.
+    template <typename DataT, ck::index_t NumInputs, ck::index_t NumDim>
+    std::vector<std::unique_ptr<ElementwiseSolution>> enumerateElementwiseSolutions()
+    {
+        std::vector<std::unique_ptr<ElementwiseSolution>> result;
+        if constexpr(sizeof(DataT) == 2)
+        {
+            result.push_back(
+                std::make_unique<ElementwiseSolutionImpl<DataT, NumInputs, NumDim, 8>>());
+        }
+        result.push_back(std::make_unique<ElementwiseSolutionImpl<DataT, NumInputs, NumDim, 4>>());
+        result.push_back(std::make_unique<ElementwiseSolutionImpl<DataT, NumInputs, NumDim, 2>>());
+        result.push_back(std::make_unique<ElementwiseSolutionImpl<DataT, NumInputs, NumDim, 1>>());
+        return result;
+    }
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_SOLUTION_IMPL_HPP
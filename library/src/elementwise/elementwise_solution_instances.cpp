@@ -0,0 +1,56 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "elementwise_solution_instances.hpp"
+#include "elementwise_cpu_reference.hpp"
+#include "registry_profiler.hpp"
+
+namespace hiptensor
+{
+    ElementwiseSolutionInstances::ElementwiseSolutionInstances()
+    {
+        RegistryProfiler::ScopedTimer timer("ElementwiseSolutionInstances");
+
+        ElementwiseSolution2DInstances();
+        ElementwiseSolution3DInstances();
+        ElementwiseSolution4DInstances();
+        ElementwiseSolution5DInstances();
+        ElementwiseSolution6DInstances();
+
+        timer.finish(solutionCount(), hostBytes());
+    }
+
+    ElementwiseCpuReferenceInstances::ElementwiseCpuReferenceInstances()
+    {
+        RegistryProfiler::ScopedTimer timer("ElementwiseCpuReferenceInstances");
+
+        // The host solutions support problems of any rank
+        registerSolutions(enumerateElementwiseCpuReferences<float>());
+        registerSolutions(enumerateElementwiseCpuReferences<float16_t>());
+
+        timer.finish(solutionCount(), hostBytes());
+    }
+} // namespace hiptensor
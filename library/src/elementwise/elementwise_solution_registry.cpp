@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "elementwise_solution_registry.hpp"
+#include "elementwise_solution.hpp"
+#include "registry_profiler.hpp"
+
+namespace hiptensor
+{
+    /////////////////////////////////////////
+    /// Class ElementwiseSolutionRegistry ///
+    /////////////////////////////////////////
+    std::vector<ElementwiseSolution*>
+        ElementwiseSolutionRegistry::query(hipDataType type,
+                                           int32_t     numInputs,
+                                           int32_t     numDim) const
+    {
+        std::vector<ElementwiseSolution*> solutions;
+        for(auto& solution : mAllSolutions)
+        {
+            if(solution->type() == type && solution->numInputs() == numInputs
+               && (solution->dim() == 0 || solution->dim() == numDim))
+            {
+                solutions.push_back(solution.get());
+            }
+        }
+
+        return solutions;
+    }
+
+    void ElementwiseSolutionRegistry::registerSolutions(
+        std::vector<std::unique_ptr<ElementwiseSolution>>&& solutions)
+    {
+        for(auto&& solution : solutions)
+        {
+            mAllSolutions.push_back(std::move(solution));
+        }
+    }
+
+    uint32_t ElementwiseSolutionRegistry::solutionCount() const
+    {
+        return mAllSolutions.size();
+    }
+
+    std::size_t ElementwiseSolutionRegistry::hostBytes() const
+    {
+        return mAllSolutions.size() * sizeof(ElementwiseSolution)
+               + RegistryProfiler::containerBytes(mAllSolutions);
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_SOLUTION_REGISTRY_HPP
+#define HIPTENSOR_ELEMENTWISE_SOLUTION_REGISTRY_HPP
+
+#include <memory>
+#include <vector>
+
+#include <hip/library_types.h>
+
+namespace hiptensor
+{
+    class ElementwiseSolution;
+
+    class ElementwiseSolutionRegistry
+    {
+    protected:
+        // Move only
+        ElementwiseSolutionRegistry()                                              = default;
+        ElementwiseSolutionRegistry(ElementwiseSolutionRegistry&&)                 = default;
+        ElementwiseSolutionRegistry& operator=(ElementwiseSolutionRegistry&&)      = default;
+        ElementwiseSolutionRegistry(ElementwiseSolutionRegistry const&)            = delete;
+        ElementwiseSolutionRegistry& operator=(ElementwiseSolutionRegistry const&) = delete;
+
+        // Import elementwise solutions for the registry to manage
+        void registerSolutions(std::vector<std::unique_ptr<ElementwiseSolution>>&& solutions);
+
+    public:
+        virtual ~ElementwiseSolutionRegistry() = default;
+
+        // Candidates for the data type, number of inputs and rank, in the order
+        // they were registered
+        std::vector<ElementwiseSolution*>
+            query(hipDataType type, int32_t numInputs, int32_t numDim) const;
+
+        uint32_t solutionCount() const;
+
+        // Approximate host memory held by the solutions
+        std::size_t hostBytes() const;
+
+    private:
+        std::vector<std::unique_ptr<ElementwiseSolution>> mAllSolutions;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_SOLUTION_REGISTRY_HPP
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "../permutation/permutation_folding.hpp"
+#include "elementwise_types.hpp"
+
+namespace hiptensor
+{
+    std::size_t ElementwiseProblem::elementCount() const
+    {
+        return std::accumulate(
+            mLengths.cbegin(), mLengths.cend(), std::size_t(1), std::multiplies<std::size_t>{});
+    }
+
+    bool makeElementwiseProblem(std::initializer_list<ElementwiseTensor> inputs,
+                                ElementwiseTensor                        output,
+                                ElementwiseProblem&                      problem)
+    {
+        auto const* descD = output.first;
+        auto const* modeD = output.second;
+        auto const  rank  = descD->mLengths.size();
+
+        // Strides of every input along the modes of D, followed by the strides of D
+        auto strides = std::vector<std::vector<std::size_t>>{};
+        for(auto const& [desc, mode] : inputs)
+        {
+            auto inStrides = std::vector<std::size_t>(rank, 0);
+            for(std::size_t i = 0; i < desc->mLengths.size(); i++)
+            {
+                auto found = std::find(modeD, modeD + rank, mode[i]);
+                if(found == modeD + rank || descD->mLengths[found - modeD] != desc->mLengths[i])
+                {
+                    return false;
+                }
+                inStrides[found - modeD] = desc->mStrides[i];
+            }
+            strides.push_back(std::move(inStrides));
+        }
+        strides.push_back(descD->mStrides);
+
+        problem.mType = descD->mType;
+        problem.mLengths.clear();
+        problem.mInStrides.assign(inputs.size(), {});
+        problem.mOutStrides.clear();
+
+        // Folded strides of input t, or of D for t == inputs.size()
+        auto foldedStrides = [&](std::size_t t) -> std::vector<std::size_t>& {
+            return t < inputs.size() ? problem.mInStrides[t] : problem.mOutStrides;
+        };
+
+        auto appendMode = [&](std::size_t length, auto const& strideOf) {
+            problem.mLengths.push_back(length);
+            for(std::size_t t = 0; t < inputs.size(); t++)
+            {
+                problem.mInStrides[t].push_back(strideOf(t));
+            }
+            problem.mOutStrides.push_back(strideOf(inputs.size()));
+        };
+
+        // Strides of every tensor along one mode, and along the last folded mode
+        auto const count        = inputs.size() + 1;
+        auto       modeStrides  = std::vector<std::size_t>(count);
+        auto       groupStrides = std::vector<std::size_t>(count);
+        for(std::size_t i = 0; i < rank; i++)
+        {
+            auto length = descD->mLengths[i];
+            if(length == 1)
+            {
+                continue;
+            }
+
+            // The previous mode and this one are contiguous in every tensor,
+            // with the same one the faster changing in all of them
+            auto last = problem.mLengths.size();
+            if(last > 0)
+            {
+                for(std::size_t t = 0; t < count; t++)
+                {
+                    modeStrides[t]  = strides[t][i];
+                    groupStrides[t] = foldedStrides(t)[last - 1];
+                }
+                if(continuesFoldedMode(length,
+                                       modeStrides.data(),
+                                       problem.mLengths[last - 1],
+                                       groupStrides.data(),
+                                       count))
+                {
+                    problem.mLengths[last - 1] *= length;
+                    for(std::size_t t = 0; t < count; t++)
+                    {
+                        foldedStrides(t)[last - 1] = groupStrides[t];
+                    }
+                    continue;
+                }
+            }
+
+            appendMode(length, [&](std::size_t t) { return strides[t][i]; });
+        }
+
+        // Instances have at least two modes
+        while(problem.mLengths.size() < 2)
+        {
+            auto last = problem.mLengths.size();
+            appendMode(1, [&](std::size_t t) {
+                return last > 0 ? foldedStrides(t)[last - 1] * problem.mLengths[last - 1]
+                                : std::size_t(1);
+            });
+        }
+
+        return true;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_TYPES_HPP
+#define HIPTENSOR_ELEMENTWISE_TYPES_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+namespace hiptensor
+{
+    // @cond
+    // Operators and scalars of D = opABC(opAB(alpha * opA(A), beta * opB(B)), gamma * opC(C)).
+    // Binary operations D = opAC(alpha * opA(A), gamma * opC(C)) have no B, and
+    // opAC is held by mOpABC. Evaluated in single precision on the host and device.
+    struct ElementwiseOperators
+    {
+        float               mAlpha;
+        float               mBeta;
+        float               mGamma;
+        hiptensorOperator_t mOpA;
+        hiptensorOperator_t mOpB;
+        hiptensorOperator_t mOpC;
+        hiptensorOperator_t mOpAB;
+        hiptensorOperator_t mOpABC;
+
+        __host__ __device__ static float unary(hiptensorOperator_t op, float x)
+        {
+            return op == HIPTENSOR_OP_SQRT ? sqrtf(x) : x;
+        }
+
+        __host__ __device__ static float binary(hiptensorOperator_t op, float x, float y)
+        {
+            switch(op)
+            {
+            case HIPTENSOR_OP_MUL:
+                return x * y;
+            case HIPTENSOR_OP_MAX:
+                return x > y ? x : y;
+            case HIPTENSOR_OP_MIN:
+                return x < y ? x : y;
+            default:
+                return x + y;
+            }
+        }
+
+        __host__ __device__ float operator()(float a, float c) const
+        {
+            return binary(mOpABC, mAlpha * unary(mOpA, a), mGamma * unary(mOpC, c));
+        }
+
+        __host__ __device__ float operator()(float a, float b, float c) const
+        {
+            auto ab = binary(mOpAB, mAlpha * unary(mOpA, a), mBeta * unary(mOpB, b));
+            return binary(mOpABC, ab, mGamma * unary(mOpC, c));
+        }
+    };
+
+    // Elementwise problem over the modes of D. The strides of every input are
+    // reordered to the modes of D, and are zero along the modes it broadcasts.
+    struct ElementwiseProblem
+    {
+        hipDataType                           mType;
+        std::vector<std::size_t>              mLengths;
+        std::vector<std::vector<std::size_t>> mInStrides;
+        std::vector<std::size_t>              mOutStrides;
+
+        std::size_t elementCount() const;
+    };
+
+    // Descriptor and modes of one tensor of an elementwise operation
+    using ElementwiseTensor = std::pair<const hiptensorTensorDescriptor_t*, const int32_t*>;
+
+    // Builds the problem of the inputs A, [B,] C and the output D. Length-1 modes
+    // are dropped, and modes that are contiguous in every tensor are folded, so
+    // that lower rank instances and wider vectors apply. Problems folding to a
+    // single mode keep a second mode of length one.
+    // Returns false if an input has a mode missing from D or of another length.
+    bool makeElementwiseProblem(std::initializer_list<ElementwiseTensor> inputs,
+                                ElementwiseTensor                        output,
+                                ElementwiseProblem&                      problem);
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_TYPES_HPP
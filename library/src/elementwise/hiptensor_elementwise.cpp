@@ -0,0 +1,784 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "api_helpers.hpp"
+#include "data_types.hpp"
+#include "elementwise_solution.hpp"
+#include "elementwise_solution_instances.hpp"
+#include "elementwise_types.hpp"
+#include "handle.hpp"
+#include "logger.hpp"
+
+namespace
+{
+    using PreparedArgs = hiptensor::ElementwiseSolution::PreparedArgs;
+
+    hiptensorStatus_t
+        checkOperation(const char*                                               apiName,
+                       std::initializer_list<const hiptensorTensorDescriptor_t*> inputs,
+                       const hiptensorTensorDescriptor_t*                        descD,
+                       std::initializer_list<hiptensorOperator_t>                binaryOps,
+                       const hipDataType                                         typeScalar)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        auto logNotSupported = [&](const char* message) {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+
+            char msg[512];
+            snprintf(msg, sizeof(msg), "%s (%s)", message, hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        };
+
+        bool sameTypes = descD->mType == HIP_R_16F || descD->mType == HIP_R_32F;
+        bool unaryOps  = true;
+        for(auto desc : inputs)
+        {
+            sameTypes &= desc->mType == descD->mType;
+            unaryOps &= desc->mUnaryOp == HIPTENSOR_OP_IDENTITY
+                        || desc->mUnaryOp == HIPTENSOR_OP_SQRT;
+        }
+
+        bool binaryOpsValid = true;
+        for(auto op : binaryOps)
+        {
+            binaryOpsValid &= op == HIPTENSOR_OP_ADD || op == HIPTENSOR_OP_MUL
+                              || op == HIPTENSOR_OP_MAX || op == HIPTENSOR_OP_MIN;
+        }
+
+        if(!sameTypes)
+        {
+            return logNotSupported("Unsupported Data Type Error : The tensors must all be "
+                                   "HIP_R_16F or all HIP_R_32F");
+        }
+        if(!unaryOps)
+        {
+            return logNotSupported("Unsupported Operator Error : The supported unary operators "
+                                   "are HIPTENSOR_OP_IDENTITY and HIPTENSOR_OP_SQRT");
+        }
+        if(!binaryOpsValid)
+        {
+            return logNotSupported("Unsupported Operator Error : The supported binary operators "
+                                   "are HIPTENSOR_OP_ADD, HIPTENSOR_OP_MUL, HIPTENSOR_OP_MAX "
+                                   "and HIPTENSOR_OP_MIN");
+        }
+        if(typeScalar != HIP_R_16F && typeScalar != HIP_R_32F && typeScalar != HIP_R_64F)
+        {
+            return logNotSupported("Unsupported Data Type Error : The supported data types of "
+                                   "the scalars are HIP_R_16F, HIP_R_32F and HIP_R_64F");
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Selects the first candidate supporting the problem and resolves its arguments
+    hiptensorStatus_t
+        prepareOperation(const char*                                         apiName,
+                         const hiptensorHandle_t*                            handle,
+                         std::initializer_list<hiptensor::ElementwiseTensor> inputs,
+                         hiptensor::ElementwiseTensor                        output,
+                         hiptensor::ElementwiseSolution*&                    solution,
+                         std::unique_ptr<PreparedArgs>&                      args)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        char msg[512];
+
+        hiptensor::ElementwiseProblem problem;
+        if(!hiptensor::makeElementwiseProblem(inputs, output, problem))
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Invalid Mode Error : Every mode of the inputs must be a mode of D of the "
+                     "same extent (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        // Host tensors are computed by the multithreaded CPU solutions
+        auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+        hiptensor::ElementwiseSolutionRegistry* registry
+            = realHandle->isHostBackend()
+                  ? static_cast<hiptensor::ElementwiseSolutionRegistry*>(
+                      hiptensor::ElementwiseCpuReferenceInstances::instance().get())
+                  : hiptensor::ElementwiseSolutionInstances::instance().get();
+
+        for(auto pSolution :
+            registry->query(problem.mType, inputs.size(), problem.mLengths.size()))
+        {
+            if(auto prepared = pSolution->prepareArgs(problem))
+            {
+                solution = pSolution;
+                args     = std::move(prepared);
+                return HIPTENSOR_STATUS_SUCCESS;
+            }
+        }
+
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "No kernels available for this elementwise operation (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError(apiName, msg);
+        return errorCode;
+    }
+
+    float readScalar(const void* scalar, const hipDataType typeScalar)
+    {
+        return hiptensor::readVal<float>(scalar, hiptensor::convertToComputeType(typeScalar));
+    }
+
+    // Runs the solution, with timing if LOG_LEVEL_PERF_TRACE
+    hiptensorStatus_t launchOperation(const char*                            apiName,
+                                      hiptensor::ElementwiseSolution const*  solution,
+                                      PreparedArgs const&                    args,
+                                      hiptensor::ElementwiseOperators const& ops,
+                                      std::vector<void const*> const&        inputs,
+                                      void*                                  D,
+                                      hipStream_t                            stream)
+    {
+        // One scale per input, and one binary operator per input after the first
+        auto flops = (2 * inputs.size() - 1) * args.mSize;
+
+        return hiptensor::launchSolution(
+            apiName,
+            solution,
+            nullptr,
+            flops,
+            args.mBytes,
+            false,
+            stream,
+            [&](StreamConfig const& streamConfig) {
+                return solution->run(args, ops, inputs, D, streamConfig);
+            });
+    }
+}
+
+hiptensorStatus_t hiptensorElementwiseBinary(const hiptensorHandle_t*           handle,
+                                             const void*                        alpha,
+                                             const void*                        A,
+                                             const hiptensorTensorDescriptor_t* descA,
+                                             const int32_t                      modeA[],
+                                             const void*                        gamma,
+                                             const void*                        C,
+                                             const hiptensorTensorDescriptor_t* descC,
+                                             const int32_t                      modeC[],
+                                             void*                              D,
+                                             const hiptensorTensorDescriptor_t* descD,
+                                             const int32_t                      modeD[],
+                                             hiptensorOperator_t                opAC,
+                                             const hipDataType                  typeScalar,
+                                             const hipStream_t                  stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, gamma=%p, C=%p, descC=%p, "
+                 "modeC=%p, D=%p, descD=%p, modeD=%p, opAC=0x%02X, typeScalar=0x%02X, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 gamma,
+                 C,
+                 descC,
+                 modeC,
+                 D,
+                 descD,
+                 modeD,
+                 (unsigned int)opAC,
+                 (unsigned int)typeScalar,
+                 stream);
+
+        logger->logAPITrace("hiptensorElementwiseBinary", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorElementwiseBinary",
+                                                {{"handle", handle},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"gamma", gamma},
+                                                 {"C", C},
+                                                 {"descC", descC},
+                                                 {"modeC", modeC},
+                                                 {"D", D},
+                                                 {"descD", descD},
+                                                 {"modeD", modeD}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode
+       = checkOperation("hiptensorElementwiseBinary", {descA, descC}, descD, {opAC}, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = hiptensor::checkHandleDevice("hiptensorElementwiseBinary", handle);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    hiptensor::ElementwiseSolution* solution = nullptr;
+    std::unique_ptr<PreparedArgs>   args;
+    if(auto errorCode = prepareOperation("hiptensorElementwiseBinary",
+                                         handle,
+                                         {{descA, modeA}, {descC, modeC}},
+                                         {descD, modeD},
+                                         solution,
+                                         args);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    auto ops = hiptensor::ElementwiseOperators{readScalar(alpha, typeScalar),
+                                               0.0F,
+                                               readScalar(gamma, typeScalar),
+                                               descA->mUnaryOp,
+                                               HIPTENSOR_OP_IDENTITY,
+                                               descC->mUnaryOp,
+                                               HIPTENSOR_OP_IDENTITY,
+                                               opAC};
+    return launchOperation("hiptensorElementwiseBinary", solution, *args, ops, {A, C}, D, stream);
+}
+
+hiptensorStatus_t hiptensorElementwiseTrinary(const hiptensorHandle_t*           handle,
+                                              const void*                        alpha,
+                                              const void*                        A,
+                                              const hiptensorTensorDescriptor_t* descA,
+                                              const int32_t                      modeA[],
+                                              const void*                        beta,
+                                              const void*                        B,
+                                              const hiptensorTensorDescriptor_t* descB,
+                                              const int32_t                      modeB[],
+                                              const void*                        gamma,
+                                              const void*                        C,
+                                              const hiptensorTensorDescriptor_t* descC,
+                                              const int32_t                      modeC[],
+                                              void*                              D,
+                                              const hiptensorTensorDescriptor_t* descD,
+                                              const int32_t                      modeD[],
+                                              hiptensorOperator_t                opAB,
+                                              hiptensorOperator_t                opABC,
+                                              const hipDataType                  typeScalar,
+                                              const hipStream_t                  stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, beta=%p, B=%p, descB=%p, "
+                 "modeB=%p, gamma=%p, C=%p, descC=%p, modeC=%p, D=%p, descD=%p, modeD=%p, "
+                 "opAB=0x%02X, opABC=0x%02X, typeScalar=0x%02X, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 beta,
+                 B,
+                 descB,
+                 modeB,
+                 gamma,
+                 C,
+                 descC,
+                 modeC,
+                 D,
+                 descD,
+                 modeD,
+                 (unsigned int)opAB,
+                 (unsigned int)opABC,
+                 (unsigned int)typeScalar,
+                 stream);
+
+        logger->logAPITrace("hiptensorElementwiseTrinary", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorElementwiseTrinary",
+                                                {{"handle", handle},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"beta", beta},
+                                                 {"B", B},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB},
+                                                 {"gamma", gamma},
+                                                 {"C", C},
+                                                 {"descC", descC},
+                                                 {"modeC", modeC},
+                                                 {"D", D},
+                                                 {"descD", descD},
+                                                 {"modeD", modeD}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkOperation(
+           "hiptensorElementwiseTrinary", {descA, descB, descC}, descD, {opAB, opABC}, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = hiptensor::checkHandleDevice("hiptensorElementwiseTrinary", handle);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    hiptensor::ElementwiseSolution* solution = nullptr;
+    std::unique_ptr<PreparedArgs>   args;
+    if(auto errorCode = prepareOperation("hiptensorElementwiseTrinary",
+                                         handle,
+                                         {{descA, modeA}, {descB, modeB}, {descC, modeC}},
+                                         {descD, modeD},
+                                         solution,
+                                         args);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    auto ops = hiptensor::ElementwiseOperators{readScalar(alpha, typeScalar),
+                                               readScalar(beta, typeScalar),
+                                               readScalar(gamma, typeScalar),
+                                               descA->mUnaryOp,
+                                               descB->mUnaryOp,
+                                               descC->mUnaryOp,
+                                               opAB,
+                                               opABC};
+    return launchOperation(
+        "hiptensorElementwiseTrinary", solution, *args, ops, {A, B, C}, D, stream);
+}
+
+hiptensorStatus_t hiptensorInitElementwiseBinaryPlan(const hiptensorHandle_t*           handle,
+                                                     hiptensorElementwisePlan_t*        plan,
+                                                     const hiptensorTensorDescriptor_t* descA,
+                                                     const int32_t                      modeA[],
+                                                     const hiptensorTensorDescriptor_t* descC,
+                                                     const int32_t                      modeC[],
+                                                     const hiptensorTensorDescriptor_t* descD,
+                                                     const int32_t                      modeD[],
+                                                     hiptensorOperator_t                opAC,
+                                                     const hipDataType                  typeScalar)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, plan=%p, descA=%p, modeA=%p, descC=%p, modeC=%p, descD=%p, "
+                 "modeD=%p, opAC=0x%02X, typeScalar=0x%02X",
+                 handle,
+                 plan,
+                 descA,
+                 modeA,
+                 descC,
+                 modeC,
+                 descD,
+                 modeD,
+                 (unsigned int)opAC,
+                 (unsigned int)typeScalar);
+
+        logger->logAPITrace("hiptensorInitElementwiseBinaryPlan", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorInitElementwiseBinaryPlan",
+                                                {{"handle", handle},
+                                                 {"plan", plan},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"descC", descC},
+                                                 {"modeC", modeC},
+                                                 {"descD", descD},
+                                                 {"modeD", modeD}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkOperation(
+           "hiptensorInitElementwiseBinaryPlan", {descA, descC}, descD, {opAC}, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    hiptensor::ElementwiseSolution* solution = nullptr;
+    std::unique_ptr<PreparedArgs>   args;
+    if(auto errorCode = prepareOperation("hiptensorInitElementwiseBinaryPlan",
+                                         handle,
+                                         {{descA, modeA}, {descC, modeC}},
+                                         {descD, modeD},
+                                         solution,
+                                         args);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    plan->mSolution   = solution;
+    plan->mArgs       = std::move(args);
+    plan->mNumInputs  = 2;
+    plan->mOpA        = descA->mUnaryOp;
+    plan->mOpB        = HIPTENSOR_OP_IDENTITY;
+    plan->mOpC        = descC->mUnaryOp;
+    plan->mOpAB       = HIPTENSOR_OP_IDENTITY;
+    plan->mOpABC      = opAC;
+    plan->mTypeScalar = typeScalar;
+    plan->mBackend    = hiptensor::handleBackend(handle);
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorInitElementwiseTrinaryPlan(const hiptensorHandle_t*           handle,
+                                                      hiptensorElementwisePlan_t*        plan,
+                                                      const hiptensorTensorDescriptor_t* descA,
+                                                      const int32_t                      modeA[],
+                                                      const hiptensorTensorDescriptor_t* descB,
+                                                      const int32_t                      modeB[],
+                                                      const hiptensorTensorDescriptor_t* descC,
+                                                      const int32_t                      modeC[],
+                                                      const hiptensorTensorDescriptor_t* descD,
+                                                      const int32_t                      modeD[],
+                                                      hiptensorOperator_t                opAB,
+                                                      hiptensorOperator_t                opABC,
+                                                      const hipDataType                  typeScalar)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, plan=%p, descA=%p, modeA=%p, descB=%p, modeB=%p, descC=%p, "
+                 "modeC=%p, descD=%p, modeD=%p, opAB=0x%02X, opABC=0x%02X, typeScalar=0x%02X",
+                 handle,
+                 plan,
+                 descA,
+                 modeA,
+                 descB,
+                 modeB,
+                 descC,
+                 modeC,
+                 descD,
+                 modeD,
+                 (unsigned int)opAB,
+                 (unsigned int)opABC,
+                 (unsigned int)typeScalar);
+
+        logger->logAPITrace("hiptensorInitElementwiseTrinaryPlan", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorInitElementwiseTrinaryPlan",
+                                                {{"handle", handle},
+                                                 {"plan", plan},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB},
+                                                 {"descC", descC},
+                                                 {"modeC", modeC},
+                                                 {"descD", descD},
+                                                 {"modeD", modeD}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkOperation("hiptensorInitElementwiseTrinaryPlan",
+                                       {descA, descB, descC},
+                                       descD,
+                                       {opAB, opABC},
+                                       typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    hiptensor::ElementwiseSolution* solution = nullptr;
+    std::unique_ptr<PreparedArgs>   args;
+    if(auto errorCode = prepareOperation("hiptensorInitElementwiseTrinaryPlan",
+                                         handle,
+                                         {{descA, modeA}, {descB, modeB}, {descC, modeC}},
+                                         {descD, modeD},
+                                         solution,
+                                         args);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    plan->mSolution   = solution;
+    plan->mArgs       = std::move(args);
+    plan->mNumInputs  = 3;
+    plan->mOpA        = descA->mUnaryOp;
+    plan->mOpB        = descB->mUnaryOp;
+    plan->mOpC        = descC->mUnaryOp;
+    plan->mOpAB       = opAB;
+    plan->mOpABC      = opABC;
+    plan->mTypeScalar = typeScalar;
+    plan->mBackend    = hiptensor::handleBackend(handle);
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+namespace
+{
+    // Checks that the plan is initialized for the given number of inputs, and
+    // that it runs on the backend it was built for and on the current device
+    hiptensorStatus_t checkPlan(const char*                       apiName,
+                                const hiptensorHandle_t*          handle,
+                                const hiptensorElementwisePlan_t* plan,
+                                int32_t                           numInputs)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        if(plan->mSolution == nullptr || !plan->mArgs)
+        {
+            return hiptensor::logPlanNotInitialized(apiName);
+        }
+
+        if(plan->mNumInputs != numInputs)
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Invalid Plan Error : plan has %d inputs, expected %d (%s)",
+                     (int)plan->mNumInputs,
+                     (int)numInputs,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        if(auto errorCode = hiptensor::checkPlanBackend(apiName, handle, plan->mBackend);
+           errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+
+        return hiptensor::checkHandleDevice(apiName, handle);
+    }
+
+    hiptensorStatus_t executePlan(const char*                       apiName,
+                                  const hiptensorElementwisePlan_t* plan,
+                                  hiptensor::ElementwiseOperators   ops,
+                                  std::vector<void const*> const&   inputs,
+                                  void*                             D,
+                                  hipStream_t                       stream)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        auto* pSolution = static_cast<hiptensor::ElementwiseSolution const*>(plan->mSolution);
+        auto* pArgs     = static_cast<PreparedArgs const*>(plan->mArgs.get());
+
+        auto errorCode = launchOperation(apiName, pSolution, *pArgs, ops, inputs, D, stream);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Selected kernel is unable to run the plan (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+        }
+        return errorCode;
+    }
+}
+
+hiptensorStatus_t hiptensorElementwiseBinaryExecute(const hiptensorHandle_t*          handle,
+                                                    const hiptensorElementwisePlan_t* plan,
+                                                    const void*                       alpha,
+                                                    const void*                       A,
+                                                    const void*                       gamma,
+                                                    const void*                       C,
+                                                    void*                             D,
+                                                    const hipStream_t                 stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, plan=%p, alpha=%p, A=%p, gamma=%p, C=%p, D=%p, stream=%p",
+                 handle,
+                 plan,
+                 alpha,
+                 A,
+                 gamma,
+                 C,
+                 D,
+                 stream);
+
+        logger->logAPITrace("hiptensorElementwiseBinaryExecute", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorElementwiseBinaryExecute",
+                                                {{"handle", handle},
+                                                 {"plan", plan},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"gamma", gamma},
+                                                 {"C", C},
+                                                 {"D", D}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkPlan("hiptensorElementwiseBinaryExecute", handle, plan, 2);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    auto ops = hiptensor::ElementwiseOperators{readScalar(alpha, plan->mTypeScalar),
+                                               0.0F,
+                                               readScalar(gamma, plan->mTypeScalar),
+                                               plan->mOpA,
+                                               plan->mOpB,
+                                               plan->mOpC,
+                                               plan->mOpAB,
+                                               plan->mOpABC};
+    return executePlan("hiptensorElementwiseBinaryExecute", plan, ops, {A, C}, D, stream);
+}
+
+hiptensorStatus_t hiptensorElementwiseTrinaryExecute(const hiptensorHandle_t*          handle,
+                                                     const hiptensorElementwisePlan_t* plan,
+                                                     const void*                       alpha,
+                                                     const void*                       A,
+                                                     const void*                       beta,
+                                                     const void*                       B,
+                                                     const void*                       gamma,
+                                                     const void*                       C,
+                                                     void*                             D,
+                                                     const hipStream_t                 stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, plan=%p, alpha=%p, A=%p, beta=%p, B=%p, gamma=%p, C=%p, D=%p, "
+                 "stream=%p",
+                 handle,
+                 plan,
+                 alpha,
+                 A,
+                 beta,
+                 B,
+                 gamma,
+                 C,
+                 D,
+                 stream);
+
+        logger->logAPITrace("hiptensorElementwiseTrinaryExecute", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorElementwiseTrinaryExecute",
+                                                {{"handle", handle},
+                                                 {"plan", plan},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"beta", beta},
+                                                 {"B", B},
+                                                 {"gamma", gamma},
+                                                 {"C", C},
+                                                 {"D", D}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkPlan("hiptensorElementwiseTrinaryExecute", handle, plan, 3);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    auto ops = hiptensor::ElementwiseOperators{readScalar(alpha, plan->mTypeScalar),
+                                               readScalar(beta, plan->mTypeScalar),
+                                               readScalar(gamma, plan->mTypeScalar),
+                                               plan->mOpA,
+                                               plan->mOpB,
+                                               plan->mOpC,
+                                               plan->mOpAB,
+                                               plan->mOpABC};
+    return executePlan("hiptensorElementwiseTrinaryExecute", plan, ops, {A, B, C}, D, stream);
+}
@@ -25,9 +25,27 @@
  *******************************************************************************/
 
 #include "handle.hpp"
+#include "hiptensor_options.hpp"
 
 namespace hiptensor
 {
+    Handle::Handle()
+        : mDevice(nullptr)
+        , mBackend(HIPTENSOR_BACKEND_GPU)
+    {
+        // Without a device, only the host backend is usable
+        int deviceCount = 0;
+        if(hipGetDeviceCount(&deviceCount) == hipSuccess && deviceCount > 0)
+        {
+            mDevice = &HipDevice::cached(HipDevice::currentDeviceId());
+        }
+
+        if(!setBackend(HiptensorOptions::instance()->defaultBackend()))
+        {
+            mBackend = HIPTENSOR_BACKEND_AUTO;
+        }
+    }
+
     Handle Handle::createHandle(int64_t* buff)
     {
         auto handle = toHandle(buff);
@@ -47,9 +65,36 @@ namespace hiptensor
         return reinterpret_cast<Handle*>(buff);
     }
 
-    HipDevice Handle::getDevice()
+    HipDevice const& Handle::getDevice() const
+    {
+        return *mDevice;
+    }
+
+    bool Handle::hasDevice() const
+    {
+        return mDevice != nullptr;
+    }
+
+    hiptensorBackend_t Handle::getBackend() const
+    {
+        return mBackend;
+    }
+
+    bool Handle::setBackend(hiptensorBackend_t backend)
+    {
+        if(backend == HIPTENSOR_BACKEND_GPU && !hasDevice())
+        {
+            return false;
+        }
+
+        mBackend = backend;
+        return true;
+    }
+
+    bool Handle::isHostBackend() const
     {
-        return mDevice;
+        return mBackend == HIPTENSOR_BACKEND_CPU
+               || (mBackend == HIPTENSOR_BACKEND_AUTO && !hasDevice());
     }
 
 } // namespace hiptensor
@@ -24,20 +24,27 @@
  *
  *******************************************************************************/
 
+#include <memory>
+#include <mutex>
+
 #include "hip_device.hpp"
 #include <hiptensor/internal/hiptensor_utility.hpp>
 
 namespace hiptensor
 {
     HipDevice::HipDevice()
-        : mDeviceId(-1)
+        : HipDevice(currentDeviceId())
+    {
+    }
+
+    HipDevice::HipDevice(hipDevice_t deviceId)
+        : mDeviceId(deviceId)
         , mGcnArch(hipGcnArch_t::UNSUPPORTED_ARCH)
         , mWarpSize(hipWarpSize_t::UNSUPPORTED_WARP_SIZE)
         , mSharedMemSize(0)
         , mCuCount(0)
         , mMaxFreqMhz(0)
     {
-        CHECK_HIP_ERROR(hipGetDevice(&mDeviceId));
         CHECK_HIP_ERROR(hipGetDeviceProperties(&mProps, mDeviceId));
 
         mArch = mProps.arch;
@@ -77,12 +84,53 @@ namespace hiptensor
         mMaxFreqMhz    = static_cast<int>(static_cast<double>(mProps.clockRate) / 1000.0);
     }
 
+    /* static */
+    HipDevice const& HipDevice::cached(hipDevice_t deviceId)
+    {
+        // One lazily constructed entry per visible device
+        struct DeviceCache
+        {
+            DeviceCache()
+            {
+                CHECK_HIP_ERROR(hipGetDeviceCount(&mCount));
+                mOnceFlags = std::make_unique<std::once_flag[]>(mCount);
+                mDevices   = std::make_unique<std::unique_ptr<HipDevice>[]>(mCount);
+            }
+
+            int                                           mCount = 0;
+            std::unique_ptr<std::once_flag[]>             mOnceFlags;
+            std::unique_ptr<std::unique_ptr<HipDevice>[]> mDevices;
+        };
+
+        static DeviceCache sCache;
+
+        if(deviceId < 0 || deviceId >= sCache.mCount)
+        {
+            std::cerr << "Invalid HIP device id: " << deviceId << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        std::call_once(sCache.mOnceFlags[deviceId], [deviceId]() {
+            sCache.mDevices[deviceId] = std::make_unique<HipDevice>(deviceId);
+        });
+
+        return *sCache.mDevices[deviceId];
+    }
+
+    /* static */
+    hipDevice_t HipDevice::currentDeviceId()
+    {
+        hipDevice_t deviceId = -1;
+        CHECK_HIP_ERROR(hipGetDevice(&deviceId));
+        return deviceId;
+    }
+
     hipDevice_t HipDevice::getDeviceId() const
     {
         return mDeviceId;
     }
 
-    hipDeviceProp_t HipDevice::getDeviceProps() const
+    hipDeviceProp_t const& HipDevice::getDeviceProps() const
     {
         return mProps;
     }
@@ -131,7 +179,14 @@ namespace hiptensor
     {
         static bool testSupportedDevice()
         {
-            auto device = HipDevice();
+            // Without a device, the library can still run on the host backend
+            int deviceCount = 0;
+            if(hipGetDeviceCount(&deviceCount) != hipSuccess || deviceCount == 0)
+            {
+                return false;
+            }
+
+            auto& device = HipDevice::cached(HipDevice::currentDeviceId());
 
             if((device.getGcnArch() == HipDevice::hipGcnArch_t::UNSUPPORTED_ARCH)
                || (device.warpSize() == HipDevice::hipWarpSize_t::UNSUPPORTED_WARP_SIZE))
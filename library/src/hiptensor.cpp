@@ -40,9 +40,15 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle)
 
     // Log API access
     char msg[128];
-    snprintf(
-        msg, sizeof(msg), "handle=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)handle);
-    logger->logAPITrace("hiptensorCreate", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=0x%0*llX",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)handle);
+        logger->logAPITrace("hiptensorCreate", msg);
+    }
 
     (*handle) = new hiptensorHandle_t;
 
@@ -79,7 +85,8 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle)
         return HIPTENSOR_STATUS_INVALID_VALUE;
     }
 
-    // Get the current device (handled by the Handle class)
+    // Get the current device (handled by the Handle class).
+    // hipErrorNoDevice is not an error here: the handle then runs on the host backend.
     auto realHandle = hiptensor::Handle::createHandle((*handle)->fields);
 
     return HIPTENSOR_STATUS_SUCCESS;
@@ -92,9 +99,15 @@ hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle)
 
     // Log API access
     char msg[128];
-    snprintf(
-        msg, sizeof(msg), "handle=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)handle);
-    logger->logAPITrace("hiptensorDestroy", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=0x%0*llX",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)handle);
+        logger->logAPITrace("hiptensorDestroy", msg);
+    }
 
     hiptensor::Handle::destroyHandle(handle->fields);
 
@@ -104,6 +117,97 @@ hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle)
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
+hiptensorStatus_t hiptensorSetBackend(hiptensorHandle_t* handle, hiptensorBackend_t backend)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=0x%0*llX, backend=0x%02X",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)handle,
+                 (unsigned int)backend);
+        logger->logAPITrace("hiptensorSetBackend", msg);
+    }
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetBackend", msg);
+        return errorCode;
+    }
+
+    if(backend != HIPTENSOR_BACKEND_GPU && backend != HIPTENSOR_BACKEND_CPU
+       && backend != HIPTENSOR_BACKEND_AUTO)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(
+            msg, sizeof(msg), "Invalid Backend Value (%s)", hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetBackend", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle(handle->fields);
+    if(!realHandle->setBackend(backend))
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "GPU backend requested but no device is present (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetBackend", msg);
+        return errorCode;
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorGetBackend(const hiptensorHandle_t* handle,
+                                      hiptensorBackend_t*      backend)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=0x%0*llX, backend=0x%llX",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)handle,
+                 (unsigned long long)backend);
+        logger->logAPITrace("hiptensorGetBackend", msg);
+    }
+
+    if(handle == nullptr || backend == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "backend",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorGetBackend", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    *backend        = realHandle->getBackend();
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     handle,
                                                 hiptensorTensorDescriptor_t* desc,
                                                 const uint32_t               numModes,
@@ -117,19 +221,22 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
 
     // Log API access
     char msg[256];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, desc=0x%llX, numModes=0x%02X, lens=0x%llX, strides=0x%llX,"
-             "dataType=0x%02X, unaryOp=0x%02X",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)desc,
-             (unsigned int)numModes,
-             (unsigned long long)lens,
-             (unsigned long long)strides,
-             (unsigned int)dataType,
-             (unsigned int)unaryOp);
-    logger->logAPITrace("hiptensorInitTensorDescriptor", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=0x%0*llX, desc=0x%llX, numModes=0x%02X, lens=0x%llX, strides=0x%llX,"
+                 "dataType=0x%02X, unaryOp=0x%02X",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)handle,
+                 (unsigned long long)desc,
+                 (unsigned int)numModes,
+                 (unsigned long long)lens,
+                 (unsigned long long)strides,
+                 (unsigned int)dataType,
+                 (unsigned int)unaryOp);
+        logger->logAPITrace("hiptensorInitTensorDescriptor", msg);
+    }
 
     if(handle == nullptr || desc == nullptr)
     {
@@ -184,7 +291,8 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
     }
 
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
-    if(dataType == HIP_R_64F && !realHandle->getDevice().supportsF64())
+    if(dataType == HIP_R_64F && !realHandle->isHostBackend()
+       && !realHandle->getDevice().supportsF64())
     {
         return HIPTENSOR_STATUS_ARCH_MISMATCH;
     }
@@ -226,8 +334,12 @@ const char* hiptensorGetErrorString(const hiptensorStatus_t error)
 
     // Log API access
     char msg[128];
-    snprintf(msg, sizeof(msg), "error=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)error);
-    logger->logAPITrace("hiptensorGetErrorString", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(
+            msg, sizeof(msg), "error=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)error);
+        logger->logAPITrace("hiptensorGetErrorString", msg);
+    }
 
     if(error == HIPTENSOR_STATUS_SUCCESS)
         return "HIPTENSOR_STATUS_SUCCESS";
@@ -269,16 +381,19 @@ hiptensorStatus_t hiptensorGetAlignmentRequirement(const hiptensorHandle_t*
 
     // Log API access
     char msg[256];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, ptr=0x%llX, desc=0x%llX, alignmentRequirement=0x%02X",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)ptr,
-             (unsigned long long)desc,
-             (unsigned int)*alignmentRequirement);
-
-    logger->logAPITrace("hiptensorGetAlignmentRequirement", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=0x%0*llX, ptr=0x%llX, desc=0x%llX, alignmentRequirement=0x%02X",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)handle,
+                 (unsigned long long)ptr,
+                 (unsigned long long)desc,
+                 (unsigned int)*alignmentRequirement);
+
+        logger->logAPITrace("hiptensorGetAlignmentRequirement", msg);
+    }
 
     if(!handle || !desc)
     {
@@ -333,12 +448,15 @@ hiptensorStatus_t hiptensorLoggerSetCallback(hiptensorLoggerCallback_t callback)
 
     // Log API access
     char msg[128];
-    snprintf(msg,
-             sizeof(msg),
-             "callback=0x%0*llX",
-             2 * (int)sizeof(void*),
-             (unsigned long long)callback);
-    logger->logAPITrace("hiptensorLoggerSetCallback", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "callback=0x%0*llX",
+                 2 * (int)sizeof(void*),
+                 (unsigned long long)callback);
+        logger->logAPITrace("hiptensorLoggerSetCallback", msg);
+    }
 
     // Check logger callback result
     auto loggerResult = logger->setCallback(callback);
@@ -362,8 +480,12 @@ hiptensorStatus_t hiptensorLoggerSetFile(FILE* file)
 
     // Log API access
     char msg[128];
-    snprintf(msg, sizeof(msg), "file=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)file);
-    logger->logAPITrace("hiptensorLoggerSetFile", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(
+            msg, sizeof(msg), "file=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)file);
+        logger->logAPITrace("hiptensorLoggerSetFile", msg);
+    }
 
     // Check logger callback result
     auto loggerResult = logger->writeToStream(file);
@@ -387,8 +509,11 @@ hiptensorStatus_t hiptensorLoggerOpenFile(const char* logFile)
 
     // Log API trace
     char msg[2048];
-    snprintf(msg, sizeof(msg), "logFile=%s", logFile);
-    logger->logAPITrace("hiptensorLoggerOpenFile", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg, sizeof(msg), "logFile=%s", logFile);
+        logger->logAPITrace("hiptensorLoggerOpenFile", msg);
+    }
 
     // Check logger open file result
     auto loggerResult = logger->openFileStream(logFile);
@@ -409,8 +534,11 @@ hiptensorStatus_t hiptensorLoggerSetLevel(hiptensorLogLevel_t level)
 
     // Log API trace
     char msg[128];
-    snprintf(msg, sizeof(msg), "log level=0x%02X", (unsigned int)level);
-    logger->logAPITrace("hiptensorLoggerSetLevel", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg, sizeof(msg), "log level=0x%02X", (unsigned int)level);
+        logger->logAPITrace("hiptensorLoggerSetLevel", msg);
+    }
 
     // Check logger level
     auto loggerResult = logger->setLogLevel(Logger::LogLevel_t(level));
@@ -435,8 +563,11 @@ hiptensorStatus_t hiptensorLoggerSetMask(int32_t mask)
 
     // Log API trace
     char msg[128];
-    snprintf(msg, sizeof(msg), "mask=0x%02X", (unsigned int)mask);
-    logger->logAPITrace("hiptensorLoggerSetMask", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg, sizeof(msg), "mask=0x%02X", (unsigned int)mask);
+        logger->logAPITrace("hiptensorLoggerSetMask", msg);
+    }
 
     // Check for logger error
     auto loggerResult = logger->setLogMask(mask);
@@ -42,6 +42,8 @@ namespace hiptensor
         , mInputFilename("")
         , mOutputFilename("")
         , mColMajorStrides(HIPTENSOR_DEFAULT_STRIDES_COL_MAJOR)
+        , mDefaultBackend(HIPTENSOR_BACKEND_AUTO)
+        , mGoldenCacheDir("")
     {
         // Override HIPTENSOR_DEFAULT_STRIDES_COL_MAJOR with environment variable if present
         if(const char* stride_env = std::getenv("HIPTENSOR_DEFAULT_STRIDES_COL_MAJOR"))
@@ -57,6 +59,31 @@ namespace hiptensor
                 mColMajorStrides = false;
             }
         }
+
+        // Directory of the validation golden-result cache, disabled if empty
+        if(const char* cache_env = std::getenv("HIPTENSOR_GOLDEN_CACHE_DIR"))
+        {
+            mGoldenCacheDir = cache_env;
+        }
+
+        // Initial backend of new handles
+        if(const char* backend_env = std::getenv("HIPTENSOR_DEFAULT_BACKEND"))
+        {
+            std::string upper = backend_env;
+            std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+            if(upper.compare("GPU") == 0)
+            {
+                mDefaultBackend = HIPTENSOR_BACKEND_GPU;
+            }
+            else if(upper.compare("CPU") == 0)
+            {
+                mDefaultBackend = HIPTENSOR_BACKEND_CPU;
+            }
+            else if(upper.compare("AUTO") == 0)
+            {
+                mDefaultBackend = HIPTENSOR_BACKEND_AUTO;
+            }
+        }
     }
 
     void HiptensorOptions::setOstream(std::string file)
@@ -141,6 +168,11 @@ namespace hiptensor
         mOutputFilename = file;
     }
 
+    void HiptensorOptions::setGoldenCacheDir(std::string dir)
+    {
+        mGoldenCacheDir = dir;
+    }
+
     HiptensorOStream& HiptensorOptions::ostream()
     {
         return mOstream;
@@ -186,6 +218,11 @@ namespace hiptensor
         return mColdRuns;
     }
 
+    hiptensorBackend_t HiptensorOptions::defaultBackend()
+    {
+        return mDefaultBackend;
+    }
+
     std::string HiptensorOptions::inputFilename()
     {
         return mInputFilename;
@@ -196,6 +233,11 @@ namespace hiptensor
         return mOutputFilename;
     }
 
+    std::string HiptensorOptions::goldenCacheDir()
+    {
+        return mGoldenCacheDir;
+    }
+
     bool HiptensorOptions::isColMajorStrides()
     {
         return mColMajorStrides;
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_API_HELPERS_HPP
+#define HIPTENSOR_API_HELPERS_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+// CK includes
+#include <ck/stream_config.hpp>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "hiptensor_options.hpp"
+#include "logger.hpp"
+#include "performance.hpp"
+
+namespace hiptensor
+{
+    // @cond
+    // Argument checks and kernel launches shared by the permutation and
+    // elementwise API entry points.
+
+    // Logs every missing parameter of an API call. Returns
+    // HIPTENSOR_STATUS_NOT_INITIALIZED if any of them is nullptr.
+    hiptensorStatus_t
+        checkNotNull(const char*                                                  apiName,
+                     std::initializer_list<std::pair<const char*, const void*>> params);
+
+    // Ensures the current HIP device is the device of the handle, unless the
+    // handle runs on the host
+    hiptensorStatus_t checkHandleDevice(const char* apiName, const hiptensorHandle_t* handle);
+
+    // Logs an execution of a plan that was not initialized
+    hiptensorStatus_t logPlanNotInitialized(const char* apiName);
+
+    // Backend that the operations of the handle run on: HIPTENSOR_BACKEND_CPU or
+    // HIPTENSOR_BACKEND_GPU, with HIPTENSOR_BACKEND_AUTO resolved
+    hiptensorBackend_t handleBackend(const hiptensorHandle_t* handle);
+
+    // Ensures a plan runs on the backend it was built for, so that host solutions
+    // never see device pointers nor device kernels host pointers. Returns
+    // HIPTENSOR_STATUS_INVALID_VALUE on a mismatch.
+    hiptensorStatus_t checkPlanBackend(const char*              apiName,
+                                       const hiptensorHandle_t* handle,
+                                       hiptensorBackend_t       planBackend);
+
+    // Logs the performance metrics of a kernel run
+    void logKernelPerformance(const char* apiName, PerfMetrics const& metrics);
+
+    // Runs a solution, with timing if LOG_LEVEL_PERF_TRACE. run(streamConfig)
+    // returns the time in ms, or a negative value on failure. solution may be
+    // nullptr for kernels without one, which are traced as name. Kernels that
+    // change their input are timed by a single run.
+    template <typename Solution, typename RunFunc>
+    hiptensorStatus_t launchSolution(const char*     apiName,
+                                     Solution const* solution,
+                                     const char*     name,
+                                     std::size_t     flops,
+                                     std::size_t     bytes,
+                                     bool            singleRun,
+                                     hipStream_t     stream,
+                                     RunFunc&&       run)
+    {
+        auto& logger = Logger::instance();
+
+        if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+        {
+            auto& options = HiptensorOptions::instance();
+
+            auto time = run(StreamConfig{
+                stream, // stream id
+                true, // time_kernel
+                0, // log_level
+                singleRun ? 0 : options->coldRuns(), // cold_niters
+                singleRun ? 1 : options->hotRuns(), // nrepeat
+            });
+            if(time < 0)
+            {
+                return HIPTENSOR_STATUS_CK_ERROR;
+            }
+
+            logKernelPerformance(
+                apiName,
+                {
+                    solution != nullptr ? solution->uid() : 0, // id
+                    solution != nullptr ? solution->kernelName() : name, // name
+                    time, // avg time
+                    static_cast<float>(flops) / static_cast<float>(1.E9) / time, // tflops
+                    static_cast<float>(bytes) / static_cast<float>(1.E6) / time // BW
+                });
+        }
+        // Perform the operation without timing
+        else if(run(StreamConfig{stream, false}) < 0)
+        {
+            return HIPTENSOR_STATUS_CK_ERROR;
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_API_HELPERS_HPP
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CPU_TYPE_CONVERT_HPP
+#define HIPTENSOR_CPU_TYPE_CONVERT_HPP
+
+#include <cstdint>
+
+namespace hiptensor
+{
+    // @cond
+    // Bulk host conversions between the 16-bit floating point storage types and f32,
+    // used to convert whole blocks of operands at once instead of element by element.
+    // Half values are IEEE binary16 bit patterns and bf16 values are the upper 16 bits
+    // of an f32, which matches the layout of ck::half_t and ck::bhalf_t.
+    // The kernels use F16C and AVX2 when the host supports them.
+
+    // Widens count half values to f32. The conversion is exact.
+    void cpuHalfToFloat(uint16_t const* src, float* dst, int64_t count);
+
+    // Widens count bf16 values to f32. The conversion is exact.
+    void cpuBhalfToFloat(uint16_t const* src, float* dst, int64_t count);
+
+    // Rounds count f32 values to the nearest half, ties to even, and widens them back.
+    // Matches the f32 to half conversion of ck::type_convert.
+    void cpuRoundToHalf(float const* src, float* dst, int64_t count);
+
+    // Rounds count f32 values to the nearest bf16, ties to even, and widens them back.
+    // Matches the f32 to bf16 conversion of ck::type_convert, including the handling
+    // of NaN payloads that would otherwise be truncated to infinity.
+    void cpuRoundToBhalf(float const* src, float* dst, int64_t count);
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CPU_TYPE_CONVERT_HPP
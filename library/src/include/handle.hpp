@@ -31,6 +31,8 @@
 
 #include <hip/hip_runtime_api.h>
 
+#include <hiptensor/hiptensor_types.hpp>
+
 #include "hip_device.hpp"
 
 namespace hiptensor
@@ -39,17 +41,31 @@ namespace hiptensor
     struct Handle
     {
     public:
-        Handle()  = default;
+        Handle();
         ~Handle() = default;
 
         static Handle  createHandle(int64_t* buff); // Calls constructor for all member variables
         static void    destroyHandle(int64_t* buff); // Calls destructor for all member variables
         static Handle* toHandle(int64_t* buff); // Reinterprets input buffer as Handle class
 
-        HipDevice getDevice();
+        HipDevice const& getDevice() const;
+
+        // Whether a HIP device was present at creation
+        bool hasDevice() const;
+
+        hiptensorBackend_t getBackend() const;
+
+        // Returns false if the backend needs a device that is not present
+        bool setBackend(hiptensorBackend_t backend);
+
+        // Whether operations on this handle run the host solutions
+        bool isHostBackend() const;
 
     private:
-        HipDevice mDevice;
+        // Cached properties of the device that was current at creation,
+        // or nullptr if no device is present.
+        HipDevice const*   mDevice;
+        hiptensorBackend_t mBackend;
     };
 } // namespace hiptensor
 
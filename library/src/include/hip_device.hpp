@@ -51,10 +51,18 @@ namespace hiptensor
         };
 
         HipDevice();
+        explicit HipDevice(hipDevice_t deviceId);
         ~HipDevice() = default;
 
-        hipDevice_t     getDeviceId() const;
-        hipDeviceProp_t getDeviceProps() const;
+        // Process-wide cached properties of the given device, queried
+        // from the driver only once per device id.
+        static HipDevice const& cached(hipDevice_t deviceId);
+
+        // Id of the current HIP device, without querying its properties.
+        static hipDevice_t currentDeviceId();
+
+        hipDevice_t            getDeviceId() const;
+        hipDeviceProp_t const& getDeviceProps() const;
         hipDeviceArch_t getDeviceArch() const;
         hipGcnArch_t    getGcnArch() const;
 
@@ -29,6 +29,8 @@
 
 #include <stdlib.h>
 
+#include <hiptensor/hiptensor_types.hpp>
+
 #include "hiptensor_ostream.hpp"
 #include "singleton.hpp"
 
@@ -57,6 +59,7 @@ namespace hiptensor
         void setColdRuns(int runs);
         void setInputYAMLFilename(std::string file);
         void setOutputStreamFilename(std::string file);
+        void setGoldenCacheDir(std::string dir);
 
         HiptensorOStream& ostream();
 
@@ -71,8 +74,11 @@ namespace hiptensor
         int32_t hotRuns();
         int32_t coldRuns();
 
+        hiptensorBackend_t defaultBackend();
+
         std::string inputFilename();
         std::string outputFilename();
+        std::string goldenCacheDir();
 
     protected:
         HiptensorOStream mOstream;
@@ -84,7 +90,10 @@ namespace hiptensor
 
         int32_t mHotRuns, mColdRuns;
 
+        hiptensorBackend_t mDefaultBackend;
+
         std::string mInputFilename, mOutputFilename;
+        std::string mGoldenCacheDir;
     };
 
 } // namespace hiptensor
@@ -29,6 +29,7 @@
 
 #include "singleton.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace hiptensor
@@ -69,6 +70,7 @@ namespace hiptensor
         Status_t openFileStream(const char* fileName);
         Status_t setCallback(Callback_t callbackFunc);
         int32_t  getLogMask() const;
+        bool     isEnabled(LogLevel_t level) const;
         Status_t setLogMask(int32_t mask);
         Status_t setLogLevel(LogLevel_t level);
         void     disable();
@@ -77,6 +79,7 @@ namespace hiptensor
         Status_t logMessage(int32_t context, const char* apiFuncName, const char* message);
         Status_t logError(const char* apiFuncName, const char* message);
         Status_t logPerformanceTrace(const char* apiFuncName, const char* message);
+        Status_t logPerformanceHint(const char* apiFuncName, const char* message);
         Status_t logHeuristics(const char* apiFuncName, const char* message);
         Status_t logAPITrace(const char* apiFuncName, const char* message);
 
@@ -89,10 +92,11 @@ namespace hiptensor
         static const char* contextString(LogLevel_t context);
 
     private:
-        bool mEnabled;
-        bool mOwnsStream;
+        // Read without the lock on every API call to skip disabled levels
+        std::atomic<bool>    mEnabled;
+        bool                 mOwnsStream;
+        std::atomic<int32_t> mLogMask;
 
-        int32_t    mLogMask;
         FILE*      mWriteStream;
         Callback_t mCallback;
 
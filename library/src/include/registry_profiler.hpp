@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_REGISTRY_PROFILER_HPP
+#define HIPTENSOR_REGISTRY_PROFILER_HPP
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    struct RegistryInitMetrics
+    {
+        std::string mRegistryName; /*!< Name of the solution registry */
+        float       mInitTimeMs; /*!< Registry construction time in milli-seconds */
+        std::size_t mSolutionCount; /*!< Number of solutions held by the registry */
+        std::size_t mHostBytes; /*!< Approximate host memory held by the registry in bytes */
+    };
+
+    // @cond
+    // Collects the construction metrics of the lazily created solution registries,
+    // so that the cost of library startup can be queried and traced.
+    class RegistryProfiler : public LazySingleton<RegistryProfiler>
+    {
+    public:
+        // Times a registry constructor from creation until finish() is called.
+        class ScopedTimer
+        {
+        public:
+            explicit ScopedTimer(const char* registryName);
+
+            // Records the metrics of the fully constructed registry
+            void finish(std::size_t solutionCount, std::size_t hostBytes);
+
+        private:
+            const char*                           mRegistryName;
+            std::chrono::steady_clock::time_point mStart;
+        };
+
+        // Records the metrics of one registry, and traces them
+        // if HIPTENSOR_LOG_LEVEL_PERF_TRACE is enabled.
+        void record(RegistryInitMetrics const& metrics);
+
+        // Metrics of all registries constructed so far, in construction order
+        std::vector<RegistryInitMetrics> metrics() const;
+
+        // Host storage helpers for registry containers
+        template <typename T>
+        static std::size_t containerBytes(std::vector<T> const& container)
+        {
+            return container.capacity() * sizeof(T);
+        }
+
+        template <typename Key, typename T>
+        static std::size_t containerBytes(std::unordered_map<Key, T> const& container)
+        {
+            // One node per element plus the bucket array
+            using Node = std::pair<void*, typename std::unordered_map<Key, T>::value_type>;
+            return container.size() * sizeof(Node) + container.bucket_count() * sizeof(void*);
+        }
+
+    private:
+        mutable std::mutex               mMutex;
+        std::vector<RegistryInitMetrics> mMetrics;
+    };
+    // @endcond
+
+} // namespace hiptensor
+
+namespace std
+{
+    ostream& operator<<(std::ostream& os, hiptensor::RegistryInitMetrics const& metrics);
+} // namespace std
+
+#endif // HIPTENSOR_REGISTRY_PROFILER_HPP
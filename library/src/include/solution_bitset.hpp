@@ -0,0 +1,311 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#ifndef HIPTENSOR_SOLUTION_BITSET_HPP
+#define HIPTENSOR_SOLUTION_BITSET_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace hiptensor
+{
+    // @cond
+    // Bitset with word-level access, allowing cheap iteration over set bits.
+    // Sized by the registry when it is frozen, so it holds any number of
+    // solutions. Bits past the end read as unset.
+    class SolutionBitset
+    {
+    public:
+        using Word = uint64_t;
+
+        static constexpr uint32_t WordBits = 64u;
+
+        // Sentinel returned when no further bits are set
+        static constexpr uint32_t npos = ~0u;
+
+        SolutionBitset() = default;
+
+        explicit SolutionBitset(uint32_t numBits)
+            : mWords((numBits + WordBits - 1u) / WordBits, Word(0))
+        {
+        }
+
+        void set(uint32_t pos)
+        {
+            if(pos / WordBits >= mWords.size())
+            {
+                mWords.resize(pos / WordBits + 1u, Word(0));
+            }
+            mWords[pos / WordBits] |= (Word(1) << (pos % WordBits));
+        }
+
+        bool test(uint32_t pos) const
+        {
+            return pos / WordBits < mWords.size()
+                   && ((mWords[pos / WordBits] >> (pos % WordBits)) & Word(1));
+        }
+
+        // Sets exactly the first count bits
+        void setFirst(uint32_t count)
+        {
+            mWords.assign((count + WordBits - 1u) / WordBits, ~Word(0));
+            if(count % WordBits != 0u)
+            {
+                mWords.back() = (Word(1) << (count % WordBits)) - Word(1);
+            }
+        }
+
+        uint32_t count() const
+        {
+            return countWords(mWords.data(), mWords.size());
+        }
+
+        // Position of the first set bit at or after pos, or npos
+        uint32_t findNext(uint32_t pos) const
+        {
+            return findNextInWords(mWords.data(), mWords.size(), pos);
+        }
+
+        uint32_t findFirst() const
+        {
+            return findNext(0u);
+        }
+
+        // Host memory held by the words
+        std::size_t bytes() const
+        {
+            return mWords.capacity() * sizeof(Word);
+        }
+
+        Word const* data() const
+        {
+            return mWords.data();
+        }
+
+        uint32_t wordCount() const
+        {
+            return mWords.size();
+        }
+
+        // Word-level helpers shared with SolutionBitsetView
+        static uint32_t countWords(Word const* words, uint32_t wordCount)
+        {
+            uint32_t result = 0;
+            for(uint32_t i = 0; i < wordCount; i++)
+            {
+                result += __builtin_popcountll(words[i]);
+            }
+            return result;
+        }
+
+        static uint32_t findNextInWords(Word const* words, uint32_t wordCount, uint32_t pos)
+        {
+            auto wordIdx = pos / WordBits;
+            if(pos == npos || wordIdx >= wordCount)
+            {
+                return npos;
+            }
+
+            auto word = words[wordIdx] & (~Word(0) << (pos % WordBits));
+            while(true)
+            {
+                if(word != Word(0))
+                {
+                    return wordIdx * WordBits + __builtin_ctzll(word);
+                }
+                if(++wordIdx == wordCount)
+                {
+                    return npos;
+                }
+                word = words[wordIdx];
+            }
+        }
+
+    private:
+        std::vector<Word> mWords;
+    };
+
+    // Read-only solution mask of a query. Views a bitset owned elsewhere, such
+    // as the frozen category bitsets of a registry, without copying its words.
+    // Unions and intersections keep their words inline, so that combining
+    // queries does not allocate unless a mask exceeds InlineWords words.
+    class SolutionBitsetView
+    {
+    public:
+        using Word = SolutionBitset::Word;
+
+        static constexpr uint32_t WordBits = SolutionBitset::WordBits;
+        static constexpr uint32_t npos     = SolutionBitset::npos;
+
+        // Inline capacity, in words of 64 solutions
+        static constexpr uint32_t InlineWords = 64u;
+
+        SolutionBitsetView() = default;
+
+        // Views the words of bits, which must outlive the view
+        explicit SolutionBitsetView(SolutionBitset const& bits)
+            : mWords(bits.data())
+            , mWordCount(bits.wordCount())
+        {
+        }
+
+        // Owns numBits cleared bits
+        explicit SolutionBitsetView(uint32_t numBits)
+        {
+            auto wordCount = (numBits + WordBits - 1u) / WordBits;
+            std::fill_n(allocate(wordCount), wordCount, Word(0));
+        }
+
+        // Views are shared, owned words are copied into the inline storage
+        SolutionBitsetView(SolutionBitsetView const& other)
+        {
+            *this = other;
+        }
+
+        SolutionBitsetView& operator=(SolutionBitsetView const& other)
+        {
+            if(this == &other)
+            {
+                return *this;
+            }
+
+            if(other.ownsWords())
+            {
+                std::copy_n(other.mWords, other.mWordCount, allocate(other.mWordCount));
+            }
+            else
+            {
+                mWords     = other.mWords;
+                mWordCount = other.mWordCount;
+            }
+            return *this;
+        }
+
+        static SolutionBitsetView unite(SolutionBitsetView const& lhs,
+                                        SolutionBitsetView const& rhs)
+        {
+            SolutionBitsetView result;
+            auto* words = result.allocate(std::max(lhs.mWordCount, rhs.mWordCount));
+            for(uint32_t i = 0; i < result.mWordCount; i++)
+            {
+                words[i] = lhs.word(i) | rhs.word(i);
+            }
+            return result;
+        }
+
+        static SolutionBitsetView intersect(SolutionBitsetView const& lhs,
+                                            SolutionBitsetView const& rhs)
+        {
+            SolutionBitsetView result;
+            auto* words = result.allocate(std::min(lhs.mWordCount, rhs.mWordCount));
+            for(uint32_t i = 0; i < result.mWordCount; i++)
+            {
+                words[i] = lhs.mWords[i] & rhs.mWords[i];
+            }
+            return result;
+        }
+
+        // Only valid for owned words, positions past the end are ignored
+        void set(uint32_t pos)
+        {
+            if(ownsWords() && pos / WordBits < mWordCount)
+            {
+                ownedWords()[pos / WordBits] |= (Word(1) << (pos % WordBits));
+            }
+        }
+
+        bool test(uint32_t pos) const
+        {
+            return (word(pos / WordBits) >> (pos % WordBits)) & Word(1);
+        }
+
+        uint32_t count() const
+        {
+            return SolutionBitset::countWords(mWords, mWordCount);
+        }
+
+        uint32_t findNext(uint32_t pos) const
+        {
+            return SolutionBitset::findNextInWords(mWords, mWordCount, pos);
+        }
+
+        uint32_t findFirst() const
+        {
+            return findNext(0u);
+        }
+
+        // True when viewing the words of bits in place
+        bool views(SolutionBitset const& bits) const
+        {
+            return mWords == bits.data() && mWordCount == bits.wordCount();
+        }
+
+    private:
+        Word word(uint32_t idx) const
+        {
+            return idx < mWordCount ? mWords[idx] : Word(0);
+        }
+
+        bool ownsWords() const
+        {
+            return mWords == mInline.data() || (!mHeap.empty() && mWords == mHeap.data());
+        }
+
+        Word* ownedWords()
+        {
+            return mWords == mInline.data() ? mInline.data() : mHeap.data();
+        }
+
+        // Points the view at owned storage for wordCount words
+        Word* allocate(uint32_t wordCount)
+        {
+            auto* words = mInline.data();
+            if(wordCount > InlineWords)
+            {
+                mHeap.resize(wordCount);
+                words = mHeap.data();
+            }
+            mWords     = words;
+            mWordCount = wordCount;
+            return words;
+        }
+
+    private:
+        Word const* mWords     = nullptr;
+        uint32_t    mWordCount = 0;
+
+        // Storage for unions and intersections, left uninitialized past mWordCount
+        std::array<Word, InlineWords> mInline;
+        std::vector<Word>             mHeap;
+    };
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_SOLUTION_BITSET_HPP
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_THREAD_POOL_HPP
+#define HIPTENSOR_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // @cond
+    // Library-wide work-stealing pool of host worker threads, shared by all CPU solutions
+    // and host validation helpers so that they never oversubscribe the host.
+    //
+    // Each parallelFor splits its index space into one contiguous range per thread.
+    // Threads consume their own range from the front and, once it is empty, steal the
+    // back half of the nearest non-empty range. Calls made from inside a task are jobs
+    // of their own, which idle threads join, so that nested parallelism is not lost.
+    //
+    // The number of threads defaults to the CPUs the process may run on, and may be
+    // overridden with the HIPTENSOR_CPU_THREADS environment variable.
+    // HIPTENSOR_CPU_AFFINITY pins the workers on Linux:
+    //  - NONE (default): workers are not pinned
+    //  - COMPACT: workers fill one NUMA node after the other, so neighbouring ranges
+    //    and steals stay on the same node
+    //  - SCATTER: workers are spread round-robin over the NUMA nodes
+    class ThreadPool : public LazySingleton<ThreadPool>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<ThreadPool> std::make_unique<ThreadPool>();
+
+        ~ThreadPool();
+
+        // Number of threads executing a parallelFor, including the caller
+        std::size_t threadCount() const;
+
+        // Runs task(i) for every i in [0, count) and returns once all of them
+        // are complete. The calling thread participates in the work.
+        void parallelFor(std::size_t count, std::function<void(std::size_t)> const& task);
+
+        // Runs task(begin, end) over consecutive chunks of at most grain indices
+        // that together cover [0, count).
+        void parallelForRange(std::size_t                                          count,
+                              std::size_t                                          grain,
+                              std::function<void(std::size_t, std::size_t)> const& task);
+
+        // Runs task(index, begin, end) over chunks of at most grain elements of the
+        // index space spanned by lengths, with the first mode fastest. index is the
+        // multi-index of the flat offset begin, so that tasks can walk their chunk
+        // with an odometer over (already folded) modes.
+        void parallelForIndexSpace(
+            std::vector<std::size_t> const& lengths,
+            std::size_t                     grain,
+            std::function<void(std::vector<std::size_t> const&, std::size_t, std::size_t)> const&
+                task);
+
+    private:
+        struct Job;
+
+        ThreadPool();
+        ThreadPool(ThreadPool const&)            = delete;
+        ThreadPool(ThreadPool&&)                 = delete;
+        ThreadPool& operator=(ThreadPool const&) = delete;
+        ThreadPool& operator=(ThreadPool&&)      = delete;
+
+        void workerLoop(std::size_t slot, int cpu);
+
+        // Runs tasks of job from the given thread slot until no range has work left
+        void runJob(Job& job, std::size_t slot);
+        bool claim(Job& job, std::size_t slot, std::size_t& index);
+
+        // Newest job that still has unclaimed tasks, guarded by mMutex
+        Job* findJob() const;
+
+    private:
+        std::vector<std::thread> mWorkers;
+
+        std::mutex              mMutex;
+        std::condition_variable mWake;
+        std::condition_variable mDone;
+
+        // Running jobs in submission order, guarded by mMutex
+        std::vector<Job*> mJobs;
+        bool              mStop;
+    };
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_THREAD_POOL_HPP
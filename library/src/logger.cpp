@@ -107,8 +107,13 @@ namespace hiptensor
 
     int32_t Logger::getLogMask() const
     {
-        std::scoped_lock lock(mMutex);
-        return mLogMask;
+        return mLogMask.load(std::memory_order_relaxed);
+    }
+
+    bool Logger::isEnabled(LogLevel_t level) const
+    {
+        return (static_cast<int32_t>(level) & mLogMask.load(std::memory_order_relaxed)) > 0
+               && mEnabled.load(std::memory_order_relaxed);
     }
 
     Logger::Status_t Logger::setLogLevel(LogLevel_t level)
@@ -160,8 +165,14 @@ namespace hiptensor
     Logger::Status_t
         Logger::logMessage(int32_t context, const char* apiFuncName, const char* message)
     {
+        // Early out without taking the lock when the context is masked off
+        if(!isEnabled((LogLevel_t)context))
+        {
+            return Status_t::SUCCESS;
+        }
+
         std::scoped_lock lock(mMutex);
-        if((context & mLogMask) > 0 && mEnabled)
+        if(isEnabled((LogLevel_t)context))
         {
             // Init message
             char buff[2048];
@@ -199,6 +210,12 @@ namespace hiptensor
             static_cast<int>(LogLevel_t::LOG_LEVEL_PERF_TRACE), apiFuncName, message);
     }
 
+    Logger::Status_t Logger::logPerformanceHint(const char* apiFuncName, const char* message)
+    {
+        return Logger::logMessage(
+            static_cast<int>(LogLevel_t::LOG_LEVEL_PERF_HINT), apiFuncName, message);
+    }
+
     Logger::Status_t Logger::logHeuristics(const char* apiFuncName, const char* message)
     {
         return Logger::logMessage(
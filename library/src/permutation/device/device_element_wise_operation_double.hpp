@@ -0,0 +1,61 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENT_WISE_OPERATION_DOUBLE_HPP
+#define HIPTENSOR_ELEMENT_WISE_OPERATION_DOUBLE_HPP
+
+#include <unary_element_wise_operation.hpp>
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace element_wise
+        {
+
+            // Scale with a double factor. CK's Scale keeps its factor in float,
+            // which rounds f64 alphas before they reach the data.
+            struct ScaleDouble
+            {
+                __host__ __device__ ScaleDouble(double scale = 1.0)
+                    : scale_(scale)
+                {
+                }
+
+                template <typename Y, typename X>
+                __host__ __device__ void operator()(Y& y, const X& x) const
+                {
+                    y = ck::type_convert<Y>(scale_ * ck::type_convert<double>(x));
+                };
+
+                double scale_;
+            };
+
+        } // namespace element_wise
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_ELEMENT_WISE_OPERATION_DOUBLE_HPP
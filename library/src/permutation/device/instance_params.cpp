@@ -24,6 +24,8 @@
  *
  *******************************************************************************/
 
+#include <algorithm>
+
 #include "instance_params.hpp"
 
 namespace ck::tensor_operation::device::instance
@@ -63,36 +65,88 @@ namespace ck::tensor_operation::device::instance
                                               threadClusterArrangeOrder.second,
                                               inScalarPerVectorSeq,
                                               inScalarPerVectorSeq));
-        // instances below are safe net
+
+        // The same tile with narrower vectors, for the lengths, strides and
+        // addresses that the selected vectors do not divide
+        for(auto width = inScalarPerVectorSeq / 2; width >= 1; width /= 2)
+        {
+            hashCodes.push_back(hiptensor::Hash{}(typeIn,
+                                                  typeOut,
+                                                  aOp,
+                                                  bOp,
+                                                  scale,
+                                                  numDim,
+                                                  blockSize,
+                                                  m0PerBlock,
+                                                  m1PerBlock,
+                                                  m0PerThread,
+                                                  m1PerThread,
+                                                  threadClusterArrangeOrder.first,
+                                                  threadClusterArrangeOrder.second,
+                                                  width,
+                                                  width));
+        }
+
+        // instances below are safe net, skipped when wider than the selected vectors
+        auto safeNet = [&](index_t block,
+                           index_t m0,
+                           index_t m1,
+                           index_t m0Thread,
+                           index_t m1Thread,
+                           index_t order0,
+                           index_t order1,
+                           index_t inWidth,
+                           index_t outWidth) {
+            auto hashCode = hiptensor::Hash{}(typeIn,
+                                              typeOut,
+                                              aOp,
+                                              bOp,
+                                              scale,
+                                              numDim,
+                                              block,
+                                              m0,
+                                              m1,
+                                              m0Thread,
+                                              m1Thread,
+                                              order0,
+                                              order1,
+                                              inWidth,
+                                              outWidth);
+            if(inWidth <= inScalarPerVectorSeq
+               && std::find(hashCodes.cbegin(), hashCodes.cend(), hashCode) == hashCodes.cend())
+            {
+                hashCodes.push_back(hashCode);
+            }
+        };
         // clang-format off
         if (numDim == 2) {
             if (typeIn == HIP_R_16F) {
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 64  , 32  , 128 , 8 , 8 , 0 , 1 , 2 , 2));
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 64  , 32  , 128 , 8 , 8 , 0 , 1 , 1 , 1));
-            } else if (typeIn == HIP_R_32F) {
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2));
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1));
+                safeNet(64  , 32  , 128 , 8 , 8 , 0 , 1 , 2 , 2);
+                safeNet(64  , 32  , 128 , 8 , 8 , 0 , 1 , 1 , 1);
+            } else {
+                safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2);
+                safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1);
             }
         } else if (numDim == 3) {
             if (typeIn == HIP_R_16F) {
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 128 , 128 , 8 , 8 , 0 , 1 , 2 , 2));
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 128 , 128 , 8 , 8 , 0 , 1 , 1 , 1));
-            } else if (typeIn == HIP_R_32F) {
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2));
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1));
+                safeNet(256 , 128 , 128 , 8 , 8 , 0 , 1 , 2 , 2);
+                safeNet(256 , 128 , 128 , 8 , 8 , 0 , 1 , 1 , 1);
+            } else {
+                safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2);
+                safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1);
             }
         } else if (numDim == 4) {
             if (typeIn == HIP_R_16F) {
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 64  , 128 , 32  , 8  , 8  , 0 , 1 , 2  , 2));
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 64  , 128 , 32  , 8  , 8  , 0 , 1 , 1  , 1));
-            } else if (typeIn == HIP_R_32F) {
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2));
-                hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1));
+                safeNet(64  , 128 , 32  , 8  , 8  , 0 , 1 , 2  , 2);
+                safeNet(64  , 128 , 32  , 8  , 8  , 0 , 1 , 1  , 1);
+            } else {
+                safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2);
+                safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1);
             }
         } else if (numDim == 5 || numDim == 6) {
-            hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 4 , 4));
-            hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2));
-            hashCodes.push_back(hiptensor::Hash{}( typeIn , typeOut , aOp , bOp , scale , numDim , 256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1));
+            safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 4 , 4);
+            safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 2 , 2);
+            safeNet(256 , 64  , 64  , 4 , 4 , 0 , 1 , 1 , 1);
         }
         // clang-format on
 
@@ -51,8 +51,8 @@ namespace ck::tensor_operation::device::instance
         static hiptensor::Uid hashCode()
         {
             return hiptensor::Hash{}(
-                hiptensor::HipDataType_v<typename ck::tuple_element_t<0, InDataTypeTuple>>,
-                hiptensor::HipDataType_v<typename ck::tuple_element_t<0, OutDataTypeTuple>>,
+                hiptensor::PermutationDataType_v<typename ck::tuple_element_t<0, InDataTypeTuple>>,
+                hiptensor::PermutationDataType_v<typename ck::tuple_element_t<0, OutDataTypeTuple>>,
                 hiptensor::ElementWiseOperatorType_v<Aop>,
                 hiptensor::ElementWiseOperatorType_v<Bop>,
                 hiptensor::PermutationOperatorType_v<Scale>,
@@ -70,8 +70,9 @@ namespace ck::tensor_operation::device::instance
     };
 
     // `getHashCodeOfBestPerfInstances` generates a hash code based on the arguments. This hash code represents
-    // the best perf instance. And it appends hash codes of 2 more instances which can handle the input tensors
-    // that cannot be handled by the best perf instance.
+    // the best perf instance. It appends hash codes of the same tile with narrower vectors, then of up to 3
+    // more instances, no wider than the best one, which can handle the input tensors that cannot be handled
+    // by the best perf instance.
     //
     // Ck requires that the length of fastest changing dimonsion must be multiple times of `InScalarPerVectorSeq`
     // and `OutScalarPerVectorSeq`. For example, `tensor.lengths[0] == 1777`, it cannot be handled by instance with
@@ -23,15 +23,821 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <hiptensor/hiptensor.hpp>
 
+#include "api_helpers.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
 #include "logger.hpp"
+#include "permutation_cpu_reference.hpp"
+#include "permutation_cpu_reference_instances.hpp"
+#include "permutation_flat.hpp"
+#include "permutation_folding.hpp"
+#include "permutation_in_place.hpp"
+#include "permutation_pointer_batch.hpp"
 #include "permutation_solution.hpp"
 #include "permutation_solution_instances.hpp"
 #include "permutation_solution_registry.hpp"
+#include "permutation_tuning.hpp"
 
 #include "hiptensor_options.hpp"
 
+namespace
+{
+    bool isSupportedDataType(hipDataType type)
+    {
+        return type == HIP_R_16F || type == HIP_R_16BF || type == HIP_R_32F || type == HIP_R_64F
+               || type == HIP_C_32F || type == HIP_C_64F;
+    }
+
+    // A and B have the same data type, or one converts to the other through f32.
+    // Complex tensors convert between single and double precision.
+    bool isSupportedConversion(hipDataType typeA, hipDataType typeB)
+    {
+        auto convertsToF32 = [](hipDataType type) {
+            return type == HIP_R_16F || type == HIP_R_16BF || type == HIP_R_64F;
+        };
+        auto isComplex = [](hipDataType type) { return type == HIP_C_32F || type == HIP_C_64F; };
+
+        return typeA == typeB || (typeA == HIP_R_32F && convertsToF32(typeB))
+               || (typeB == HIP_R_32F && convertsToF32(typeA))
+               || (isComplex(typeA) && isComplex(typeB));
+    }
+
+    hiptensorStatus_t checkDataTypes(const char*                        apiName,
+                                     const hiptensorTensorDescriptor_t* descA,
+                                     const hiptensorTensorDescriptor_t* descB,
+                                     const hipDataType                  typeScalar)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        char msg[512];
+        if(!isSupportedDataType(descA->mType) || !isSupportedDataType(descB->mType))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Data Type Error : The supported data types of A and B are "
+                     "HIP_R_16F, HIP_R_16BF, HIP_R_32F, HIP_R_64F, HIP_C_32F and HIP_C_64F (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        if(!isSupportedConversion(descA->mType, descB->mType))
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Mismatched Data Type Error : Data types of A and B are not the same, and "
+                     "not a conversion between f32 and f16, bf16 or f64 (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        // The f16 and f32 permutations also have instances applying unary operators
+        bool hasUnaryOp
+            = descA->mUnaryOp != HIPTENSOR_OP_IDENTITY || descB->mUnaryOp != HIPTENSOR_OP_IDENTITY;
+        if(hasUnaryOp
+           && (descA->mType != descB->mType
+               || (descA->mType != HIP_R_16F && descA->mType != HIP_R_32F)))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Operator Error : Unary operators are only supported when A "
+                     "and B are both HIP_R_16F or both HIP_R_32F (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        bool isComplexScalar = typeScalar == HIP_C_32F || typeScalar == HIP_C_64F;
+        bool isComplexA      = descA->mType == HIP_C_32F || descA->mType == HIP_C_64F;
+        if((typeScalar != HIP_R_16F && typeScalar != HIP_R_32F && typeScalar != HIP_R_64F
+            && !isComplexScalar)
+           || (isComplexScalar && !isComplexA))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Data Type Error : The supported data types of alpha are "
+                     "HIP_R_16F, HIP_R_32F and HIP_R_64F, or HIP_C_32F and HIP_C_64F for "
+                     "complex tensors (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Reads alpha for the real view of complex tensors. The parts of a complex
+    // tensor are permuted as real values, so alpha must not have an imaginary part.
+    hiptensorStatus_t
+        readRealAlpha(const char* apiName, const void* alpha, hipDataType typeScalar, double& value)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        if(!hiptensor::realPermutationAlpha(alpha, typeScalar, value))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Value Error : alpha of a complex permutation must be real (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Runs a permutation kernel, with timing if LOG_LEVEL_PERF_TRACE.
+    // solution is nullptr for flat permutations, which are traced as flatName.
+    // Kernels permuting in place are timed by a single run, as every run changes
+    // their input.
+    template <typename RunFunc>
+    hiptensorStatus_t launchPermutation(const char*                           apiName,
+                                        hiptensor::PermutationSolution const* solution,
+                                        const char*                           flatName,
+                                        std::size_t                           size,
+                                        std::size_t                           bytes,
+                                        bool                                  inPlace,
+                                        hipStream_t                           stream,
+                                        RunFunc&&                             run)
+    {
+        return hiptensor::launchSolution(apiName,
+                                         solution,
+                                         flatName,
+                                         std::size_t(2) * size,
+                                         bytes,
+                                         inPlace,
+                                         stream,
+                                         std::forward<RunFunc>(run));
+    }
+
+    // Architecture name of the device of a handle, part of the tuning keys
+    std::string deviceArch(hiptensor::Handle const* handle)
+    {
+        return handle->getDevice().getDeviceProps().gcnArchName;
+    }
+
+    // Logs the autotuned selection of a permutation kernel
+    void traceTuning(const char* apiName, hiptensor::PermutationTuning::Result const& tuned)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        auto* pSolution = tuned.mSolution;
+
+        char msg[2048];
+        if(tuned.mCandidates == 0)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Tuned KernelId: %lu KernelName: %s, found in %0.3f ms",
+                     pSolution->uid(),
+                     pSolution->kernelName().c_str(),
+                     tuned.mSelectionMs);
+        }
+        else
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Tuned KernelId: %lu KernelName: %s, selected from %d instances in %0.3f "
+                     "ms, %0.3f ms, %0.3f GB/s",
+                     pSolution->uid(),
+                     pSolution->kernelName().c_str(),
+                     tuned.mCandidates,
+                     tuned.mSelectionMs,
+                     tuned.mKernelMs,
+                     static_cast<float>(pSolution->problemBytes()) / static_cast<float>(1.E6)
+                         / tuned.mKernelMs);
+        }
+        logger->logPerformanceTrace(apiName, msg);
+    }
+
+    // Permutes A into B after the arguments have been checked. Shared by
+    // hiptensorPermutation and the batched permutations, which permute a view
+    // with the batch as an extra mode.
+    hiptensorStatus_t permute(const char*                        apiName,
+                              const hiptensorHandle_t*           handle,
+                              const void*                        alpha,
+                              const void*                        A,
+                              const hiptensorTensorDescriptor_t* descA,
+                              const int32_t                      modeA[],
+                              void*                              B,
+                              const hiptensorTensorDescriptor_t* descB,
+                              const int32_t                      modeB[],
+                              const hipDataType                  typeScalar,
+                              const hipStream_t                  stream)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        char msg[512];
+
+        // Complex tensors are permuted as real tensors, with the real and imaginary
+        // parts as an extra mode
+        hiptensor::FoldedPermutation complexView;
+        double                       realAlpha  = 0.0;
+        auto                         scalarType = typeScalar;
+        if(hiptensor::complexAsRealPermutation(descA, modeA, descB, modeB, complexView))
+        {
+            if(auto errorCode = readRealAlpha(apiName, alpha, typeScalar, realAlpha);
+               errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return errorCode;
+            }
+            alpha      = &realAlpha;
+            scalarType = HIP_R_64F;
+            descA      = &complexView.mDescA;
+            modeA      = complexView.mModeA.data();
+            descB      = &complexView.mDescB;
+            modeB      = complexView.mModeB.data();
+        }
+
+        auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+        if(realHandle->isHostBackend())
+        {
+            // Host tensors are permuted by the multithreaded CPU solutions
+            auto hostStart = std::chrono::steady_clock::now();
+            auto errorCode = hiptensorPermutationReference(
+                handle, alpha, A, descA, modeA, B, descB, modeB, scalarType, stream);
+
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                snprintf(msg,
+                         sizeof(msg),
+                         "Host solution is unable to solve the problem (%s)",
+                         hiptensorGetErrorString(errorCode));
+                logger->logError(apiName, msg);
+            }
+            else if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+            {
+                auto time = std::chrono::duration<float, std::milli>(
+                                std::chrono::steady_clock::now() - hostStart)
+                                .count();
+                snprintf(msg, sizeof(msg), "Host solution, %0.3f ms", time);
+                logger->logPerformanceTrace(apiName, msg);
+            }
+            return errorCode;
+        }
+
+        // Fold the modes that stay adjacent, so that lower rank instances and wider
+        // vectors apply. A permutation folding to one mode is a flat copy or scale.
+        hiptensor::FoldedPermutation folded;
+        bool isFolded = hiptensor::foldPermutation(descA, modeA, descB, modeB, folded);
+        if(isFolded && folded.isFlat() && descA->mUnaryOp == HIPTENSOR_OP_IDENTITY
+           && descB->mUnaryOp == HIPTENSOR_OP_IDENTITY)
+        {
+            auto alphaValue
+                = hiptensor::readVal<double>(alpha, hiptensor::convertToComputeType(scalarType));
+            auto count = folded.elementCount();
+            auto typeA = descA->mType;
+            auto typeB = descB->mType;
+            auto bytes
+                = count * (hiptensor::hipDataTypeSize(typeA) + hiptensor::hipDataTypeSize(typeB));
+            return launchPermutation(apiName,
+                                     nullptr,
+                                     hiptensor::flatPermutationName(typeA, typeB, alphaValue),
+                                     count,
+                                     bytes,
+                                     A == B,
+                                     stream,
+                                     [=](StreamConfig const& streamConfig) {
+                                         return hiptensor::flatPermutation(
+                                             typeA, typeB, alphaValue, A, B, count, streamConfig);
+                                     });
+        }
+
+        // No instances have a single mode, so flat problems with unary operators,
+        // or folded ranks missing from the kernel manifest, keep the original modes
+        auto& instances = hiptensor::PermutationSolutionInstances::instance();
+        auto  solutions = std::vector<hiptensor::PermutationSolution*>{};
+        if(isFolded && !folded.isFlat())
+        {
+            solutions = instances->query(alpha,
+                                         &folded.mDescA,
+                                         folded.mModeA.data(),
+                                         &folded.mDescB,
+                                         folded.mModeB.data(),
+                                         scalarType,
+                                         hiptensor::PermutationInstanceType_t::Device,
+                                         A,
+                                         B);
+        }
+
+        if(solutions.empty())
+        {
+            isFolded  = false;
+            solutions = instances->query(alpha,
+                                         descA,
+                                         modeA,
+                                         descB,
+                                         modeB,
+                                         scalarType,
+                                         hiptensor::PermutationInstanceType_t::Device,
+                                         A,
+                                         B);
+        }
+
+        if(isFolded)
+        {
+            descA = &folded.mDescA;
+            modeA = folded.mModeA.data();
+            descB = &folded.mDescB;
+            modeB = folded.mModeB.data();
+        }
+
+        if(solutions.empty())
+        {
+            // No kernels were built for these types and ranks in the kernel manifest
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "No kernels available for this permutation in the kernel manifest (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        // Opt-in autotuning times every compatible instance on the actual problem,
+        // instead of trusting the instance tables
+        auto& tuning = hiptensor::PermutationTuning::instance();
+        if(tuning->isEnabled())
+        {
+            auto scale = hiptensor::PermutationSolutionRegistry::scaleOp(
+                alpha, descA, descB, scalarType, hiptensor::PermutationInstanceType_t::Device);
+            auto key = hiptensor::PermutationTuning::key(
+                deviceArch(realHandle), scale, descA, modeA, descB, modeB);
+            auto candidates = instances->query(descA->mType,
+                                               descB->mType,
+                                               descA->mUnaryOp,
+                                               descB->mUnaryOp,
+                                               scale,
+                                               descA->mLengths.size());
+
+            auto tuned = tuning->tune(
+                key, candidates, alpha, A, B, descA, modeA, descB, modeB, scalarType, stream);
+            if(tuned.mSolution != nullptr)
+            {
+                solutions = {tuned.mSolution};
+                if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+                {
+                    traceTuning(apiName, tuned);
+                }
+            }
+        }
+
+        bool canRun = false;
+        for(auto pSolution : solutions)
+        {
+            canRun = pSolution->initArgs(alpha,
+                                         A,
+                                         B,
+                                         descA->mLengths,
+                                         descA->mStrides,
+                                         modeA,
+                                         descB->mLengths,
+                                         descB->mStrides,
+                                         modeB,
+                                         scalarType);
+
+            if(canRun)
+            {
+                return launchPermutation(apiName,
+                                         pSolution,
+                                         nullptr,
+                                         pSolution->problemSize(),
+                                         pSolution->problemBytes(),
+                                         A == B,
+                                         stream,
+                                         [pSolution](StreamConfig const& streamConfig) {
+                                             return (*pSolution)(streamConfig);
+                                         });
+            }
+        }
+
+        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Selected kernel is unable to solve the problem (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError(apiName, msg);
+        return errorCode;
+    }
+
+    // Permutes A into itself after the arguments have been checked. Permutations
+    // that move no element, and transposes of square matrices, run in place; the
+    // others copy as many slabs as the workspace holds and permute them back, or
+    // follow the cycles of the slabs when the workspace cannot hold one.
+    hiptensorStatus_t permuteInPlace(const char*                        apiName,
+                                     const hiptensorHandle_t*           handle,
+                                     const void*                        alpha,
+                                     void*                              A,
+                                     const hiptensorTensorDescriptor_t* descA,
+                                     const int32_t                      modeA[],
+                                     const hiptensorTensorDescriptor_t* descB,
+                                     const int32_t                      modeB[],
+                                     const hipDataType                  typeScalar,
+                                     void*                              workspace,
+                                     uint64_t                           workspaceSize,
+                                     const hipStream_t                  stream)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        char msg[512];
+
+        hiptensor::InPlacePermutation inPlace;
+        if(!hiptensor::makeInPlacePermutation(descA, modeA, descB, modeB, inPlace))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported In-place Error : A and B must have the same data type, the "
+                     "same modes and packed strides to be permuted in place (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        if(inPlace.mKind == hiptensor::InPlaceKind_t::FLAT)
+        {
+            return permute(
+                apiName, handle, alpha, A, descA, modeA, A, descB, modeB, typeScalar, stream);
+        }
+
+        // The parts of complex elements are scaled by a real alpha
+        double alphaValue = 0.0;
+        if(typeScalar == HIP_C_32F || typeScalar == HIP_C_64F)
+        {
+            if(auto errorCode = readRealAlpha(apiName, alpha, typeScalar, alphaValue);
+               errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return errorCode;
+            }
+        }
+        else
+        {
+            alphaValue
+                = hiptensor::readVal<double>(alpha, hiptensor::convertToComputeType(typeScalar));
+        }
+
+        auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+        auto type       = inPlace.mDescA.mType;
+        if(inPlace.mKind == hiptensor::InPlaceKind_t::SQUARE_TRANSPOSE)
+        {
+            auto order = inPlace.mDescA.mLengths[0];
+            auto count = inPlace.mSlabCount;
+            if(realHandle->isHostBackend())
+            {
+                hiptensor::squareTransposeInPlaceCpu(type, alphaValue, A, order, count);
+                return HIPTENSOR_STATUS_SUCCESS;
+            }
+
+            auto size = order * order * count;
+            return launchPermutation(apiName,
+                                     nullptr,
+                                     "SquareTransposeInPlace",
+                                     size,
+                                     2 * size * hiptensor::hipDataTypeSize(type),
+                                     true,
+                                     stream,
+                                     [=](StreamConfig const& streamConfig) {
+                                         return hiptensor::squareTransposeInPlace(
+                                             type, alphaValue, A, order, count, streamConfig);
+                                     });
+        }
+
+        // Without a workspace for one slab, the slabs are permuted by following
+        // their cycles
+        auto slabBytes = inPlace.mSlabElements * hiptensor::hipDataTypeSize(type);
+        if(inPlace.mCycles && (workspace == nullptr || workspaceSize < slabBytes))
+        {
+            if(realHandle->isHostBackend())
+            {
+                hiptensor::cyclePermutationInPlaceCpu(inPlace, alphaValue, A);
+                return HIPTENSOR_STATUS_SUCCESS;
+            }
+
+            // Each cycle is moved by one thread, and non-square transposes, which
+            // fold to a single slab, have few long cycles
+            if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_PERF_HINT))
+            {
+                snprintf(msg,
+                         sizeof(msg),
+                         "Permuting %zu slab(s) of %zu elements in place by following their "
+                         "cycles, one thread per cycle. hiptensorPermutationInPlace with a "
+                         "workspace of %lu bytes (HIPTENSOR_WORKSPACE_RECOMMENDED) permutes "
+                         "them in parallel",
+                         inPlace.mSlabCount,
+                         inPlace.mSlabElements,
+                         (unsigned long)hiptensor::inPlaceWorkspaceSize(
+                             inPlace, HIPTENSOR_WORKSPACE_RECOMMENDED));
+                logger->logPerformanceHint(apiName, msg);
+            }
+
+            auto size = inPlace.mSlabElements * inPlace.mSlabCount;
+            return launchPermutation(apiName,
+                                     nullptr,
+                                     "CyclePermutationInPlace",
+                                     size,
+                                     2 * size * hiptensor::hipDataTypeSize(type),
+                                     true,
+                                     stream,
+                                     [=](StreamConfig const& streamConfig) {
+                                         return hiptensor::cyclePermutationInPlace(
+                                             inPlace, alphaValue, A, streamConfig);
+                                     });
+        }
+
+        auto minSize = hiptensor::inPlaceWorkspaceSize(inPlace, HIPTENSOR_WORKSPACE_MIN);
+        if(workspace == nullptr || workspaceSize < minSize)
+        {
+            auto errorCode = HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Insufficient Workspace Error : this in-place permutation needs a workspace "
+                     "of at least %lu bytes, given by hiptensorPermutationGetWorkspaceSize (%s)",
+                     (unsigned long)minSize,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        // Each group of slabs is permuted as a batch, from the workspace back into A
+        auto groupSlabs = std::min<std::size_t>(workspaceSize / slabBytes, inPlace.mSlabCount);
+        for(std::size_t first = 0; first < inPlace.mSlabCount; first += groupSlabs)
+        {
+            auto slabs = std::min(groupSlabs, inPlace.mSlabCount - first);
+            auto slabA = static_cast<char*>(A) + first * slabBytes;
+            if(realHandle->isHostBackend())
+            {
+                std::memcpy(workspace, slabA, slabs * slabBytes);
+            }
+            else if(auto result = hipMemcpyAsync(
+                        workspace, slabA, slabs * slabBytes, hipMemcpyDeviceToDevice, stream);
+                    result != hipSuccess)
+            {
+                auto errorCode = HIPTENSOR_STATUS_HIP_ERROR;
+                snprintf(msg,
+                         sizeof(msg),
+                         "Workspace copy failed: %s (%s)",
+                         hipGetErrorString(result),
+                         hiptensorGetErrorString(errorCode));
+                logger->logError(apiName, msg);
+                return errorCode;
+            }
+
+            hiptensor::FoldedPermutation batched;
+            hiptensor::batchedPermutation(&inPlace.mDescA,
+                                          inPlace.mModeA.data(),
+                                          inPlace.mSlabElements,
+                                          &inPlace.mDescB,
+                                          inPlace.mModeB.data(),
+                                          inPlace.mSlabElements,
+                                          slabs,
+                                          batched);
+            if(auto errorCode = permute(apiName,
+                                        handle,
+                                        alpha,
+                                        workspace,
+                                        &batched.mDescA,
+                                        batched.mModeA.data(),
+                                        slabA,
+                                        &batched.mDescB,
+                                        batched.mModeB.data(),
+                                        typeScalar,
+                                        stream);
+               errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return errorCode;
+            }
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Number of elements from the first to the last element of a tensor, plus one
+    std::size_t tensorSpan(const hiptensorTensorDescriptor_t* desc)
+    {
+        std::size_t span = 1;
+        for(std::size_t i = 0; i < desc->mLengths.size(); i++)
+        {
+            span += (desc->mLengths[i] - 1) * desc->mStrides[i];
+        }
+        return span;
+    }
+
+    // A batch has at least one tensor, and the tensors of B, which are written
+    // by the same launch, do not overlap
+    hiptensorStatus_t checkBatch(const char*                        apiName,
+                                 const hiptensorTensorDescriptor_t* descB,
+                                 int64_t                            strideA,
+                                 int64_t                            strideB,
+                                 int64_t                            batchCount)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        if(batchCount < 1
+           || (batchCount > 1
+               && (strideA < 1 || strideB < 1 || std::size_t(strideB) < tensorSpan(descB))))
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Invalid Batch Error : batchCount = %ld, strideA = %ld, strideB = %ld. The "
+                     "strides must be positive and the tensors of B must not overlap (%s)",
+                     (long)batchCount,
+                     (long)strideA,
+                     (long)strideB,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Permutes the batch as one tensor with the batch as an extra mode
+    hiptensorStatus_t permuteBatch(const char*                        apiName,
+                                   const hiptensorHandle_t*           handle,
+                                   const void*                        alpha,
+                                   const void*                        A,
+                                   const hiptensorTensorDescriptor_t* descA,
+                                   const int32_t                      modeA[],
+                                   int64_t                            strideA,
+                                   void*                              B,
+                                   const hiptensorTensorDescriptor_t* descB,
+                                   const int32_t                      modeB[],
+                                   int64_t                            strideB,
+                                   int64_t                            batchCount,
+                                   const hipDataType                  typeScalar,
+                                   const hipStream_t                  stream)
+    {
+        // Batches permuted in place run without a workspace
+        if(batchCount == 1 && A == B)
+        {
+            return permuteInPlace(apiName,
+                                  handle,
+                                  alpha,
+                                  B,
+                                  descA,
+                                  modeA,
+                                  descB,
+                                  modeB,
+                                  typeScalar,
+                                  nullptr,
+                                  0,
+                                  stream);
+        }
+        else if(batchCount == 1)
+        {
+            return permute(
+                apiName, handle, alpha, A, descA, modeA, B, descB, modeB, typeScalar, stream);
+        }
+
+        hiptensor::FoldedPermutation batched;
+        hiptensor::batchedPermutation(
+            descA, modeA, strideA, descB, modeB, strideB, batchCount, batched);
+        if(A == B)
+        {
+            return permuteInPlace(apiName,
+                                  handle,
+                                  alpha,
+                                  B,
+                                  &batched.mDescA,
+                                  batched.mModeA.data(),
+                                  &batched.mDescB,
+                                  batched.mModeB.data(),
+                                  typeScalar,
+                                  nullptr,
+                                  0,
+                                  stream);
+        }
+        return permute(apiName,
+                       handle,
+                       alpha,
+                       A,
+                       &batched.mDescA,
+                       batched.mModeA.data(),
+                       B,
+                       &batched.mDescB,
+                       batched.mModeB.data(),
+                       typeScalar,
+                       stream);
+    }
+
+    // Distance in elements between consecutive tensors, or zero if the tensors
+    // are not equally spaced in memory, in increasing address order
+    int64_t batchStride(const void* const tensors[], int64_t batchCount, std::size_t elementSize)
+    {
+        auto address = [&](int64_t i) { return reinterpret_cast<std::uintptr_t>(tensors[i]); };
+        if(address(1) <= address(0) || (address(1) - address(0)) % elementSize != 0)
+        {
+            return 0;
+        }
+
+        auto bytes = address(1) - address(0);
+        for(int64_t i = 2; i < batchCount; i++)
+        {
+            if(address(i) != address(0) + i * bytes)
+            {
+                return 0;
+            }
+        }
+        return bytes / elementSize;
+    }
+
+    // Permutes a batch of tensors at arbitrary addresses in one launch, with
+    // the base pointers of the tensors in device arrays indexed by the batch
+    hiptensorStatus_t permutePointers(const char*                        apiName,
+                                      const void*                        alpha,
+                                      const void* const                  A[],
+                                      const hiptensorTensorDescriptor_t* descA,
+                                      const int32_t                      modeA[],
+                                      void* const                        B[],
+                                      const hiptensorTensorDescriptor_t* descB,
+                                      const int32_t                      modeB[],
+                                      int64_t                            batchCount,
+                                      const hipDataType                  typeScalar,
+                                      const hipStream_t                  stream)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        // Complex tensors are permuted as real tensors, with the real and imaginary
+        // parts as an extra mode
+        hiptensor::FoldedPermutation complexView;
+        double                       alphaValue = 0.0;
+        if(hiptensor::complexAsRealPermutation(descA, modeA, descB, modeB, complexView))
+        {
+            if(auto errorCode = readRealAlpha(apiName, alpha, typeScalar, alphaValue);
+               errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return errorCode;
+            }
+            descA = &complexView.mDescA;
+            modeA = complexView.mModeA.data();
+            descB = &complexView.mDescB;
+            modeB = complexView.mModeB.data();
+        }
+        else
+        {
+            alphaValue
+                = hiptensor::readVal<double>(alpha, hiptensor::convertToComputeType(typeScalar));
+        }
+
+        hiptensor::PointerBatchPermutation batch;
+        if(!hiptensor::makePointerBatchPermutation(descA, modeA, descB, modeB, batch))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+
+            char msg[512];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Rank Error : The batch folds to more than %d modes (%s)",
+                     hiptensor::PointerBatchPermutation::MaxRank,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        auto count = std::size_t(batch.mElementCount) * batchCount;
+        auto bytes = count
+                     * (hiptensor::hipDataTypeSize(batch.mTypeA)
+                        + hiptensor::hipDataTypeSize(batch.mTypeB));
+        return launchPermutation(apiName,
+                                 nullptr,
+                                 hiptensor::pointerBatchPermutationName(batch),
+                                 count,
+                                 bytes,
+                                 false,
+                                 stream,
+                                 [&](StreamConfig const& streamConfig) {
+                                     return hiptensor::pointerBatchPermutation(
+                                         batch, alphaValue, A, B, batchCount, streamConfig);
+                                 });
+    }
+}
+
 hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle,
                                        const void*                        alpha,
                                        const void*                        A,
@@ -48,188 +854,875 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
 
     // Log API access
     char msg[2048];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, B=%p, descB=%p, modeB=%p, "
-             "typeScalar=0x%02X, stream=%p",
-             handle,
-             alpha,
-             A,
-             descA,
-             modeA,
-             B,
-             descB,
-             modeB,
-             (unsigned int)typeScalar,
-             stream);
-
-    logger->logAPITrace("hiptensorPermutation", msg);
-
-    if(!handle || !alpha || !A || !descA || !modeA || !B || !descB || !modeB)
-    {
-        auto errorCode         = HIPTENSOR_STATUS_NOT_INITIALIZED;
-        auto printErrorMessage = [&logger, errorCode](const std::string& paramName) {
-            char msg[512];
-            snprintf(msg,
-                     sizeof(msg),
-                     "Initialization Error : %s = nullptr (%s)",
-                     paramName.c_str(),
-                     hiptensorGetErrorString(errorCode));
-            logger->logError("hiptensorPermutation", msg);
-        };
-        if(!handle)
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, B=%p, descB=%p, modeB=%p, "
+                 "typeScalar=0x%02X, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 B,
+                 descB,
+                 modeB,
+                 (unsigned int)typeScalar,
+                 stream);
+
+        logger->logAPITrace("hiptensorPermutation", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorPermutation",
+                                                {{"handle", handle},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"B", B},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkDataTypes("hiptensorPermutation", descA, descB, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(A == B)
+    {
+        return permuteInPlace("hiptensorPermutation",
+                              handle,
+                              alpha,
+                              B,
+                              descA,
+                              modeA,
+                              descB,
+                              modeB,
+                              typeScalar,
+                              nullptr,
+                              0,
+                              stream);
+    }
+
+    return permute("hiptensorPermutation",
+                   handle,
+                   alpha,
+                   A,
+                   descA,
+                   modeA,
+                   B,
+                   descB,
+                   modeB,
+                   typeScalar,
+                   stream);
+}
+
+hiptensorStatus_t hiptensorInitPermutationPlan(const hiptensorHandle_t*           handle,
+                                               hiptensorPermutationPlan_t*        plan,
+                                               const hiptensorTensorDescriptor_t* descA,
+                                               const int32_t                      modeA[],
+                                               const hiptensorTensorDescriptor_t* descB,
+                                               const int32_t                      modeB[],
+                                               const hipDataType                  typeScalar)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, plan=%p, descA=%p, modeA=%p, descB=%p, modeB=%p, typeScalar=0x%02X",
+                 handle,
+                 plan,
+                 descA,
+                 modeA,
+                 descB,
+                 modeB,
+                 (unsigned int)typeScalar);
+
+        logger->logAPITrace("hiptensorInitPermutationPlan", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorInitPermutationPlan",
+                                                {{"handle", handle},
+                                                 {"plan", plan},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkDataTypes("hiptensorInitPermutationPlan", descA, descB, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // Complex tensors are permuted as real tensors, with the real and imaginary
+    // parts as an extra mode. The complex alpha is read on execution.
+    hiptensor::FoldedPermutation complexView;
+    if(hiptensor::complexAsRealPermutation(descA, modeA, descB, modeB, complexView))
+    {
+        descA = &complexView.mDescA;
+        modeA = complexView.mModeA.data();
+        descB = &complexView.mDescB;
+        modeB = complexView.mModeB.data();
+    }
+
+    // Host tensors are permuted by the multithreaded CPU solutions
+    auto realHandle   = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto instanceType = realHandle->isHostBackend() ? hiptensor::PermutationInstanceType_t::Host
+                                                    : hiptensor::PermutationInstanceType_t::Device;
+    hiptensor::PermutationSolutionRegistry* registry
+        = realHandle->isHostBackend()
+              ? static_cast<hiptensor::PermutationSolutionRegistry*>(
+                  hiptensor::PermutationCpuReferenceInstances::instance().get())
+              : hiptensor::PermutationSolutionInstances::instance().get();
+
+    plan->mSolution       = nullptr;
+    plan->mCopySolution   = nullptr;
+    plan->mNarrowSolution = nullptr;
+    plan->mArgs.reset();
+    plan->mCopyArgs.reset();
+    plan->mNarrowArgs.reset();
+    plan->mAlignmentA = 1;
+    plan->mAlignmentB = 1;
+    plan->mTypeScalar = typeScalar;
+    plan->mFlatCount  = 0;
+    plan->mFlatTypeA  = descA->mType;
+    plan->mFlatTypeB  = descB->mType;
+    plan->mBackend    = hiptensor::handleBackend(handle);
+
+    // On the device, fold the modes that stay adjacent as hiptensorPermutation
+    // does. The host solutions fold the modes themselves.
+    hiptensor::FoldedPermutation folded;
+    bool                         isFolded
+        = instanceType == hiptensor::PermutationInstanceType_t::Device
+          && hiptensor::foldPermutation(descA, modeA, descB, modeB, folded);
+    if(isFolded && folded.isFlat() && descA->mUnaryOp == HIPTENSOR_OP_IDENTITY
+       && descB->mUnaryOp == HIPTENSOR_OP_IDENTITY)
+    {
+        plan->mFlatCount = folded.elementCount();
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Select the first candidate supporting the problem, with vectors of at most
+    // maxWidth elements, and resolve its arguments and the vector width it uses
+    auto prepareProblem = [&](hiptensor::PermutationOpId_t       scale,
+                              const hiptensorTensorDescriptor_t* dA,
+                              const int32_t*                     mA,
+                              const hiptensorTensorDescriptor_t* dB,
+                              const int32_t*                     mB,
+                              uint32_t                           maxWidth,
+                              void*&                             solution,
+                              std::shared_ptr<void>&             args,
+                              uint32_t&                          usedWidth) {
+        auto candidates
+            = registry->query(scale, dA, mA, dB, mB, instanceType, nullptr, nullptr, maxWidth);
+
+        // A kernel autotuned for this problem by hiptensorPermutation is preferred.
+        // Its vectors may be as wide as any instance's.
+        hiptensor::PermutationSolution* tuned  = nullptr;
+        auto&                           tuning = hiptensor::PermutationTuning::instance();
+        if(instanceType == hiptensor::PermutationInstanceType_t::Device && tuning->isEnabled()
+           && maxWidth == hiptensor::PermutationSolutionRegistry::MaxVectorWidth)
         {
-            printErrorMessage("handle");
+            auto key = hiptensor::PermutationTuning::key(
+                deviceArch(realHandle), scale, dA, mA, dB, mB);
+            auto all = registry->query(
+                dA->mType, dB->mType, dA->mUnaryOp, dB->mUnaryOp, scale, dA->mLengths.size());
+            if(tuned = tuning->find(key, all); tuned != nullptr)
+            {
+                candidates.insert(candidates.begin(), tuned);
+            }
         }
-        if(!alpha)
+
+        for(auto pSolution : candidates)
         {
-            printErrorMessage("alpha");
+            auto prepared = pSolution->prepareArgs(
+                dA->mLengths, dA->mStrides, mA, dB->mLengths, dB->mStrides, mB);
+            if(prepared)
+            {
+                solution  = pSolution;
+                args      = std::move(prepared);
+                usedWidth = pSolution == tuned ? maxWidth
+                                               : registry->vectorWidth(dA,
+                                                                       mA,
+                                                                       dB,
+                                                                       mB,
+                                                                       instanceType,
+                                                                       nullptr,
+                                                                       nullptr,
+                                                                       maxWidth);
+                return true;
+            }
         }
-        if(!A)
+        return false;
+    };
+
+    constexpr auto MaxVectorWidth = hiptensor::PermutationSolutionRegistry::MaxVectorWidth;
+    uint32_t       width          = 1;
+    uint32_t       copyWidth      = 1;
+    uint32_t       narrowWidth    = 1;
+
+    // Flat problems with unary operators, or folded ranks missing from the
+    // kernel manifest, keep the original modes
+    if(isFolded && !folded.isFlat()
+       && prepareProblem(hiptensor::PermutationOpId_t::SCALE,
+                         &folded.mDescA,
+                         folded.mModeA.data(),
+                         &folded.mDescB,
+                         folded.mModeB.data(),
+                         MaxVectorWidth,
+                         plan->mSolution,
+                         plan->mArgs,
+                         width))
+    {
+        descA = &folded.mDescA;
+        modeA = folded.mModeA.data();
+        descB = &folded.mDescB;
+        modeB = folded.mModeB.data();
+    }
+
+    auto prepare = [&](hiptensor::PermutationOpId_t scale,
+                       uint32_t                     maxWidth,
+                       void*&                       solution,
+                       std::shared_ptr<void>&       args,
+                       uint32_t&                    usedWidth) {
+        return prepareProblem(
+            scale, descA, modeA, descB, modeB, maxWidth, solution, args, usedWidth);
+    };
+
+    if(plan->mSolution == nullptr
+       && !prepare(hiptensor::PermutationOpId_t::SCALE,
+                   MaxVectorWidth,
+                   plan->mSolution,
+                   plan->mArgs,
+                   width))
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "No kernels available for this permutation in the kernel manifest (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitPermutationPlan", msg);
+        return errorCode;
+    }
+
+    // When alpha is one and there are no unary operators, permutation only moves
+    // data around, so the faster noop instances are also prepared if available.
+    if(instanceType == hiptensor::PermutationInstanceType_t::Device
+       && descA->mUnaryOp == HIPTENSOR_OP_IDENTITY && descB->mUnaryOp == HIPTENSOR_OP_IDENTITY)
+    {
+        prepare(hiptensor::PermutationOpId_t::PASS_THROUGH,
+                MaxVectorWidth,
+                plan->mCopySolution,
+                plan->mCopyArgs,
+                copyWidth);
+    }
+
+    // The addresses of A and B are only known on execution, so the vectors of the
+    // prepared candidates are recorded as the alignment they require. Tensors offset
+    // into a larger allocation may not have it, so a candidate with scalar accesses
+    // is also prepared for them.
+    width = std::max(width, copyWidth);
+    if(width > 1)
+    {
+        plan->mAlignmentA = width * hiptensor::hipDataTypeSize(descA->mType);
+        plan->mAlignmentB = width * hiptensor::hipDataTypeSize(descB->mType);
+        prepare(hiptensor::PermutationOpId_t::SCALE,
+                1,
+                plan->mNarrowSolution,
+                plan->mNarrowArgs,
+                narrowWidth);
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorPermutationExecute(const hiptensorHandle_t*          handle,
+                                              const hiptensorPermutationPlan_t* plan,
+                                              const void*                       alpha,
+                                              const void*                       A,
+                                              void*                             B,
+                                              const hipStream_t                 stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, plan=%p, alpha=%p, A=%p, B=%p, stream=%p",
+                 handle,
+                 plan,
+                 alpha,
+                 A,
+                 B,
+                 stream);
+
+        logger->logAPITrace("hiptensorPermutationExecute", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorPermutationExecute",
+                                                {{"handle", handle},
+                                                 {"plan", plan},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"B", B}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(plan->mFlatCount == 0 && (plan->mSolution == nullptr || !plan->mArgs))
+    {
+        return hiptensor::logPlanNotInitialized("hiptensorPermutationExecute");
+    }
+
+    if(auto errorCode
+       = hiptensor::checkPlanBackend("hiptensorPermutationExecute", handle, plan->mBackend);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // Only the flat plans move no element, the others would overwrite A while reading it
+    if(A == B && plan->mFlatCount == 0)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported In-place Error : B = A needs hiptensorPermutationInPlace (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorPermutationExecute", msg);
+        return errorCode;
+    }
+
+    // A complex alpha applies to the real view of complex tensors
+    double realAlpha  = 0.0;
+    auto   scalarType = plan->mTypeScalar;
+    if(scalarType == HIP_C_32F || scalarType == HIP_C_64F)
+    {
+        if(auto errorCode
+           = readRealAlpha("hiptensorPermutationExecute", alpha, scalarType, realAlpha);
+           errorCode != HIPTENSOR_STATUS_SUCCESS)
         {
-            printErrorMessage("A");
+            return errorCode;
         }
-        if(!descA)
+        alpha      = &realAlpha;
+        scalarType = HIP_R_64F;
+    }
+
+    // Ensure current HIP device is same as the handle, unless running on the host.
+    if(auto errorCode = hiptensor::checkHandleDevice("hiptensorPermutationExecute", handle);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(plan->mFlatCount > 0)
+    {
+        auto alphaValue
+            = hiptensor::readVal<double>(alpha, hiptensor::convertToComputeType(scalarType));
+        auto count = plan->mFlatCount;
+        auto typeA = plan->mFlatTypeA;
+        auto typeB = plan->mFlatTypeB;
+        auto bytes
+            = count * (hiptensor::hipDataTypeSize(typeA) + hiptensor::hipDataTypeSize(typeB));
+        auto errorCode
+            = launchPermutation("hiptensorPermutationExecute",
+                                nullptr,
+                                hiptensor::flatPermutationName(typeA, typeB, alphaValue),
+                                count,
+                                bytes,
+                                A == B,
+                                stream,
+                                [=](StreamConfig const& streamConfig) {
+                                    return hiptensor::flatPermutation(
+                                        typeA, typeB, alphaValue, A, B, count, streamConfig);
+                                });
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
         {
-            printErrorMessage("descA");
+            snprintf(msg,
+                     sizeof(msg),
+                     "Flat permutation is unable to run the plan (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorPermutationExecute", msg);
         }
-        if(!modeA)
+        return errorCode;
+    }
+
+    using PreparedArgs = hiptensor::PermutationSolution::PreparedArgs;
+
+    auto* pSolution = static_cast<hiptensor::PermutationSolution const*>(plan->mSolution);
+    auto* pArgs     = static_cast<PreparedArgs const*>(plan->mArgs.get());
+
+    // The vectors of the prepared candidates need A and B aligned to them
+    bool aligned = reinterpret_cast<std::uintptr_t>(A) % plan->mAlignmentA == 0
+                   && reinterpret_cast<std::uintptr_t>(B) % plan->mAlignmentB == 0;
+    if(!aligned)
+    {
+        if(plan->mNarrowSolution == nullptr || !plan->mNarrowArgs)
         {
-            printErrorMessage("modeA");
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported alignment Error : the plan needs A aligned to %zu bytes and "
+                     "B aligned to %zu bytes (%s)",
+                     plan->mAlignmentA,
+                     plan->mAlignmentB,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorPermutationExecute", msg);
+            return errorCode;
         }
-        if(!B)
+
+        pSolution = static_cast<hiptensor::PermutationSolution const*>(plan->mNarrowSolution);
+        pArgs     = static_cast<PreparedArgs const*>(plan->mNarrowArgs.get());
+    }
+    else if(plan->mCopySolution != nullptr
+            && hiptensor::readVal<double>(alpha, hiptensor::convertToComputeType(scalarType))
+                   == 1.0)
+    {
+        pSolution = static_cast<hiptensor::PermutationSolution const*>(plan->mCopySolution);
+        pArgs     = static_cast<PreparedArgs const*>(plan->mCopyArgs.get());
+    }
+
+    auto errorCode = launchPermutation(
+        "hiptensorPermutationExecute",
+        pSolution,
+        nullptr,
+        pArgs->mSize,
+        pArgs->mBytes,
+        A == B,
+        stream,
+        [=](StreamConfig const& streamConfig) {
+            return pSolution->run(*pArgs, alpha, A, B, scalarType, streamConfig);
+        });
+
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Selected kernel is unable to run the plan (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorPermutationExecute", msg);
+    }
+    return errorCode;
+}
+
+hiptensorStatus_t hiptensorPermutationStridedBatched(const hiptensorHandle_t*           handle,
+                                                     const void*                        alpha,
+                                                     const void*                        A,
+                                                     const hiptensorTensorDescriptor_t* descA,
+                                                     const int32_t                      modeA[],
+                                                     const int64_t                      strideA,
+                                                     void*                              B,
+                                                     const hiptensorTensorDescriptor_t* descB,
+                                                     const int32_t                      modeB[],
+                                                     const int64_t                      strideB,
+                                                     const int64_t                      batchCount,
+                                                     const hipDataType                  typeScalar,
+                                                     const hipStream_t                  stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, strideA=%ld, B=%p, descB=%p, "
+                 "modeB=%p, strideB=%ld, batchCount=%ld, typeScalar=0x%02X, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 (long)strideA,
+                 B,
+                 descB,
+                 modeB,
+                 (long)strideB,
+                 (long)batchCount,
+                 (unsigned int)typeScalar,
+                 stream);
+
+        logger->logAPITrace("hiptensorPermutationStridedBatched", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorPermutationStridedBatched",
+                                                {{"handle", handle},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"B", B},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode
+       = checkDataTypes("hiptensorPermutationStridedBatched", descA, descB, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkBatch(
+           "hiptensorPermutationStridedBatched", descB, strideA, strideB, batchCount);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    return permuteBatch("hiptensorPermutationStridedBatched",
+                        handle,
+                        alpha,
+                        A,
+                        descA,
+                        modeA,
+                        strideA,
+                        B,
+                        descB,
+                        modeB,
+                        strideB,
+                        batchCount,
+                        typeScalar,
+                        stream);
+}
+
+hiptensorStatus_t hiptensorPermutationBatched(const hiptensorHandle_t*           handle,
+                                              const void*                        alpha,
+                                              const void* const                  A[],
+                                              const hiptensorTensorDescriptor_t* descA,
+                                              const int32_t                      modeA[],
+                                              void* const                        B[],
+                                              const hiptensorTensorDescriptor_t* descB,
+                                              const int32_t                      modeB[],
+                                              const int64_t                      batchCount,
+                                              const hipDataType                  typeScalar,
+                                              const hipStream_t                  stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, B=%p, descB=%p, modeB=%p, "
+                 "batchCount=%ld, typeScalar=0x%02X, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 B,
+                 descB,
+                 modeB,
+                 (long)batchCount,
+                 (unsigned int)typeScalar,
+                 stream);
+
+        logger->logAPITrace("hiptensorPermutationBatched", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorPermutationBatched",
+                                                {{"handle", handle},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"B", B},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkDataTypes("hiptensorPermutationBatched", descA, descB, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    if(auto errorCode = checkBatch("hiptensorPermutationBatched", descB, 1, 1, batchCount);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    for(int64_t i = 0; i < batchCount; i++)
+    {
+        if(A[i] == nullptr || B[i] == nullptr)
         {
-            printErrorMessage("B");
+            auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Initialization Error : %s[%ld] = nullptr (%s)",
+                     A[i] == nullptr ? "A" : "B",
+                     (long)i,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorPermutationBatched", msg);
+            return errorCode;
         }
-        if(!descB)
+    }
+
+    // Equally spaced batches run in one launch
+    int64_t strideA = 0;
+    int64_t strideB = 0;
+    if(batchCount > 1)
+    {
+        strideA = batchStride(A, batchCount, hiptensor::hipDataTypeSize(descA->mType));
+        strideB = batchStride(B, batchCount, hiptensor::hipDataTypeSize(descB->mType));
+    }
+
+    if(batchCount == 1 || (strideA > 0 && std::size_t(strideB) >= tensorSpan(descB)))
+    {
+        return permuteBatch("hiptensorPermutationBatched",
+                            handle,
+                            alpha,
+                            A[0],
+                            descA,
+                            modeA,
+                            strideA,
+                            B[0],
+                            descB,
+                            modeB,
+                            strideB,
+                            batchCount,
+                            typeScalar,
+                            stream);
+    }
+
+    // Tensors of B that are their tensor of A are permuted in place one at a time,
+    // without a workspace
+    std::vector<const void*> outOfPlaceA;
+    std::vector<void*>       outOfPlaceB;
+    outOfPlaceA.reserve(batchCount);
+    outOfPlaceB.reserve(batchCount);
+    for(int64_t i = 0; i < batchCount; i++)
+    {
+        if(A[i] != B[i])
         {
-            printErrorMessage("descB");
+            outOfPlaceA.push_back(A[i]);
+            outOfPlaceB.push_back(B[i]);
+            continue;
         }
-        if(!modeB)
+
+        if(auto errorCode = permuteInPlace("hiptensorPermutationBatched",
+                                           handle,
+                                           alpha,
+                                           B[i],
+                                           descA,
+                                           modeA,
+                                           descB,
+                                           modeB,
+                                           typeScalar,
+                                           nullptr,
+                                           0,
+                                           stream);
+           errorCode != HIPTENSOR_STATUS_SUCCESS)
         {
-            printErrorMessage("modeB");
+            return errorCode;
         }
+    }
+
+    int64_t outOfPlaceCount = outOfPlaceA.size();
+    if(outOfPlaceCount == 0)
+    {
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // The device permutes the other tensors in one launch over arrays of base
+    // pointers. Host tensors are permuted one at a time with a kernel selected once.
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    if(!realHandle->isHostBackend())
+    {
+        return permutePointers("hiptensorPermutationBatched",
+                               alpha,
+                               outOfPlaceA.data(),
+                               descA,
+                               modeA,
+                               outOfPlaceB.data(),
+                               descB,
+                               modeB,
+                               outOfPlaceCount,
+                               typeScalar,
+                               stream);
+    }
+
+    hiptensorPermutationPlan_t plan;
+    if(auto errorCode
+       = hiptensorInitPermutationPlan(handle, &plan, descA, modeA, descB, modeB, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
         return errorCode;
     }
 
-    if(descA->mType != HIP_R_16F && descA->mType != HIP_R_32F)
+    for(int64_t i = 0; i < outOfPlaceCount; i++)
+    {
+        if(auto errorCode = hiptensorPermutationExecute(
+               handle, &plan, alpha, outOfPlaceA[i], outOfPlaceB[i], stream);
+           errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorPermutationGetWorkspaceSize(const hiptensorHandle_t*            handle,
+                                                       const hiptensorTensorDescriptor_t*  descA,
+                                                       const int32_t                       modeA[],
+                                                       const hiptensorTensorDescriptor_t*  descB,
+                                                       const int32_t                       modeB[],
+                                                       const hiptensorWorksizePreference_t pref,
+                                                       uint64_t* workspaceSize)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
     {
-        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
         snprintf(msg,
                  sizeof(msg),
-                 "Unsupported Data Type Error : The supported data types of A and B are HIP_R_16F "
-                 "and HIP_R_32F (%s)",
-                 hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+                 "handle=%p, descA=%p, modeA=%p, descB=%p, modeB=%p, pref=%d, workspaceSize=%p",
+                 handle,
+                 descA,
+                 modeA,
+                 descB,
+                 modeB,
+                 (int)pref,
+                 workspaceSize);
+
+        logger->logAPITrace("hiptensorPermutationGetWorkspaceSize", msg);
+    }
+
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorPermutationGetWorkspaceSize",
+                                                {{"handle", handle},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB},
+                                                 {"workspaceSize", workspaceSize}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
         return errorCode;
     }
 
-    if(descA->mType != descB->mType)
+    hiptensor::InPlacePermutation inPlace;
+    if(!isSupportedDataType(descA->mType)
+       || !hiptensor::makeInPlacePermutation(descA, modeA, descB, modeB, inPlace))
     {
-        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
         snprintf(msg,
                  sizeof(msg),
-                 "Mismatched Data Type Error : Data types of A and B are not the same. (%s)",
+                 "Unsupported In-place Error : A and B must have the same supported data type, "
+                 "the same modes and packed strides to be permuted in place (%s)",
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+        logger->logError("hiptensorPermutationGetWorkspaceSize", msg);
         return errorCode;
     }
 
-    if(typeScalar != HIP_R_16F && typeScalar != HIP_R_32F)
+    *workspaceSize = hiptensor::inPlaceWorkspaceSize(inPlace, pref);
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorPermutationInPlace(const hiptensorHandle_t*           handle,
+                                              const void*                        alpha,
+                                              void*                              A,
+                                              const hiptensorTensorDescriptor_t* descA,
+                                              const int32_t                      modeA[],
+                                              const hiptensorTensorDescriptor_t* descB,
+                                              const int32_t                      modeB[],
+                                              const hipDataType                  typeScalar,
+                                              void*                              workspace,
+                                              uint64_t                           workspaceSize,
+                                              const hipStream_t                  stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
     {
-        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
         snprintf(msg,
                  sizeof(msg),
-                 "Unsupported Data Type Error : The supported data types of alpha are HIP_R_16F "
-                 "and HIP_R_32F (%s)",
-                 hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
-        return errorCode;
-    }
-
-    auto& instances = hiptensor::PermutationSolutionInstances::instance();
-    auto  solutions = instances->query(alpha,
-                                      descA,
-                                      modeA,
-                                      descB,
-                                      modeB,
-                                      typeScalar,
-                                      hiptensor::PermutationInstanceType_t::Device);
-
-    bool canRun = false;
-    for(auto pSolution : solutions)
-    {
-        canRun = pSolution->initArgs(alpha,
-                                     A,
-                                     B,
-                                     descA->mLengths,
-                                     descA->mStrides,
-                                     modeA,
-                                     descB->mLengths,
-                                     descB->mStrides,
-                                     modeB,
-                                     typeScalar);
-
-        if(canRun)
-        {
-            // Perform permutation with timing if LOG_LEVEL_PERF_TRACE
-            if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
-            {
-                using hiptensor::HiptensorOptions;
-                auto& options = HiptensorOptions::instance();
-
-                auto time = (*pSolution)(StreamConfig{
-                    stream, // stream id
-                    true, // time_kernel
-                    0, // log_level
-                    options->coldRuns(), // cold_niters
-                    options->hotRuns(), // nrepeat
-                });
-                if(time < 0)
-                {
-                    return HIPTENSOR_STATUS_CK_ERROR;
-                }
-
-                auto flops = std::size_t(2) * pSolution->problemSize();
-                auto bytes = pSolution->problemBytes();
+                 "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, descB=%p, modeB=%p, "
+                 "typeScalar=0x%02X, workspace=%p, workspaceSize=%lu, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 descB,
+                 modeB,
+                 (unsigned int)typeScalar,
+                 workspace,
+                 (unsigned long)workspaceSize,
+                 stream);
 
-                hiptensor::PerfMetrics metrics = {
-                    pSolution->uid(), // id
-                    pSolution->kernelName(), // name
-                    time, // avg time
-                    static_cast<float>(flops) / static_cast<float>(1.E9) / time, // tflops
-                    static_cast<float>(bytes) / static_cast<float>(1.E6) / time // BW
-                };
+        logger->logAPITrace("hiptensorPermutationInPlace", msg);
+    }
 
-                // log perf metrics (not name/id)
-                snprintf(msg,
-                         sizeof(msg),
-                         "KernelId: %lu KernelName: %s, %0.3f ms, %0.3f TFlops, %0.3f GB/s",
-                         metrics.mKernelUid,
-                         metrics.mKernelName.c_str(),
-                         metrics.mAvgTimeMs,
-                         metrics.mTflops,
-                         metrics.mBandwidth);
-                logger->logPerformanceTrace("hiptensorPermutation", msg);
-            }
-            // Perform permutation without timing
-            else
-            {
-                if((*pSolution)(StreamConfig{stream, false}) < 0)
-                {
-                    return HIPTENSOR_STATUS_CK_ERROR;
-                }
-            }
+    if(auto errorCode = hiptensor::checkNotNull("hiptensorPermutationInPlace",
+                                                {{"handle", handle},
+                                                 {"alpha", alpha},
+                                                 {"A", A},
+                                                 {"descA", descA},
+                                                 {"modeA", modeA},
+                                                 {"descB", descB},
+                                                 {"modeB", modeB}});
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
 
-            return HIPTENSOR_STATUS_SUCCESS;
-        }
+    if(auto errorCode = checkDataTypes("hiptensorPermutationInPlace", descA, descB, typeScalar);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
     }
 
-    auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
-    snprintf(msg,
-             sizeof(msg),
-             "Selected kernel is unable to solve the problem (%s)",
-             hiptensorGetErrorString(errorCode));
-    logger->logError("hiptensorPermutation", msg);
-    return errorCode;
+    return permuteInPlace("hiptensorPermutationInPlace",
+                          handle,
+                          alpha,
+                          A,
+                          descA,
+                          modeA,
+                          descB,
+                          modeB,
+                          typeScalar,
+                          workspace,
+                          workspaceSize,
+                          stream);
 }
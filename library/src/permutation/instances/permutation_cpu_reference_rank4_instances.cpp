@@ -96,5 +96,70 @@ namespace hiptensor
                                         ck::tensor_operation::element_wise::UnarySquare,
                                         ck::tensor_operation::element_wise::Scale,
                                         4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<ck::bhalf_t>,
+                                        ck::Tuple<ck::bhalf_t>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<double>,
+                                        ck::Tuple<double>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        // Conversions between the data types of A and B
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<ck::half_t>,
+                                        ck::Tuple<float>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<float>,
+                                        ck::Tuple<ck::half_t>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<ck::bhalf_t>,
+                                        ck::Tuple<float>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<float>,
+                                        ck::Tuple<ck::bhalf_t>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<float>,
+                                        ck::Tuple<double>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
+
+        registerSolutions(
+            enumerateReferenceSolutions<ck::Tuple<double>,
+                                        ck::Tuple<float>,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        4>());
     }
 } // namespace hiptensor
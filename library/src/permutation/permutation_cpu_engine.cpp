@@ -0,0 +1,368 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
+#include "permutation_cpu_engine.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define HIPTENSOR_PERMUTATION_CPU_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace hiptensor
+{
+    namespace
+    {
+        template <typename T>
+        void transposeScalar(
+            T const* src, int64_t ldSrc, T* dst, int64_t ldDst, int64_t rows, int64_t cols)
+        {
+            for(int64_t c = 0; c < cols; c++)
+            {
+                for(int64_t r = 0; r < rows; r++)
+                {
+                    dst[c * ldDst + r] = src[r * ldSrc + c];
+                }
+            }
+        }
+
+        // Transposes full Block x Block sub-blocks with kernel, and the edges element-wise
+        template <int64_t Block, typename T>
+        void transposeBlocked(T const* src,
+                              int64_t  ldSrc,
+                              T*       dst,
+                              int64_t  ldDst,
+                              int64_t  rows,
+                              int64_t  cols,
+                              void (*kernel)(T const*, int64_t, T*, int64_t))
+        {
+            auto const rowsFull = rows / Block * Block;
+            auto const colsFull = cols / Block * Block;
+
+            for(int64_t r = 0; r < rowsFull; r += Block)
+            {
+                for(int64_t c = 0; c < colsFull; c += Block)
+                {
+                    kernel(src + r * ldSrc + c, ldSrc, dst + c * ldDst + r, ldDst);
+                }
+            }
+
+            transposeScalar(
+                src + colsFull, ldSrc, dst + colsFull * ldDst, ldDst, rowsFull, cols - colsFull);
+            transposeScalar(
+                src + rowsFull * ldSrc, ldSrc, dst + rowsFull, ldDst, rows - rowsFull, cols);
+        }
+
+#if HIPTENSOR_PERMUTATION_CPU_SIMD
+        bool hasAvx()
+        {
+            static const bool sSupported = __builtin_cpu_supports("avx");
+            return sSupported;
+        }
+
+        // 8 x 8 16-bit block through three rounds of SSE2 unpacks
+        void transpose8x8Sse2(uint16_t const* src, int64_t ldSrc, uint16_t* dst, int64_t ldDst)
+        {
+            __m128i a[8];
+            for(int i = 0; i < 8; i++)
+            {
+                a[i] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i * ldSrc));
+            }
+
+            __m128i b[8];
+            for(int i = 0; i < 4; i++)
+            {
+                b[2 * i]     = _mm_unpacklo_epi16(a[2 * i], a[2 * i + 1]);
+                b[2 * i + 1] = _mm_unpackhi_epi16(a[2 * i], a[2 * i + 1]);
+            }
+
+            __m128i c[8];
+            for(int i = 0; i < 2; i++)
+            {
+                c[4 * i]     = _mm_unpacklo_epi32(b[4 * i], b[4 * i + 2]);
+                c[4 * i + 1] = _mm_unpackhi_epi32(b[4 * i], b[4 * i + 2]);
+                c[4 * i + 2] = _mm_unpacklo_epi32(b[4 * i + 1], b[4 * i + 3]);
+                c[4 * i + 3] = _mm_unpackhi_epi32(b[4 * i + 1], b[4 * i + 3]);
+            }
+
+            for(int i = 0; i < 4; i++)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * i * ldDst),
+                                 _mm_unpacklo_epi64(c[i], c[i + 4]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (2 * i + 1) * ldDst),
+                                 _mm_unpackhi_epi64(c[i], c[i + 4]));
+            }
+        }
+
+        // 4 x 4 32-bit block with SSE shuffles
+        void transpose4x4Sse(float const* src, int64_t ldSrc, float* dst, int64_t ldDst)
+        {
+            auto r0 = _mm_loadu_ps(src);
+            auto r1 = _mm_loadu_ps(src + ldSrc);
+            auto r2 = _mm_loadu_ps(src + 2 * ldSrc);
+            auto r3 = _mm_loadu_ps(src + 3 * ldSrc);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(dst, r0);
+            _mm_storeu_ps(dst + ldDst, r1);
+            _mm_storeu_ps(dst + 2 * ldDst, r2);
+            _mm_storeu_ps(dst + 3 * ldDst, r3);
+        }
+
+        // 8 x 8 32-bit block: unpack pairs, shuffle quads, then swap 128-bit lanes
+        __attribute__((target("avx"))) void
+            transpose8x8Avx(float const* src, int64_t ldSrc, float* dst, int64_t ldDst)
+        {
+            __m256 r[8];
+            for(int i = 0; i < 8; i++)
+            {
+                r[i] = _mm256_loadu_ps(src + i * ldSrc);
+            }
+
+            __m256 t[8];
+            for(int i = 0; i < 4; i++)
+            {
+                t[2 * i]     = _mm256_unpacklo_ps(r[2 * i], r[2 * i + 1]);
+                t[2 * i + 1] = _mm256_unpackhi_ps(r[2 * i], r[2 * i + 1]);
+            }
+
+            __m256 s[8];
+            for(int i = 0; i < 2; i++)
+            {
+                s[4 * i]     = _mm256_shuffle_ps(t[4 * i], t[4 * i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+                s[4 * i + 1] = _mm256_shuffle_ps(t[4 * i], t[4 * i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+                s[4 * i + 2]
+                    = _mm256_shuffle_ps(t[4 * i + 1], t[4 * i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+                s[4 * i + 3]
+                    = _mm256_shuffle_ps(t[4 * i + 1], t[4 * i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+            }
+
+            for(int i = 0; i < 4; i++)
+            {
+                _mm256_storeu_ps(dst + i * ldDst, _mm256_permute2f128_ps(s[i], s[i + 4], 0x20));
+                _mm256_storeu_ps(dst + (i + 4) * ldDst,
+                                 _mm256_permute2f128_ps(s[i], s[i + 4], 0x31));
+            }
+        }
+
+        // 2 x 2 64-bit block with SSE2 unpacks
+        void transpose2x2Sse2(double const* src, int64_t ldSrc, double* dst, int64_t ldDst)
+        {
+            auto r0 = _mm_loadu_pd(src);
+            auto r1 = _mm_loadu_pd(src + ldSrc);
+            _mm_storeu_pd(dst, _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd(dst + ldDst, _mm_unpackhi_pd(r0, r1));
+        }
+
+        // 4 x 4 64-bit block: unpack pairs, then swap 128-bit lanes
+        __attribute__((target("avx"))) void
+            transpose4x4Avx(double const* src, int64_t ldSrc, double* dst, int64_t ldDst)
+        {
+            __m256d r[4];
+            for(int i = 0; i < 4; i++)
+            {
+                r[i] = _mm256_loadu_pd(src + i * ldSrc);
+            }
+
+            auto t0 = _mm256_unpacklo_pd(r[0], r[1]);
+            auto t1 = _mm256_unpackhi_pd(r[0], r[1]);
+            auto t2 = _mm256_unpacklo_pd(r[2], r[3]);
+            auto t3 = _mm256_unpackhi_pd(r[2], r[3]);
+
+            _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(dst + ldDst, _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(dst + 2 * ldDst, _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(dst + 3 * ldDst, _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+#endif // HIPTENSOR_PERMUTATION_CPU_SIMD
+    } // namespace
+
+    PermutationCpuPlan makePermutationCpuPlan(std::vector<int64_t> const& lengths,
+                                              std::vector<int64_t> const& inStrides,
+                                              std::vector<int64_t> const& outStrides)
+    {
+        PermutationCpuPlan plan;
+        plan.mElementCount = std::accumulate(
+            lengths.begin(), lengths.end(), int64_t(1), std::multiplies<int64_t>());
+        plan.mTranspose = false;
+
+        if(plan.mElementCount == 0)
+        {
+            return plan;
+        }
+
+        // Visit the modes from the smallest input stride, so that modes which
+        // are adjacent in memory are also adjacent here
+        std::vector<std::size_t> order;
+        for(std::size_t d = 0; d < lengths.size(); d++)
+        {
+            if(lengths[d] != 1)
+            {
+                order.push_back(d);
+            }
+        }
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+            return std::abs(inStrides[lhs]) < std::abs(inStrides[rhs]);
+        });
+
+        for(auto d : order)
+        {
+            if(!plan.mLengths.empty())
+            {
+                auto const prevLength = plan.mLengths.back();
+                if(inStrides[d] == plan.mStridesIn.back() * prevLength
+                   && outStrides[d] == plan.mStridesOut.back() * prevLength)
+                {
+                    plan.mLengths.back() *= lengths[d];
+                    continue;
+                }
+            }
+
+            plan.mLengths.push_back(lengths[d]);
+            plan.mStridesIn.push_back(inStrides[d]);
+            plan.mStridesOut.push_back(outStrides[d]);
+        }
+
+        if(plan.mLengths.empty())
+        {
+            return plan;
+        }
+
+        // Mode 0 is innermost in the input. Bring the innermost output mode
+        // next to it when they differ, then order the outer modes by output
+        // stride so that consecutive units write close together.
+        std::vector<std::size_t> modes(plan.mLengths.size());
+        std::iota(modes.begin(), modes.end(), 0);
+
+        auto byOutStride = [&](std::size_t lhs, std::size_t rhs) {
+            return std::abs(plan.mStridesOut[lhs]) < std::abs(plan.mStridesOut[rhs]);
+        };
+
+        if(modes.size() > 1)
+        {
+            auto innerOut   = *std::min_element(modes.begin() + 1, modes.end(), byOutStride);
+            plan.mTranspose = byOutStride(innerOut, 0);
+            if(plan.mTranspose)
+            {
+                std::swap(modes[1], modes[innerOut]);
+            }
+        }
+        std::stable_sort(modes.begin() + (plan.mTranspose ? 2 : 1), modes.end(), byOutStride);
+
+        auto permute = [&modes](std::vector<int64_t>& values) {
+            std::vector<int64_t> result;
+            for(auto m : modes)
+            {
+                result.push_back(values[m]);
+            }
+            values = std::move(result);
+        };
+        permute(plan.mLengths);
+        permute(plan.mStridesIn);
+        permute(plan.mStridesOut);
+
+        return plan;
+    }
+
+    void permutationCpuTranspose(void const* src,
+                                 int64_t     ldSrc,
+                                 void*       dst,
+                                 int64_t     ldDst,
+                                 int64_t     rows,
+                                 int64_t     cols,
+                                 std::size_t elementBytes)
+    {
+        switch(elementBytes)
+        {
+        case 2:
+        {
+            auto s = static_cast<uint16_t const*>(src);
+            auto d = static_cast<uint16_t*>(dst);
+#if HIPTENSOR_PERMUTATION_CPU_SIMD
+            transposeBlocked<8>(s, ldSrc, d, ldDst, rows, cols, transpose8x8Sse2);
+#else
+            transposeScalar(s, ldSrc, d, ldDst, rows, cols);
+#endif
+            return;
+        }
+        case 4:
+        {
+            auto s = static_cast<float const*>(src);
+            auto d = static_cast<float*>(dst);
+#if HIPTENSOR_PERMUTATION_CPU_SIMD
+            if(hasAvx())
+            {
+                transposeBlocked<8>(s, ldSrc, d, ldDst, rows, cols, transpose8x8Avx);
+            }
+            else
+            {
+                transposeBlocked<4>(s, ldSrc, d, ldDst, rows, cols, transpose4x4Sse);
+            }
+#else
+            transposeScalar(s, ldSrc, d, ldDst, rows, cols);
+#endif
+            return;
+        }
+        case 8:
+        {
+            auto s = static_cast<double const*>(src);
+            auto d = static_cast<double*>(dst);
+#if HIPTENSOR_PERMUTATION_CPU_SIMD
+            if(hasAvx())
+            {
+                transposeBlocked<4>(s, ldSrc, d, ldDst, rows, cols, transpose4x4Avx);
+            }
+            else
+            {
+                transposeBlocked<2>(s, ldSrc, d, ldDst, rows, cols, transpose2x2Sse2);
+            }
+#else
+            transposeScalar(s, ldSrc, d, ldDst, rows, cols);
+#endif
+            return;
+        }
+        default:
+        {
+            auto s = static_cast<char const*>(src);
+            auto d = static_cast<char*>(dst);
+            for(int64_t c = 0; c < cols; c++)
+            {
+                for(int64_t r = 0; r < rows; r++)
+                {
+                    std::memcpy(d + (c * ldDst + r) * elementBytes,
+                                s + (r * ldSrc + c) * elementBytes,
+                                elementBytes);
+                }
+            }
+            return;
+        }
+        }
+    }
+
+} // namespace hiptensor
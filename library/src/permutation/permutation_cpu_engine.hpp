@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_CPU_ENGINE_HPP
+#define HIPTENSOR_PERMUTATION_CPU_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hiptensor
+{
+    // @cond
+    // Host permutation problem B_{idx} = op(A_{idx}) over folded modes.
+    // Mode 0 is the mode with the smallest input stride. When the output is
+    // innermost along a different mode, that mode is mode 1 and the two are
+    // transposed in tiles. Every remaining (outer) mode is a parallel loop.
+    struct PermutationCpuPlan
+    {
+        int64_t mElementCount;
+
+        // Folded mode lengths and the input and output strides along them
+        std::vector<int64_t> mLengths;
+        std::vector<int64_t> mStridesIn;
+        std::vector<int64_t> mStridesOut;
+
+        // Whether modes 0 and 1 form a tiled transpose
+        bool mTranspose;
+    };
+
+    // Builds the plan from per-mode lengths, input strides and output strides,
+    // all in the same mode order. Length-1 modes are dropped and modes that are
+    // contiguous in both tensors are folded together.
+    PermutationCpuPlan makePermutationCpuPlan(std::vector<int64_t> const& lengths,
+                                              std::vector<int64_t> const& inStrides,
+                                              std::vector<int64_t> const& outStrides);
+
+    // Tile sizes: Tile x Tile elements per transpose, and the number of elements
+    // of the contiguous inner loop handled in one unit when no transpose is needed.
+    struct PermutationCpuBlocking
+    {
+        static constexpr int64_t Tile         = 64;
+        static constexpr int64_t Chunk        = 8192;
+        static constexpr int64_t TaskElements = 32768;
+    };
+
+    // Bitwise transpose of a rows x cols block: dst[c * ldDst + r] = src[r * ldSrc + c].
+    // 2, 4 and 8 byte elements use SSE2/AVX shuffles on 8x8 or 4x4 sub-blocks.
+    void permutationCpuTranspose(void const* src,
+                                 int64_t     ldSrc,
+                                 void*       dst,
+                                 int64_t     ldDst,
+                                 int64_t     rows,
+                                 int64_t     cols,
+                                 std::size_t elementBytes);
+
+    // Runs the permutation on the host thread pool.
+    // op(out, in) writes one output element from one input element, matching
+    // the CK element-wise operator signature.
+    template <typename InT, typename OutT, typename Op>
+    void permutationCpu(PermutationCpuPlan const& plan, InT const* in, OutT* out, Op&& op);
+
+    // Runs func(inOffset, outOffset) for every element, in the same tiles and on
+    // the same thread pool as permutationCpu. For callers whose elements are not
+    // plain arrays, such as converting loads.
+    template <typename Func>
+    void permutationCpuOffsets(PermutationCpuPlan const& plan, Func&& func);
+    // @endcond
+
+} // namespace hiptensor
+
+#include "permutation_cpu_engine_impl.hpp"
+
+#endif // HIPTENSOR_PERMUTATION_CPU_ENGINE_HPP
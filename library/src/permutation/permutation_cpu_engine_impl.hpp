@@ -0,0 +1,261 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_CPU_ENGINE_IMPL_HPP
+#define HIPTENSOR_PERMUTATION_CPU_ENGINE_IMPL_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "permutation_cpu_engine.hpp"
+#include "thread_pool.hpp"
+
+namespace hiptensor
+{
+    namespace detail
+    {
+        // Prefetches count elements starting at ptr into the cache
+        template <typename T>
+        inline void prefetchElements(T const* ptr, int64_t count)
+        {
+            constexpr int64_t LineElements = std::max<int64_t>(1, 64 / sizeof(T));
+            for(int64_t i = 0; i < count; i += LineElements)
+            {
+                __builtin_prefetch(ptr + i);
+            }
+        }
+
+        // Walks the plan in units of one tile (or chunk) of the inner modes at one
+        // outer index, on the thread pool. Calls unit(baseIn, baseOut, i0, ni, j0, nj)
+        // for the block [i0, i0 + ni) x [j0, j0 + nj) of modes 0 and 1, where
+        // baseIn and baseOut are the offsets of the outer index.
+        template <typename Unit>
+        void forEachPermutationUnit(PermutationCpuPlan const& plan, Unit&& unitFunc)
+        {
+            constexpr auto Tile  = PermutationCpuBlocking::Tile;
+            constexpr auto Chunk = PermutationCpuBlocking::Chunk;
+
+            auto const& lengths    = plan.mLengths;
+            auto const& stridesIn  = plan.mStridesIn;
+            auto const& stridesOut = plan.mStridesOut;
+            auto const  transpose  = plan.mTranspose;
+            auto const  rank       = static_cast<int64_t>(lengths.size());
+            auto const  firstOuter = transpose ? int64_t(2) : int64_t(1);
+
+            // Units are numbered with the mode 0 tile fastest, then mode 1, then the outer modes
+            auto const len0   = lengths[0];
+            auto const len1   = transpose ? lengths[1] : int64_t(1);
+            auto const block0 = transpose ? Tile : Chunk;
+            auto const block1 = transpose ? Tile : int64_t(1);
+            auto const tiles0 = (len0 + block0 - 1) / block0;
+            auto const tiles1 = (len1 + block1 - 1) / block1;
+            auto const units  = tiles0 * tiles1 * (plan.mElementCount / (len0 * len1));
+
+            // Group units into tasks of about TaskElements elements, while keeping
+            // enough tasks to balance the thread pool
+            auto const threads      = static_cast<int64_t>(ThreadPool::instance()->threadCount());
+            auto const unitSize     = std::min(len0, block0) * std::min(len1, block1);
+            auto       unitsPerTask = PermutationCpuBlocking::TaskElements / unitSize;
+            unitsPerTask            = std::min(unitsPerTask, units / (threads * 4));
+            unitsPerTask            = std::max<int64_t>(1, unitsPerTask);
+            auto const tasks        = (units + unitsPerTask - 1) / unitsPerTask;
+
+            ThreadPool::instance()->parallelFor(tasks, [&](std::size_t task) {
+                auto unit    = static_cast<int64_t>(task) * unitsPerTask;
+                auto unitEnd = std::min(unit + unitsPerTask, units);
+
+                // Decompose the first unit, then walk the rest as an odometer
+                auto t0    = unit % tiles0;
+                auto t1    = (unit / tiles0) % tiles1;
+                auto outer = unit / (tiles0 * tiles1);
+
+                std::vector<int64_t> index(rank, 0);
+                int64_t              baseIn  = 0;
+                int64_t              baseOut = 0;
+                for(auto d = firstOuter; d < rank; d++)
+                {
+                    index[d] = outer % lengths[d];
+                    outer /= lengths[d];
+                    baseIn += index[d] * stridesIn[d];
+                    baseOut += index[d] * stridesOut[d];
+                }
+
+                for(; unit < unitEnd; unit++)
+                {
+                    auto const i0 = t0 * block0;
+                    auto const j0 = t1 * block1;
+                    unitFunc(baseIn,
+                             baseOut,
+                             i0,
+                             std::min(block0, len0 - i0),
+                             j0,
+                             std::min(block1, len1 - j0));
+
+                    // Advance to the next unit
+                    if(++t0 < tiles0)
+                    {
+                        continue;
+                    }
+                    t0 = 0;
+                    if(++t1 < tiles1)
+                    {
+                        continue;
+                    }
+                    t1 = 0;
+                    for(auto d = firstOuter; d < rank; d++)
+                    {
+                        baseIn += stridesIn[d];
+                        baseOut += stridesOut[d];
+                        if(++index[d] < lengths[d])
+                        {
+                            break;
+                        }
+                        baseIn -= lengths[d] * stridesIn[d];
+                        baseOut -= lengths[d] * stridesOut[d];
+                        index[d] = 0;
+                    }
+                }
+            });
+        }
+    } // namespace detail
+
+    template <typename InT, typename OutT, typename Op>
+    void permutationCpu(PermutationCpuPlan const& plan, InT const* in, OutT* out, Op&& op)
+    {
+        constexpr auto Tile = PermutationCpuBlocking::Tile;
+
+        if(plan.mElementCount == 0)
+        {
+            return;
+        }
+
+        if(plan.mLengths.empty())
+        {
+            op(out[0], in[0]);
+            return;
+        }
+
+        auto const& stridesIn  = plan.mStridesIn;
+        auto const& stridesOut = plan.mStridesOut;
+        auto const  len0       = plan.mLengths[0];
+
+        detail::forEachPermutationUnit(
+            plan,
+            [&](int64_t baseIn, int64_t baseOut, int64_t i0, int64_t ni, int64_t j0, int64_t nj) {
+                auto src = in + baseIn + i0 * stridesIn[0];
+                auto dst = out + baseOut + i0 * stridesOut[0];
+
+                if(!plan.mTranspose)
+                {
+                    if(stridesIn[0] == 1 && stridesOut[0] == 1)
+                    {
+                        for(int64_t i = 0; i < ni; i++)
+                        {
+                            op(dst[i], src[i]);
+                        }
+                    }
+                    else
+                    {
+                        for(int64_t i = 0; i < ni; i++)
+                        {
+                            op(dst[i * stridesOut[0]], src[i * stridesIn[0]]);
+                        }
+                    }
+                }
+                else if(stridesIn[0] == 1 && stridesOut[1] == 1)
+                {
+                    // Convert the tile with contiguous reads into a stage buffer,
+                    // prefetching the tile that follows along mode 0,
+                    // then transpose it out with contiguous writes.
+                    alignas(64) OutT stage[Tile * Tile];
+
+                    src += j0 * stridesIn[1];
+                    dst += j0;
+                    auto const prefetch = std::min(Tile, len0 - i0 - ni);
+                    for(int64_t j = 0; j < nj; j++)
+                    {
+                        auto row = src + j * stridesIn[1];
+                        detail::prefetchElements(row + ni, prefetch);
+                        for(int64_t i = 0; i < ni; i++)
+                        {
+                            op(stage[j * Tile + i], row[i]);
+                        }
+                    }
+                    permutationCpuTranspose(stage, Tile, dst, stridesOut[0], nj, ni, sizeof(OutT));
+                }
+                else
+                {
+                    src += j0 * stridesIn[1];
+                    dst += j0 * stridesOut[1];
+                    for(int64_t j = 0; j < nj; j++)
+                    {
+                        for(int64_t i = 0; i < ni; i++)
+                        {
+                            op(dst[i * stridesOut[0] + j * stridesOut[1]],
+                               src[i * stridesIn[0] + j * stridesIn[1]]);
+                        }
+                    }
+                }
+            });
+    }
+
+    template <typename Func>
+    void permutationCpuOffsets(PermutationCpuPlan const& plan, Func&& func)
+    {
+        if(plan.mElementCount == 0)
+        {
+            return;
+        }
+
+        if(plan.mLengths.empty())
+        {
+            func(int64_t(0), int64_t(0));
+            return;
+        }
+
+        auto const& stridesIn  = plan.mStridesIn;
+        auto const& stridesOut = plan.mStridesOut;
+        auto const  stride1In  = plan.mTranspose ? stridesIn[1] : int64_t(0);
+        auto const  stride1Out = plan.mTranspose ? stridesOut[1] : int64_t(0);
+
+        detail::forEachPermutationUnit(
+            plan,
+            [&](int64_t baseIn, int64_t baseOut, int64_t i0, int64_t ni, int64_t j0, int64_t nj) {
+                for(int64_t j = j0; j < j0 + nj; j++)
+                {
+                    auto rowIn  = baseIn + j * stride1In;
+                    auto rowOut = baseOut + j * stride1Out;
+                    for(int64_t i = i0; i < i0 + ni; i++)
+                    {
+                        func(rowIn + i * stridesIn[0], rowOut + i * stridesOut[0]);
+                    }
+                }
+            });
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERMUTATION_CPU_ENGINE_IMPL_HPP
@@ -24,9 +24,12 @@
  *
  *******************************************************************************/
 
+#include <vector>
+
 #include "permutation_cpu_reference.hpp"
 #include "permutation_cpu_reference_impl.hpp"
 #include "permutation_cpu_reference_instances.hpp"
+#include "permutation_folding.hpp"
 
 hiptensorStatus_t hiptensorPermutationReference(const hiptensorHandle_t*           handle,
                                                 const void*                        alpha,
@@ -39,11 +42,49 @@ hiptensorStatus_t hiptensorPermutationReference(const hiptensorHandle_t*
                                                 const hipDataType                  typeScalar,
                                                 const hipStream_t                  stream)
 {
-    const int32_t dim       = descA->mLengths.size();
-    auto&         instances = hiptensor::PermutationCpuReferenceInstances::instance();
+    // Complex tensors are permuted as real tensors, with the real and imaginary
+    // parts as an extra mode
+    hiptensor::FoldedPermutation complexView;
+    double                       realAlpha  = 0.0;
+    auto                         scalarType = typeScalar;
+    if(hiptensor::complexAsRealPermutation(descA, modeA, descB, modeB, complexView))
+    {
+        if(!hiptensor::realPermutationAlpha(alpha, typeScalar, realAlpha))
+        {
+            return HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+        alpha      = &realAlpha;
+        scalarType = HIP_R_64F;
+        descA      = &complexView.mDescA;
+        modeA      = complexView.mModeA.data();
+        descB      = &complexView.mDescB;
+        modeB      = complexView.mModeB.data();
+    }
+
+    // In-place permutations read a copy of A, as the CPU solutions write B while
+    // reading A
+    std::vector<char> copyA;
+    if(A == B)
+    {
+        std::size_t span = 1;
+        for(std::size_t i = 0; i < descA->mLengths.size(); i++)
+        {
+            if(descA->mLengths[i] == 0)
+            {
+                span = 0;
+                break;
+            }
+            span += (descA->mLengths[i] - 1) * descA->mStrides[i];
+        }
+        auto bytes = span * hiptensor::hipDataTypeSize(descA->mType);
+        copyA.assign(static_cast<char const*>(A), static_cast<char const*>(A) + bytes);
+        A = copyA.data();
+    }
+
+    auto& instances = hiptensor::PermutationCpuReferenceInstances::instance();
 
     auto refCandidates = instances->query(
-        alpha, descA, modeA, descB, modeB, typeScalar, hiptensor::PermutationInstanceType_t::Host);
+        alpha, descA, modeA, descB, modeB, scalarType, hiptensor::PermutationInstanceType_t::Host);
 
     for(auto refCandidate : refCandidates)
     {
@@ -56,7 +97,7 @@ hiptensorStatus_t hiptensorPermutationReference(const hiptensorHandle_t*
                                   descB->mLengths,
                                   descB->mStrides,
                                   modeB,
-                                  typeScalar))
+                                  scalarType))
         {
             (*refCandidate)();
             return HIPTENSOR_STATUS_SUCCESS;
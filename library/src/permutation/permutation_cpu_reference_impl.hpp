@@ -38,6 +38,7 @@
 #include <device_elementwise_dynamic_vector_dims_impl.hpp>
 #include <host_tensor.hpp>
 
+#include "permutation_cpu_engine.hpp"
 #include "permutation_meta_traits.hpp"
 #include "permutation_solution.hpp"
 
@@ -222,6 +223,68 @@ namespace hiptensor
         }
     };
 
+    // Host permutation running on the multithreaded CPU engine.
+    // Shares the argument of the reference permutation.
+    template <typename InDataTypeTuple,
+              typename OutDataTypeTuple,
+              typename ElementOp,
+              ck::index_t NumDim>
+    struct HostPermutation
+        : public ReferencePermutation<InDataTypeTuple, OutDataTypeTuple, ElementOp, NumDim>
+    {
+        using Base = ReferencePermutation<InDataTypeTuple, OutDataTypeTuple, ElementOp, NumDim>;
+
+        using BaseArgument = ck::tensor_operation::device::BaseArgument;
+        using BaseInvoker  = ck::tensor_operation::device::BaseInvoker;
+        using Argument     = typename Base::Argument;
+
+        // Invoker
+        struct Invoker : public BaseInvoker
+        {
+            float Run(const Argument& arg)
+            {
+                auto toInt64 = [](std::array<ck::index_t, NumDim> const& a) {
+                    return std::vector<int64_t>(a.begin(), a.end());
+                };
+
+                auto plan = makePermutationCpuPlan(toInt64(arg.mLengths),
+                                                   toInt64(arg.mInStrides[0]),
+                                                   toInt64(arg.mOutStrides[0]));
+                permutationCpu(plan, arg.mInput, arg.mOutput, arg.mElementOp);
+                return 0;
+            }
+
+            float Run(const BaseArgument* p_arg,
+                      const StreamConfig& /* stream_config */ = StreamConfig{}) override
+            {
+                return Run(*dynamic_cast<const Argument*>(p_arg));
+            }
+        };
+
+        static auto MakeInvoker()
+        {
+            return Invoker{};
+        }
+
+        std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+        {
+            return std::make_unique<Invoker>(Invoker{});
+        }
+
+        std::string GetTypeString() const override
+        {
+            auto str = std::stringstream();
+
+            // clang-format off
+            str << "HostPermutation<";
+            str << NumDim << ", ";
+            str << 1 << ">";
+            // clang-format on
+
+            return str.str();
+        }
+    };
+
     // Partial specialize for reference permutation
     template <typename InDataTypeTuple,
               typename OutDataTypeTuple,
@@ -242,6 +305,26 @@ namespace hiptensor
     {
     };
 
+    // Partial specialize for host permutation
+    template <typename InDataTypeTuple,
+              typename OutDataTypeTuple,
+              typename Aop,
+              typename Bop,
+              typename Scale,
+              ck::index_t NumDim>
+    struct MetaTraits<
+        HostPermutation<InDataTypeTuple,
+                        OutDataTypeTuple,
+                        ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, Scale, Bop>,
+                        NumDim>>
+        : public MetaTraits<ck::tensor_operation::device::DeviceElementwise<
+              InDataTypeTuple,
+              OutDataTypeTuple,
+              ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, Scale, Bop>,
+              NumDim>>
+    {
+    };
+
     template <typename InDataTypeTuple,
               typename OutDataTypeTuple,
               typename Aop,
@@ -250,17 +333,19 @@ namespace hiptensor
               ck::index_t NumDim>
     auto enumerateReferenceSolutions()
     {
-        using ReferenceOp = ReferencePermutation<
+        // The host engine replaces the element-wise reference as the registered solution
+        using ScaleOp     = PermutationScaleOp_t<Scale, OutDataTypeTuple>;
+        using ReferenceOp = HostPermutation<
             InDataTypeTuple,
             OutDataTypeTuple,
-            ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, Scale, Bop>,
+            ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, ScaleOp, Bop>,
             NumDim>;
 
         auto solution = std::make_unique<PermutationSolutionImpl<ReferenceOp>>(
             std::make_unique<ReferenceOp>());
 
         auto hashCode = ck::tensor_operation::device::instance::
-            DeviceElementwiseParams<InDataTypeTuple, OutDataTypeTuple, Aop, Bop, Scale, NumDim>::
+            DeviceElementwiseParams<InDataTypeTuple, OutDataTypeTuple, Aop, Bop, ScaleOp, NumDim>::
                 hashCode();
         auto result = std::unordered_map<Uid, std::unique_ptr<PermutationSolution>>();
         result.insert({hashCode, std::move(solution)});
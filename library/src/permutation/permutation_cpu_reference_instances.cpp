@@ -26,15 +26,20 @@
 
 #include "permutation_cpu_reference_instances.hpp"
 #include "permutation_cpu_reference_impl.hpp"
+#include "registry_profiler.hpp"
 
 namespace hiptensor
 {
     PermutationCpuReferenceInstances::PermutationCpuReferenceInstances()
     {
+        RegistryProfiler::ScopedTimer timer("PermutationCpuReferenceInstances");
+
         PermutationCpuReference2DInstances();
         PermutationCpuReference3DInstances();
         PermutationCpuReference4DInstances();
         PermutationCpuReference5DInstances();
         PermutationCpuReference6DInstances();
+
+        timer.finish(solutionCount(), hostBytes());
     }
 } // namespace hiptensor
@@ -0,0 +1,60 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_FLAT_HPP
+#define HIPTENSOR_PERMUTATION_FLAT_HPP
+
+#include <cstddef>
+
+#include <hip/library_types.h>
+
+// CK includes
+#include <ck/stream_config.hpp>
+
+namespace hiptensor
+{
+    // @cond
+    // Runs a permutation that folds to a single mode, B = alpha * A over count
+    // contiguous elements, converting from typeA to typeB. A hipMemcpyAsync is
+    // issued when the types match and alpha is exactly one, and a vectorized scale
+    // kernel otherwise. Alpha is applied in double when either type is double.
+    // Returns the average time in milli-seconds if the stream config times the
+    // kernel and 0 if not, or a negative value if the copy or the kernel fails.
+    float flatPermutation(hipDataType         typeA,
+                          hipDataType         typeB,
+                          double              alpha,
+                          void const*         A,
+                          void*               B,
+                          std::size_t         count,
+                          StreamConfig const& streamConfig);
+
+    // Kernel name reported in the performance trace
+    const char* flatPermutationName(hipDataType typeA, hipDataType typeB, double alpha);
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERMUTATION_FLAT_HPP
@@ -0,0 +1,353 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "data_types.hpp"
+#include "hiptensor_options.hpp"
+#include "permutation_folding.hpp"
+#include "permutation_instance_selection.hpp"
+#include "util.hpp"
+
+namespace
+{
+    // A mode label used by neither A nor B
+    int32_t unusedMode(const hiptensorTensorDescriptor_t* descA,
+                       const int32_t                      modeA[],
+                       const hiptensorTensorDescriptor_t* descB,
+                       const int32_t                      modeB[])
+    {
+        int32_t mode = 0;
+        for(std::size_t i = 0; i < descA->mLengths.size(); i++)
+        {
+            mode = std::max(mode, modeA[i] + 1);
+        }
+        for(std::size_t i = 0; i < descB->mLengths.size(); i++)
+        {
+            mode = std::max(mode, modeB[i] + 1);
+        }
+        return mode;
+    }
+}
+
+namespace hiptensor
+{
+    std::size_t FoldedPermutation::rank() const
+    {
+        return mDescA.mLengths.size();
+    }
+
+    std::size_t FoldedPermutation::elementCount() const
+    {
+        return std::accumulate(mDescA.mLengths.cbegin(),
+                               mDescA.mLengths.cend(),
+                               std::size_t(1),
+                               std::multiplies<std::size_t>());
+    }
+
+    bool FoldedPermutation::isFlat() const
+    {
+        // A single mode of A and B must also be contiguous in memory
+        auto contiguous = [this](hiptensorTensorDescriptor_t const& desc) {
+            return desc.mStrides.empty() || desc.mStrides[0] == 1 || elementCount() <= 1;
+        };
+        return rank() <= 1 && contiguous(mDescA) && contiguous(mDescB);
+    }
+
+    bool continuesFoldedMode(std::size_t        length,
+                             std::size_t const* strides,
+                             std::size_t        foldedLength,
+                             std::size_t*       foldedStrides,
+                             std::size_t        count)
+    {
+        bool slower = true;
+        bool faster = true;
+        for(std::size_t t = 0; t < count; t++)
+        {
+            slower &= strides[t] == foldedStrides[t] * foldedLength;
+            faster &= foldedStrides[t] == strides[t] * length;
+        }
+
+        if(!slower && faster)
+        {
+            std::copy_n(strides, count, foldedStrides);
+        }
+        return slower || faster;
+    }
+
+    bool foldPermutation(const hiptensorTensorDescriptor_t* descA,
+                         const int32_t                      modeA[],
+                         const hiptensorTensorDescriptor_t* descB,
+                         const int32_t                      modeB[],
+                         FoldedPermutation&                 folded)
+    {
+        // Empty problems are not folded
+        auto rank = descA->mLengths.size();
+        if(rank != descB->mLengths.size()
+           || std::find(descA->mLengths.cbegin(), descA->mLengths.cend(), 0)
+                  != descA->mLengths.cend())
+        {
+            return false;
+        }
+
+        // Mode of A at each position of B
+        auto outputMode
+            = findIndices({modeA, modeA + rank}, {modeB, modeB + descB->mLengths.size()});
+        if(outputMode.size() != rank)
+        {
+            return false;
+        }
+
+        // Padded and strided tensors fold where their modes stay contiguous
+        auto& options  = HiptensorOptions::instance();
+        bool  colMajor = options->isColMajorStrides();
+        auto  strides  = [colMajor](const hiptensorTensorDescriptor_t* desc) {
+            return desc->mStrides.size() == desc->mLengths.size()
+                       ? desc->mStrides
+                       : stridesFromLengths(desc->mLengths, colMajor);
+        };
+        auto stridesA    = strides(descA);
+        auto stridesBInB = strides(descB);
+        auto stridesB    = std::vector<std::size_t>(rank);
+        for(std::size_t j = 0; j < rank; j++)
+        {
+            stridesB[outputMode[j]] = stridesBInB[j];
+        }
+
+        std::vector<std::size_t> foldedLengths, foldedStridesA, foldedStridesB;
+        std::vector<int32_t>     foldedOutputMode;
+        foldModes(descA->mLengths,
+                  outputMode,
+                  stridesA,
+                  stridesB,
+                  foldedLengths,
+                  foldedOutputMode,
+                  foldedStridesA,
+                  foldedStridesB);
+
+        // A problem of ones folds to a single element
+        if(foldedLengths.empty())
+        {
+            foldedLengths.push_back(1);
+            foldedOutputMode.push_back(0);
+            foldedStridesA.push_back(1);
+            foldedStridesB.push_back(1);
+        }
+
+        if(foldedLengths.size() >= rank && foldedLengths.size() > 1)
+        {
+            return false;
+        }
+
+        folded.mModeA.resize(foldedLengths.size());
+        std::iota(folded.mModeA.begin(), folded.mModeA.end(), 0);
+        folded.mModeB = foldedOutputMode;
+
+        folded.mDescA.mType    = descA->mType;
+        folded.mDescA.mLengths = foldedLengths;
+        folded.mDescA.mStrides = foldedStridesA;
+        folded.mDescA.mUnaryOp = descA->mUnaryOp;
+
+        folded.mDescB.mType = descB->mType;
+        folded.mDescB.mLengths.clear();
+        folded.mDescB.mStrides.clear();
+        for(auto mode : foldedOutputMode)
+        {
+            folded.mDescB.mLengths.push_back(foldedLengths[mode]);
+            folded.mDescB.mStrides.push_back(foldedStridesB[mode]);
+        }
+        folded.mDescB.mUnaryOp = descB->mUnaryOp;
+
+        return true;
+    }
+
+    bool complexAsRealPermutation(const hiptensorTensorDescriptor_t* descA,
+                                  const int32_t                      modeA[],
+                                  const hiptensorTensorDescriptor_t* descB,
+                                  const int32_t                      modeB[],
+                                  FoldedPermutation&                 real)
+    {
+        auto isComplex = [](hipDataType type) { return type == HIP_C_32F || type == HIP_C_64F; };
+        if(!isComplex(descA->mType) || !isComplex(descB->mType))
+        {
+            return false;
+        }
+
+        auto rankA    = descA->mLengths.size();
+        auto rankB    = descB->mLengths.size();
+        auto partMode = unusedMode(descA, modeA, descB, modeB);
+
+        auto& options  = HiptensorOptions::instance();
+        bool  colMajor = options->isColMajorStrides();
+
+        auto toReal = [&](const hiptensorTensorDescriptor_t* desc,
+                          const int32_t                      mode[],
+                          std::size_t                        rank,
+                          hiptensorTensorDescriptor_t&       realDesc,
+                          std::vector<int32_t>&              realMode) {
+            realDesc.mType    = desc->mType == HIP_C_32F ? HIP_R_32F : HIP_R_64F;
+            realDesc.mUnaryOp = desc->mUnaryOp;
+            realDesc.mLengths = desc->mLengths;
+            realDesc.mStrides.clear();
+            for(auto stride : desc->mStrides)
+            {
+                realDesc.mStrides.push_back(2 * stride);
+            }
+            realMode.assign(mode, mode + rank);
+
+            // The parts are adjacent in memory
+            auto offset = colMajor ? 0 : rank;
+            realDesc.mLengths.insert(realDesc.mLengths.begin() + offset, 2);
+            if(realDesc.mStrides.size() == rank)
+            {
+                realDesc.mStrides.insert(realDesc.mStrides.begin() + offset, 1);
+            }
+            realMode.insert(realMode.begin() + offset, partMode);
+        };
+
+        toReal(descA, modeA, rankA, real.mDescA, real.mModeA);
+        toReal(descB, modeB, rankB, real.mDescB, real.mModeB);
+        return true;
+    }
+
+    void batchedPermutation(const hiptensorTensorDescriptor_t* descA,
+                            const int32_t                      modeA[],
+                            std::size_t                        strideA,
+                            const hiptensorTensorDescriptor_t* descB,
+                            const int32_t                      modeB[],
+                            std::size_t                        strideB,
+                            std::size_t                        batchCount,
+                            FoldedPermutation&                 batched)
+    {
+        auto batchMode = unusedMode(descA, modeA, descB, modeB);
+
+        auto& options  = HiptensorOptions::instance();
+        bool  colMajor = options->isColMajorStrides();
+
+        auto addBatch = [&](const hiptensorTensorDescriptor_t* desc,
+                            const int32_t                      mode[],
+                            std::size_t                        stride,
+                            hiptensorTensorDescriptor_t&       batchedDesc,
+                            std::vector<int32_t>&              batchedMode) {
+            auto rank   = desc->mLengths.size();
+            batchedDesc = *desc;
+            batchedMode.assign(mode, mode + rank);
+
+            // The batch is the slowest changing mode
+            auto offset = colMajor ? rank : 0;
+            batchedDesc.mLengths.insert(batchedDesc.mLengths.begin() + offset, batchCount);
+            batchedDesc.mStrides.insert(batchedDesc.mStrides.begin() + offset, stride);
+            batchedMode.insert(batchedMode.begin() + offset, batchMode);
+        };
+
+        addBatch(descA, modeA, strideA, batched.mDescA, batched.mModeA);
+        addBatch(descB, modeB, strideB, batched.mDescB, batched.mModeB);
+    }
+
+    uint32_t permutationVectorWidth(const hiptensorTensorDescriptor_t* descA,
+                                    const void*                        A,
+                                    const hiptensorTensorDescriptor_t* descB,
+                                    const void*                        B,
+                                    uint32_t                           maxWidth)
+    {
+        auto& options  = HiptensorOptions::instance();
+        bool  colMajor = options->isColMajorStrides();
+
+        auto width     = maxWidth;
+        auto narrowFor = [&width](std::size_t multiple) {
+            while(width > 1 && multiple % width != 0)
+            {
+                width /= 2;
+            }
+        };
+
+        auto fit = [&](const hiptensorTensorDescriptor_t* desc, const void* data) {
+            auto& lengths = desc->mLengths;
+            auto& strides = desc->mStrides;
+            auto  address = reinterpret_cast<std::uintptr_t>(data);
+            while(data != nullptr && width > 1
+                  && address % (width * hipDataTypeSize(desc->mType)) != 0)
+            {
+                width /= 2;
+            }
+
+            // Packed tensors are left to the instance tables
+            if(strides.size() != lengths.size() || strides == stridesFromLengths(lengths, colMajor))
+            {
+                return;
+            }
+
+            // Vectors run along the unit stride mode and start at the other strides
+            bool unitMode = false;
+            for(std::size_t i = 0; i < lengths.size(); i++)
+            {
+                if(lengths[i] == 1)
+                {
+                    continue;
+                }
+                if(strides[i] == 1 && !unitMode)
+                {
+                    unitMode = true;
+                    narrowFor(lengths[i]);
+                }
+                else
+                {
+                    narrowFor(strides[i]);
+                }
+            }
+            if(!unitMode)
+            {
+                width = 1;
+            }
+        };
+
+        fit(descA, A);
+        fit(descB, B);
+        return width;
+    }
+
+    bool realPermutationAlpha(const void* alpha, hipDataType typeScalar, double& value)
+    {
+        if(typeScalar == HIP_C_32F)
+        {
+            auto complexAlpha = *static_cast<const hipFloatComplex*>(alpha);
+            value             = hipCrealf(complexAlpha);
+            return hipCimagf(complexAlpha) == 0.0F;
+        }
+        else if(typeScalar == HIP_C_64F)
+        {
+            auto complexAlpha = *static_cast<const hipDoubleComplex*>(alpha);
+            value             = hipCreal(complexAlpha);
+            return hipCimag(complexAlpha) == 0.0;
+        }
+
+        value = readVal<double>(alpha, convertToComputeType(typeScalar));
+        return true;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_FOLDING_HPP
+#define HIPTENSOR_PERMUTATION_FOLDING_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+namespace hiptensor
+{
+    // @cond
+    // Permutation problem with the modes of A that stay adjacent and in order
+    // in B, and contiguous in memory in both, folded into one mode, and the modes
+    // of length one dropped. The folded problem addresses the same elements as
+    // the original one, so padded tensors keep their strides.
+    struct FoldedPermutation
+    {
+        hiptensorTensorDescriptor_t mDescA;
+        hiptensorTensorDescriptor_t mDescB;
+        std::vector<int32_t>        mModeA;
+        std::vector<int32_t>        mModeB;
+
+        // Number of folded modes
+        std::size_t rank() const;
+
+        // Number of elements of A and B
+        std::size_t elementCount() const;
+
+        // B is A in the same element order, so the permutation is a flat
+        // copy or scale of elementCount() elements
+        bool isFlat() const;
+    };
+
+    // Whether a mode of the given length continues the folded mode before it in
+    // memory in each of count tensors, on the same side in all of them: slower
+    // changing than the folded mode in every tensor, or faster in every tensor.
+    // strides and foldedStrides hold the stride of each tensor along the mode
+    // and the folded mode. If the mode continues it, foldedStrides become the
+    // strides of the faster changing of the two; the caller extends the length.
+    bool continuesFoldedMode(std::size_t        length,
+                             std::size_t const* strides,
+                             std::size_t        foldedLength,
+                             std::size_t*       foldedStrides,
+                             std::size_t        count);
+
+    // Folds the permutation of descA into descB. Returns false, leaving folded
+    // unspecified, if folding neither lowers the rank nor makes the problem flat.
+    bool foldPermutation(const hiptensorTensorDescriptor_t* descA,
+                         const int32_t                      modeA[],
+                         const hiptensorTensorDescriptor_t* descB,
+                         const int32_t                      modeB[],
+                         FoldedPermutation&                 folded);
+
+    // Views a permutation of complex tensors as one of real tensors, with the
+    // real and imaginary parts as an extra mode of length 2 that is the fastest
+    // changing mode of both A and B. Returns false, leaving real unspecified,
+    // if A and B are not complex.
+    bool complexAsRealPermutation(const hiptensorTensorDescriptor_t* descA,
+                                  const int32_t                      modeA[],
+                                  const hiptensorTensorDescriptor_t* descB,
+                                  const int32_t                      modeB[],
+                                  FoldedPermutation&                 real);
+
+    // Views a batch of permutations as one permutation of rank one higher, with
+    // the batch as an extra mode that is the slowest changing mode of both A and
+    // B. strideA and strideB are the distances in elements between the tensors
+    // of the batch.
+    void batchedPermutation(const hiptensorTensorDescriptor_t* descA,
+                            const int32_t                      modeA[],
+                            std::size_t                        strideA,
+                            const hiptensorTensorDescriptor_t* descB,
+                            const int32_t                      modeB[],
+                            std::size_t                        strideB,
+                            std::size_t                        batchCount,
+                            FoldedPermutation&                 batched);
+
+    // Widest vector, in elements and at most maxWidth, that the layouts of A and
+    // B allow. A padded or strided tensor needs a unit stride mode whose length,
+    // like each of its other strides, is a multiple of the width. The addresses
+    // of A and B, unless nullptr, must be aligned to the vectors. Packed tensors
+    // are otherwise left to the instance tables, which were measured on them.
+    uint32_t permutationVectorWidth(const hiptensorTensorDescriptor_t* descA,
+                                    const void*                        A,
+                                    const hiptensorTensorDescriptor_t* descB,
+                                    const void*                        B,
+                                    uint32_t                           maxWidth);
+
+    // Reads alpha as the real value applied to the real view of the tensors.
+    // Returns false if alpha is complex with a non-zero imaginary part.
+    bool realPermutationAlpha(const void* alpha, hipDataType typeScalar, double& value);
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERMUTATION_FOLDING_HPP
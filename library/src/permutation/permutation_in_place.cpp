@@ -0,0 +1,621 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+
+#include <hiptensor/internal/native_types.hpp>
+
+#include "data_types.hpp"
+#include "hiptensor_options.hpp"
+#include "permutation_in_place.hpp"
+#include "permutation_instance_selection.hpp"
+#include "thread_pool.hpp"
+#include "util.hpp"
+
+namespace
+{
+    // Square tiles swapped by one block of TransposeTile x TransposeRows threads
+    constexpr uint32_t TransposeTile = 32;
+    constexpr uint32_t TransposeRows = 8;
+
+    // Matrices of the grid, the kernel loops over the others
+    constexpr uint32_t TransposeMaxMatrices = 65535;
+
+    // Cycle leaders tested by each thread of the cycle kernel, and by each task
+    // on the host
+    constexpr uint32_t CycleBlockSize = 256;
+    constexpr uint32_t CycleMaxBlocks = 8192;
+    constexpr uint64_t CycleCpuChunk  = 4096;
+
+    // The recommended workspace holds as many slabs as fit in 64 MiB
+    constexpr uint64_t InPlaceRecommendedBytes = uint64_t(64) << 20;
+
+    // Half, bfloat16 and float elements are scaled in float, double and complex
+    // double elements in double so that alpha keeps its full precision
+    template <typename T>
+    __host__ __device__ inline T scaleElement(T value, double alpha)
+    {
+        return static_cast<T>(static_cast<float>(alpha) * static_cast<float>(value));
+    }
+
+    __host__ __device__ inline double scaleElement(double value, double alpha)
+    {
+        return alpha * value;
+    }
+
+    __host__ __device__ inline hipFloatComplex scaleElement(hipFloatComplex value, double alpha)
+    {
+        auto scale = static_cast<float>(alpha);
+        return make_hipFloatComplex(scale * hipCrealf(value), scale * hipCimagf(value));
+    }
+
+    __host__ __device__ inline hipDoubleComplex scaleElement(hipDoubleComplex value, double alpha)
+    {
+        return make_hipDoubleComplex(alpha * hipCreal(value), alpha * hipCimag(value));
+    }
+
+    // Square roots are only requested for half and float elements
+    template <typename T>
+    __host__ __device__ inline T sqrtElement(T value)
+    {
+        return static_cast<T>(sqrtf(static_cast<float>(value)));
+    }
+
+    __host__ __device__ inline double sqrtElement(double value)
+    {
+        return sqrt(value);
+    }
+
+    __host__ __device__ inline hipFloatComplex sqrtElement(hipFloatComplex value)
+    {
+        return value;
+    }
+
+    __host__ __device__ inline hipDoubleComplex sqrtElement(hipDoubleComplex value)
+    {
+        return value;
+    }
+
+    // Slab permutation followed by the cycle kernels, on the folded modes of A
+    struct CycleMap
+    {
+        int32_t mRank;
+        int64_t mLengths[hiptensor::InPlacePermutation::MaxCycleRank];
+        int64_t mStridesA[hiptensor::InPlacePermutation::MaxCycleRank];
+        int64_t mStridesB[hiptensor::InPlacePermutation::MaxCycleRank];
+
+        bool mSqrtA;
+        bool mSqrtB;
+
+        // Index in the slab of B of the element at the given index of A
+        __host__ __device__ inline int64_t operator()(int64_t index) const
+        {
+            int64_t result = 0;
+            for(int32_t i = 0; i < mRank; i++)
+            {
+                result += (index / mStridesA[i]) % mLengths[i] * mStridesB[i];
+            }
+            return result;
+        }
+
+        template <typename T>
+        __host__ __device__ inline T apply(T value, double alpha) const
+        {
+            value = mSqrtA ? sqrtElement(value) : value;
+            value = alpha != 1.0 ? scaleElement(value, alpha) : value;
+            return mSqrtB ? sqrtElement(value) : value;
+        }
+    };
+
+    CycleMap makeCycleMap(hiptensor::InPlacePermutation const& inPlace)
+    {
+        CycleMap map;
+        map.mRank = static_cast<int32_t>(inPlace.mDescA.mLengths.size());
+        for(int32_t i = 0; i < map.mRank; i++)
+        {
+            map.mLengths[i]                  = inPlace.mDescA.mLengths[i];
+            map.mStridesA[i]                 = inPlace.mDescA.mStrides[i];
+            map.mStridesB[inPlace.mModeB[i]] = inPlace.mDescB.mStrides[i];
+        }
+        map.mSqrtA = inPlace.mDescA.mUnaryOp == HIPTENSOR_OP_SQRT;
+        map.mSqrtB = inPlace.mDescB.mUnaryOp == HIPTENSOR_OP_SQRT;
+        return map;
+    }
+
+    // Moves the cycle of the slab through index when index is its smallest
+    // element. Cycles are disjoint, so their leaders move them independently.
+    template <typename T>
+    __host__ __device__ inline void followCycle(T*              slab,
+                                                CycleMap const& map,
+                                                double          alpha,
+                                                int64_t         index)
+    {
+        auto next = map(index);
+        while(next > index)
+        {
+            next = map(next);
+        }
+        if(next != index)
+        {
+            return;
+        }
+
+        auto value = slab[index];
+        for(next = map(index); next != index; next = map(next))
+        {
+            auto moved = slab[next];
+            slab[next] = map.apply(value, alpha);
+            value      = moved;
+        }
+        slab[index] = map.apply(value, alpha);
+    }
+
+    template <typename T>
+    __global__ void cyclePermutationInPlaceKernel(
+        T* data, CycleMap map, double alpha, int64_t slabElements, int64_t total)
+    {
+        auto stride = int64_t(gridDim.x) * blockDim.x;
+        for(auto i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; i < total; i += stride)
+        {
+            auto slab = i / slabElements;
+            followCycle(data + slab * slabElements, map, alpha, i - slab * slabElements);
+        }
+    }
+
+    // Block (x, y) swaps tile (y, x) of the upper triangle with its mirror tile
+    // (x, y) through shared memory. Blocks below the diagonal have no work.
+    template <typename T>
+    __global__ void squareTransposeInPlaceKernel(T*          data,
+                                                 double      alpha,
+                                                 std::size_t order,
+                                                 std::size_t count)
+    {
+        __shared__ T upper[TransposeTile][TransposeTile + 1];
+        __shared__ T lower[TransposeTile][TransposeTile + 1];
+
+        if(blockIdx.y > blockIdx.x)
+        {
+            return;
+        }
+
+        auto rowBase  = std::size_t(blockIdx.y) * TransposeTile;
+        auto colBase  = std::size_t(blockIdx.x) * TransposeTile;
+        bool diagonal = blockIdx.x == blockIdx.y;
+        bool scale    = alpha != 1.0;
+
+        for(auto z = std::size_t(blockIdx.z); z < count; z += gridDim.z)
+        {
+            auto matrix = data + z * order * order;
+
+            for(auto r = threadIdx.y; r < TransposeTile; r += TransposeRows)
+            {
+                auto row = rowBase + r;
+                auto col = colBase + threadIdx.x;
+                if(row < order && col < order)
+                {
+                    upper[r][threadIdx.x] = matrix[row * order + col];
+                }
+                auto mirrorRow = colBase + r;
+                auto mirrorCol = rowBase + threadIdx.x;
+                if(!diagonal && mirrorRow < order && mirrorCol < order)
+                {
+                    lower[r][threadIdx.x] = matrix[mirrorRow * order + mirrorCol];
+                }
+            }
+            __syncthreads();
+
+            // Element (r, c) of a tile moves to (c, r) of its mirror tile
+            for(auto r = threadIdx.y; r < TransposeTile; r += TransposeRows)
+            {
+                auto mirrorRow = colBase + r;
+                auto mirrorCol = rowBase + threadIdx.x;
+                if(mirrorRow < order && mirrorCol < order)
+                {
+                    auto value = upper[threadIdx.x][r];
+                    matrix[mirrorRow * order + mirrorCol]
+                        = scale ? scaleElement(value, alpha) : value;
+                }
+
+                auto row = rowBase + r;
+                auto col = colBase + threadIdx.x;
+                if(!diagonal && row < order && col < order)
+                {
+                    auto value                = lower[threadIdx.x][r];
+                    matrix[row * order + col] = scale ? scaleElement(value, alpha) : value;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    template <typename T>
+    hipError_t launchSquareTranspose(
+        double alpha, void* A, std::size_t order, std::size_t count, hipStream_t stream)
+    {
+        auto tiles
+            = static_cast<uint32_t>(hiptensor::ceilDiv(order, std::size_t(TransposeTile)));
+        auto matrices = static_cast<uint32_t>(
+            std::min<std::size_t>(count, std::size_t(TransposeMaxMatrices)));
+        hipLaunchKernelGGL((squareTransposeInPlaceKernel<T>),
+                           dim3(tiles, tiles, matrices),
+                           dim3(TransposeTile, TransposeRows),
+                           0,
+                           stream,
+                           static_cast<T*>(A),
+                           alpha,
+                           order,
+                           count);
+        return hipGetLastError();
+    }
+
+    // Tile row i of a matrix swaps the elements on and right of the diagonal
+    // with their mirrors, so that every pair is swapped once
+    template <typename T>
+    void squareTransposeCpu(double alpha, void* A, std::size_t order, std::size_t count)
+    {
+        auto data  = static_cast<T*>(A);
+        auto tiles = hiptensor::ceilDiv(order, std::size_t(TransposeTile));
+        bool scale = alpha != 1.0;
+
+        auto& pool = hiptensor::ThreadPool::instance();
+        pool->parallelFor(count * tiles, [&](std::size_t task) {
+            auto matrix  = data + (task / tiles) * order * order;
+            auto rowBase = (task % tiles) * TransposeTile;
+            auto rowEnd  = std::min(rowBase + TransposeTile, order);
+
+            for(auto colBase = rowBase; colBase < order; colBase += TransposeTile)
+            {
+                auto colEnd = std::min(colBase + TransposeTile, order);
+                for(auto row = rowBase; row < rowEnd; row++)
+                {
+                    for(auto col = std::max(colBase, row); col < colEnd; col++)
+                    {
+                        auto& upper = matrix[row * order + col];
+                        auto& lower = matrix[col * order + row];
+                        auto  value = upper;
+                        upper       = scale ? scaleElement(lower, alpha) : lower;
+                        if(col != row)
+                        {
+                            lower = scale ? scaleElement(value, alpha) : value;
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    // Calls func with a value of the element type of the permutation data type
+    template <typename Func>
+    bool dispatchElement(hipDataType type, Func&& func)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            func(hiptensor::float16_t{});
+            return true;
+        case HIP_R_16BF:
+            func(hip_bfloat16{});
+            return true;
+        case HIP_R_32F:
+            func(float{});
+            return true;
+        case HIP_R_64F:
+            func(double{});
+            return true;
+        case HIP_C_32F:
+            func(hipFloatComplex{});
+            return true;
+        case HIP_C_64F:
+            func(hipDoubleComplex{});
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <typename T>
+    hipError_t launchCyclePermutation(CycleMap const& map,
+                                      double          alpha,
+                                      void*           A,
+                                      int64_t         slabElements,
+                                      int64_t         total,
+                                      hipStream_t     stream)
+    {
+        auto blocks = static_cast<uint32_t>(std::min<int64_t>(
+            hiptensor::ceilDiv(total, int64_t(CycleBlockSize)), CycleMaxBlocks));
+        hipLaunchKernelGGL((cyclePermutationInPlaceKernel<T>),
+                           dim3(blocks),
+                           dim3(CycleBlockSize),
+                           0,
+                           stream,
+                           static_cast<T*>(A),
+                           map,
+                           alpha,
+                           slabElements,
+                           total);
+        return hipGetLastError();
+    }
+
+    hipError_t launchSquare(hipDataType type,
+                            double      alpha,
+                            void*       A,
+                            std::size_t order,
+                            std::size_t count,
+                            hipStream_t stream)
+    {
+        auto result = hipErrorInvalidValue;
+        dispatchElement(type, [&](auto element) {
+            result = launchSquareTranspose<decltype(element)>(alpha, A, order, count, stream);
+        });
+        return result;
+    }
+
+    hipError_t launchCycles(hiptensor::InPlacePermutation const& inPlace,
+                            double                               alpha,
+                            void*                                A,
+                            hipStream_t                          stream)
+    {
+        auto map          = makeCycleMap(inPlace);
+        auto slabElements = static_cast<int64_t>(inPlace.mSlabElements);
+        auto total        = slabElements * static_cast<int64_t>(inPlace.mSlabCount);
+        auto result       = hipErrorInvalidValue;
+        dispatchElement(inPlace.mDescA.mType, [&](auto element) {
+            result = launchCyclePermutation<decltype(element)>(
+                map, alpha, A, slabElements, total, stream);
+        });
+        return result;
+    }
+
+    // Every run permutes the data again, so in-place kernels are timed once
+    template <typename Launch>
+    float runInPlace(StreamConfig const& streamConfig, Launch&& launch)
+    {
+        auto stream = streamConfig.stream_id_;
+        if(!streamConfig.time_kernel_)
+        {
+            return launch(stream) == hipSuccess ? 0.0F : -1.0F;
+        }
+
+        hipEvent_t start, stop;
+        if(hipEventCreate(&start) != hipSuccess)
+        {
+            return -1.0F;
+        }
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            hipEventDestroy(start);
+            return -1.0F;
+        }
+
+        auto result = hipEventRecord(start, stream);
+        if(result == hipSuccess)
+        {
+            result = launch(stream);
+        }
+
+        float elapsedMs = 0.0F;
+        if(result == hipSuccess)
+        {
+            result = hipEventRecord(stop, stream);
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventSynchronize(stop);
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventElapsedTime(&elapsedMs, start, stop);
+        }
+
+        hipEventDestroy(start);
+        hipEventDestroy(stop);
+
+        return result == hipSuccess ? elapsedMs : -1.0F;
+    }
+} // namespace
+
+namespace hiptensor
+{
+    bool makeInPlacePermutation(const hiptensorTensorDescriptor_t* descA,
+                                const int32_t                      modeA[],
+                                const hiptensorTensorDescriptor_t* descB,
+                                const int32_t                      modeB[],
+                                InPlacePermutation&                inPlace)
+    {
+        auto& options  = HiptensorOptions::instance();
+        bool  colMajor = options->isColMajorStrides();
+
+        auto rank = descA->mLengths.size();
+        if(descA->mType != descB->mType || rank != descB->mLengths.size()
+           || descA->mStrides != stridesFromLengths(descA->mLengths, colMajor)
+           || descB->mStrides != stridesFromLengths(descB->mLengths, colMajor))
+        {
+            return false;
+        }
+
+        // Mode of A at each position of B
+        auto outputMode = findIndices({modeA, modeA + rank}, {modeB, modeB + rank});
+        if(outputMode.size() != rank)
+        {
+            return false;
+        }
+
+        std::vector<std::size_t> lengths;
+        std::vector<int32_t>     foldedOutputMode;
+        foldModes(descA->mLengths, outputMode, lengths, foldedOutputMode);
+        if(lengths.empty())
+        {
+            lengths.push_back(1);
+            foldedOutputMode.push_back(0);
+        }
+
+        inPlace.mKind      = InPlaceKind_t::SLABS;
+        inPlace.mSlabCount = 1;
+
+        // The slowest changing mode stays in place: its slices are the slabs
+        auto foldedRank = static_cast<int32_t>(lengths.size());
+        auto slowest    = colMajor ? foldedRank - 1 : 0;
+        if(foldedRank == 1)
+        {
+            inPlace.mKind = InPlaceKind_t::FLAT;
+        }
+        else if(foldedOutputMode[slowest] == slowest)
+        {
+            inPlace.mSlabCount = lengths[slowest];
+            lengths.erase(lengths.begin() + slowest);
+            foldedOutputMode.erase(foldedOutputMode.begin() + slowest);
+            for(auto& mode : foldedOutputMode)
+            {
+                mode -= mode > slowest ? 1 : 0;
+            }
+        }
+
+        if(lengths.size() == 2 && lengths[0] == lengths[1]
+           && descA->mUnaryOp == HIPTENSOR_OP_IDENTITY && descB->mUnaryOp == HIPTENSOR_OP_IDENTITY)
+        {
+            inPlace.mKind = InPlaceKind_t::SQUARE_TRANSPOSE;
+        }
+
+        inPlace.mModeA.resize(lengths.size());
+        std::iota(inPlace.mModeA.begin(), inPlace.mModeA.end(), 0);
+        inPlace.mModeB = foldedOutputMode;
+
+        inPlace.mDescA.mType    = descA->mType;
+        inPlace.mDescA.mLengths = lengths;
+        inPlace.mDescA.mStrides = stridesFromLengths(lengths, colMajor);
+        inPlace.mDescA.mUnaryOp = descA->mUnaryOp;
+
+        inPlace.mDescB.mType    = descB->mType;
+        inPlace.mDescB.mUnaryOp = descB->mUnaryOp;
+        inPlace.mDescB.mLengths.clear();
+        for(auto mode : foldedOutputMode)
+        {
+            inPlace.mDescB.mLengths.push_back(lengths[mode]);
+        }
+        inPlace.mDescB.mStrides = stridesFromLengths(inPlace.mDescB.mLengths, colMajor);
+
+        inPlace.mSlabElements = std::accumulate(
+            lengths.cbegin(), lengths.cend(), std::size_t(1), std::multiplies<std::size_t>());
+        inPlace.mCycles = inPlace.mKind == InPlaceKind_t::SLABS
+                          && lengths.size() <= std::size_t(InPlacePermutation::MaxCycleRank);
+        return true;
+    }
+
+    uint64_t inPlaceWorkspaceSize(InPlacePermutation const&     inPlace,
+                                  hiptensorWorksizePreference_t pref)
+    {
+        if(inPlace.mKind != InPlaceKind_t::SLABS)
+        {
+            return 0;
+        }
+
+        auto slabBytes = uint64_t(inPlace.mSlabElements) * hipDataTypeSize(inPlace.mDescA.mType);
+        auto maxBytes  = slabBytes * inPlace.mSlabCount;
+        if(pref == HIPTENSOR_WORKSPACE_MIN)
+        {
+            return inPlace.mCycles ? 0 : slabBytes;
+        }
+        else if(pref == HIPTENSOR_WORKSPACE_MAX)
+        {
+            return maxBytes;
+        }
+        return std::min(maxBytes,
+                        std::max(slabBytes, InPlaceRecommendedBytes / slabBytes * slabBytes));
+    }
+
+    float squareTransposeInPlace(hipDataType         type,
+                                 double              alpha,
+                                 void*               A,
+                                 std::size_t         order,
+                                 std::size_t         count,
+                                 StreamConfig const& streamConfig)
+    {
+        if(order == 0 || count == 0)
+        {
+            return 0.0F;
+        }
+
+        return runInPlace(streamConfig, [&](hipStream_t stream) {
+            return launchSquare(type, alpha, A, order, count, stream);
+        });
+    }
+
+    void squareTransposeInPlaceCpu(
+        hipDataType type, double alpha, void* A, std::size_t order, std::size_t count)
+    {
+        dispatchElement(type, [&](auto element) {
+            squareTransposeCpu<decltype(element)>(alpha, A, order, count);
+        });
+    }
+
+    float cyclePermutationInPlace(InPlacePermutation const& inPlace,
+                                  double                    alpha,
+                                  void*                     A,
+                                  StreamConfig const&       streamConfig)
+    {
+        if(inPlace.mSlabElements == 0 || inPlace.mSlabCount == 0)
+        {
+            return 0.0F;
+        }
+
+        return runInPlace(streamConfig, [&](hipStream_t stream) {
+            return launchCycles(inPlace, alpha, A, stream);
+        });
+    }
+
+    void cyclePermutationInPlaceCpu(InPlacePermutation const& inPlace, double alpha, void* A)
+    {
+        auto map          = makeCycleMap(inPlace);
+        auto slabElements = static_cast<int64_t>(inPlace.mSlabElements);
+        auto total        = slabElements * static_cast<int64_t>(inPlace.mSlabCount);
+        auto chunks       = ceilDiv(uint64_t(total), CycleCpuChunk);
+
+        dispatchElement(inPlace.mDescA.mType, [&](auto element) {
+            using T   = decltype(element);
+            auto data = static_cast<T*>(A);
+
+            auto& pool = ThreadPool::instance();
+            pool->parallelFor(chunks, [&](std::size_t chunk) {
+                auto first = static_cast<int64_t>(chunk * CycleCpuChunk);
+                auto last  = std::min(first + static_cast<int64_t>(CycleCpuChunk), total);
+                for(auto i = first; i < last; i++)
+                {
+                    auto slab = i / slabElements;
+                    followCycle(data + slab * slabElements, map, alpha, i - slab * slabElements);
+                }
+            });
+        });
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_IN_PLACE_HPP
+#define HIPTENSOR_PERMUTATION_IN_PLACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+// CK includes
+#include <ck/stream_config.hpp>
+
+namespace hiptensor
+{
+    // @cond
+    enum struct InPlaceKind_t
+    {
+        // B has the memory layout of A, so every element stays in place
+        FLAT,
+        // Each slab is a square matrix, transposed by swapping its tiles
+        SQUARE_TRANSPOSE,
+        // Each slab is copied to the workspace and permuted back into place, or
+        // without a workspace, permuted in place by following its cycles
+        SLABS
+    };
+
+    // Permutation of packed tensors sharing their memory. The modes are folded
+    // as by foldPermutation, and the slowest changing mode, when it stays in
+    // place, is split off as independent slabs of the problem. Otherwise the
+    // whole tensor is one slab, e.g. for non-square transposes.
+    struct InPlacePermutation
+    {
+        // Folded modes of a slab that can be permuted by following its cycles
+        static constexpr int32_t MaxCycleRank = 8;
+
+        InPlaceKind_t mKind;
+
+        // Permutation of one slab, on the folded modes
+        hiptensorTensorDescriptor_t mDescA;
+        hiptensorTensorDescriptor_t mDescB;
+        std::vector<int32_t>        mModeA;
+        std::vector<int32_t>        mModeB;
+
+        std::size_t mSlabElements;
+        std::size_t mSlabCount;
+
+        // Whether the slabs can be permuted without a workspace
+        bool mCycles;
+    };
+
+    // Returns false, leaving inPlace unspecified, unless A and B have the same
+    // data type, the same modes and packed strides.
+    bool makeInPlacePermutation(const hiptensorTensorDescriptor_t* descA,
+                                const int32_t                      modeA[],
+                                const hiptensorTensorDescriptor_t* descB,
+                                const int32_t                      modeB[],
+                                InPlacePermutation&                inPlace);
+
+    // Workspace bytes of the slabs: none at least when the slabs can follow their
+    // cycles and one slab otherwise, all of them at most, and none for flat
+    // problems and square transposes. A slab may be the whole tensor, so the
+    // maximum and recommended sizes are the bytes that make the permutation fast.
+    uint64_t inPlaceWorkspaceSize(InPlacePermutation const&     inPlace,
+                                  hiptensorWorksizePreference_t pref);
+
+    // Transposes count consecutive order x order matrices of A in place, and
+    // scales them by alpha. Timed like flatPermutation().
+    float squareTransposeInPlace(hipDataType         type,
+                                 double              alpha,
+                                 void*               A,
+                                 std::size_t         order,
+                                 std::size_t         count,
+                                 StreamConfig const& streamConfig);
+
+    // squareTransposeInPlace() on host memory, run on the host thread pool
+    void squareTransposeInPlaceCpu(
+        hipDataType type, double alpha, void* A, std::size_t order, std::size_t count);
+
+    // Permutes the slabs of A in place without a workspace, B = opB(alpha * opA(A)).
+    // Each cycle of the permutation is moved by the element with its smallest
+    // index, found by walking the cycle, which makes it slower than permuting
+    // slabs copied to a workspace. Requires inPlace.mCycles. Timed like
+    // squareTransposeInPlace().
+    float cyclePermutationInPlace(InPlacePermutation const& inPlace,
+                                  double                    alpha,
+                                  void*                     A,
+                                  StreamConfig const&       streamConfig);
+
+    // cyclePermutationInPlace() on host memory, run on the host thread pool
+    void cyclePermutationInPlaceCpu(InPlacePermutation const& inPlace, double alpha, void* A);
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERMUTATION_IN_PLACE_HPP
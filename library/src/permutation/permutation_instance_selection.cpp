@@ -24,12 +24,15 @@
  *
  *******************************************************************************/
 
+#include <algorithm>
+#include <array>
+
+#include "permutation_folding.hpp"
 #include "permutation_instance_selection.hpp"
-#include <unordered_map>
 
 namespace hiptensor
 {
-    static std::unordered_map<std::string, InstanceHyperParams> const lookUpTableRank2 = {
+    static constexpr InstanceTableEntry lookUpTableRank2[] = {
         // clang-format off
         {"HIP_R_16F_32_32_0_1"        , {256 , 64  , 64  , 4  , 4  , {0 , 1} , 4  , 4}}  ,
         {"HIP_R_16F_32_32_1_0"        , {32  , 16  , 32  , 4  , 4  , {0 , 1} , 4  , 4}}  ,
@@ -959,7 +962,7 @@ namespace hiptensor
         // clang-format on
     };
 
-    static std::unordered_map<std::string, InstanceHyperParams> const lookUpTableRank3 = {
+    static constexpr InstanceTableEntry lookUpTableRank3[] = {
         // clang-format off
         {"HIP_R_16F_32_32_32_0_1_2"      , {64  , 32  , 32  , 4  , 4  , {0 , 1} , 4  , 4}}  ,
         {"HIP_R_16F_32_32_32_0_2_1"      , {64  , 32  , 32  , 4  , 4  , {0 , 1} , 4  , 4}}  ,
@@ -2404,7 +2407,8 @@ namespace hiptensor
         {"HIP_R_32F_524288_32_32_2_1_0"  , {256 , 128 , 128 , 16 , 16 , {0 , 1} , 4  , 4}}  ,
         // clang-format on
     };
-    static std::unordered_map<std::string, InstanceHyperParams> const lookUpTableRank4 = {
+
+    static constexpr InstanceTableEntry lookUpTableRank4[] = {
         // clang-format off
         {"HIP_R_16F_32_32_32_32_0_1_2_3"    , {64  , 128 , 32  , 8  , 8  , {0 , 1} , 8  , 8}}  ,
         {"HIP_R_16F_32_32_32_32_0_1_3_2"    , {64  , 128 , 32  , 8  , 8  , {0 , 1} , 8  , 8}}  ,
@@ -4090,71 +4094,261 @@ namespace hiptensor
         // clang-format on
     };
 
-    static std::vector<ck::index_t>
-        findRepresentPointOfSubSpace(std::vector<std::size_t> const& lengths)
+    // Keys of a table, packed from the legacy string keys at compile time
+    template <std::size_t N>
+    static constexpr std::array<InstanceKey, N>
+        makeInstanceKeys(InstanceTableEntry const (&table)[N])
     {
-        // the total number of a tensor should be less then 2^31
-        static std::vector<std::vector<std::size_t>> const edgeList = {
-            {}, // placeholder for rank0
-            {}, // placeholder for rank1
-            {32,     64,      128,     256,     512,     1024,     2048,
-             4096,   8192,    16384,   32768,   65536,   131072,   262144,
-             524288, 1048576, 2097152, 4194304, 8388608, 16777216, 33554432},
-            {32, 128, 512, 2048, 8192, 32768, 131072, 524288},
-            {32, 256, 2048, 16384, 131072},
-        };
-        auto&                    edges = edgeList[lengths.size()];
-        std::vector<ck::index_t> point;
-        point.reserve(lengths.size());
-        for(auto len : lengths)
+        std::array<InstanceKey, N> keys{};
+        for(std::size_t i = 0; i < N; i++)
         {
-            auto lower_edge = len <= 32 ? 32 : *std::lower_bound(edges.cbegin(), edges.cend(), len);
-            point.push_back(lower_edge);
+            keys[i] = instanceKey(table[i].mName);
         }
-        return point;
+        return keys;
     }
 
-    InstanceHyperParams selectInstanceParams(std::vector<std::size_t> const& lengths,
-                                             std::vector<int32_t> const&     outputMode,
-                                             hipDataType                     typeIn,
-                                             hipDataType                     typeOut,
-                                             ck::index_t                     numDim)
+    template <std::size_t N>
+    static constexpr bool isSortedUnique(std::array<InstanceKey, N> const& keys)
     {
-        auto key = hipTypeToString(typeIn);
-        for(auto&& index : findRepresentPointOfSubSpace(lengths))
+        for(std::size_t i = 0; i < N; i++)
         {
-            key += '_';
-            key += std::to_string(index);
-        }
-        for(auto&& mode : outputMode)
-        {
-            key += '_';
-            key += std::to_string(mode);
+            if(keys[i] == InvalidInstanceKey || (i > 0 && keys[i - 1] >= keys[i]))
+            {
+                return false;
+            }
         }
+        return true;
+    }
+
+    static constexpr auto lookUpKeysRank2 = makeInstanceKeys(lookUpTableRank2);
+    static constexpr auto lookUpKeysRank3 = makeInstanceKeys(lookUpTableRank3);
+    static constexpr auto lookUpKeysRank4 = makeInstanceKeys(lookUpTableRank4);
+
+    static_assert(isSortedUnique(lookUpKeysRank2), "Rank 2 table must be sorted by unique keys");
+    static_assert(isSortedUnique(lookUpKeysRank3), "Rank 3 table must be sorted by unique keys");
+    static_assert(isSortedUnique(lookUpKeysRank4), "Rank 4 table must be sorted by unique keys");
+
+    // Lengths are bucketed up to the nearest edge of these sub-spaces.
+    // The total number of a tensor should be less then 2^31
+    static constexpr std::size_t edgesRank2[]
+        = {32,     64,      128,     256,     512,     1024,     2048,
+           4096,   8192,    16384,   32768,   65536,   131072,   262144,
+           524288, 1048576, 2097152, 4194304, 8388608, 16777216, 33554432};
+    static constexpr std::size_t edgesRank3[] = {32, 128, 512, 2048, 8192, 32768, 131072, 524288};
+    static constexpr std::size_t edgesRank4[] = {32, 256, 2048, 16384, 131072};
+    static constexpr std::size_t edgesRank5[] = {32, 128, 512, 2048};
+    static constexpr std::size_t edgesRank6[] = {32, 128, 512};
 
-        decltype(lookUpTableRank2)* lut = nullptr;
+    struct InstanceTableView
+    {
+        InstanceTableEntry const* mEntries;
+        InstanceKey const*        mKeys;
+        std::size_t const*        mEdges;
+        std::size_t               mSize;
+        std::size_t               mEdgeCount;
+    };
+
+    static InstanceTableView lookUpTable(std::size_t numDim)
+    {
         switch(numDim)
         {
         case 2:
-            lut = &lookUpTableRank2;
-            break;
+            return {lookUpTableRank2,
+                    lookUpKeysRank2.data(),
+                    edgesRank2,
+                    lookUpKeysRank2.size(),
+                    std::size(edgesRank2)};
         case 3:
-            lut = &lookUpTableRank3;
-            break;
+            return {lookUpTableRank3,
+                    lookUpKeysRank3.data(),
+                    edgesRank3,
+                    lookUpKeysRank3.size(),
+                    std::size(edgesRank3)};
         case 4:
-            lut = &lookUpTableRank4;
-            break;
+            return {lookUpTableRank4,
+                    lookUpKeysRank4.data(),
+                    edgesRank4,
+                    lookUpKeysRank4.size(),
+                    std::size(edgesRank4)};
+        // Permutations of rank 5 and 6 that fold to a lower rank use its table.
+        // The generator only sweeps the ones that do not fold.
         case 5:
-            break;
+            return {nullptr, nullptr, edgesRank5, 0, std::size(edgesRank5)};
         case 6:
-            break;
+            return {nullptr, nullptr, edgesRank6, 0, std::size(edgesRank6)};
+        default:
+            return {nullptr, nullptr, nullptr, 0, 0};
+        }
+    }
+
+    // Looks up a problem in the table of its rank
+    static InstanceHyperParams const* findInstanceParams(std::vector<std::size_t> const& lengths,
+                                                         std::vector<int32_t> const& outputMode,
+                                                         hipDataType                 type)
+    {
+        auto table = lookUpTable(lengths.size());
+        auto key   = instanceKey(lengths, outputMode, type);
+        if(table.mSize != 0 && key != InvalidInstanceKey)
+        {
+            auto keysEnd = table.mKeys + table.mSize;
+            if(auto it = std::lower_bound(table.mKeys, keysEnd, key); it != keysEnd && *it == key)
+            {
+                return &table.mEntries[it - table.mKeys].mParams;
+            }
+        }
+        return nullptr;
+    }
+
+    InstanceKey instanceKey(std::vector<std::size_t> const& lengths,
+                            std::vector<int32_t> const&     outputMode,
+                            hipDataType                     type)
+    {
+        auto table = lookUpTable(lengths.size());
+        if(table.mEdges == nullptr || outputMode.size() != lengths.size())
+        {
+            return InvalidInstanceKey;
         }
-        if(lut)
+
+        std::size_t point[6];
+        for(std::size_t i = 0; i < lengths.size(); i++)
         {
-            if(auto it = lut->find(key); it != lut->cend())
+            auto edge = std::lower_bound(table.mEdges, table.mEdges + table.mEdgeCount, lengths[i]);
+            if(edge == table.mEdges + table.mEdgeCount)
             {
-                return it->second;
+                return InvalidInstanceKey;
             }
+            point[i] = lengths[i] <= 32 ? 32 : *edge;
+        }
+
+        return detail::instanceKey(
+            detail::instanceKeyTypeId(type), point, outputMode.data(), lengths.size());
+    }
+
+    std::pair<InstanceTableEntry const*, std::size_t> instanceTable(ck::index_t numDim)
+    {
+        auto table = lookUpTable(numDim);
+        return {table.mEntries, table.mSize};
+    }
+
+    std::pair<std::size_t const*, std::size_t> instanceTableEdges(ck::index_t numDim)
+    {
+        auto table = lookUpTable(numDim);
+        return {table.mEdges, table.mEdgeCount};
+    }
+
+    void foldModes(std::vector<std::size_t> const& lengths,
+                   std::vector<int32_t> const&     outputMode,
+                   std::vector<std::size_t>&       foldedLengths,
+                   std::vector<int32_t>&           foldedOutputMode)
+    {
+        std::vector<std::size_t> foldedStridesA, foldedStridesB;
+        foldModes(lengths,
+                  outputMode,
+                  {},
+                  {},
+                  foldedLengths,
+                  foldedOutputMode,
+                  foldedStridesA,
+                  foldedStridesB);
+    }
+
+    void foldModes(std::vector<std::size_t> const& lengths,
+                   std::vector<int32_t> const&     outputMode,
+                   std::vector<std::size_t> const& stridesA,
+                   std::vector<std::size_t> const& stridesB,
+                   std::vector<std::size_t>&       foldedLengths,
+                   std::vector<int32_t>&           foldedOutputMode,
+                   std::vector<std::size_t>&       foldedStridesA,
+                   std::vector<std::size_t>&       foldedStridesB)
+    {
+        foldedLengths.clear();
+        foldedOutputMode.clear();
+        foldedStridesA.clear();
+        foldedStridesB.clear();
+
+        // Position in B of each mode of A
+        auto                 rank    = lengths.size();
+        bool                 strided = !stridesA.empty() && !stridesB.empty();
+        std::vector<int32_t> positionB(rank);
+        for(std::size_t i = 0; i < rank; i++)
+        {
+            positionB[outputMode[i]] = i;
+        }
+
+        // Folded mode of each mode of A, or -1 for dropped modes
+        std::vector<int32_t> foldedMode(rank, -1);
+        int32_t              previous = -1;
+        for(std::size_t i = 0; i < rank; i++)
+        {
+            if(lengths[i] == 1)
+            {
+                continue;
+            }
+
+            // Only dropped modes may lie between the previous mode and this one in B
+            bool adjacent = previous >= 0;
+            for(auto j = (previous >= 0 ? positionB[previous] + 1 : 0);
+                adjacent && j < positionB[i];
+                j++)
+            {
+                adjacent = lengths[outputMode[j]] == 1;
+            }
+            adjacent = adjacent && positionB[previous] < positionB[i];
+
+            // With strides, the mode must also continue the folded mode in memory,
+            // on the same side of it in A and B
+            if(adjacent && strided)
+            {
+                std::size_t modeStrides[]  = {stridesA[i], stridesB[i]};
+                std::size_t groupStrides[] = {foldedStridesA.back(), foldedStridesB.back()};
+                adjacent                   = continuesFoldedMode(
+                    lengths[i], modeStrides, foldedLengths.back(), groupStrides, 2);
+                foldedStridesA.back() = groupStrides[0];
+                foldedStridesB.back() = groupStrides[1];
+            }
+
+            if(adjacent)
+            {
+                foldedLengths.back() *= lengths[i];
+            }
+            else
+            {
+                foldedLengths.push_back(lengths[i]);
+                if(strided)
+                {
+                    foldedStridesA.push_back(stridesA[i]);
+                    foldedStridesB.push_back(stridesB[i]);
+                }
+            }
+            foldedMode[i] = foldedLengths.size() - 1;
+            previous      = i;
+        }
+
+        // Folded modes in the order of B, each listed once
+        for(std::size_t j = 0; j < rank; j++)
+        {
+            auto mode = foldedMode[outputMode[j]];
+            if(mode >= 0
+               && std::find(foldedOutputMode.cbegin(), foldedOutputMode.cend(), mode)
+                      == foldedOutputMode.cend())
+            {
+                foldedOutputMode.push_back(mode);
+            }
+        }
+    }
+
+    InstanceHyperParams selectInstanceParams(std::vector<std::size_t> const& lengths,
+                                             std::vector<int32_t> const&     outputMode,
+                                             hipDataType                     typeIn,
+                                             hipDataType                     typeOut,
+                                             ck::index_t                     numDim)
+    {
+        // Problems are folded before they are queried, so ranks 5 and 6 only reach
+        // this point when no modes fold. Their tables are empty until they are
+        // measured with permutation_table_generator, which selects the default.
+        if(auto params = findInstanceParams(lengths, outputMode, typeIn); params != nullptr)
+        {
+            return *params;
         }
 
         // default instance has the best perf on average
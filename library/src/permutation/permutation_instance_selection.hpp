@@ -27,11 +27,160 @@
 #ifndef PERMUTATION_INSTANCE_SELECTION_HPP
 #define PERMUTATION_INSTANCE_SELECTION_HPP
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "data_types.hpp"
 #include "permutation_types.hpp"
 
 namespace hiptensor
 {
+    // Packed key of the instance lookup tables. From the most significant bits:
+    // the data type, the log2 of each bucketed length and the lexicographic rank
+    // of the output modes, so the keys sort in the order of the legacy string keys.
+    using InstanceKey = uint64_t;
+
+    constexpr InstanceKey InvalidInstanceKey = ~InstanceKey(0);
+    constexpr uint32_t    InstanceKeyLengthBits = 5;
+    constexpr uint32_t    InstanceKeyModeBits   = 10;
+
+    struct InstanceTableEntry
+    {
+        const char*         mName; // Legacy string key, such as "HIP_R_16F_32_64_1_0"
+        InstanceHyperParams mParams;
+    };
+
+    namespace detail
+    {
+        constexpr InstanceKey instanceKeyTypeId(hipDataType type)
+        {
+            return type == HIP_R_16F ? 0 : type == HIP_R_32F ? 1 : InvalidInstanceKey;
+        }
+
+        constexpr uint32_t instanceKeyLog2(std::size_t value)
+        {
+            uint32_t result = 0;
+            while(value >>= 1)
+            {
+                result++;
+            }
+            return result;
+        }
+
+        // Lexicographic rank of a permutation of {0, ..., count - 1}
+        template <typename T>
+        constexpr InstanceKey instanceKeyModeRank(T const* modes, std::size_t count)
+        {
+            InstanceKey rank = 0;
+            for(std::size_t i = 0; i < count; i++)
+            {
+                InstanceKey smaller = 0;
+                for(std::size_t j = i + 1; j < count; j++)
+                {
+                    smaller += modes[j] < modes[i];
+                }
+                rank = rank * (count - i) + smaller;
+            }
+            return rank;
+        }
+
+        // Lengths must already be bucketed to powers of two
+        template <typename L, typename M>
+        constexpr InstanceKey
+            instanceKey(InstanceKey typeId, L const* lengths, M const* modes, std::size_t count)
+        {
+            if(typeId == InvalidInstanceKey)
+            {
+                return InvalidInstanceKey;
+            }
+
+            auto key = typeId;
+            for(std::size_t i = 0; i < count; i++)
+            {
+                key = (key << InstanceKeyLengthBits) | instanceKeyLog2(lengths[i]);
+            }
+            return (key << InstanceKeyModeBits) | instanceKeyModeRank(modes, count);
+        }
+    } // namespace detail
+
+    // Key of a legacy string key "HIP_R_<type>_<lengths>_<output modes>"
+    constexpr InstanceKey instanceKey(const char* name)
+    {
+        constexpr char prefix[] = "HIP_R_";
+        for(std::size_t i = 0; i + 1 < sizeof(prefix); i++)
+        {
+            if(name[i] != prefix[i])
+            {
+                return InvalidInstanceKey;
+            }
+        }
+        name += sizeof(prefix) - 1;
+
+        auto typeId = InvalidInstanceKey;
+        if(name[0] == '1' && name[1] == '6' && name[2] == 'F')
+        {
+            typeId = detail::instanceKeyTypeId(HIP_R_16F);
+        }
+        else if(name[0] == '3' && name[1] == '2' && name[2] == 'F')
+        {
+            typeId = detail::instanceKeyTypeId(HIP_R_32F);
+        }
+        name += 3;
+
+        // Lengths followed by as many output modes
+        std::size_t values[12] = {};
+        std::size_t count      = 0;
+        while(*name == '_' && count < 12)
+        {
+            name++;
+            while(*name >= '0' && *name <= '9')
+            {
+                values[count] = values[count] * 10 + std::size_t(*name - '0');
+                name++;
+            }
+            count++;
+        }
+        if(*name != '\0' || count % 2 != 0)
+        {
+            return InvalidInstanceKey;
+        }
+
+        return detail::instanceKey(typeId, values, values + count / 2, count / 2);
+    }
+
+    // Key of a problem, or InvalidInstanceKey if no table can hold it
+    InstanceKey instanceKey(std::vector<std::size_t> const& lengths,
+                            std::vector<int32_t> const&     outputMode,
+                            hipDataType                     type);
+
+    // Tuned table of a rank, sorted by key. Empty if the rank has no table.
+    std::pair<InstanceTableEntry const*, std::size_t> instanceTable(ck::index_t numDim);
+
+    // Edges of the sub-spaces that the lengths of a rank are bucketed up to
+    std::pair<std::size_t const*, std::size_t> instanceTableEdges(ck::index_t numDim);
+
+    // Folds the modes of A that stay adjacent and in order in B into one mode,
+    // and drops modes of length one. outputMode holds the mode of A at each
+    // position of B. Folding does not change the memory layout of the problem.
+    void foldModes(std::vector<std::size_t> const& lengths,
+                   std::vector<int32_t> const&     outputMode,
+                   std::vector<std::size_t>&       foldedLengths,
+                   std::vector<int32_t>&           foldedOutputMode);
+
+    // As above, for tensors with the strides stridesA and stridesB, both listed in
+    // the modes of A. Adjacent modes are folded only where they are contiguous in
+    // memory in both A and B, and each folded mode has the strides of its fastest
+    // changing mode. Empty strides are packed and leave the folded strides empty.
+    void foldModes(std::vector<std::size_t> const& lengths,
+                   std::vector<int32_t> const&     outputMode,
+                   std::vector<std::size_t> const& stridesA,
+                   std::vector<std::size_t> const& stridesB,
+                   std::vector<std::size_t>&       foldedLengths,
+                   std::vector<int32_t>&           foldedOutputMode,
+                   std::vector<std::size_t>&       foldedStridesA,
+                   std::vector<std::size_t>&       foldedStridesB);
+
     InstanceHyperParams selectInstanceParams(std::vector<Uid> const&     lengths,
                                              std::vector<int32_t> const& outputMode,
                                              hipDataType                 typeIn,
@@ -0,0 +1,511 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_runtime.h>
+
+#include <hiptensor/internal/native_types.hpp>
+
+#include "data_types.hpp"
+#include "hiptensor_options.hpp"
+#include "permutation_folding.hpp"
+#include "permutation_pointer_batch.hpp"
+#include "util.hpp"
+
+namespace
+{
+    using hiptensor::PointerBatchPermutation;
+
+    constexpr uint32_t BatchBlockSize = 256;
+    constexpr uint32_t BatchMaxBlocks = 8192;
+
+    // Tensors of the grid, the kernels loop over the others
+    constexpr uint32_t BatchMaxTensors = 65535;
+
+    // Square tiles transposed by one block of BatchTile x BatchTileRows threads
+    constexpr uint32_t BatchTile     = 32;
+    constexpr uint32_t BatchTileRows = 8;
+
+    // Scales in double precision when either side is double, in float otherwise
+    template <typename TA, typename TB>
+    using BatchComputeType = std::conditional_t<std::is_same_v<TA, double>
+                                                    || std::is_same_v<TB, double>,
+                                                double,
+                                                float>;
+
+    // opB(alpha * opA(value)), the element operation of the permutation instances
+    template <typename ComputeT, typename TA>
+    __device__ inline ComputeT
+        batchElement(TA value, ComputeT alpha, hiptensorOperator_t opA, hiptensorOperator_t opB)
+    {
+        auto result = static_cast<ComputeT>(value);
+        if(opA == HIPTENSOR_OP_SQRT)
+        {
+            result = sqrt(result);
+        }
+        result *= alpha;
+        if(opB == HIPTENSOR_OP_SQRT)
+        {
+            result = sqrt(result);
+        }
+        return result;
+    }
+
+    // Offsets in A and B of the multi-index that index encodes over the modes
+    // [first, mRank), mode first changing fastest
+    __device__ inline void batchOffsets(PointerBatchPermutation const& batch,
+                                        int32_t                        first,
+                                        int64_t                        index,
+                                        int64_t&                       offsetA,
+                                        int64_t&                       offsetB)
+    {
+        offsetA = 0;
+        offsetB = 0;
+        for(int32_t mode = first; mode < batch.mRank; mode++)
+        {
+            auto coordinate = index % batch.mLengths[mode];
+            index /= batch.mLengths[mode];
+            offsetA += coordinate * batch.mStridesA[mode];
+            offsetB += coordinate * batch.mStridesB[mode];
+        }
+    }
+
+    // Grid-stride loop over the elements of each tensor in the memory order of B.
+    // Tensor blockIdx.y of the batch, and every gridDim.y-th after it, is read
+    // from and written to the base pointers of the device arrays A and B.
+    template <typename TA, typename TB>
+    __global__ void pointerBatchKernel(TA const* const*         A,
+                                       TB* const*               B,
+                                       PointerBatchPermutation  batch,
+                                       BatchComputeType<TA, TB> alpha,
+                                       int64_t                  batchCount)
+    {
+        auto tid    = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        auto stride = int64_t(gridDim.x) * blockDim.x;
+
+        for(auto tensor = int64_t(blockIdx.y); tensor < batchCount; tensor += gridDim.y)
+        {
+            auto in  = A[tensor];
+            auto out = B[tensor];
+            for(auto i = tid; i < batch.mElementCount; i += stride)
+            {
+                int64_t offsetA, offsetB;
+                batchOffsets(batch, 0, i, offsetA, offsetB);
+                out[offsetB] = static_cast<TB>(
+                    batchElement(in[offsetA], alpha, batch.mOpA, batch.mOpB));
+            }
+        }
+    }
+
+    // Tiles of modes 0 and 1 are read along mode 1, the fastest changing mode
+    // of A, and written along mode 0, the fastest changing mode of B, through
+    // shared memory. Blocks loop over the tiles of every outer index.
+    template <typename TA, typename TB>
+    __global__ void pointerBatchTransposeKernel(TA const* const*         A,
+                                                TB* const*               B,
+                                                PointerBatchPermutation  batch,
+                                                BatchComputeType<TA, TB> alpha,
+                                                int64_t                  batchCount)
+    {
+        using ComputeT = BatchComputeType<TA, TB>;
+
+        __shared__ ComputeT tile[BatchTile][BatchTile + 1];
+
+        auto lengths0 = batch.mLengths[0];
+        auto lengths1 = batch.mLengths[1];
+        auto tiles0   = (lengths0 + BatchTile - 1) / BatchTile;
+        auto tiles1   = (lengths1 + BatchTile - 1) / BatchTile;
+        auto work     = tiles0 * tiles1 * (batch.mElementCount / (lengths0 * lengths1));
+
+        for(auto tensor = int64_t(blockIdx.y); tensor < batchCount; tensor += gridDim.y)
+        {
+            auto in  = A[tensor];
+            auto out = B[tensor];
+            for(auto item = int64_t(blockIdx.x); item < work; item += gridDim.x)
+            {
+                auto base0 = (item % tiles0) * BatchTile;
+                auto base1 = (item / tiles0 % tiles1) * BatchTile;
+
+                int64_t outerA, outerB;
+                batchOffsets(batch, 2, item / (tiles0 * tiles1), outerA, outerB);
+
+                for(auto r = threadIdx.y; r < BatchTile; r += BatchTileRows)
+                {
+                    auto index0 = base0 + r;
+                    auto index1 = base1 + threadIdx.x;
+                    if(index0 < lengths0 && index1 < lengths1)
+                    {
+                        tile[r][threadIdx.x] = batchElement(
+                            in[outerA + index0 * batch.mStridesA[0]
+                               + index1 * batch.mStridesA[1]],
+                            alpha,
+                            batch.mOpA,
+                            batch.mOpB);
+                    }
+                }
+                __syncthreads();
+
+                for(auto r = threadIdx.y; r < BatchTile; r += BatchTileRows)
+                {
+                    auto index0 = base0 + threadIdx.x;
+                    auto index1 = base1 + r;
+                    if(index0 < lengths0 && index1 < lengths1)
+                    {
+                        out[outerB + index0 * batch.mStridesB[0] + index1 * batch.mStridesB[1]]
+                            = static_cast<TB>(tile[threadIdx.x][r]);
+                    }
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    template <typename TA, typename TB>
+    hipError_t launchPointerBatch(PointerBatchPermutation const& batch,
+                                  double                         alpha,
+                                  void const* const*             A,
+                                  void* const*                   B,
+                                  int64_t                        batchCount,
+                                  hipStream_t                    stream)
+    {
+        // Alpha is only narrowed when neither side is double
+        auto scale   = static_cast<BatchComputeType<TA, TB>>(alpha);
+        auto in      = reinterpret_cast<TA const* const*>(A);
+        auto out     = reinterpret_cast<TB* const*>(B);
+        auto tensors = static_cast<uint32_t>(std::min(batchCount, int64_t(BatchMaxTensors)));
+
+        if(batch.mTranspose)
+        {
+            auto tiles
+                = hiptensor::ceilDiv(batch.mLengths[0], int64_t(BatchTile))
+                  * hiptensor::ceilDiv(batch.mLengths[1], int64_t(BatchTile))
+                  * (batch.mElementCount / (batch.mLengths[0] * batch.mLengths[1]));
+            auto blocks = static_cast<uint32_t>(std::min(tiles, int64_t(BatchMaxBlocks)));
+            hipLaunchKernelGGL((pointerBatchTransposeKernel<TA, TB>),
+                               dim3(blocks, tensors),
+                               dim3(BatchTile, BatchTileRows),
+                               0,
+                               stream,
+                               in,
+                               out,
+                               batch,
+                               scale,
+                               batchCount);
+        }
+        else
+        {
+            auto blocks = static_cast<uint32_t>(
+                std::min(hiptensor::ceilDiv(batch.mElementCount, int64_t(BatchBlockSize)),
+                         int64_t(BatchMaxBlocks)));
+            hipLaunchKernelGGL((pointerBatchKernel<TA, TB>),
+                               dim3(blocks, tensors),
+                               dim3(BatchBlockSize),
+                               0,
+                               stream,
+                               in,
+                               out,
+                               batch,
+                               scale,
+                               batchCount);
+        }
+        return hipGetLastError();
+    }
+
+    hipError_t launchBatch(PointerBatchPermutation const& batch,
+                           double                         alpha,
+                           void const* const*             A,
+                           void* const*                   B,
+                           int64_t                        batchCount,
+                           hipStream_t                    stream)
+    {
+        using hiptensor::float16_t;
+
+        auto launch = [&](auto a, auto b) {
+            return launchPointerBatch<decltype(a), decltype(b)>(
+                batch, alpha, A, B, batchCount, stream);
+        };
+
+        // The data type pairs accepted by hiptensorPermutation, complex
+        // tensors in their real view
+        auto typeA = batch.mTypeA;
+        auto typeB = batch.mTypeB;
+        if(typeA == HIP_R_16F && typeB == HIP_R_16F)
+        {
+            return launch(float16_t{}, float16_t{});
+        }
+        else if(typeA == HIP_R_16BF && typeB == HIP_R_16BF)
+        {
+            return launch(hip_bfloat16{}, hip_bfloat16{});
+        }
+        else if(typeA == HIP_R_32F && typeB == HIP_R_32F)
+        {
+            return launch(float{}, float{});
+        }
+        else if(typeA == HIP_R_64F && typeB == HIP_R_64F)
+        {
+            return launch(double{}, double{});
+        }
+        else if(typeA == HIP_R_16F && typeB == HIP_R_32F)
+        {
+            return launch(float16_t{}, float{});
+        }
+        else if(typeA == HIP_R_32F && typeB == HIP_R_16F)
+        {
+            return launch(float{}, float16_t{});
+        }
+        else if(typeA == HIP_R_16BF && typeB == HIP_R_32F)
+        {
+            return launch(hip_bfloat16{}, float{});
+        }
+        else if(typeA == HIP_R_32F && typeB == HIP_R_16BF)
+        {
+            return launch(float{}, hip_bfloat16{});
+        }
+        else if(typeA == HIP_R_64F && typeB == HIP_R_32F)
+        {
+            return launch(double{}, float{});
+        }
+        else if(typeA == HIP_R_32F && typeB == HIP_R_64F)
+        {
+            return launch(float{}, double{});
+        }
+        return hipErrorInvalidValue;
+    }
+
+    // Runs the launches of a timed or untimed stream config, as flatPermutation does
+    float runBatch(PointerBatchPermutation const& batch,
+                   double                         alpha,
+                   void const* const*             A,
+                   void* const*                   B,
+                   int64_t                        batchCount,
+                   StreamConfig const&            streamConfig)
+    {
+        auto stream = streamConfig.stream_id_;
+        if(!streamConfig.time_kernel_)
+        {
+            auto result = launchBatch(batch, alpha, A, B, batchCount, stream);
+            return result == hipSuccess ? 0.0F : -1.0F;
+        }
+
+        // Timed like the CK kernels: warm up, then average the hot runs
+        for(int i = 0; i < streamConfig.cold_niters_; i++)
+        {
+            if(launchBatch(batch, alpha, A, B, batchCount, stream) != hipSuccess)
+            {
+                return -1.0F;
+            }
+        }
+
+        auto       repeats = std::max(streamConfig.nrepeat_, 1);
+        hipEvent_t start, stop;
+        if(hipEventCreate(&start) != hipSuccess)
+        {
+            return -1.0F;
+        }
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            hipEventDestroy(start);
+            return -1.0F;
+        }
+
+        auto result = hipEventRecord(start, stream);
+        for(int i = 0; i < repeats && result == hipSuccess; i++)
+        {
+            result = launchBatch(batch, alpha, A, B, batchCount, stream);
+        }
+
+        float elapsedMs = 0.0F;
+        if(result == hipSuccess)
+        {
+            result = hipEventRecord(stop, stream);
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventSynchronize(stop);
+        }
+        if(result == hipSuccess)
+        {
+            result = hipEventElapsedTime(&elapsedMs, start, stop);
+        }
+
+        hipEventDestroy(start);
+        hipEventDestroy(stop);
+
+        return result == hipSuccess ? elapsedMs / repeats : -1.0F;
+    }
+} // namespace
+
+namespace hiptensor
+{
+    bool makePointerBatchPermutation(const hiptensorTensorDescriptor_t* descA,
+                                     const int32_t                      modeA[],
+                                     const hiptensorTensorDescriptor_t* descB,
+                                     const int32_t                      modeB[],
+                                     PointerBatchPermutation&           batch)
+    {
+        // Modes that stay contiguous in both tensors are folded
+        FoldedPermutation folded;
+        if(foldPermutation(descA, modeA, descB, modeB, folded))
+        {
+            descA = &folded.mDescA;
+            modeA = folded.mModeA.data();
+            descB = &folded.mDescB;
+            modeB = folded.mModeB.data();
+        }
+
+        auto rank = descA->mLengths.size();
+        if(rank != descB->mLengths.size())
+        {
+            return false;
+        }
+
+        auto& options  = HiptensorOptions::instance();
+        bool  colMajor = options->isColMajorStrides();
+        auto  strides  = [colMajor](const hiptensorTensorDescriptor_t* desc) {
+            return desc->mStrides.size() == desc->mLengths.size()
+                         ? desc->mStrides
+                         : stridesFromLengths(desc->mLengths, colMajor);
+        };
+        auto stridesA = strides(descA);
+        auto stridesB = strides(descB);
+
+        // Position in B of each mode of A
+        auto inputMode = findIndices({modeB, modeB + rank}, {modeA, modeA + rank});
+        if(inputMode.size() != rank)
+        {
+            return false;
+        }
+
+        // Modes of length one are dropped, the others ordered by their stride in B
+        std::vector<std::size_t> modes;
+        for(std::size_t i = 0; i < rank; i++)
+        {
+            if(descA->mLengths[i] != 1)
+            {
+                modes.push_back(i);
+            }
+        }
+        if(modes.size() > PointerBatchPermutation::MaxRank)
+        {
+            return false;
+        }
+        std::stable_sort(modes.begin(), modes.end(), [&](auto lhs, auto rhs) {
+            return stridesB[inputMode[lhs]] < stridesB[inputMode[rhs]];
+        });
+
+        // The fastest changing mode of A is transposed with that of B
+        auto fastestA = std::min_element(modes.begin(), modes.end(), [&](auto lhs, auto rhs) {
+            return stridesA[lhs] < stridesA[rhs];
+        });
+        batch.mTranspose = fastestA != modes.end() && fastestA != modes.begin()
+                           && stridesA[*fastestA] < stridesA[modes.front()];
+        if(batch.mTranspose)
+        {
+            std::rotate(modes.begin() + 1, fastestA, fastestA + 1);
+        }
+
+        batch.mTypeA        = descA->mType;
+        batch.mTypeB        = descB->mType;
+        batch.mOpA          = descA->mUnaryOp;
+        batch.mOpB          = descB->mUnaryOp;
+        batch.mRank         = static_cast<int32_t>(modes.size());
+        batch.mElementCount = std::accumulate(descA->mLengths.cbegin(),
+                                              descA->mLengths.cend(),
+                                              int64_t(1),
+                                              std::multiplies<int64_t>());
+        for(int32_t i = 0; i < batch.mRank; i++)
+        {
+            batch.mLengths[i]  = descA->mLengths[modes[i]];
+            batch.mStridesA[i] = stridesA[modes[i]];
+            batch.mStridesB[i] = stridesB[inputMode[modes[i]]];
+        }
+
+        // A problem of ones is a single element
+        if(batch.mRank == 0)
+        {
+            batch.mRank        = 1;
+            batch.mLengths[0]  = 1;
+            batch.mStridesA[0] = 1;
+            batch.mStridesB[0] = 1;
+        }
+        return true;
+    }
+
+    float pointerBatchPermutation(PointerBatchPermutation const& batch,
+                                  double                         alpha,
+                                  const void* const              A[],
+                                  void* const                    B[],
+                                  int64_t                        batchCount,
+                                  StreamConfig const&            streamConfig)
+    {
+        if(batch.mElementCount == 0 || batchCount == 0)
+        {
+            return 0.0F;
+        }
+
+        // The base pointers of A, then those of B. A copy from pageable memory
+        // returns once the host array is staged, so pointers may go out of scope.
+        auto pointers = std::vector<const void*>(A, A + batchCount);
+        pointers.insert(pointers.end(), B, B + batchCount);
+
+        auto  stream = streamConfig.stream_id_;
+        auto  bytes  = pointers.size() * sizeof(void*);
+        void* devicePointers;
+        if(hipMallocAsync(&devicePointers, bytes, stream) != hipSuccess)
+        {
+            return -1.0F;
+        }
+
+        auto time = -1.0F;
+        if(hipMemcpyAsync(devicePointers, pointers.data(), bytes, hipMemcpyHostToDevice, stream)
+           == hipSuccess)
+        {
+            auto deviceA = static_cast<void const* const*>(devicePointers);
+            auto deviceB = static_cast<void* const*>(devicePointers) + batchCount;
+            time         = runBatch(batch, alpha, deviceA, deviceB, batchCount, streamConfig);
+        }
+
+        if(hipFreeAsync(devicePointers, stream) != hipSuccess)
+        {
+            return -1.0F;
+        }
+        return time;
+    }
+
+    const char* pointerBatchPermutationName(PointerBatchPermutation const& batch)
+    {
+        return batch.mTranspose ? "PointerBatchTranspose" : "PointerBatch";
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_POINTER_BATCH_HPP
+#define HIPTENSOR_PERMUTATION_POINTER_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+// CK includes
+#include <ck/stream_config.hpp>
+
+namespace hiptensor
+{
+    // @cond
+    // Permutation of a batch of tensors that are given by arrays of base pointers
+    // instead of a stride between them. The modes are folded as by
+    // foldPermutation and the modes of length one dropped. Mode 0 is the fastest
+    // changing mode of B. When A changes fastest along another mode, that mode is
+    // mode 1 and the two are transposed in shared memory tiles; every remaining
+    // mode is an outer loop.
+    struct PointerBatchPermutation
+    {
+        // The modes of a complex permutation and the parts of its elements
+        static constexpr int32_t MaxRank = 8;
+
+        hipDataType         mTypeA;
+        hipDataType         mTypeB;
+        hiptensorOperator_t mOpA;
+        hiptensorOperator_t mOpB;
+
+        int32_t mRank;
+        int64_t mLengths[MaxRank];
+        int64_t mStridesA[MaxRank];
+        int64_t mStridesB[MaxRank];
+
+        // Elements of one tensor of the batch
+        int64_t mElementCount;
+
+        // Whether modes 0 and 1 form a tiled transpose
+        bool mTranspose;
+    };
+
+    // Returns false, leaving batch unspecified, if the folded permutation has
+    // more than MaxRank modes. Complex permutations are expected in their real
+    // view of complexAsRealPermutation.
+    bool makePointerBatchPermutation(const hiptensorTensorDescriptor_t* descA,
+                                     const int32_t                      modeA[],
+                                     const hiptensorTensorDescriptor_t* descB,
+                                     const int32_t                      modeB[],
+                                     PointerBatchPermutation&           batch);
+
+    // Runs B[i] = opB(alpha * opA(A[i])) for the batchCount tensors in one launch,
+    // with the batch along the second grid dimension. A and B are host arrays of
+    // base pointers, staged to a device array on the stream for the launch. The
+    // tensors of B must not overlap each other nor the tensors of A. Timed like
+    // flatPermutation().
+    float pointerBatchPermutation(PointerBatchPermutation const& batch,
+                                  double                         alpha,
+                                  const void* const              A[],
+                                  void* const                    B[],
+                                  int64_t                        batchCount,
+                                  StreamConfig const&            streamConfig);
+
+    // Kernel name reported in the performance trace
+    const char* pointerBatchPermutationName(PointerBatchPermutation const& batch);
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERMUTATION_POINTER_BATCH_HPP
@@ -88,6 +88,36 @@ namespace hiptensor
                          const hipDataType               typeScalar,
                          StreamConfig const&             streamConfig = StreamConfig{});
 
+        // Problem layout resolved once by a permutation plan, so that
+        // execution only supplies the data pointers and alpha.
+        struct PreparedArgs
+        {
+            virtual ~PreparedArgs() = default;
+
+            ck::index_t mSize  = 0;
+            ck::index_t mBytes = 0;
+        };
+
+        // Returns nullptr if the kernel does not support the problem
+        virtual std::unique_ptr<PreparedArgs>
+            prepareArgs(std::vector<std::size_t> const& a_lengths,
+                        std::vector<std::size_t> const& a_strides,
+                        const int32_t                   modeA[],
+                        std::vector<std::size_t> const& b_lengths,
+                        std::vector<std::size_t> const& b_strides,
+                        const int32_t                   modeB[]) const
+            = 0;
+
+        // Runs prepared arguments. The solution itself is not modified,
+        // so plans sharing this solution may execute concurrently.
+        virtual float run(PreparedArgs const& args,
+                          void const*         alpha,
+                          void const*         A,
+                          void*               B,
+                          const hipDataType   typeScalar,
+                          StreamConfig const& streamConfig = StreamConfig{}) const
+            = 0;
+
         /// Accessors
 
         // Problem can be solved with this kernel
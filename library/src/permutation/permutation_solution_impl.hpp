@@ -91,7 +91,8 @@ namespace hiptensor
                 {
                     std::string kernelName = argValues.substr(0, argValues.find('<'));
                     if(kernelName == "DeviceElementwiseImpl"
-                       || kernelName == "ReferencePermutation")
+                       || kernelName == "ReferencePermutation"
+                       || kernelName == "HostPermutation")
                     {
                         int beg = argValues.find(',');
                         int end = argValues.find(',', beg + 1);
@@ -101,21 +102,158 @@ namespace hiptensor
                 return 1;
             };
 
-            // Note: CK ALWAYS uses float for alpha in permutation
-            float alphaF;
+            // Alpha stays in double until the scale operator narrows it to its own type
+            double alphaValue = 1.0;
             if(alpha != nullptr)
             {
-                alphaF = hiptensor::readVal<float>(alpha, convertToComputeType(typeScalar));
+                alphaValue = hiptensor::readVal<double>(alpha, convertToComputeType(typeScalar));
             }
 
+            std::array<ck::index_t, Traits::NDim> abLengths, aStrides, bStridesCk;
+            toCkProblem(a_lengths,
+                        a_strides,
+                        modeA,
+                        b_lengths,
+                        b_strides,
+                        modeB,
+                        abLengths,
+                        aStrides,
+                        bStridesCk);
+
+            // Initialize the argument pointer
+            Base::mInvokerArgPtr
+                = makeArgument(deviceOp, abLengths, aStrides, bStridesCk, A, B, alphaValue);
+
+            // Initialize the invoker
+            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+
+            // Fill problem metrics
+            Base::mDim = Traits::NDim;
+
+            // Size count
+            Base::mSize
+                = std::accumulate(abLengths.cbegin(), abLengths.cend(), 1, std::multiplies{});
+
+            // Byte count
+            Base::mBytes = (sizeof(typename Traits::InDataT) + sizeof(typename Traits::OutDataT))
+                           * Base::mSize;
+
+            // Arg test
+            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+
+            Base::mThreadDim = findThreadDim(deviceOp->GetTypeString());
+
+            return mValid;
+        }
+
+        std::unique_ptr<PreparedArgs>
+            prepareArgs(std::vector<std::size_t> const& a_lengths,
+                        std::vector<std::size_t> const& a_strides,
+                        const int32_t                   modeA[],
+                        std::vector<std::size_t> const& b_lengths,
+                        std::vector<std::size_t> const& b_strides,
+                        const int32_t                   modeB[]) const override
+        {
+            using Traits = MetaTraits<DeviceOp>;
+
+            auto* deviceOp = dynamic_cast<DeviceOp*>(mDeviceOp.get());
+            if(deviceOp == nullptr)
+            {
+                return nullptr;
+            }
+
+            auto args = std::make_unique<PreparedArgsImpl>();
+            toCkProblem(a_lengths,
+                        a_strides,
+                        modeA,
+                        b_lengths,
+                        b_strides,
+                        modeB,
+                        args->mLengths,
+                        args->mAStrides,
+                        args->mBStrides);
+
+            // Support does not depend on the data pointers or on alpha
+            auto probe = makeArgument(
+                deviceOp, args->mLengths, args->mAStrides, args->mBStrides, nullptr, nullptr, 1.0);
+            if(!deviceOp->IsSupportedArgument(probe.get()))
+            {
+                return nullptr;
+            }
+
+            args->mInvoker = deviceOp->MakeInvokerPointer();
+            args->mSize    = std::accumulate(
+                args->mLengths.cbegin(), args->mLengths.cend(), 1, std::multiplies{});
+            args->mBytes = (sizeof(typename Traits::InDataT) + sizeof(typename Traits::OutDataT))
+                           * args->mSize;
+
+            return args;
+        }
+
+        float run(PreparedArgs const& args,
+                  void const*         alpha,
+                  void const*         A,
+                  void*               B,
+                  const hipDataType   typeScalar,
+                  StreamConfig const& streamConfig) const override
+        {
+            auto* deviceOp = dynamic_cast<DeviceOp*>(mDeviceOp.get());
+            auto* prepared = dynamic_cast<PreparedArgsImpl const*>(&args);
+            if(deviceOp == nullptr || prepared == nullptr || !prepared->mInvoker)
+            {
+                return -1.0f;
+            }
+
+            // Alpha stays in double until the scale operator narrows it to its own type
+            double alphaValue = 1.0;
+            if(alpha != nullptr)
+            {
+                alphaValue = hiptensor::readVal<double>(alpha, convertToComputeType(typeScalar));
+            }
+
+            // Only the pointers and alpha change between executions of a plan
+            auto argument = makeArgument(deviceOp,
+                                         prepared->mLengths,
+                                         prepared->mAStrides,
+                                         prepared->mBStrides,
+                                         A,
+                                         B,
+                                         alphaValue);
+
+            return prepared->mInvoker->Run(argument.get(), streamConfig);
+        }
+
+    private:
+        using CkArray = std::array<ck::index_t, MetaTraits<DeviceOp>::NDim>;
+
+        struct PreparedArgsImpl : public PreparedArgs
+        {
+            CkArray                                                    mLengths;
+            CkArray                                                    mAStrides;
+            CkArray                                                    mBStrides;
+            std::unique_ptr<ck::tensor_operation::device::BaseInvoker> mInvoker;
+        };
+
+        // Converts the problem to CK's format, with the strides of B
+        // reordered to the modes of A. Empty strides are packed.
+        static void toCkProblem(std::vector<std::size_t> const& a_lengths,
+                                std::vector<std::size_t> const& a_strides,
+                                const int32_t                   modeA[],
+                                std::vector<std::size_t> const& b_lengths,
+                                std::vector<std::size_t> const& b_strides,
+                                const int32_t                   modeB[],
+                                CkArray&                        abLengths,
+                                CkArray&                        aStrides,
+                                CkArray&                        bStridesCk)
+        {
+            using Traits = MetaTraits<DeviceOp>;
+
             // CK has its own format for indices...
-            auto toCKArr
-                = [](std::vector<std::size_t> const& v, std::array<ck::index_t, Traits::NDim>& a) {
-                      std::copy_n(v.begin(), Traits::NDim, a.begin());
-                  };
+            auto toCKArr = [](std::vector<std::size_t> const& v, CkArray& a) {
+                std::copy_n(v.begin(), Traits::NDim, a.begin());
+            };
 
-            // Re-construct strides from lengths, assuming packed.
-            std::array<ck::index_t, Traits::NDim> aStrides, bStrides, bStridesCk, abLengths;
+            CkArray bStrides;
 
             std::map<char, ck::index_t> modeAToIndex;
             for(int i = 0; i < Traits::NDim; i++)
@@ -123,23 +261,39 @@ namespace hiptensor
                 modeAToIndex[modeA[i]] = i;
             }
 
+            // Padded and strided views keep their own strides
             auto& options = HiptensorOptions::instance();
-            toCKArr(hiptensor::stridesFromLengths(a_lengths, options->isColMajorStrides()),
-                    aStrides);
-            toCKArr(hiptensor::stridesFromLengths(b_lengths, options->isColMajorStrides()),
-                    bStrides);
+            auto  strides = [&](std::vector<std::size_t> const& lengths,
+                               std::vector<std::size_t> const& given) {
+                return given.size() == lengths.size()
+                           ? given
+                           : hiptensor::stridesFromLengths(lengths, options->isColMajorStrides());
+            };
+            toCKArr(strides(a_lengths, a_strides), aStrides);
+            toCKArr(strides(b_lengths, b_strides), bStrides);
             for(int i = 0; i < Traits::NDim; i++)
             {
                 bStridesCk[modeAToIndex[modeB[i]]] = bStrides[i];
             }
 
             toCKArr(a_lengths, abLengths);
+        }
+
+        static std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(DeviceOp*      deviceOp,
+                         CkArray const& abLengths,
+                         CkArray const& aStrides,
+                         CkArray const& bStridesCk,
+                         void const*    A,
+                         void*          B,
+                         double         alpha)
+        {
+            using Traits = MetaTraits<DeviceOp>;
 
-            // Initialize the argument pointer
             if constexpr(std::is_same_v<typename Traits::ScaleOp,
                                         ck::tensor_operation::element_wise::PassThrough>)
             {
-                Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(
+                return deviceOp->MakeArgumentPointer(
                     abLengths,
                     {aStrides},
                     {bStridesCk},
@@ -147,42 +301,20 @@ namespace hiptensor
                     {B},
                     typename Traits::CombinedOp{typename Traits::AOp{},
                                                 ck::tensor_operation::element_wise::PassThrough{},
-                                                typename Traits::BOp{}}));
+                                                typename Traits::BOp{}});
             }
             else
             {
-
-                Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(
+                return deviceOp->MakeArgumentPointer(
                     abLengths,
                     {aStrides},
                     {bStridesCk},
                     {A},
                     {B},
                     typename Traits::CombinedOp{typename Traits::AOp{},
-                                                typename Traits::ScaleOp{alphaF},
-                                                typename Traits::BOp{}}));
+                                                typename Traits::ScaleOp(alpha),
+                                                typename Traits::BOp{}});
             }
-
-            // Initialize the invoker
-            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
-
-            // Fill problem metrics
-            Base::mDim = Traits::NDim;
-
-            // Size count
-            Base::mSize
-                = std::accumulate(abLengths.cbegin(), abLengths.cend(), 1, std::multiplies{});
-
-            // Byte count
-            Base::mBytes = (sizeof(typename Traits::InDataT) + sizeof(typename Traits::OutDataT))
-                           * Base::mSize;
-
-            // Arg test
-            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
-
-            Base::mThreadDim = findThreadDim(deviceOp->GetTypeString());
-
-            return mValid;
         }
     };
 
@@ -194,10 +326,11 @@ namespace hiptensor
               ck::index_t NumDim>
     auto enumeratePermutationSolutions()
     {
+        using ScaleOp       = PermutationScaleOp_t<Scale, OutDataTypeTuple>;
         using PermutationOp = ck::tensor_operation::device::DeviceElementwise<
             InDataTypeTuple,
             OutDataTypeTuple,
-            ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, Scale, Bop>,
+            ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, ScaleOp, Bop>,
             NumDim>;
 
         using Factory
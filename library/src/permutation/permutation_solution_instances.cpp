@@ -26,6 +26,7 @@
 
 #include "permutation_solution_instances.hpp"
 #include "permutation_solution.hpp"
+#include "registry_profiler.hpp"
 
 // Ensure access to
 #include "device/hiptensor_permutation_scale_instances.hpp"
@@ -34,55 +35,11 @@ namespace hiptensor
 {
     PermutationSolutionInstances::PermutationSolutionInstances()
     {
-        PermutationSolution2DFloatNoopInstances();
-        PermutationSolution2DFloatSquareSquareInstances();
-        PermutationSolution2DFloatSquareThroughInstances();
-        PermutationSolution2DFloatThroughSquareInstances();
-        PermutationSolution2DFloatThroughThroughInstances();
-        PermutationSolution2DHalfNoopInstances();
-        PermutationSolution2DHalfSquareSquareInstances();
-        PermutationSolution2DHalfSquareThroughInstances();
-        PermutationSolution2DHalfThroughSquareInstances();
-        PermutationSolution2DHalfThroughThroughInstances();
-        PermutationSolution3DFloatNoopInstances();
-        PermutationSolution3DFloatSquareSquareInstances();
-        PermutationSolution3DFloatSquareThroughInstances();
-        PermutationSolution3DFloatThroughSquareInstances();
-        PermutationSolution3DFloatThroughThroughInstances();
-        PermutationSolution3DHalfNoopInstances();
-        PermutationSolution3DHalfSquareSquareInstances();
-        PermutationSolution3DHalfSquareThroughInstances();
-        PermutationSolution3DHalfThroughSquareInstances();
-        PermutationSolution3DHalfThroughThroughInstances();
-        PermutationSolution4DFloatNoopInstances();
-        PermutationSolution4DFloatSquareSquareInstances();
-        PermutationSolution4DFloatSquareThroughInstances();
-        PermutationSolution4DFloatThroughSquareInstances();
-        PermutationSolution4DFloatThroughThroughInstances();
-        PermutationSolution4DHalfNoopInstances();
-        PermutationSolution4DHalfSquareSquareInstances();
-        PermutationSolution4DHalfSquareThroughInstances();
-        PermutationSolution4DHalfThroughSquareInstances();
-        PermutationSolution4DHalfThroughThroughInstances();
-        PermutationSolution5DFloatNoopInstances();
-        PermutationSolution5DFloatSquareSquareInstances();
-        PermutationSolution5DFloatSquareThroughInstances();
-        PermutationSolution5DFloatThroughSquareInstances();
-        PermutationSolution5DFloatThroughThroughInstances();
-        PermutationSolution5DHalfNoopInstances();
-        PermutationSolution5DHalfSquareSquareInstances();
-        PermutationSolution5DHalfSquareThroughInstances();
-        PermutationSolution5DHalfThroughSquareInstances();
-        PermutationSolution5DHalfThroughThroughInstances();
-        PermutationSolution6DFloatNoopInstances();
-        PermutationSolution6DFloatSquareSquareInstances();
-        PermutationSolution6DFloatSquareThroughInstances();
-        PermutationSolution6DFloatThroughSquareInstances();
-        PermutationSolution6DFloatThroughThroughInstances();
-        PermutationSolution6DHalfNoopInstances();
-        PermutationSolution6DHalfSquareSquareInstances();
-        PermutationSolution6DHalfSquareThroughInstances();
-        PermutationSolution6DHalfThroughSquareInstances();
-        PermutationSolution6DHalfThroughThroughInstances();
+        RegistryProfiler::ScopedTimer timer("PermutationSolutionInstances");
+
+        // Register the solutions selected by the kernel manifest
+#include "permutation_solution_manifest.inc"
+
+        timer.finish(solutionCount(), hostBytes());
     }
 } // namespace hiptensor
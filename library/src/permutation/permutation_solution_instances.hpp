@@ -45,6 +45,12 @@ namespace hiptensor
         ~PermutationSolutionInstances() = default;
 
     private:
+        void PermutationSolution2DBhalfNoopInstances();
+        void PermutationSolution2DBhalfThroughThroughInstances();
+        void PermutationSolution2DConvertNoopInstances();
+        void PermutationSolution2DConvertThroughThroughInstances();
+        void PermutationSolution2DDoubleNoopInstances();
+        void PermutationSolution2DDoubleThroughThroughInstances();
         void PermutationSolution2DFloatNoopInstances();
         void PermutationSolution2DFloatSquareSquareInstances();
         void PermutationSolution2DFloatSquareThroughInstances();
@@ -55,6 +61,12 @@ namespace hiptensor
         void PermutationSolution2DHalfSquareThroughInstances();
         void PermutationSolution2DHalfThroughSquareInstances();
         void PermutationSolution2DHalfThroughThroughInstances();
+        void PermutationSolution3DBhalfNoopInstances();
+        void PermutationSolution3DBhalfThroughThroughInstances();
+        void PermutationSolution3DConvertNoopInstances();
+        void PermutationSolution3DConvertThroughThroughInstances();
+        void PermutationSolution3DDoubleNoopInstances();
+        void PermutationSolution3DDoubleThroughThroughInstances();
         void PermutationSolution3DFloatNoopInstances();
         void PermutationSolution3DFloatSquareSquareInstances();
         void PermutationSolution3DFloatSquareThroughInstances();
@@ -65,6 +77,12 @@ namespace hiptensor
         void PermutationSolution3DHalfSquareThroughInstances();
         void PermutationSolution3DHalfThroughSquareInstances();
         void PermutationSolution3DHalfThroughThroughInstances();
+        void PermutationSolution4DBhalfNoopInstances();
+        void PermutationSolution4DBhalfThroughThroughInstances();
+        void PermutationSolution4DConvertNoopInstances();
+        void PermutationSolution4DConvertThroughThroughInstances();
+        void PermutationSolution4DDoubleNoopInstances();
+        void PermutationSolution4DDoubleThroughThroughInstances();
         void PermutationSolution4DFloatNoopInstances();
         void PermutationSolution4DFloatSquareSquareInstances();
         void PermutationSolution4DFloatSquareThroughInstances();
@@ -75,6 +93,12 @@ namespace hiptensor
         void PermutationSolution4DHalfSquareThroughInstances();
         void PermutationSolution4DHalfThroughSquareInstances();
         void PermutationSolution4DHalfThroughThroughInstances();
+        void PermutationSolution5DBhalfNoopInstances();
+        void PermutationSolution5DBhalfThroughThroughInstances();
+        void PermutationSolution5DConvertNoopInstances();
+        void PermutationSolution5DConvertThroughThroughInstances();
+        void PermutationSolution5DDoubleNoopInstances();
+        void PermutationSolution5DDoubleThroughThroughInstances();
         void PermutationSolution5DFloatNoopInstances();
         void PermutationSolution5DFloatSquareSquareInstances();
         void PermutationSolution5DFloatSquareThroughInstances();
@@ -85,6 +109,12 @@ namespace hiptensor
         void PermutationSolution5DHalfSquareThroughInstances();
         void PermutationSolution5DHalfThroughSquareInstances();
         void PermutationSolution5DHalfThroughThroughInstances();
+        void PermutationSolution6DBhalfNoopInstances();
+        void PermutationSolution6DBhalfThroughThroughInstances();
+        void PermutationSolution6DConvertNoopInstances();
+        void PermutationSolution6DConvertThroughThroughInstances();
+        void PermutationSolution6DDoubleNoopInstances();
+        void PermutationSolution6DDoubleThroughThroughInstances();
         void PermutationSolution6DFloatNoopInstances();
         void PermutationSolution6DFloatSquareSquareInstances();
         void PermutationSolution6DFloatSquareThroughInstances();
@@ -67,12 +67,14 @@ namespace hiptensor
 
         hipDataType typeIn() const override
         {
-            return HipDataType_v<typename ck::tuple_element_t<0, typename MetaTraitsT::InDataT>>;
+            return PermutationDataType_v<
+                typename ck::tuple_element_t<0, typename MetaTraitsT::InDataT>>;
         }
 
         hipDataType typeOut() const override
         {
-            return HipDataType_v<typename ck::tuple_element_t<0, typename MetaTraitsT::OutDataT>>;
+            return PermutationDataType_v<
+                typename ck::tuple_element_t<0, typename MetaTraitsT::OutDataT>>;
         }
 
         hiptensorOperator_t opA() const override
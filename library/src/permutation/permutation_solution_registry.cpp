@@ -24,9 +24,13 @@
  *
  *******************************************************************************/
 
+#include <algorithm>
+
 #include "permutation_solution_registry.hpp"
+#include "permutation_folding.hpp"
 #include "permutation_instance_selection.hpp"
 #include "permutation_solution.hpp"
+#include "registry_profiler.hpp"
 
 namespace hiptensor
 {
@@ -40,25 +44,27 @@ namespace hiptensor
                                            const hiptensorTensorDescriptor_t* descB,
                                            const int32_t                      modeB[],
                                            const hipDataType                  typeScalar,
-                                           PermutationInstanceType_t          instanceType) const
+                                           PermutationInstanceType_t          instanceType,
+                                           const void*                        A,
+                                           const void*                        B) const
     {
-        int  nDims      = descA->mLengths.size();
-        auto ADataType  = descA->mType;
-        auto BDataType  = descB->mType;
-        auto AOp        = descA->mUnaryOp;
-        auto BOp        = descB->mUnaryOp;
-        auto outputDims = hiptensor::findIndices({modeA, modeA + descA->mLengths.size()},
-                                                 {modeB, modeB + descB->mLengths.size()});
-        auto instanceParams
-            = instanceType == PermutationInstanceType_t::Device
-                  ? selectInstanceParams(descA->mLengths, outputDims, ADataType, BDataType, nDims)
-                  : InstanceHyperParams{0, 0, 0, 0, 0, {0, 0}, 0, 0};
+        auto scale = scaleOp(alpha, descA, descB, typeScalar, instanceType);
+        return query(scale, descA, modeA, descB, modeB, instanceType, A, B);
+    }
 
-        float alphaValue = 1.0F;
+    PermutationOpId_t
+        PermutationSolutionRegistry::scaleOp(const void*                        alpha,
+                                             const hiptensorTensorDescriptor_t* descA,
+                                             const hiptensorTensorDescriptor_t* descB,
+                                             const hipDataType                  typeScalar,
+                                             PermutationInstanceType_t          instanceType)
+    {
+        // Compared exactly in double, so f64 alphas near 1.0 still scale
+        double alphaValue = 1.0;
         if(alpha != nullptr)
         {
             alphaValue
-                = hiptensor::readVal<float>(alpha, hiptensor::convertToComputeType(typeScalar));
+                = hiptensor::readVal<double>(alpha, hiptensor::convertToComputeType(typeScalar));
         }
 
         /// When AOp and BOp are both pass_through and alpha is 1.0. Permutation only moves data around.
@@ -68,12 +74,64 @@ namespace hiptensor
         /// Do not use PermutationOpId_t::PASS_THROUGH when instanceType is Host since no such special
         /// instances have been created.
         bool usePassThroughIfAlphaIsOne
-            = (alphaValue == 1.0F && AOp == HIPTENSOR_OP_IDENTITY && BOp == HIPTENSOR_OP_IDENTITY
+            = (alphaValue == 1.0 && descA->mUnaryOp == HIPTENSOR_OP_IDENTITY
+               && descB->mUnaryOp == HIPTENSOR_OP_IDENTITY
                && instanceType == PermutationInstanceType_t::Device);
-        auto scale     = usePassThroughIfAlphaIsOne ? hiptensor::PermutationOpId_t::PASS_THROUGH
-                                                    : hiptensor::PermutationOpId_t::SCALE;
+        return usePassThroughIfAlphaIsOne ? hiptensor::PermutationOpId_t::PASS_THROUGH
+                                          : hiptensor::PermutationOpId_t::SCALE;
+    }
+
+    InstanceHyperParams
+        PermutationSolutionRegistry::instanceParams(const hiptensorTensorDescriptor_t* descA,
+                                                    const int32_t                      modeA[],
+                                                    const hiptensorTensorDescriptor_t* descB,
+                                                    const int32_t                      modeB[],
+                                                    PermutationInstanceType_t          instanceType,
+                                                    const void*                        A,
+                                                    const void*                        B,
+                                                    uint32_t maxWidth) const
+    {
+        if(instanceType != PermutationInstanceType_t::Device)
+        {
+            return InstanceHyperParams{0, 0, 0, 0, 0, {0, 0}, 0, 0};
+        }
+
+        int  nDims      = descA->mLengths.size();
+        auto outputDims = hiptensor::findIndices({modeA, modeA + descA->mLengths.size()},
+                                                 {modeB, modeB + descB->mLengths.size()});
+        auto params
+            = selectInstanceParams(descA->mLengths, outputDims, descA->mType, descB->mType, nDims);
+
+        // The tables assume packed, aligned tensors. Padded or strided ones keep the
+        // selected tile with vectors as wide as their layout allows.
+        auto limit = std::min(static_cast<uint32_t>(std::get<6>(params)), maxWidth);
+        auto width = static_cast<ck::index_t>(permutationVectorWidth(descA, A, descB, B, limit));
+        std::get<6>(params) = std::min(std::get<6>(params), width);
+        std::get<7>(params) = std::min(std::get<7>(params), width);
+        return params;
+    }
+
+    std::vector<PermutationSolution*>
+        PermutationSolutionRegistry::query(PermutationOpId_t                  scale,
+                                           const hiptensorTensorDescriptor_t* descA,
+                                           const int32_t                      modeA[],
+                                           const hiptensorTensorDescriptor_t* descB,
+                                           const int32_t                      modeB[],
+                                           PermutationInstanceType_t          instanceType,
+                                           const void*                        A,
+                                           const void*                        B,
+                                           uint32_t                           maxWidth) const
+    {
+        int  nDims     = descA->mLengths.size();
+        auto ADataType = descA->mType;
+        auto BDataType = descB->mType;
+        auto AOp       = descA->mUnaryOp;
+        auto BOp       = descB->mUnaryOp;
+        auto hyperParams
+            = instanceParams(descA, modeA, descB, modeB, instanceType, A, B, maxWidth);
+
         auto hashCodes = ck::tensor_operation::device::instance::getHashCodeOfBestPerfInstances(
-            ADataType, BDataType, AOp, BOp, scale, nDims, instanceParams);
+            ADataType, BDataType, AOp, BOp, scale, nDims, hyperParams);
         std::vector<PermutationSolution*> solutions;
         for(auto hashCode : hashCodes)
         {
@@ -86,6 +144,45 @@ namespace hiptensor
         return solutions;
     }
 
+    uint32_t
+        PermutationSolutionRegistry::vectorWidth(const hiptensorTensorDescriptor_t* descA,
+                                                 const int32_t                      modeA[],
+                                                 const hiptensorTensorDescriptor_t* descB,
+                                                 const int32_t                      modeB[],
+                                                 PermutationInstanceType_t          instanceType,
+                                                 const void*                        A,
+                                                 const void*                        B,
+                                                 uint32_t                           maxWidth) const
+    {
+        auto params = instanceParams(descA, modeA, descB, modeB, instanceType, A, B, maxWidth);
+        return std::max<uint32_t>({1,
+                                   static_cast<uint32_t>(std::get<6>(params)),
+                                   static_cast<uint32_t>(std::get<7>(params))});
+    }
+
+    std::vector<PermutationSolution*>
+        PermutationSolutionRegistry::query(hipDataType         typeIn,
+                                           hipDataType         typeOut,
+                                           hiptensorOperator_t aOp,
+                                           hiptensorOperator_t bOp,
+                                           PermutationOpId_t   scale,
+                                           int32_t             numDim) const
+    {
+        std::vector<PermutationSolution*> solutions;
+        for(auto& [uid, solution] : mAllSolutions)
+        {
+            auto& params = solution->params();
+            if(params->typeIn() == typeIn && params->typeOut() == typeOut
+               && params->opA() == aOp && params->opB() == bOp && params->opScale() == scale
+               && params->dim() == numDim)
+            {
+                solutions.push_back(solution.get());
+            }
+        }
+
+        return solutions;
+    }
+
     void PermutationSolutionRegistry::registerSolutions(
         std::unordered_map<Uid, std::unique_ptr<PermutationSolution>>&& solutions)
     {
@@ -101,4 +198,10 @@ namespace hiptensor
         return mAllSolutions.size();
     }
 
+    std::size_t PermutationSolutionRegistry::hostBytes() const
+    {
+        return mAllSolutions.size() * sizeof(PermutationSolution)
+               + RegistryProfiler::containerBytes(mAllSolutions);
+    }
+
 } // namespace hiptensor
@@ -56,16 +56,78 @@ namespace hiptensor
     public:
         virtual ~PermutationSolutionRegistry() = default;
 
+        // Candidates in order of preference. The vectors are narrowed to what the
+        // strides of A and B, and their addresses when given, allow.
         std::vector<PermutationSolution*> query(const void*                        alpha,
                                                 const hiptensorTensorDescriptor_t* descA,
                                                 const int32_t                      modeA[],
                                                 const hiptensorTensorDescriptor_t* descB,
                                                 const int32_t                      modeB[],
                                                 const hipDataType                  typeScalar,
-                                                PermutationInstanceType_t instanceType) const;
-        uint32_t                          solutionCount() const;
+                                                PermutationInstanceType_t          instanceType,
+                                                const void*                        A = nullptr,
+                                                const void* B = nullptr) const;
+
+        // Scale operation of the candidates query() returns for the value of alpha
+        static PermutationOpId_t scaleOp(const void*                        alpha,
+                                         const hiptensorTensorDescriptor_t* descA,
+                                         const hiptensorTensorDescriptor_t* descB,
+                                         const hipDataType                  typeScalar,
+                                         PermutationInstanceType_t          instanceType);
+
+        // Candidates for an explicit scale operation, independent of the value of alpha.
+        // The vectors are also narrowed to at most maxWidth elements.
+        std::vector<PermutationSolution*>
+            query(PermutationOpId_t                  scale,
+                  const hiptensorTensorDescriptor_t* descA,
+                  const int32_t                      modeA[],
+                  const hiptensorTensorDescriptor_t* descB,
+                  const int32_t                      modeB[],
+                  PermutationInstanceType_t          instanceType,
+                  const void*                        A        = nullptr,
+                  const void*                        B        = nullptr,
+                  uint32_t                           maxWidth = MaxVectorWidth) const;
+
+        // Widest vector, in elements, of the candidates query() returns for the
+        // same arguments. Kernels read A and write B with vectors of this width,
+        // so their addresses must be aligned to it. Host candidates return 1.
+        uint32_t vectorWidth(const hiptensorTensorDescriptor_t* descA,
+                             const int32_t                      modeA[],
+                             const hiptensorTensorDescriptor_t* descB,
+                             const int32_t                      modeB[],
+                             PermutationInstanceType_t          instanceType,
+                             const void*                        A        = nullptr,
+                             const void*                        B        = nullptr,
+                             uint32_t                           maxWidth = MaxVectorWidth) const;
+
+        // Widest vector of any registered device candidate
+        static constexpr uint32_t MaxVectorWidth = 16;
+
+        // All registered candidates of a kind, bypassing the instance tables.
+        // Used to measure the candidates when the tables are regenerated.
+        std::vector<PermutationSolution*> query(hipDataType         typeIn,
+                                                hipDataType         typeOut,
+                                                hiptensorOperator_t aOp,
+                                                hiptensorOperator_t bOp,
+                                                PermutationOpId_t   scale,
+                                                int32_t             numDim) const;
+
+        uint32_t solutionCount() const;
+
+        // Approximate host memory held by the solutions
+        std::size_t hostBytes() const;
 
     private:
+        // Instance table selection with the vectors narrowed as query() documents
+        InstanceHyperParams instanceParams(const hiptensorTensorDescriptor_t* descA,
+                                           const int32_t                      modeA[],
+                                           const hiptensorTensorDescriptor_t* descB,
+                                           const int32_t                      modeB[],
+                                           PermutationInstanceType_t          instanceType,
+                                           const void*                        A,
+                                           const void*                        B,
+                                           uint32_t                           maxWidth) const;
+
         std::unordered_map<Uid, std::unique_ptr<PermutationSolution>> mAllSolutions;
     };
 
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "logger.hpp"
+#include "permutation_solution.hpp"
+#include "permutation_tuning.hpp"
+#include "util.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Runs of each candidate when tuning
+        constexpr int32_t TuningColdRuns = 1;
+        constexpr int32_t TuningHotRuns  = 5;
+
+        template <typename T>
+        void appendList(std::ostringstream& stream, std::vector<T> const& values)
+        {
+            stream << ' ';
+            for(std::size_t i = 0; i < values.size(); i++)
+            {
+                stream << (i > 0 ? "," : "") << values[i];
+            }
+        }
+
+        float elapsedMs(std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now()
+                                                            - start)
+                .count();
+        }
+    }
+
+    PermutationTuning::PermutationTuning()
+        : mEnabled(false)
+    {
+        if(const char* env = std::getenv("HIPTENSOR_PERMUTATION_TUNING"))
+        {
+            std::string upper = env;
+            std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+            mEnabled = upper.compare("ON") == 0;
+        }
+
+        if(const char* env = std::getenv("HIPTENSOR_PERMUTATION_TUNING_FILE"))
+        {
+            mFile = env;
+        }
+
+        // Each line of the tuning file is a key followed by the hexadecimal uid of
+        // its winner. Later lines replace earlier ones of the same key.
+        if(mEnabled && !mFile.empty())
+        {
+            std::ifstream file(mFile);
+            std::string   line;
+            while(std::getline(file, line))
+            {
+                auto separator = line.rfind(' ');
+                if(separator == std::string::npos)
+                {
+                    continue;
+                }
+
+                std::istringstream converter(line.substr(separator + 1));
+                Uid                uid;
+                if(converter >> std::hex >> uid)
+                {
+                    mWinners[line.substr(0, separator)] = uid;
+                }
+            }
+        }
+    }
+
+    bool PermutationTuning::isEnabled() const
+    {
+        return mEnabled;
+    }
+
+    std::string PermutationTuning::key(std::string const&                 arch,
+                                       PermutationOpId_t                  scale,
+                                       const hiptensorTensorDescriptor_t* descA,
+                                       const int32_t                      modeA[],
+                                       const hiptensorTensorDescriptor_t* descB,
+                                       const int32_t                      modeB[])
+    {
+        auto rank       = descA->mLengths.size();
+        auto outputDims = findIndices({modeA, modeA + rank}, {modeB, modeB + rank});
+
+        std::ostringstream stream;
+        stream << arch << ' ' << descA->mType << ' ' << descB->mType << ' ' << descA->mUnaryOp
+               << ' ' << descB->mUnaryOp << ' ' << static_cast<int32_t>(scale);
+        appendList(stream, descA->mLengths);
+        appendList(stream, descA->mStrides);
+        appendList(stream, descB->mStrides);
+        appendList(stream, outputDims);
+        return stream.str();
+    }
+
+    PermutationSolution*
+        PermutationTuning::find(std::string const&                       key,
+                                std::vector<PermutationSolution*> const& candidates) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto winner = mWinners.find(key);
+        if(winner == mWinners.end())
+        {
+            return nullptr;
+        }
+
+        auto solution = std::find_if(candidates.cbegin(), candidates.cend(), [&](auto candidate) {
+            return candidate->uid() == winner->second;
+        });
+        return solution != candidates.cend() ? *solution : nullptr;
+    }
+
+    PermutationTuning::Result
+        PermutationTuning::tune(std::string const&                       key,
+                                std::vector<PermutationSolution*> const& candidates,
+                                const void*                              alpha,
+                                const void*                              A,
+                                void*                                    B,
+                                const hiptensorTensorDescriptor_t*       descA,
+                                const int32_t                            modeA[],
+                                const hiptensorTensorDescriptor_t*       descB,
+                                const int32_t                            modeB[],
+                                const hipDataType                        typeScalar,
+                                const hipStream_t                        stream)
+    {
+        auto start  = std::chrono::steady_clock::now();
+        auto result = Result{nullptr, 0, 0.0F, 0.0F};
+
+        auto initArgs = [&](PermutationSolution* solution) {
+            return solution->initArgs(alpha,
+                                      A,
+                                      B,
+                                      descA->mLengths,
+                                      descA->mStrides,
+                                      modeA,
+                                      descB->mLengths,
+                                      descB->mStrides,
+                                      modeB,
+                                      typeScalar);
+        };
+
+        // A winner from this process or from the tuning file is not timed again
+        if(auto winner = find(key, candidates); winner != nullptr && initArgs(winner))
+        {
+            result.mSolution    = winner;
+            result.mSelectionMs = elapsedMs(start);
+            return result;
+        }
+
+        // Every timed run of a problem permuted in place would apply alpha and the
+        // operators to its output again, so such problems keep the table selection
+        if(A == B)
+        {
+            return result;
+        }
+
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        for(auto candidate : candidates)
+        {
+            if(!initArgs(candidate))
+            {
+                continue;
+            }
+
+            auto time = (*candidate)(StreamConfig{
+                stream, // stream id
+                true, // time_kernel
+                0, // log_level
+                TuningColdRuns, // cold_niters
+                TuningHotRuns, // nrepeat
+            });
+            result.mCandidates++;
+
+            if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_HEURISTICS_TRACE)
+            {
+                char msg[256];
+                snprintf(msg,
+                         sizeof(msg),
+                         "KernelId: %lu, KernelName: %s, AvgTime: %0.3f ms",
+                         candidate->uid(),
+                         candidate->kernelName().c_str(),
+                         time);
+                logger->logHeuristics("PERMUTATION_TUNING_KERNEL_PERF", msg);
+            }
+
+            if(time > 0 && (result.mSolution == nullptr || time < result.mKernelMs))
+            {
+                result.mSolution = candidate;
+                result.mKernelMs = time;
+            }
+        }
+
+        // The arguments of the other candidates replaced those of the winner
+        if(result.mSolution != nullptr && initArgs(result.mSolution))
+        {
+            record(key, result.mSolution->uid());
+        }
+        else
+        {
+            result.mSolution = nullptr;
+        }
+
+        result.mSelectionMs = elapsedMs(start);
+        return result;
+    }
+
+    void PermutationTuning::record(std::string const& key, Uid uid)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mWinners[key] = uid;
+        if(!mFile.empty())
+        {
+            std::ofstream file(mFile, std::ios::app);
+            file << key << ' ' << std::hex << uid << '\n';
+        }
+    }
+
+} // namespace hiptensor
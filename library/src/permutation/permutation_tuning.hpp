@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERMUTATION_TUNING_HPP
+#define HIPTENSOR_PERMUTATION_TUNING_HPP
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hip/hip_runtime_api.h>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "permutation_types.hpp"
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // @cond
+    class PermutationSolution;
+
+    // Fastest device solutions measured per exact permutation problem.
+    // Tuning is enabled with HIPTENSOR_PERMUTATION_TUNING=ON. The winners are
+    // also appended to HIPTENSOR_PERMUTATION_TUNING_FILE when set, and read back
+    // from it by later processes.
+    class PermutationTuning : public LazySingleton<PermutationTuning>
+    {
+        // For static initialization
+        friend std::unique_ptr<PermutationTuning> std::make_unique<PermutationTuning>();
+
+    private: // No public instantiation except make_unique.
+        PermutationTuning();
+        PermutationTuning(PermutationTuning const&)            = delete;
+        PermutationTuning& operator=(PermutationTuning const&) = delete;
+
+    public:
+        ~PermutationTuning() = default;
+
+        struct Result
+        {
+            PermutationSolution* mSolution;
+
+            // Candidates timed, zero if the winner was already known
+            int32_t mCandidates;
+
+            // Time to select the solution, and the time of its kernel
+            float mSelectionMs;
+            float mKernelMs;
+        };
+
+        bool isEnabled() const;
+
+        // Exact signature of a permutation problem on a device architecture
+        static std::string key(std::string const&                 arch,
+                               PermutationOpId_t                  scale,
+                               const hiptensorTensorDescriptor_t* descA,
+                               const int32_t                      modeA[],
+                               const hiptensorTensorDescriptor_t* descB,
+                               const int32_t                      modeB[]);
+
+        // The candidate tuned for key, or nullptr if there is none
+        PermutationSolution* find(std::string const&                       key,
+                                  std::vector<PermutationSolution*> const& candidates) const;
+
+        // Selects the fastest candidate accepting the problem, timed on the given
+        // tensors, unless a winner of key is known. B is written by the timed runs.
+        // The solution of the result is nullptr if no candidate can run, or if B is A
+        // and no winner is known, since runs in place cannot be repeated.
+        Result tune(std::string const&                       key,
+                    std::vector<PermutationSolution*> const& candidates,
+                    const void*                              alpha,
+                    const void*                              A,
+                    void*                                    B,
+                    const hiptensorTensorDescriptor_t*       descA,
+                    const int32_t                            modeA[],
+                    const hiptensorTensorDescriptor_t*       descB,
+                    const int32_t                            modeB[],
+                    const hipDataType                        typeScalar,
+                    const hipStream_t                        stream);
+
+    private:
+        void record(std::string const& key, Uid uid);
+
+        bool                                 mEnabled;
+        std::string                          mFile;
+        mutable std::mutex                   mMutex;
+        std::unordered_map<std::string, Uid> mWinners;
+    };
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERMUTATION_TUNING_HPP
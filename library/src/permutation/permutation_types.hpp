@@ -30,6 +30,9 @@
 #include <ck/ck.hpp>
 #include <ck/utility/sequence.hpp>
 #include <ostream>
+#include <type_traits>
+
+#include "data_types.hpp"
 
 namespace hiptensor
 {
@@ -71,6 +74,19 @@ namespace hiptensor
     template <typename OpId>
     static constexpr auto PermutationOperatorType_v = PermutationOperatorType<OpId>::value;
 
+    // Map the scale operator of an instance list to the one it runs with
+    template <typename Scale, typename OutDataTypeTuple>
+    struct PermutationScaleOp;
+
+    template <typename Scale, typename OutDataTypeTuple>
+    using PermutationScaleOp_t = typename PermutationScaleOp<Scale, OutDataTypeTuple>::type;
+
+    // Map CK data type to runtime hipDataType. CK stores bf16 as ushort
+    // (ck::bhalf_t), which HipDataType_v alone reports as HIP_R_16U.
+    template <typename DataType>
+    static constexpr auto PermutationDataType_v = HipDataType_v<
+        std::conditional_t<std::is_same_v<DataType, ck::bhalf_t>, hip_bfloat16, DataType>>;
+
     using InstanceHyperParams = std::tuple<ck::index_t,
                                            ck::index_t,
                                            ck::index_t,
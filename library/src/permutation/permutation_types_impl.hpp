@@ -28,8 +28,10 @@
 #define HIPTENSOR_PERMUTATION_TYPES_IMPL_HPP
 
 // CK includes
+#include <ck/utility/tuple.hpp>
 #include <combined_element_wise_operation.hpp>
 
+#include "device/device_element_wise_operation_double.hpp"
 #include "permutation_types.hpp"
 #include <hiptensor/hiptensor_types.hpp>
 
@@ -55,12 +57,29 @@ namespace hiptensor
         static constexpr auto value = PermutationOpId_t::SCALE;
     };
 
+    template <>
+    struct PermutationOperatorType<ck::tensor_operation::element_wise::ScaleDouble>
+    {
+        static constexpr auto value = PermutationOpId_t::SCALE;
+    };
+
     template <>
     struct PermutationOperatorType<ck::tensor_operation::element_wise::PassThrough>
     {
         static constexpr auto value = PermutationOpId_t::PASS_THROUGH;
     };
 
+    // Scale writing double outputs keeps alpha in double
+    template <typename Scale, typename OutDataTypeTuple>
+    struct PermutationScaleOp
+    {
+        using type = std::conditional_t<
+            std::is_same_v<Scale, ck::tensor_operation::element_wise::Scale>
+                && std::is_same_v<typename ck::tuple_element_t<0, OutDataTypeTuple>, double>,
+            ck::tensor_operation::element_wise::ScaleDouble,
+            Scale>;
+    };
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_PERMUTATION_TYPES_IMPL_HPP
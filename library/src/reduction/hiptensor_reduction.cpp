@@ -23,6 +23,7 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <chrono>
 #include <hiptensor/hiptensor.hpp>
 #include <set>
 #include <unordered_set>
@@ -45,6 +46,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/utility/reduction_enums.hpp"
 
+#include "reduction_cpu_reference.hpp"
 #include "reduction_solution.hpp"
 #include "reduction_solution_instances.hpp"
 #include "reduction_solution_registry.hpp"
@@ -193,30 +195,33 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
     auto& logger = Logger::instance();
     char  msg[2048];
 
-    snprintf(msg,
-             sizeof(msg),
-             "hiptensorReduction: handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, beta=%p, C=%p, "
-             "descC=%p, modeC=%p, D=%p, descD=%p, modeD=%p, opReduce=%d, typeCompute=%d, "
-             "workspace=%p, workspaceSize=%lu, stream=%p",
-             handle,
-             alpha,
-             A,
-             descA,
-             modeA,
-             beta,
-             C,
-             descC,
-             modeC,
-             D,
-             descD,
-             modeD,
-             (int)opReduce,
-             (int)typeCompute,
-             workspace,
-             workspaceSize,
-             stream);
-
-    logger->logAPITrace("hiptensorReduction", msg);
+    if(logger->isEnabled(Logger::LogLevel_t::LOG_LEVEL_API_TRACE))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "hiptensorReduction: handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, beta=%p, "
+                 "C=%p, descC=%p, modeC=%p, D=%p, descD=%p, modeD=%p, opReduce=%d, typeCompute=%d, "
+                 "workspace=%p, workspaceSize=%lu, stream=%p",
+                 handle,
+                 alpha,
+                 A,
+                 descA,
+                 modeA,
+                 beta,
+                 C,
+                 descC,
+                 modeC,
+                 D,
+                 descD,
+                 modeD,
+                 (int)opReduce,
+                 (int)typeCompute,
+                 workspace,
+                 workspaceSize,
+                 stream);
+
+        logger->logAPITrace("hiptensorReduction", msg);
+    }
 
     if(auto errorCode = checkReductionInputData(handle,
                                                 alpha,
@@ -239,13 +244,52 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
         return errorCode;
     }
 
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    if(realHandle->isHostBackend())
+    {
+        // Host tensors are reduced by the multithreaded CPU solutions
+        auto hostStart = std::chrono::steady_clock::now();
+        auto errorCode = hiptensorReductionReference(alpha,
+                                                     A,
+                                                     descA,
+                                                     modeA,
+                                                     beta,
+                                                     C,
+                                                     descC,
+                                                     modeC,
+                                                     D,
+                                                     descD,
+                                                     modeD,
+                                                     opReduce,
+                                                     typeCompute,
+                                                     stream);
+
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Host solution is unable to solve the problem (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorReduction", msg);
+        }
+        else if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+        {
+            auto time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now()
+                                                                 - hostStart)
+                            .count();
+            snprintf(msg, sizeof(msg), "Host solution, %0.3f ms", time);
+            logger->logPerformanceTrace("hiptensorReduction", msg);
+        }
+        return errorCode;
+    }
+
     auto& instances = hiptensor::ReductionSolutionInstances::instance();
     if(instances->solutionCount() == 0)
     {
-        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : ReductionSolutionInstances is empty (%s)",
+                 "No reduction kernels available in the kernel manifest (%s)",
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorReduction", msg);
         return errorCode;
@@ -275,10 +319,11 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
 
     if(solutionQ.solutionCount() == 0)
     {
-        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        // No kernels were built for these types and ranks in the kernel manifest
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : querySolutions returns 0 kernel. (%s)",
+                 "No kernels available for this reduction in the kernel manifest (%s)",
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorReduction", msg);
         return errorCode;
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+
+#include "reduction_cpu_engine.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Drops length-1 modes, orders the rest by the first stride list and folds
+        // neighbours that are contiguous in every stride list
+        void foldModes(std::vector<int64_t>&              lengths,
+                       std::vector<std::vector<int64_t>*> strides)
+        {
+            std::vector<std::size_t> order;
+            for(std::size_t d = 0; d < lengths.size(); d++)
+            {
+                if(lengths[d] != 1)
+                {
+                    order.push_back(d);
+                }
+            }
+            std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+                return std::abs((*strides[0])[lhs]) < std::abs((*strides[0])[rhs]);
+            });
+
+            std::vector<int64_t>              foldedLengths;
+            std::vector<std::vector<int64_t>> foldedStrides(strides.size());
+            for(auto d : order)
+            {
+                if(!foldedLengths.empty())
+                {
+                    bool contiguous = true;
+                    for(std::size_t t = 0; t < strides.size(); t++)
+                    {
+                        contiguous &= (*strides[t])[d]
+                                      == foldedStrides[t].back() * foldedLengths.back();
+                    }
+
+                    if(contiguous)
+                    {
+                        foldedLengths.back() *= lengths[d];
+                        continue;
+                    }
+                }
+
+                foldedLengths.push_back(lengths[d]);
+                for(std::size_t t = 0; t < strides.size(); t++)
+                {
+                    foldedStrides[t].push_back((*strides[t])[d]);
+                }
+            }
+
+            lengths = std::move(foldedLengths);
+            for(std::size_t t = 0; t < strides.size(); t++)
+            {
+                *strides[t] = std::move(foldedStrides[t]);
+            }
+        }
+    } // namespace
+
+    ReductionCpuAccumulation reductionCpuAccumulation()
+    {
+        static const ReductionCpuAccumulation sAccumulation = []() {
+            if(const char* env = std::getenv("HIPTENSOR_CPU_REDUCTION_ACCUMULATION"))
+            {
+                std::string upper = env;
+                std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+                if(upper.compare("KAHAN") == 0)
+                {
+                    return ReductionCpuAccumulation::KAHAN;
+                }
+            }
+            return ReductionCpuAccumulation::PAIRWISE;
+        }();
+        return sAccumulation;
+    }
+
+    ReductionCpuPlan makeReductionCpuPlan(std::vector<int64_t> const& keptLengths,
+                                          std::vector<int64_t> const& keptInStrides,
+                                          std::vector<int64_t> const& keptOutStrides,
+                                          std::vector<int64_t> const& reduceLengths,
+                                          std::vector<int64_t> const& reduceInStrides)
+    {
+        auto count = [](std::vector<int64_t> const& lengths) {
+            return std::accumulate(
+                lengths.begin(), lengths.end(), int64_t(1), std::multiplies<int64_t>());
+        };
+
+        ReductionCpuPlan plan;
+        plan.mKeptCount       = count(keptLengths);
+        plan.mReduceCount     = count(reduceLengths);
+        plan.mLengthsKept     = keptLengths;
+        plan.mStridesInKept   = keptInStrides;
+        plan.mStridesOutKept  = keptOutStrides;
+        plan.mLengthsReduce   = reduceLengths;
+        plan.mStridesInReduce = reduceInStrides;
+
+        foldModes(plan.mLengthsKept, {&plan.mStridesInKept, &plan.mStridesOutKept});
+        foldModes(plan.mLengthsReduce, {&plan.mStridesInReduce});
+
+        // A broadcast (zero stride) kept mode does not make outputs contiguous
+        plan.mKeptInner = !plan.mLengthsKept.empty() && plan.mStridesInKept[0] != 0
+                          && (plan.mLengthsReduce.empty()
+                              || std::abs(plan.mStridesInKept[0])
+                                     < std::abs(plan.mStridesInReduce[0]));
+
+        return plan;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_REDUCTION_CPU_ENGINE_HPP
+#define HIPTENSOR_REDUCTION_CPU_ENGINE_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace hiptensor
+{
+    // @cond
+    // Accumulation of the reduced values on the host
+    enum struct ReductionCpuAccumulation : int32_t
+    {
+        PAIRWISE = 0, // Pairwise tree over fixed blocks of values
+        KAHAN    = 1, // Pairwise tree of compensated sums, only valid for additive reductions
+    };
+
+    // Accumulation selected with HIPTENSOR_CPU_REDUCTION_ACCUMULATION=PAIRWISE|KAHAN.
+    // Defaults to PAIRWISE.
+    ReductionCpuAccumulation reductionCpuAccumulation();
+
+    // Host reduction problem C_{kept} = reduce_{r} A_{kept, r} over folded modes.
+    // Mode 0 of each group is the one with the smallest input stride.
+    struct ReductionCpuPlan
+    {
+        int64_t mKeptCount;
+        int64_t mReduceCount;
+
+        std::vector<int64_t> mLengthsKept;
+        std::vector<int64_t> mStridesInKept;
+        std::vector<int64_t> mStridesOutKept;
+        std::vector<int64_t> mLengthsReduce;
+        std::vector<int64_t> mStridesInReduce;
+
+        // Whether kept mode 0 is innermost in the input, in which case
+        // neighbouring outputs are reduced together, one input row at a time
+        bool mKeptInner;
+    };
+
+    // Builds the plan from the lengths and strides of the kept and reduced modes.
+    // Length-1 modes are dropped and modes that are contiguous in both A and C
+    // (kept) or in A (reduced) are folded together.
+    ReductionCpuPlan makeReductionCpuPlan(std::vector<int64_t> const& keptLengths,
+                                          std::vector<int64_t> const& keptInStrides,
+                                          std::vector<int64_t> const& keptOutStrides,
+                                          std::vector<int64_t> const& reduceLengths,
+                                          std::vector<int64_t> const& reduceInStrides);
+
+    // Reduced values are visited in blocks of Block values along reduce mode 0,
+    // and blocks are combined by a pairwise tree. Segments of SegmentBlocks blocks
+    // are the unit of work when a few outputs reduce many values. Block values are
+    // accumulated in Lanes interleaved partials, or Columns outputs at once when
+    // the kept mode is innermost. The decomposition does not depend on the thread
+    // count, so results are deterministic.
+    struct ReductionCpuBlocking
+    {
+        static constexpr int64_t Lanes         = 8;
+        static constexpr int64_t Block         = 128;
+        static constexpr int64_t SegmentBlocks = 64;
+        static constexpr int64_t Columns       = 64;
+        static constexpr int64_t TaskElements  = 32768;
+    };
+
+    // Partial result of a sub-tree. The exact value is mValue + mCompensation,
+    // where mCompensation is only used by KAHAN.
+    template <typename AccT>
+    struct ReductionCpuPartial
+    {
+        AccT mValue;
+        AccT mCompensation;
+    };
+
+    // Runs the reduction on the host thread pool.
+    // load(offset) returns the input element at the offset converted to AccT,
+    // reduce(acc, value) folds a value or a partial result into acc, and
+    // store(offset, acc) writes the reduced value of one output element.
+    template <typename AccT, typename Load, typename Reduce, typename Store>
+    void reductionCpu(ReductionCpuPlan const&  plan,
+                      ReductionCpuAccumulation accumulation,
+                      AccT                     identity,
+                      Load&&                   load,
+                      Reduce&&                 reduce,
+                      Store&&                  store);
+    // @endcond
+
+} // namespace hiptensor
+
+#include "reduction_cpu_engine_impl.hpp"
+
+#endif // HIPTENSOR_REDUCTION_CPU_ENGINE_HPP
@@ -0,0 +1,347 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_REDUCTION_CPU_ENGINE_IMPL_HPP
+#define HIPTENSOR_REDUCTION_CPU_ENGINE_IMPL_HPP
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "reduction_cpu_engine.hpp"
+#include "thread_pool.hpp"
+
+namespace hiptensor
+{
+    namespace detail
+    {
+        // Pairwise tree over leaves [lo, hi). Splitting at the largest power of two
+        // below the count makes every aligned power-of-two range a sub-tree, so
+        // partial results of aligned segments combine to the same result as the
+        // tree over all leaves.
+        template <typename Leaf, typename Combine>
+        auto pairwiseTree(int64_t lo, int64_t hi, Leaf& leaf, Combine& combine)
+            -> decltype(leaf(lo))
+        {
+            if(hi - lo == 1)
+            {
+                return leaf(lo);
+            }
+
+            int64_t half = 1;
+            while(half * 2 < hi - lo)
+            {
+                half *= 2;
+            }
+
+            auto left  = pairwiseTree(lo, lo + half, leaf, combine);
+            auto right = pairwiseTree(lo + half, hi, leaf, combine);
+            combine(left, right);
+            return left;
+        }
+
+        // Compensated accumulation of x, where value + compensation is the running sum
+        template <typename AccT>
+        inline void kahanAdd(ReductionCpuPartial<AccT>& acc, AccT x)
+        {
+            auto y            = x + acc.mCompensation;
+            auto t            = acc.mValue + y;
+            acc.mCompensation = y - (t - acc.mValue);
+            acc.mValue        = t;
+        }
+
+        // Combines two compensated partials, keeping the rounding error of the sum
+        template <typename AccT>
+        inline void kahanCombine(ReductionCpuPartial<AccT>& acc, ReductionCpuPartial<AccT> const& b)
+        {
+            auto s            = acc.mValue + b.mValue;
+            auto bv           = s - acc.mValue;
+            auto error        = (acc.mValue - (s - bv)) + (b.mValue - bv);
+            acc.mCompensation = acc.mCompensation + b.mCompensation + error;
+            acc.mValue        = s;
+        }
+    } // namespace detail
+
+    template <typename AccT, typename Load, typename Reduce, typename Store>
+    void reductionCpu(ReductionCpuPlan const&  plan,
+                      ReductionCpuAccumulation accumulation,
+                      AccT                     identity,
+                      Load&&                   load,
+                      Reduce&&                 reduce,
+                      Store&&                  store)
+    {
+        using Partial = ReductionCpuPartial<AccT>;
+
+        constexpr auto Lanes         = ReductionCpuBlocking::Lanes;
+        constexpr auto Block         = ReductionCpuBlocking::Block;
+        constexpr auto SegmentBlocks = ReductionCpuBlocking::SegmentBlocks;
+        constexpr auto Columns       = ReductionCpuBlocking::Columns;
+
+        if(plan.mKeptCount == 0)
+        {
+            return;
+        }
+
+        auto const kahan = accumulation == ReductionCpuAccumulation::KAHAN;
+        auto const start = Partial{kahan ? AccT(0) : identity, AccT(0)};
+
+        // Blocks of reduced values: pieces of reduce mode 0, then the outer reduce modes
+        auto const& lengthsR = plan.mLengthsReduce;
+        auto const& stridesR = plan.mStridesInReduce;
+        auto const  rankR    = static_cast<int64_t>(lengthsR.size());
+        auto const  lenR0    = rankR > 0 ? lengthsR[0] : int64_t(1);
+        auto const  strideR0 = rankR > 0 ? stridesR[0] : int64_t(0);
+        auto const  pieces   = (lenR0 + Block - 1) / Block;
+        auto const  blocks   = plan.mReduceCount == 0 ? 0 : pieces * (plan.mReduceCount / lenR0);
+        auto const  segments = (blocks + SegmentBlocks - 1) / SegmentBlocks;
+
+        auto blockOffset = [&](int64_t block, int64_t& count) {
+            auto piece  = block % pieces;
+            auto row    = block / pieces;
+            auto offset = piece * Block * strideR0;
+            for(int64_t d = 1; d < rankR; d++)
+            {
+                offset += (row % lengthsR[d]) * stridesR[d];
+                row /= lengthsR[d];
+            }
+            count = std::min(Block, lenR0 - piece * Block);
+            return offset;
+        };
+
+        auto combine = [&](Partial& acc, Partial const& b) {
+            if(kahan)
+            {
+                detail::kahanCombine(acc, b);
+            }
+            else
+            {
+                reduce(acc.mValue, b.mValue);
+            }
+        };
+
+        auto finalValue = [kahan](Partial const& acc) {
+            return kahan ? acc.mValue + acc.mCompensation : acc.mValue;
+        };
+
+        // Groups of outputs reduced together: one output, or up to Columns outputs
+        // along kept mode 0 when it is innermost in the input
+        auto const& lengthsK  = plan.mLengthsKept;
+        auto const  rankK     = static_cast<int64_t>(lengthsK.size());
+        auto const  columns   = plan.mKeptInner ? Columns : int64_t(1);
+        auto const  lenK0     = plan.mKeptInner ? lengthsK[0] : int64_t(1);
+        auto const  colGroups = (lenK0 + columns - 1) / columns;
+        auto const  groups    = colGroups * (plan.mKeptCount / lenK0);
+
+        struct Group
+        {
+            int64_t mIn;
+            int64_t mOut;
+            int64_t mCount;
+        };
+
+        auto group = [&](int64_t g) {
+            auto  first = plan.mKeptInner ? int64_t(1) : int64_t(0);
+            auto  piece = g % colGroups;
+            auto  row   = g / colGroups;
+            Group result{0, 0, std::min(columns, lenK0 - piece * columns)};
+            if(plan.mKeptInner)
+            {
+                result.mIn  = piece * columns * plan.mStridesInKept[0];
+                result.mOut = piece * columns * plan.mStridesOutKept[0];
+            }
+            for(auto d = first; d < rankK; d++)
+            {
+                result.mIn += (row % lengthsK[d]) * plan.mStridesInKept[d];
+                result.mOut += (row % lengthsK[d]) * plan.mStridesOutKept[d];
+                row /= lengthsK[d];
+            }
+            return result;
+        };
+
+        auto const threads = static_cast<int64_t>(ThreadPool::instance()->threadCount());
+
+        // Runs the reduction given the partial result of one block of one group,
+        // how to combine two partials of a group, and how to store a group.
+        auto run = [&](auto&& blockLeaf, auto&& combineGroup, auto&& storeGroup) {
+            using GroupPartial = decltype(blockLeaf(Group{}, int64_t(0)));
+
+            if(blocks == 0)
+            {
+                ThreadPool::instance()->parallelFor(groups, [&](std::size_t g) {
+                    storeGroup(group(g), GroupPartial{});
+                });
+                return;
+            }
+
+            if(groups >= threads * 4 || segments == 1)
+            {
+                // Parallel over groups, each reducing all of its blocks
+                auto const groupElements = std::max<int64_t>(1, columns * plan.mReduceCount);
+                auto groupsPerTask
+                    = std::max<int64_t>(1, ReductionCpuBlocking::TaskElements / groupElements);
+                groupsPerTask = std::min(groupsPerTask, std::max<int64_t>(1, groups / threads));
+                auto const tasks = (groups + groupsPerTask - 1) / groupsPerTask;
+
+                ThreadPool::instance()->parallelFor(tasks, [&](std::size_t task) {
+                    auto const g0 = static_cast<int64_t>(task) * groupsPerTask;
+                    auto const g1 = std::min(g0 + groupsPerTask, groups);
+                    for(auto g = g0; g < g1; g++)
+                    {
+                        auto const info = group(g);
+                        auto       leaf = [&](int64_t b) { return blockLeaf(info, b); };
+                        storeGroup(info, detail::pairwiseTree(0, blocks, leaf, combineGroup));
+                    }
+                });
+                return;
+            }
+
+            // Few groups with many values: reduce segments in parallel, then
+            // combine the segment partials of each group
+            std::vector<GroupPartial> partials(groups * segments);
+            ThreadPool::instance()->parallelFor(groups * segments, [&](std::size_t task) {
+                auto const g    = static_cast<int64_t>(task) / segments;
+                auto const s    = static_cast<int64_t>(task) % segments;
+                auto const info = group(g);
+                auto const last = std::min((s + 1) * SegmentBlocks, blocks);
+                auto       leaf = [&](int64_t b) { return blockLeaf(info, b); };
+                partials[task]  = detail::pairwiseTree(s * SegmentBlocks, last, leaf, combineGroup);
+            });
+
+            ThreadPool::instance()->parallelFor(groups, [&](std::size_t g) {
+                auto leaf = [&](int64_t s) { return partials[g * segments + s]; };
+                storeGroup(group(g), detail::pairwiseTree(0, segments, leaf, combineGroup));
+            });
+        };
+
+        if(!plan.mKeptInner)
+        {
+            // One output per group: the block is accumulated in interleaved lanes
+            run(
+                [&](Group const& info, int64_t b) {
+                    int64_t count;
+                    auto    offset = info.mIn + blockOffset(b, count);
+
+                    std::array<Partial, Lanes> lanes;
+                    lanes.fill(start);
+
+                    int64_t i = 0;
+                    if(kahan)
+                    {
+                        for(; i + Lanes <= count; i += Lanes)
+                        {
+                            for(int64_t l = 0; l < Lanes; l++)
+                            {
+                                detail::kahanAdd(lanes[l], load(offset + (i + l) * strideR0));
+                            }
+                        }
+                        for(; i < count; i++)
+                        {
+                            detail::kahanAdd(lanes[i % Lanes], load(offset + i * strideR0));
+                        }
+                    }
+                    else
+                    {
+                        for(; i + Lanes <= count; i += Lanes)
+                        {
+                            for(int64_t l = 0; l < Lanes; l++)
+                            {
+                                reduce(lanes[l].mValue, load(offset + (i + l) * strideR0));
+                            }
+                        }
+                        for(; i < count; i++)
+                        {
+                            reduce(lanes[i % Lanes].mValue, load(offset + i * strideR0));
+                        }
+                    }
+
+                    for(int64_t width = 1; width < Lanes; width *= 2)
+                    {
+                        for(int64_t l = 0; l < Lanes; l += 2 * width)
+                        {
+                            combine(lanes[l], lanes[l + width]);
+                        }
+                    }
+                    return lanes[0];
+                },
+                combine,
+                [&](Group const& info, Partial const& acc) {
+                    store(info.mOut, blocks == 0 ? identity : finalValue(acc));
+                });
+        }
+        else
+        {
+            // Neighbouring outputs per group: each input row of the block is
+            // accumulated into one partial per output
+            auto const strideK0 = plan.mStridesInKept[0];
+            auto const strideC0 = plan.mStridesOutKept[0];
+            using Row           = std::array<Partial, Columns>;
+
+            run(
+                [&](Group const& info, int64_t b) {
+                    int64_t count;
+                    auto    offset = info.mIn + blockOffset(b, count);
+
+                    Row acc;
+                    acc.fill(start);
+                    for(int64_t i = 0; i < count; i++)
+                    {
+                        auto row = offset + i * strideR0;
+                        if(kahan)
+                        {
+                            for(int64_t c = 0; c < info.mCount; c++)
+                            {
+                                detail::kahanAdd(acc[c], load(row + c * strideK0));
+                            }
+                        }
+                        else
+                        {
+                            for(int64_t c = 0; c < info.mCount; c++)
+                            {
+                                reduce(acc[c].mValue, load(row + c * strideK0));
+                            }
+                        }
+                    }
+                    return acc;
+                },
+                [&](Row& acc, Row const& b) {
+                    for(int64_t c = 0; c < Columns; c++)
+                    {
+                        combine(acc[c], b[c]);
+                    }
+                },
+                [&](Group const& info, Row const& acc) {
+                    for(int64_t c = 0; c < info.mCount; c++)
+                    {
+                        store(info.mOut + c * strideC0,
+                              blocks == 0 ? identity : finalValue(acc[c]));
+                    }
+                });
+        }
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_REDUCTION_CPU_ENGINE_IMPL_HPP
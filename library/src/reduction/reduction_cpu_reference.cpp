@@ -24,6 +24,8 @@
  *
  *******************************************************************************/
 
+#include <cstring>
+
 #include "reduction_cpu_reference.hpp"
 #include "reduction_cpu_reference_impl.hpp"
 #include "reduction_cpu_reference_instances.hpp"
@@ -80,11 +82,11 @@ hiptensorStatus_t hiptensorReductionReference(const void*
     {
         // CK API can only process $D = alpha * reduce(A) + beta * D$
         // Need to copy C to D if C != D
-        CHECK_HIP_ERROR(hipMemcpy(D,
-                                  C,
-                                  hiptensor::elementsFromLengths(descC->mLengths)
-                                      * hiptensor::hipDataTypeSize(descC->mType),
-                                  hipMemcpyHostToHost));
+        // Host copy, so that it also works without a HIP device
+        std::memcpy(D,
+                    C,
+                    hiptensor::elementsFromLengths(descC->mLengths)
+                        * hiptensor::hipDataTypeSize(descC->mType));
     }
 
     for(auto [_, pSolution] : solutionQ.solutions())
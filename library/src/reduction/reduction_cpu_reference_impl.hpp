@@ -28,6 +28,7 @@
 #define HIPTENSOR_REDUCTION_CPU_REFERENCE_IMPL_HPP
 
 // Std includes
+#include <algorithm>
 #include <array>
 #include <list>
 #include <numeric>
@@ -36,6 +37,7 @@
 // CK includes
 #include "ck/library/reference_tensor_operation/cpu/reference_reduce.hpp"
 
+#include "reduction_cpu_engine.hpp"
 #include "reduction_meta_traits.hpp"
 #include "reduction_solution.hpp"
 
@@ -97,6 +99,247 @@ namespace hiptensor
     {
     };
 
+    // Host reduction running on the multithreaded CPU engine.
+    // Follows the reference semantics: C = alpha * accOp(reduce(inOp(A))) + beta * C.
+    template <typename InDataType,
+              typename AccDataType,
+              typename OutDataType,
+              ck::index_t Rank,
+              ck::index_t NumReduceDim,
+              typename ReduceOperation,
+              typename InElementwiseOperation,
+              typename AccElementwiseOperation,
+              bool PropagateNan,
+              bool OutputIndex>
+    struct HostReduction
+        : public ck::tensor_operation::device::DeviceReduce<InDataType,
+                                                            AccDataType,
+                                                            OutDataType,
+                                                            Rank,
+                                                            NumReduceDim,
+                                                            ReduceOperation,
+                                                            InElementwiseOperation,
+                                                            AccElementwiseOperation,
+                                                            PropagateNan,
+                                                            OutputIndex>
+    {
+        using BaseArgument = ck::tensor_operation::device::BaseArgument;
+        using BaseInvoker  = ck::tensor_operation::device::BaseInvoker;
+        using index_t      = ck::index_t;
+
+        static constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+        static constexpr index_t NumOutDim       = NumInvariantDim == 0 ? 1 : NumInvariantDim;
+
+        // Argument
+        struct Argument : public BaseArgument
+        {
+            Argument(std::array<index_t, Rank> const&      inLengths,
+                     std::array<index_t, Rank> const&      inStrides,
+                     std::array<index_t, NumOutDim> const& outStrides,
+                     std::array<int, NumReduceDim> const&  reduceDims,
+                     double                                alpha,
+                     double                                beta,
+                     InDataType const*                     in,
+                     OutDataType*                          out,
+                     InElementwiseOperation const&         inElementwiseOp,
+                     AccElementwiseOperation const&        accElementwiseOp)
+                : BaseArgument()
+                , mInLengths(inLengths)
+                , mInStrides(inStrides)
+                , mOutStrides(outStrides)
+                , mReduceDims(reduceDims)
+                , mAlpha(static_cast<AccDataType>(alpha))
+                , mBeta(static_cast<AccDataType>(beta))
+                , mIn(in)
+                , mOut(out)
+                , mInElementwiseOp(inElementwiseOp)
+                , mAccElementwiseOp(accElementwiseOp)
+            {
+            }
+
+            std::array<index_t, Rank>      mInLengths;
+            std::array<index_t, Rank>      mInStrides;
+            std::array<index_t, NumOutDim> mOutStrides;
+            std::array<int, NumReduceDim>  mReduceDims;
+
+            AccDataType mAlpha;
+            AccDataType mBeta;
+
+            InDataType const* mIn;
+            OutDataType*      mOut;
+
+            InElementwiseOperation  mInElementwiseOp;
+            AccElementwiseOperation mAccElementwiseOp;
+        };
+
+        // Invoker
+        struct Invoker : public BaseInvoker
+        {
+            float Run(const Argument& arg)
+            {
+                // Split the modes of A into kept modes, in the order of C, and reduced modes
+                std::vector<int64_t> keptLengths, keptInStrides, keptOutStrides;
+                std::vector<int64_t> reduceLengths, reduceInStrides;
+                for(index_t d = 0; d < Rank; d++)
+                {
+                    auto reduced = std::find(arg.mReduceDims.begin(), arg.mReduceDims.end(), d)
+                                   != arg.mReduceDims.end();
+                    if(reduced)
+                    {
+                        reduceLengths.push_back(arg.mInLengths[d]);
+                        reduceInStrides.push_back(arg.mInStrides[d]);
+                    }
+                    else
+                    {
+                        keptLengths.push_back(arg.mInLengths[d]);
+                        keptInStrides.push_back(arg.mInStrides[d]);
+                        keptOutStrides.push_back(arg.mOutStrides[keptOutStrides.size()]);
+                    }
+                }
+
+                auto plan = makeReductionCpuPlan(
+                    keptLengths, keptInStrides, keptOutStrides, reduceLengths, reduceInStrides);
+
+                // Compensation only applies to sums
+                auto accumulation = std::is_same_v<ReduceOperation, ck::reduce::Add>
+                                        ? reductionCpuAccumulation()
+                                        : ReductionCpuAccumulation::PAIRWISE;
+
+                auto const applyAlpha = arg.mAlpha != AccDataType(1);
+                auto const applyBeta  = arg.mBeta != AccDataType(0);
+
+                reductionCpu<AccDataType>(
+                    plan,
+                    accumulation,
+                    ReduceOperation::template GetIdentityValue<AccDataType>(),
+                    [&](int64_t offset) {
+                        auto value = ck::type_convert<AccDataType>(arg.mIn[offset]);
+                        arg.mInElementwiseOp(value, value);
+                        return value;
+                    },
+                    [](AccDataType& acc, AccDataType value) {
+                        if constexpr(PropagateNan)
+                        {
+                            if(ck::math::isnan(value))
+                            {
+                                acc = value;
+                                return;
+                            }
+                        }
+                        ReduceOperation{}(acc, value);
+                    },
+                    [&](int64_t offset, AccDataType acc) {
+                        arg.mAccElementwiseOp(acc, acc);
+                        if(applyAlpha)
+                        {
+                            acc *= arg.mAlpha;
+                        }
+                        if(applyBeta)
+                        {
+                            acc += ck::type_convert<AccDataType>(arg.mOut[offset]) * arg.mBeta;
+                        }
+                        arg.mOut[offset] = ck::type_convert<OutDataType>(acc);
+                    });
+
+                return 0;
+            }
+
+            float Run(const BaseArgument* p_arg,
+                      const StreamConfig& /* stream_config */ = StreamConfig{}) override
+            {
+                return Run(*dynamic_cast<const Argument*>(p_arg));
+            }
+        };
+
+        bool IsSupportedArgument(const BaseArgument* p_arg) override
+        {
+            auto arg = dynamic_cast<const Argument*>(p_arg);
+            return arg != nullptr && !OutputIndex
+                   && std::all_of(arg->mReduceDims.begin(),
+                                  arg->mReduceDims.end(),
+                                  [](int d) { return d >= 0 && d < Rank; });
+        }
+
+        std::unique_ptr<BaseArgument>
+            MakeArgumentPointer(const std::array<index_t, Rank>      inLengths,
+                                const std::array<index_t, Rank>      inStrides,
+                                const std::array<index_t, NumOutDim> outLengths,
+                                const std::array<index_t, NumOutDim> outStrides,
+                                const std::array<int, NumReduceDim>  reduceDims,
+                                double                               alpha,
+                                double                               beta,
+                                const void*                          in_dev,
+                                const void*                          in_index_dev,
+                                void*                                out_dev,
+                                void*                                out_index_dev,
+                                const InElementwiseOperation         in_elementwise_op,
+                                const AccElementwiseOperation        acc_elementwise_op) override
+        {
+            return std::make_unique<Argument>(inLengths,
+                                              inStrides,
+                                              outStrides,
+                                              reduceDims,
+                                              alpha,
+                                              beta,
+                                              static_cast<InDataType const*>(in_dev),
+                                              static_cast<OutDataType*>(out_dev),
+                                              in_elementwise_op,
+                                              acc_elementwise_op);
+        }
+
+        std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+        {
+            return std::make_unique<Invoker>(Invoker{});
+        }
+
+        std::string GetTypeString() const override
+        {
+            auto str = std::stringstream();
+
+            // clang-format off
+            str << "HostReduction<";
+            str << Rank << ", ";
+            str << NumReduceDim << ">";
+            // clang-format on
+
+            return str.str();
+        }
+    };
+
+    // Partial specialize for host reduction
+    template <typename InDataType,
+              typename AccDataType,
+              typename OutDataType,
+              ck::index_t Rank,
+              ck::index_t NumReduceDim,
+              typename ReduceOperation,
+              typename InElementwiseOperation,
+              typename AccElementwiseOperation,
+              bool PropagateNan,
+              bool OutputIndex>
+    struct MetaTraits<HostReduction<InDataType,
+                                    AccDataType,
+                                    OutDataType,
+                                    Rank,
+                                    NumReduceDim,
+                                    ReduceOperation,
+                                    InElementwiseOperation,
+                                    AccElementwiseOperation,
+                                    PropagateNan,
+                                    OutputIndex>>
+        : public MetaTraits<ck::tensor_operation::device::DeviceReduce<InDataType,
+                                                                       AccDataType,
+                                                                       OutDataType,
+                                                                       Rank,
+                                                                       NumReduceDim,
+                                                                       ReduceOperation,
+                                                                       InElementwiseOperation,
+                                                                       AccElementwiseOperation,
+                                                                       PropagateNan,
+                                                                       OutputIndex>>
+    {
+    };
+
     template <typename InDataType,
               typename AccDataType,
               typename OutDataType,
@@ -114,16 +357,17 @@ namespace hiptensor
             typename ck::reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
         using AccElementwiseOperation =
             typename ck::reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
-        using ReferenceOp = ReferenceReduction<InDataType,
-                                               AccDataType,
-                                               OutDataType,
-                                               Rank,
-                                               NumReduceDim,
-                                               ReduceOperation,
-                                               InElementwiseOperation,
-                                               AccElementwiseOperation,
-                                               PropagateNan,
-                                               OutputIndex>;
+        // The host engine replaces the serial reference as the registered solution
+        using ReferenceOp = HostReduction<InDataType,
+                                          AccDataType,
+                                          OutDataType,
+                                          Rank,
+                                          NumReduceDim,
+                                          ReduceOperation,
+                                          InElementwiseOperation,
+                                          AccElementwiseOperation,
+                                          PropagateNan,
+                                          OutputIndex>;
 
         auto solution
             = std::make_unique<ReductionSolutionImpl<ReferenceOp>>(std::make_unique<ReferenceOp>());
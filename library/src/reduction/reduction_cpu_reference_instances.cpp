@@ -26,6 +26,7 @@
 
 #include "reduction_cpu_reference_instances.hpp"
 #include "reduction_cpu_reference_impl.hpp"
+#include "registry_profiler.hpp"
 #include <hiptensor/internal/types.hpp>
 
 #define REG_CPU_SOLUTION(dim_count, reduced_dim_count, type, computeType) \
@@ -66,6 +67,8 @@ namespace hiptensor
 {
     ReductionCpuReferenceInstances::ReductionCpuReferenceInstances()
     {
+        RegistryProfiler::ScopedTimer timer("ReductionCpuReferenceInstances");
+
         REG_CPU_SOLUTION(1, 1, ck::half_t, float);
         REG_CPU_SOLUTION(2, 1, ck::half_t, float);
         REG_CPU_SOLUTION(2, 2, ck::half_t, float);
@@ -153,5 +156,7 @@ namespace hiptensor
         REG_CPU_SOLUTION(6, 4, double, double);
         REG_CPU_SOLUTION(6, 5, double, double);
         REG_CPU_SOLUTION(6, 6, double, double);
+
+        timer.finish(solutionCount(), hostBytes());
     }
 } // namespace hiptensor
@@ -26,6 +26,7 @@
 
 #include "reduction_solution_registry.hpp"
 #include "reduction_solution.hpp"
+#include "registry_profiler.hpp"
 
 namespace hiptensor
 {
@@ -200,6 +201,19 @@ namespace hiptensor
     {
         return mSolutionStorage.size();
     }
+
+    std::size_t ReductionSolutionRegistry::hostBytes() const
+    {
+        auto bytes = mSolutionStorage.size() * sizeof(ReductionSolution)
+                     + RegistryProfiler::containerBytes(mSolutionStorage)
+                     + RegistryProfiler::containerBytes(mSolutionQuery.mAllSolutions)
+                     + RegistryProfiler::containerBytes(mSolutionQuery.mSolutionHash);
+        for(auto const& bucket : mSolutionQuery.mSolutionHash)
+        {
+            bytes += RegistryProfiler::containerBytes(bucket.second);
+        }
+        return bytes;
+    }
     // @endcond
 
 } // namespace hiptensor
@@ -133,6 +133,9 @@ namespace hiptensor
 
         uint32_t solutionCount() const;
 
+        // Approximate host memory held by the solutions and the query hash
+        std::size_t hostBytes() const;
+
     private:
         std::vector<std::unique_ptr<ReductionSolution>> mSolutionStorage;
         Query                                           mSolutionQuery;
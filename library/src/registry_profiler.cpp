@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "include/logger.hpp"
+#include "include/registry_profiler.hpp"
+
+namespace hiptensor
+{
+    RegistryProfiler::ScopedTimer::ScopedTimer(const char* registryName)
+        : mRegistryName(registryName)
+        , mStart(std::chrono::steady_clock::now())
+    {
+    }
+
+    void RegistryProfiler::ScopedTimer::finish(std::size_t solutionCount, std::size_t hostBytes)
+    {
+        auto elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now()
+                                                                - mStart);
+
+        RegistryProfiler::instance()->record(
+            {mRegistryName, elapsed.count(), solutionCount, hostBytes});
+    }
+
+    void RegistryProfiler::record(RegistryInitMetrics const& metrics)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mMetrics.push_back(metrics);
+        }
+
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+        {
+            char msg[256];
+            snprintf(msg,
+                     sizeof(msg),
+                     "Registry: %s, %0.3f ms, %zu solutions, %zu host bytes",
+                     metrics.mRegistryName.c_str(),
+                     metrics.mInitTimeMs,
+                     metrics.mSolutionCount,
+                     metrics.mHostBytes);
+            logger->logPerformanceTrace("hiptensorRegistryInit", msg);
+        }
+    }
+
+    std::vector<RegistryInitMetrics> RegistryProfiler::metrics() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mMetrics;
+    }
+
+} // namespace hiptensor
+
+namespace std
+{
+    ostream& operator<<(std::ostream& os, hiptensor::RegistryInitMetrics const& metrics)
+    {
+        return os << "Registry: " << metrics.mRegistryName << ", " << metrics.mInitTimeMs
+                  << " ms, " << metrics.mSolutionCount << " solutions, " << metrics.mHostBytes
+                  << " host bytes" << std::endl;
+    }
+}
@@ -0,0 +1,437 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif // __linux__
+
+#include "include/thread_pool.hpp"
+
+namespace hiptensor
+{
+    // Index range of one thread slot. Owners take from the front, thieves from the back.
+    struct alignas(64) ThreadPoolRange
+    {
+        std::mutex  mMutex;
+        std::size_t mBegin = 0;
+        std::size_t mEnd   = 0;
+    };
+
+    struct ThreadPool::Job
+    {
+        Job(std::function<void(std::size_t)> const& task, std::size_t count, std::size_t slots)
+            : mTask(task)
+            , mRanges(std::make_unique<ThreadPoolRange[]>(slots))
+            , mSlots(slots)
+            , mUnclaimed(count)
+            , mUsers(0)
+        {
+            for(std::size_t i = 0; i < slots; i++)
+            {
+                mRanges[i].mBegin = count * i / slots;
+                mRanges[i].mEnd   = count * (i + 1) / slots;
+            }
+        }
+
+        std::function<void(std::size_t)> const& mTask;
+        std::unique_ptr<ThreadPoolRange[]>      mRanges;
+        std::size_t                             mSlots;
+
+        // Tasks not yet taken by any thread; a hint for idle workers
+        std::atomic<std::size_t> mUnclaimed;
+
+        // Workers that joined the job and may still touch it, guarded by the pool mutex
+        std::size_t mUsers;
+    };
+
+    namespace
+    {
+        // Slot of the current thread in every job: 0 for external callers
+        thread_local std::size_t sSlot = 0;
+
+        enum struct Affinity
+        {
+            NONE,
+            COMPACT,
+            SCATTER
+        };
+
+        Affinity affinityFromEnv()
+        {
+            if(const char* env = std::getenv("HIPTENSOR_CPU_AFFINITY"))
+            {
+                std::string upper = env;
+                std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+                if(upper.compare("COMPACT") == 0)
+                {
+                    return Affinity::COMPACT;
+                }
+                else if(upper.compare("SCATTER") == 0)
+                {
+                    return Affinity::SCATTER;
+                }
+            }
+            return Affinity::NONE;
+        }
+
+#if defined(__linux__)
+        // Parses a kernel cpu list such as "0-15,32-47"
+        std::vector<int> parseCpuList(std::string const& list)
+        {
+            std::vector<int> cpus;
+            std::size_t      pos = 0;
+            while(pos < list.size() && std::isdigit(static_cast<unsigned char>(list[pos])))
+            {
+                auto first = std::stoi(list.substr(pos));
+                auto last  = first;
+                pos        = list.find_first_not_of("0123456789", pos);
+                if(pos != std::string::npos && list[pos] == '-')
+                {
+                    last = std::stoi(list.substr(pos + 1));
+                    pos  = list.find_first_not_of("0123456789", pos + 1);
+                }
+                for(auto cpu = first; cpu <= last; cpu++)
+                {
+                    cpus.push_back(cpu);
+                }
+                if(pos == std::string::npos || list[pos] != ',')
+                {
+                    break;
+                }
+                pos++;
+            }
+            return cpus;
+        }
+#endif // __linux__
+
+        // CPUs the process may run on, grouped by NUMA node
+        std::vector<std::vector<int>> allowedCpusByNode()
+        {
+            std::vector<std::vector<int>> nodes;
+#if defined(__linux__)
+            cpu_set_t allowed;
+            CPU_ZERO(&allowed);
+            if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            {
+                return nodes;
+            }
+
+            for(int node = 0;; node++)
+            {
+                std::ifstream file("/sys/devices/system/node/node" + std::to_string(node)
+                                   + "/cpulist");
+                std::string   list;
+                if(!file || !std::getline(file, list))
+                {
+                    break;
+                }
+
+                std::vector<int> cpus;
+                for(auto cpu : parseCpuList(list))
+                {
+                    if(cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))
+                    {
+                        cpus.push_back(cpu);
+                    }
+                }
+                if(!cpus.empty())
+                {
+                    nodes.push_back(std::move(cpus));
+                }
+            }
+
+            // No NUMA information: a single node of all allowed CPUs
+            if(nodes.empty())
+            {
+                nodes.emplace_back();
+                for(int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+                {
+                    if(CPU_ISSET(cpu, &allowed))
+                    {
+                        nodes.back().push_back(cpu);
+                    }
+                }
+            }
+#endif // __linux__
+            return nodes;
+        }
+
+        // Order in which thread slots are assigned to CPUs
+        std::vector<int> cpuOrder(std::vector<std::vector<int>> const& nodes, Affinity affinity)
+        {
+            std::vector<int> order;
+            if(affinity == Affinity::SCATTER)
+            {
+                for(std::size_t i = 0;; i++)
+                {
+                    bool added = false;
+                    for(auto const& node : nodes)
+                    {
+                        if(i < node.size())
+                        {
+                            order.push_back(node[i]);
+                            added = true;
+                        }
+                    }
+                    if(!added)
+                    {
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                for(auto const& node : nodes)
+                {
+                    order.insert(order.end(), node.begin(), node.end());
+                }
+            }
+            return order;
+        }
+    }
+
+    ThreadPool::ThreadPool()
+        : mStop(false)
+    {
+        auto affinity = affinityFromEnv();
+        auto cpus     = cpuOrder(allowedCpusByNode(), affinity);
+
+        std::size_t threads
+            = cpus.empty() ? std::max(1u, std::thread::hardware_concurrency()) : cpus.size();
+        if(const char* env = std::getenv("HIPTENSOR_CPU_THREADS"))
+        {
+            auto requested = std::strtol(env, nullptr, 10);
+            if(requested > 0)
+            {
+                threads = static_cast<std::size_t>(requested);
+            }
+        }
+
+        // The calling thread is the first slot, and is never pinned
+        for(std::size_t slot = 1; slot < threads; slot++)
+        {
+            int cpu = (affinity == Affinity::NONE || cpus.empty()) ? -1 : cpus[slot % cpus.size()];
+            mWorkers.emplace_back(&ThreadPool::workerLoop, this, slot, cpu);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::scoped_lock lock(mMutex);
+            mStop = true;
+        }
+        mWake.notify_all();
+
+        for(auto& worker : mWorkers)
+        {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadPool::threadCount() const
+    {
+        return mWorkers.size() + 1;
+    }
+
+    void ThreadPool::parallelFor(std::size_t count, std::function<void(std::size_t)> const& task)
+    {
+        if(count == 0)
+        {
+            return;
+        }
+
+        if(count == 1 || mWorkers.empty())
+        {
+            for(std::size_t i = 0; i < count; i++)
+            {
+                task(i);
+            }
+            return;
+        }
+
+        Job job(task, count, threadCount());
+        {
+            std::scoped_lock lock(mMutex);
+            mJobs.push_back(&job);
+        }
+        mWake.notify_all();
+
+        runJob(job, sSlot);
+
+        // Every task is claimed: retire the job, then wait for the workers still running it
+        std::unique_lock<std::mutex> lock(mMutex);
+        mJobs.erase(std::find(mJobs.begin(), mJobs.end(), &job));
+        mDone.wait(lock, [&job]() { return job.mUsers == 0; });
+    }
+
+    void ThreadPool::parallelForRange(std::size_t                                          count,
+                                      std::size_t                                          grain,
+                                      std::function<void(std::size_t, std::size_t)> const& task)
+    {
+        grain       = std::max<std::size_t>(grain, 1);
+        auto chunks = (count + grain - 1) / grain;
+        parallelFor(chunks, [&](std::size_t chunk) {
+            auto begin = chunk * grain;
+            task(begin, std::min(begin + grain, count));
+        });
+    }
+
+    void ThreadPool::parallelForIndexSpace(
+        std::vector<std::size_t> const& lengths,
+        std::size_t                     grain,
+        std::function<void(std::vector<std::size_t> const&, std::size_t, std::size_t)> const& task)
+    {
+        std::size_t count = 1;
+        for(auto length : lengths)
+        {
+            count *= length;
+        }
+
+        parallelForRange(count, grain, [&](std::size_t begin, std::size_t end) {
+            auto index  = std::vector<std::size_t>(lengths.size());
+            auto offset = begin;
+            for(std::size_t mode = 0; mode < lengths.size(); mode++)
+            {
+                index[mode] = offset % lengths[mode];
+                offset /= lengths[mode];
+            }
+            task(index, begin, end);
+        });
+    }
+
+    void ThreadPool::runJob(Job& job, std::size_t slot)
+    {
+        std::size_t index;
+        while(claim(job, slot, index))
+        {
+            job.mTask(index);
+        }
+    }
+
+    bool ThreadPool::claim(Job& job, std::size_t slot, std::size_t& index)
+    {
+        auto& own = job.mRanges[slot];
+        {
+            std::scoped_lock lock(own.mMutex);
+            if(own.mBegin < own.mEnd)
+            {
+                index = own.mBegin++;
+                job.mUnclaimed.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // Steal the back half of the nearest non-empty range. With compact affinity,
+        // neighbouring slots run on the same NUMA node.
+        for(std::size_t distance = 1; distance < job.mSlots; distance++)
+        {
+            auto&       victim = job.mRanges[(slot + distance) % job.mSlots];
+            std::size_t begin, end;
+            {
+                std::scoped_lock lock(victim.mMutex);
+                if(victim.mBegin >= victim.mEnd)
+                {
+                    continue;
+                }
+                end          = victim.mEnd;
+                begin        = end - (end - victim.mBegin + 1) / 2;
+                victim.mEnd = begin;
+            }
+
+            {
+                std::scoped_lock lock(own.mMutex);
+                own.mBegin = begin + 1;
+                own.mEnd   = end;
+            }
+            index = begin;
+            job.mUnclaimed.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+
+    ThreadPool::Job* ThreadPool::findJob() const
+    {
+        // Nested jobs are pushed last, and their callers are waiting on them
+        for(auto job = mJobs.rbegin(); job != mJobs.rend(); job++)
+        {
+            if((*job)->mUnclaimed.load(std::memory_order_relaxed) > 0)
+            {
+                return *job;
+            }
+        }
+        return nullptr;
+    }
+
+    void ThreadPool::workerLoop(std::size_t slot, int cpu)
+    {
+        sSlot = slot;
+
+#if defined(__linux__)
+        if(cpu >= 0)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+#endif // __linux__
+
+        while(true)
+        {
+            Job* job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWake.wait(lock, [&]() { return mStop || (job = findJob()) != nullptr; });
+                if(mStop)
+                {
+                    return;
+                }
+                job->mUsers++;
+            }
+
+            runJob(*job, slot);
+
+            {
+                std::scoped_lock lock(mMutex);
+                job->mUsers--;
+            }
+            mDone.notify_all();
+        }
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <chrono>
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+#include <numeric>
+#include <unordered_map>
+
+#include "common.hpp"
+
+// Measures the host-side latency of hiptensorContraction for a trivial
+// scale contraction, where the API overhead dominates the kernel time.
+// The latency is reported with logging off and with the API trace enabled,
+// which bounds the cost that disabled logging must not pay.
+int main(int argc, char* argv[])
+{
+    if(!isF32Supported())
+    {
+        std::cout << "unsupported host device" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    int warmupCalls = 10;
+    int timedCalls  = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+    /**********************
+   * Computing: D_{m,n} = alpha * A_{m,k} B_{n,k}
+   **********************/
+    std::vector<int> modeD{'m', 'n'};
+    std::vector<int> modeA{'m', 'k'};
+    std::vector<int> modeB{'n', 'k'};
+
+    std::unordered_map<int, int64_t> extent;
+    extent['m'] = 2;
+    extent['n'] = 2;
+    extent['k'] = 2;
+
+    std::vector<int64_t> d_ms_ns_lengths, a_ms_ks_lengths, b_ns_ks_lengths;
+    for(auto mode : modeD)
+    {
+        d_ms_ns_lengths.push_back(extent[mode]);
+    }
+    for(auto mode : modeA)
+    {
+        a_ms_ks_lengths.push_back(extent[mode]);
+    }
+    for(auto mode : modeB)
+    {
+        b_ns_ks_lengths.push_back(extent[mode]);
+    }
+
+    hiptensorHandle_t* handle;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hiptensorTensorDescriptor_t a_ms_ks, b_ns_ks, d_ms_ns;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(handle,
+                                                        &a_ms_ks,
+                                                        modeA.size(),
+                                                        a_ms_ks_lengths.data(),
+                                                        NULL, /*stride*/
+                                                        HIP_R_32F,
+                                                        HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(handle,
+                                                        &b_ns_ks,
+                                                        modeB.size(),
+                                                        b_ns_ks_lengths.data(),
+                                                        NULL, /*stride*/
+                                                        HIP_R_32F,
+                                                        HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(handle,
+                                                        &d_ms_ns,
+                                                        modeD.size(),
+                                                        d_ms_ns_lengths.data(),
+                                                        NULL, /*stride*/
+                                                        HIP_R_32F,
+                                                        HIPTENSOR_OP_IDENTITY));
+
+    auto elements = [](std::vector<int64_t> const& lengths) {
+        return std::accumulate(
+            lengths.begin(), lengths.end(), size_t{1}, std::multiplies<size_t>());
+    };
+
+    size_t sizeA = sizeof(float) * elements(a_ms_ks_lengths);
+    size_t sizeB = sizeof(float) * elements(b_ns_ks_lengths);
+    size_t sizeD = sizeof(float) * elements(d_ms_ns_lengths);
+
+    void *A_d, *B_d, *D_d;
+    CHECK_HIP_ERROR(hipMalloc(static_cast<void**>(&A_d), sizeA));
+    CHECK_HIP_ERROR(hipMalloc(static_cast<void**>(&B_d), sizeB));
+    CHECK_HIP_ERROR(hipMalloc(static_cast<void**>(&D_d), sizeD));
+    CHECK_HIP_ERROR(hipMemset(A_d, 0, sizeA));
+    CHECK_HIP_ERROR(hipMemset(B_d, 0, sizeB));
+    CHECK_HIP_ERROR(hipMemset(D_d, 0, sizeD));
+
+    uint32_t alignmentRequirementA, alignmentRequirementB, alignmentRequirementD;
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorGetAlignmentRequirement(handle, A_d, &a_ms_ks, &alignmentRequirementA));
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorGetAlignmentRequirement(handle, B_d, &b_ns_ks, &alignmentRequirementB));
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorGetAlignmentRequirement(handle, D_d, &d_ms_ns, &alignmentRequirementD));
+
+    hiptensorContractionDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &desc,
+                                                             &a_ms_ks,
+                                                             modeA.data(),
+                                                             alignmentRequirementA,
+                                                             &b_ns_ks,
+                                                             modeB.data(),
+                                                             alignmentRequirementB,
+                                                             nullptr,
+                                                             nullptr,
+                                                             0,
+                                                             &d_ms_ns,
+                                                             modeD.data(),
+                                                             alignmentRequirementD,
+                                                             HIPTENSOR_COMPUTE_32F));
+
+    hiptensorContractionFind_t find;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT));
+
+    uint64_t worksize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &worksize));
+
+    void* workspace = nullptr;
+    if(worksize > 0)
+    {
+        CHECK_HIP_ERROR(hipMalloc(static_cast<void**>(&workspace), worksize));
+    }
+
+    hiptensorContractionPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionPlan(handle, &plan, &desc, &find, worksize));
+
+    float alpha    = 1.0f;
+    auto  contract = [&]() {
+        CHECK_HIPTENSOR_ERROR(hiptensorContraction(handle,
+                                                   &plan,
+                                                   (void*)&alpha,
+                                                   A_d,
+                                                   B_d,
+                                                   nullptr,
+                                                   nullptr,
+                                                   D_d,
+                                                   workspace,
+                                                   worksize,
+                                                   0 /* stream */));
+    };
+
+    for(int i = 0; i < warmupCalls; i++)
+    {
+        contract();
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // Host time spent inside the API call: kernel launches are asynchronous
+    auto hostLatencyUs = [&]() {
+        double callUs = 0.0;
+        for(int i = 0; i < timedCalls; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            contract();
+            callUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                - start)
+                          .count();
+        }
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        return callUs / timedCalls;
+    };
+
+    // With logging off the API trace message is never formatted
+    CHECK_HIPTENSOR_ERROR(hiptensorLoggerSetMask(HIPTENSOR_LOG_LEVEL_OFF));
+    double callUs = hostLatencyUs();
+
+    // Same calls with the API trace formatted and written to a null sink
+    CHECK_HIPTENSOR_ERROR(hiptensorLoggerOpenFile("/dev/null"));
+    CHECK_HIPTENSOR_ERROR(hiptensorLoggerSetMask(HIPTENSOR_LOG_LEVEL_API_TRACE));
+    double tracedUs = hostLatencyUs();
+    CHECK_HIPTENSOR_ERROR(hiptensorLoggerSetMask(HIPTENSOR_LOG_LEVEL_OFF));
+
+    // End-to-end time per call, including the kernel
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < timedCalls; i++)
+    {
+        contract();
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    double totalUs
+        = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+              .count();
+
+    std::cout << "hiptensorContraction calls: " << timedCalls << std::endl;
+    std::cout << "Host latency per call: " << callUs << " us" << std::endl;
+    std::cout << "Host latency per call (API trace on): " << tracedUs << " us" << std::endl;
+    std::cout << "API trace cost skipped when off: " << tracedUs - callUs << " us" << std::endl;
+    std::cout << "End-to-end time per call: " << totalUs / timedCalls << " us" << std::endl;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+
+    HIPTENSOR_FREE_DEVICE(A_d);
+    HIPTENSOR_FREE_DEVICE(B_d);
+    HIPTENSOR_FREE_DEVICE(D_d);
+    HIPTENSOR_FREE_DEVICE(workspace);
+
+    return 0;
+}
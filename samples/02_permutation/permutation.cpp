@@ -133,6 +133,13 @@ int main()
                                                typeCompute,
                                                0 /* stream */));
 
+    // Repeated permutations of the same problem select the kernel once with a plan
+    hiptensorPermutationPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitPermutationPlan(
+        handle, &plan, &descA, modeA.data(), &descC, modeC.data(), typeCompute));
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorPermutationExecute(handle, &plan, &one, A_d, C_d, 0 /* stream */));
+
 #if !NDEBUG
     bool printElements = false;
     bool storeElements = false;
@@ -43,13 +43,25 @@ if [ -d "$binary_dir" ]; then
            "rank3_permutation_test"
            "rank4_permutation_test"
            "rank5_permutation_test"
-           "rank6_permutation_test")
+           "rank6_permutation_test"
+           "rank2_permutation_test"
+           "rank3_permutation_test")
 
     configs=("rank2_test_params.yaml"
              "rank3_test_params.yaml"
              "rank4_test_params.yaml"
              "rank5_test_params.yaml"
-             "rank6_test_params.yaml")
+             "rank6_test_params.yaml"
+             "rank2_padded_test_params.yaml"
+             "rank3_padded_test_params.yaml")
+
+    outputs=("rank2_permutation_test"
+             "rank3_permutation_test"
+             "rank4_permutation_test"
+             "rank5_permutation_test"
+             "rank6_permutation_test"
+             "rank2_padded_permutation_test"
+             "rank3_padded_permutation_test")
 
     arrayLength=${#tests[@]}
 
@@ -57,7 +69,7 @@ if [ -d "$binary_dir" ]; then
     for (( i=0; i<${arrayLength}; i++ )); do
         if [[ -e $binary_dir && ! -L $binary_dir/${tests[$i]} ]]; then
             $binary_dir${tests[$i]} -y $config_dir/${configs[$i]} \
-            -o $output_dir${tests[$i]}".csv" --cold_runs $cold_runs --hot_runs $hot_runs -v $validate
+            -o $output_dir${outputs[$i]}".csv" --cold_runs $cold_runs --hot_runs $hot_runs -v $validate
         fi
     done
 fi
@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+# Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+# Reports the on-disk size, device code size and load time of one or more
+# hipTensor shared libraries, e.g. to compare builds using different kernel
+# manifests (-DHIPTENSOR_KERNEL_MANIFEST=...).
+
+set -eu
+
+if [ $# -lt 1 ]; then
+    echo "Usage: $0 <libhiptensor.so> [<libhiptensor.so> ...]"
+    exit 1
+fi
+
+load_runs=${LOAD_RUNS:-10}
+
+echo "library, file_bytes, device_code_bytes, load_time_ms"
+
+for lib in "$@"; do
+    if [ ! -f "$lib" ]; then
+        echo "$lib does not exist."
+        exit 1
+    fi
+
+    file_bytes=$(stat -L -c %s "$lib")
+
+    # Device code is embedded in the .hip_fatbin section
+    fatbin_size=$(readelf -S -W "$lib" | sed 's/\[ */[/' | awk '$2 == ".hip_fatbin" { print $6 }')
+    device_code_bytes=$((16#${fatbin_size:-0}))
+
+    # Mean time to dlopen the library in a fresh process
+    load_time_ms=$(python3 - "$lib" "$load_runs" <<'PYEOF'
+import subprocess, sys
+lib, runs = sys.argv[1], int(sys.argv[2])
+probe = "import ctypes, sys, time; t = time.perf_counter(); ctypes.CDLL(sys.argv[1], mode=ctypes.RTLD_GLOBAL); print((time.perf_counter() - t) * 1e3)"
+total = 0.0
+for _ in range(runs):
+    total += float(subprocess.check_output([sys.executable, "-c", probe, lib]))
+print("%.3f" % (total / runs))
+PYEOF
+)
+
+    echo "$lib, $file_bytes, $device_code_bytes, $load_time_ms"
+done
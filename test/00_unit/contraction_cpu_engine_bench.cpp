@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+// hiptensor includes
+#include "contraction_cpu_engine_common.hpp"
+
+template <typename Func>
+double bestOfMs(int runs, Func&& func)
+{
+    auto ms = std::numeric_limits<double>::max();
+    for(int i = 0; i < runs; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        ms = std::min(
+            ms,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count());
+    }
+    return ms;
+}
+
+// Times each engine strategy (best of several runs) against the reference loop,
+// or against the direct strategy for problems too large for the reference.
+// Correctness is covered by contraction_cpu_engine_test; results are only
+// checked here to make sure the timings are of working code.
+template <typename T>
+bool contractionBench(Problem const& p, bool withReference)
+{
+    ContractionCase<T> c(p, true);
+
+    double refMs = 0.0;
+    if(withReference)
+    {
+        refMs = bestOfMs(1, [&]() { c.reference(); });
+    }
+    else
+    {
+        c.direct();
+        c.mR = c.mE;
+    }
+
+    auto directMs   = bestOfMs(5, [&]() { c.direct(); });
+    auto maxError   = c.maxError();
+    auto ttgtMs     = bestOfMs(5, [&]() { c.ttgt(); });
+    maxError        = std::max(maxError, c.maxError());
+    auto selectedMs = bestOfMs(5, [&]() { c.selected(); });
+    maxError        = std::max(maxError, c.maxError());
+
+    using Traits = hiptensor::ContractionCpuKernelTraits<T>;
+    auto cost = hiptensor::selectContractionCpuStrategy(c.mPlan, sizeof(T), Traits::MR, Traits::NR);
+    std::cout << "M=" << c.mM << " N=" << c.mN << " K=" << c.mK << " folded ranks ("
+              << c.mPlan.mLengthsM.size() << ", " << c.mPlan.mLengthsN.size() << ", "
+              << c.mPlan.mLengthsK.size() << "): ";
+    if(withReference)
+    {
+        std::cout << "reference " << refMs << " ms, ";
+    }
+    std::cout << "direct " << directMs << " ms, ttgt " << ttgtMs << " ms, selected "
+              << (cost.mStrategy == hiptensor::ContractionCpuStrategy::TTGT ? "ttgt" : "direct")
+              << " (" << selectedMs << " ms";
+    if(withReference)
+    {
+        std::cout << ", speedup " << refMs / selectedMs << "x";
+    }
+    std::cout << "), max rel error " << maxError << std::endl;
+    return maxError <= c.tolerance();
+}
+
+int main()
+{
+    bool pass = true;
+
+    // Column-major (the library default): k is strided in A and B
+    Problem colMajor{{16, 8}, {8, 16}, {16, 8}, {0, 1, 2, 3}, {0, 1, 2, 3}, {0, 1, 2, 3}};
+    std::cout << "colMajorF32: ";
+    pass &= contractionBench<float>(colMajor, true);
+    std::cout << "colMajorF64: ";
+    pass &= contractionBench<double>(colMajor, true);
+
+    // Large column-major problem, timed against the direct strategy only
+    Problem colMajorLarge{{32, 16}, {16, 32}, {32, 16}, {0, 1, 2, 3}, {0, 1, 2, 3}, {0, 1, 2, 3}};
+    std::cout << "colMajorLargeF32: ";
+    pass &= contractionBench<float>(colMajorLarge, false);
+
+    // Interleaved modes: neither m nor k is contiguous in A and B, which favours TTGT
+    Problem interleaved{{32, 16}, {16, 32}, {32, 16}, {1, 3, 0, 2}, {1, 3, 0, 2}, {0, 1, 2, 3}};
+    std::cout << "interleavedF32: ";
+    pass &= contractionBench<float>(interleaved, false);
+
+    // k innermost in A and B: already in GEMM layout
+    Problem kInner{{16, 8}, {8, 16}, {16, 8}, {2, 3, 0, 1}, {2, 3, 0, 1}, {0, 1, 2, 3}};
+    std::cout << "kInnerF32: ";
+    pass &= contractionBench<float>(kInner, true);
+
+    return pass ? 0 : -1;
+}
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#ifndef HIPTENSOR_TEST_CONTRACTION_CPU_ENGINE_COMMON_HPP
+#define HIPTENSOR_TEST_CONTRACTION_CPU_ENGINE_COMMON_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_engine.hpp"
+
+// Problems and helpers shared by the CPU contraction engine unit test and benchmark
+
+struct Problem
+{
+    std::vector<int64_t> mLengthsM;
+    std::vector<int64_t> mLengthsN;
+    std::vector<int64_t> mLengthsK;
+
+    // Storage order of each tensor's modes, fastest first, as indices into
+    // its (m..., k...), (n..., k...) or (m..., n...) mode list
+    std::vector<int32_t> mOrderA;
+    std::vector<int32_t> mOrderB;
+    std::vector<int32_t> mOrderE;
+};
+
+// Packed strides of a tensor whose modes are stored in the given order, first fastest
+inline std::vector<int64_t> packedStrides(std::vector<int64_t> const& lengths,
+                                          std::vector<int32_t> const& order)
+{
+    std::vector<int64_t> strides(lengths.size());
+    int64_t              stride = 1;
+    for(auto mode : order)
+    {
+        strides[mode] = stride;
+        stride *= lengths[mode];
+    }
+    return strides;
+}
+
+inline std::vector<int64_t> decode(int64_t flat, std::vector<int64_t> const& lengths)
+{
+    std::vector<int64_t> index(lengths.size());
+    for(std::size_t d = 0; d < lengths.size(); d++)
+    {
+        index[d] = flat % lengths[d];
+        flat /= lengths[d];
+    }
+    return index;
+}
+
+inline int64_t elementCount(std::vector<int64_t> const& lengths)
+{
+    return std::accumulate(lengths.begin(), lengths.end(), int64_t{1}, std::multiplies<>());
+}
+
+template <typename T>
+std::vector<T> randomTensor(int64_t elements, uint32_t seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<T>                        result(elements);
+    for(auto& value : result)
+    {
+        if constexpr(std::is_same_v<T, std::complex<float>>
+                     || std::is_same_v<T, std::complex<double>>)
+        {
+            value = T(dist(gen), dist(gen));
+        }
+        else
+        {
+            value = T(dist(gen));
+        }
+    }
+    return result;
+}
+
+// E = alpha * A B + beta * D on random packed tensors, with the engine
+// strategies and the original reference loop writing E and R respectively
+template <typename T>
+struct ContractionCase
+{
+    ContractionCase(Problem const& p, bool bilinear)
+        : mProblem(p)
+        , mAlpha(T(1.5f))
+        , mBeta(T(bilinear ? -0.5f : 0.0f))
+    {
+        std::vector<int64_t> aLengths(p.mLengthsM), bLengths(p.mLengthsN), eLengths(p.mLengthsM);
+        aLengths.insert(aLengths.end(), p.mLengthsK.begin(), p.mLengthsK.end());
+        bLengths.insert(bLengths.end(), p.mLengthsK.begin(), p.mLengthsK.end());
+        eLengths.insert(eLengths.end(), p.mLengthsN.begin(), p.mLengthsN.end());
+
+        mStridesA = packedStrides(aLengths, p.mOrderA);
+        mStridesB = packedStrides(bLengths, p.mOrderB);
+        mStridesE = packedStrides(eLengths, p.mOrderE);
+
+        mM = elementCount(p.mLengthsM);
+        mN = elementCount(p.mLengthsN);
+        mK = elementCount(p.mLengthsK);
+
+        mA = randomTensor<T>(elementCount(aLengths), 1);
+        mB = randomTensor<T>(elementCount(bLengths), 2);
+        mD = randomTensor<T>(elementCount(eLengths), 3);
+        mE.resize(elementCount(eLengths));
+        mR.resize(elementCount(eLengths));
+
+        mPlan = hiptensor::makeContractionCpuPlan(static_cast<int32_t>(p.mLengthsM.size()),
+                                                  static_cast<int32_t>(p.mLengthsN.size()),
+                                                  static_cast<int32_t>(p.mLengthsK.size()),
+                                                  aLengths,
+                                                  mStridesA,
+                                                  bLengths,
+                                                  mStridesB,
+                                                  mStridesE,
+                                                  mStridesE);
+    }
+
+    auto loadA() const
+    {
+        return [this](int64_t offset) { return mA[offset]; };
+    }
+
+    auto loadB() const
+    {
+        return [this](int64_t offset) { return mB[offset]; };
+    }
+
+    auto store()
+    {
+        return [this](int64_t eOffset, int64_t dOffset, T accum) {
+            mE[eOffset] = mAlpha * accum + mBeta * mD[dOffset];
+        };
+    }
+
+    void direct()
+    {
+        hiptensor::contractionCpuDirect<T>(mPlan, loadA(), loadB(), store());
+    }
+
+    void ttgt()
+    {
+        hiptensor::contractionCpuTtgt<T>(mPlan, loadA(), loadB(), store());
+    }
+
+    void selected()
+    {
+        hiptensor::contractionCpu<T>(mPlan, loadA(), loadB(), store());
+    }
+
+    // Mirrors the original reference: a fresh index vector and inner product per MAC
+    void reference()
+    {
+        auto offset = [](auto const& indices, auto const& strides) {
+            return std::inner_product(indices.begin(), indices.end(), strides.begin(), int64_t{0});
+        };
+
+        auto const& p = mProblem;
+        for(int64_t n = 0; n < mN; n++)
+        {
+            auto nIdx = decode(n, p.mLengthsN);
+            for(int64_t m = 0; m < mM; m++)
+            {
+                auto mIdx  = decode(m, p.mLengthsM);
+                T    accum = T(0);
+                for(int64_t k = 0; k < mK; k++)
+                {
+                    auto kIdx = decode(k, p.mLengthsK);
+                    auto aIdx = mIdx;
+                    auto bIdx = nIdx;
+                    aIdx.insert(aIdx.end(), kIdx.begin(), kIdx.end());
+                    bIdx.insert(bIdx.end(), kIdx.begin(), kIdx.end());
+                    accum += mA[offset(aIdx, mStridesA)] * mB[offset(bIdx, mStridesB)];
+                }
+                auto eIdx = mIdx;
+                eIdx.insert(eIdx.end(), nIdx.begin(), nIdx.end());
+                auto e = offset(eIdx, mStridesE);
+                mR[e]  = mAlpha * accum + mBeta * mD[e];
+            }
+        }
+    }
+
+    // Max relative error of E against R
+    double maxError() const
+    {
+        double result = 0.0;
+        for(std::size_t i = 0; i < mE.size(); i++)
+        {
+            result = std::max(result, std::abs(mE[i] - mR[i]) / (1.0 + std::abs(mR[i])));
+        }
+        return result;
+    }
+
+    // Tolerance scales with the length of the reduction
+    double tolerance() const
+    {
+        bool isDouble = std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>;
+        return (isDouble ? 1e-12 : 1e-5) * std::sqrt(static_cast<double>(mK));
+    }
+
+    Problem                       mProblem;
+    T                             mAlpha, mBeta;
+    int64_t                       mM, mN, mK;
+    std::vector<int64_t>          mStridesA, mStridesB, mStridesE;
+    std::vector<T>                mA, mB, mD, mE, mR;
+    hiptensor::ContractionCpuPlan mPlan;
+};
+
+#endif // HIPTENSOR_TEST_CONTRACTION_CPU_ENGINE_COMMON_HPP
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <cstring>
+#include <iostream>
+
+// hiptensor includes
+#include "contraction_cpu_engine_common.hpp"
+#include "cpu_type_convert.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Runs E = alpha * A B + beta * D with every engine strategy, and checks them
+// against a direct loop that mirrors the original reference. Timing lives in
+// contraction_cpu_engine_bench.
+template <typename T>
+bool contractionTest(Problem const& p, bool bilinear)
+{
+    ContractionCase<T> c(p, bilinear);
+    c.reference();
+
+    double maxError = 0.0;
+    for(auto strategy :
+        {&ContractionCase<T>::direct, &ContractionCase<T>::ttgt, &ContractionCase<T>::selected})
+    {
+        std::fill(c.mE.begin(), c.mE.end(), T(0));
+        (c.*strategy)();
+        maxError = std::max(maxError, c.maxError());
+    }
+
+    std::cout << "M=" << c.mM << " N=" << c.mN << " K=" << c.mK << " folded ranks ("
+              << c.mPlan.mLengthsM.size() << ", " << c.mPlan.mLengthsN.size() << ", "
+              << c.mPlan.mLengthsK.size() << "): max rel error " << maxError << std::endl;
+    return maxError <= c.tolerance();
+}
+
+// f16 operand loader: per-element conversions, plus block conversions if Block
+template <bool Block>
+struct HalfLoad
+{
+    uint16_t const* mData;
+    int64_t*        mBlocks;
+
+    float operator()(int64_t offset) const
+    {
+        float value;
+        hiptensor::cpuHalfToFloat(mData + offset, &value, 1);
+        return value;
+    }
+
+    template <bool B = Block, typename = std::enable_if_t<B>>
+    void operator()(int64_t offset, int64_t count, float* dst) const
+    {
+        (*mBlocks)++;
+        hiptensor::cpuHalfToFloat(mData + offset, dst, count);
+    }
+};
+
+// Packing f16 operands through block conversions must produce the same panels,
+// and therefore bitwise the same result, as converting element by element.
+// Block conversions are expected whenever k or the m / n modes are contiguous.
+bool halfBlockLoadTest(Problem const& p, bool expectBlocks)
+{
+    std::vector<int64_t> aLengths(p.mLengthsM), bLengths(p.mLengthsN), eLengths(p.mLengthsM);
+    aLengths.insert(aLengths.end(), p.mLengthsK.begin(), p.mLengthsK.end());
+    bLengths.insert(bLengths.end(), p.mLengthsK.begin(), p.mLengthsK.end());
+    eLengths.insert(eLengths.end(), p.mLengthsN.begin(), p.mLengthsN.end());
+
+    auto aStrides = packedStrides(aLengths, p.mOrderA);
+    auto bStrides = packedStrides(bLengths, p.mOrderB);
+    auto eStrides = packedStrides(eLengths, p.mOrderE);
+
+    // Random finite halves in [2^-5, 2^2) with random signs
+    std::mt19937                            gen(5);
+    std::uniform_int_distribution<uint16_t> mantissa(0, 0x3ff), exponent(10, 16), sign(0, 1);
+    auto                                    randomHalves = [&](int64_t elements) {
+        std::vector<uint16_t> result(elements);
+        for(auto& value : result)
+        {
+            value = (sign(gen) << 15) | (exponent(gen) << 10) | mantissa(gen);
+        }
+        return result;
+    };
+    auto A = randomHalves(elementCount(aLengths));
+    auto B = randomHalves(elementCount(bLengths));
+
+    auto plan = hiptensor::makeContractionCpuPlan(static_cast<int32_t>(p.mLengthsM.size()),
+                                                  static_cast<int32_t>(p.mLengthsN.size()),
+                                                  static_cast<int32_t>(p.mLengthsK.size()),
+                                                  aLengths,
+                                                  aStrides,
+                                                  bLengths,
+                                                  bStrides,
+                                                  eStrides,
+                                                  {});
+
+    int64_t            blocks = 0;
+    std::vector<float> E(elementCount(eLengths)), R(elementCount(eLengths));
+    hiptensor::contractionCpuDirect<float>(
+        plan,
+        HalfLoad<false>{A.data(), &blocks},
+        HalfLoad<false>{B.data(), &blocks},
+        [&](int64_t eOffset, int64_t, float accum) { R[eOffset] = accum; });
+    hiptensor::contractionCpuDirect<float>(
+        plan,
+        HalfLoad<true>{A.data(), &blocks},
+        HalfLoad<true>{B.data(), &blocks},
+        [&](int64_t eOffset, int64_t, float accum) { E[eOffset] = accum; });
+
+    std::cout << blocks << " block conversions" << std::endl;
+    return std::memcmp(E.data(), R.data(), E.size() * sizeof(float)) == 0
+           && (blocks > 0) == expectBlocks;
+}
+
+int main()
+{
+    bool testPass = true;
+
+    // Packed rank-2 problem: every group folds to one mode
+    Problem packed{{7, 5}, {9, 3}, {11, 13}, {0, 1, 2, 3}, {0, 1, 2, 3}, {0, 1, 2, 3}};
+    std::cout << "packedF32: ";
+    testPass &= contractionTest<float>(packed, false);
+    std::cout << "packedF64Bilinear: ";
+    testPass &= contractionTest<double>(packed, true);
+    std::cout << "packedCF32Bilinear: ";
+    testPass &= contractionTest<std::complex<float>>(packed, true);
+    std::cout << "packedCF64: ";
+    testPass &= contractionTest<std::complex<double>>(packed, false);
+
+    // Permuted layouts: k innermost in A, n modes swapped in B, modes reordered in E
+    Problem permuted{{6, 4}, {5, 7}, {3, 9}, {2, 3, 0, 1}, {1, 0, 2, 3}, {2, 0, 3, 1}};
+    std::cout << "permutedF32Bilinear: ";
+    testPass &= contractionTest<float>(permuted, true);
+    std::cout << "permutedF64: ";
+    testPass &= contractionTest<double>(permuted, false);
+
+    // Rank-6 groups padded with length-1 modes, as normalized by the library
+    Problem padded{{3, 1, 4, 1, 1, 1},
+                   {1, 5, 1, 2, 1, 1},
+                   {2, 1, 3, 1, 1, 7},
+                   {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+                   {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+                   {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}};
+    std::cout << "paddedRank6F32: ";
+    testPass &= contractionTest<float>(padded, true);
+
+    // Interleaved modes: neither m nor k is contiguous in A and B
+    Problem interleaved{{12, 5}, {5, 12}, {12, 5}, {1, 3, 0, 2}, {1, 3, 0, 2}, {0, 1, 2, 3}};
+    std::cout << "interleavedF32Bilinear: ";
+    testPass &= contractionTest<float>(interleaved, true);
+
+    // k innermost in A and B: already in GEMM layout
+    Problem kInner{{10, 6}, {6, 10}, {10, 6}, {2, 3, 0, 1}, {2, 3, 0, 1}, {0, 1, 2, 3}};
+    std::cout << "kInnerF64Bilinear: ";
+    testPass &= contractionTest<double>(kInner, true);
+
+    // f16 operands packed through block conversions: along k, along m / n, or gathered
+    Problem halfKInner{{7, 5}, {9, 3}, {11, 13}, {2, 3, 0, 1}, {2, 3, 0, 1}, {0, 1, 2, 3}};
+    std::cout << "halfBlockLoadKInner: ";
+    testPass &= halfBlockLoadTest(halfKInner, true);
+    std::cout << "halfBlockLoadColMajor: ";
+    testPass &= halfBlockLoadTest(packed, true);
+    Problem halfInterleaved{{6, 4}, {4, 6}, {6, 4}, {1, 3, 0, 2}, {1, 3, 0, 2}, {0, 1, 2, 3}};
+    std::cout << "halfBlockLoadInterleaved: ";
+    testPass &= halfBlockLoadTest(halfInterleaved, false);
+
+    std::cout << "contractionCpuEngine: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,199 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+// hiptensor includes
+#include "cpu_type_convert.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+uint32_t toBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float fromBits(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Bitwise equality, where any two NaNs compare equal
+bool sameValue(float a, float b)
+{
+    return (std::isnan(a) && std::isnan(b)) || toBits(a) == toBits(b);
+}
+
+// Value of a binary16 bit pattern computed from its fields
+float halfValue(uint16_t half)
+{
+    int  exponent = (half >> 10) & 0x1f;
+    int  mantissa = half & 0x3ff;
+    auto sign     = (half & 0x8000) ? -1.0f : 1.0f;
+    if(exponent == 0x1f)
+    {
+        return mantissa ? std::numeric_limits<float>::quiet_NaN()
+                        : sign * std::numeric_limits<float>::infinity();
+    }
+    if(exponent == 0)
+    {
+        return sign * std::ldexp(static_cast<float>(mantissa), -24);
+    }
+    return sign * std::ldexp(static_cast<float>(mantissa | 0x400), exponent - 25);
+}
+
+// f32 to bf16 rounding of ck::type_convert (round to nearest even, NaN preserving)
+float bhalfRound(float value)
+{
+    uint32_t bits = toBits(value);
+    if((bits & 0x7f800000u) != 0x7f800000u)
+    {
+        bits += 0x7fffu + ((bits >> 16) & 1u);
+    }
+    else if(bits & 0xffffu)
+    {
+        bits |= 0x10000u;
+    }
+    return fromBits(bits & 0xffff0000u);
+}
+
+// Widening checked for every bit pattern, with lengths that exercise the vector tails
+bool widenTest()
+{
+    std::vector<uint16_t> src(1 << 16);
+    for(std::size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<uint16_t>(i);
+    }
+
+    std::vector<float> dst(src.size());
+    for(int64_t count : {int64_t(1), int64_t(7), int64_t(9), int64_t(src.size())})
+    {
+        hiptensor::cpuHalfToFloat(src.data(), dst.data(), count);
+        for(int64_t i = 0; i < count; i++)
+        {
+            if(!sameValue(dst[i], halfValue(src[i])))
+            {
+                return false;
+            }
+        }
+
+        hiptensor::cpuBhalfToFloat(src.data(), dst.data(), count);
+        for(int64_t i = 0; i < count; i++)
+        {
+            if(toBits(dst[i]) != static_cast<uint32_t>(src[i]) << 16)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Rounding checked on random values over the whole exponent range and on edge cases:
+// ties, the half overflow threshold, subnormals, infinities and NaNs
+bool roundTest()
+{
+    std::vector<float> src = {0.0f,
+                              -0.0f,
+                              1.0f + std::ldexp(1.0f, -11),
+                              1.0f + 3.0f * std::ldexp(1.0f, -11),
+                              65504.0f,
+                              65519.0f,
+                              65520.0f,
+                              -1e10f,
+                              std::ldexp(1.0f, -25),
+                              std::ldexp(3.0f, -26),
+                              std::ldexp(1.0f, -130),
+                              1.0f + std::ldexp(1.0f, -8),
+                              1.0f + 3.0f * std::ldexp(1.0f, -8),
+                              std::numeric_limits<float>::max(),
+                              std::numeric_limits<float>::infinity(),
+                              -std::numeric_limits<float>::infinity(),
+                              std::numeric_limits<float>::quiet_NaN(),
+                              fromBits(0x7f800001u)};
+
+    std::mt19937                            gen(7);
+    std::uniform_int_distribution<uint32_t> dist;
+    while(src.size() < 100003)
+    {
+        src.push_back(fromBits(dist(gen)));
+    }
+
+    std::vector<float> dst(src.size());
+    hiptensor::cpuRoundToHalf(src.data(), dst.data(), static_cast<int64_t>(src.size()));
+    for(std::size_t i = 0; i < src.size(); i++)
+    {
+        if(!sameValue(dst[i], static_cast<float>(static_cast<_Float16>(src[i]))))
+        {
+            return false;
+        }
+    }
+
+    hiptensor::cpuRoundToBhalf(src.data(), dst.data(), static_cast<int64_t>(src.size()));
+    for(std::size_t i = 0; i < src.size(); i++)
+    {
+        if(!sameValue(dst[i], bhalfRound(src[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    bool testPass = true;
+
+    std::cout << "widen: ";
+    bool result = widenTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "round: ";
+    result = roundTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "cpuTypeConvert: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
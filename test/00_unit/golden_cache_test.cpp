@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+#include <unistd.h>
+
+// hiptensor includes
+#include "golden_cache.hpp"
+#include "hiptensor_options.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+hiptensor::GoldenKey makeKey(std::vector<int64_t> const& lengths, double alpha)
+{
+    auto key = hiptensor::GoldenKey("test");
+    key.add(uint32_t(256)).add(lengths).add(alpha);
+    return key;
+}
+
+bool keyTest()
+{
+    // Equal fields hash equally, and any differing field changes the hash
+    auto key = makeKey({4, 5, 6}, 1.5).value();
+    return key == makeKey({4, 5, 6}, 1.5).value() && key != makeKey({4, 5, 7}, 1.5).value()
+           && key != makeKey({4, 5}, 1.5).value() && key != makeKey({4, 5, 6}, 2.5).value()
+           && hiptensor::GoldenKey("a").value() != hiptensor::GoldenKey("b").value();
+}
+
+bool storeFindTest()
+{
+    auto& cache = hiptensor::GoldenCache::instance();
+    auto  key   = makeKey({100}, 1.0);
+
+    std::vector<float> data(100);
+    for(std::size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = float(i) * 0.25f;
+    }
+
+    if(!cache->store(key, data.data(), data.size() * sizeof(float)))
+    {
+        return false;
+    }
+
+    // Hit with the stored size, miss with any other size or key
+    auto hit = cache->find(key, data.size() * sizeof(float));
+    if(!hit || hit.size() != data.size() * sizeof(float)
+       || std::memcmp(hit.data(), data.data(), hit.size()) != 0)
+    {
+        return false;
+    }
+    return !cache->find(key, 4 * sizeof(float)) && !cache->find(makeKey({101}, 1.0), 404);
+}
+
+// An entry renamed to the file of another key, as a hash collision would leave it,
+// is not served for that key
+bool collisionTest(std::filesystem::path const& directory)
+{
+    auto& cache = hiptensor::GoldenCache::instance();
+    auto  key   = makeKey({7}, 1.0);
+    auto  other = makeKey({8}, 1.0);
+
+    std::vector<float> data(7, 1.0f);
+    if(!cache->store(key, data.data(), data.size() * sizeof(float)))
+    {
+        return false;
+    }
+
+    auto fileName = [&](hiptensor::GoldenKey const& k) {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.golden", (unsigned long long)k.value());
+        return directory / name;
+    };
+    std::error_code error;
+    std::filesystem::copy_file(fileName(key),
+                               fileName(other),
+                               std::filesystem::copy_options::overwrite_existing,
+                               error);
+    return !error && cache->find(key, data.size() * sizeof(float))
+           && !cache->find(other, data.size() * sizeof(float));
+}
+
+bool fetchTest()
+{
+    auto& cache = hiptensor::GoldenCache::instance();
+    auto  key   = makeKey({3, 3}, 0.5);
+
+    // The first fetch computes and stores, the second is served from the cache
+    int                 computed = 0;
+    std::vector<double> first(9), second(9);
+    auto                compute = [&](std::vector<double>& out) {
+        computed++;
+        for(std::size_t i = 0; i < out.size(); i++)
+        {
+            out[i] = double(i) - 4.0;
+        }
+    };
+
+    bool firstHit
+        = cache->fetch(key, first.data(), 9 * sizeof(double), [&]() { compute(first); });
+    bool secondHit
+        = cache->fetch(key, second.data(), 9 * sizeof(double), [&]() { compute(second); });
+    return !firstHit && secondHit && computed == 1 && first == second;
+}
+
+bool scalarsTest()
+{
+    // D = alpha * acc + beta * C, with C ignored when beta is zero
+    std::vector<float> acc = {1.0f, -2.0f, 3.0f}, c = {10.0f, 20.0f, 30.0f}, d(3);
+    hiptensor::applyGoldenScalars(d.data(), acc.data(), c.data(), 3, 2.0, 0.5);
+    if(d != std::vector<float>{7.0f, 6.0f, 21.0f})
+    {
+        return false;
+    }
+    hiptensor::applyGoldenScalars(d.data(), acc.data(), (float const*)nullptr, 3, 2.0, 0.0);
+    if(d != std::vector<float>{2.0f, -4.0f, 6.0f})
+    {
+        return false;
+    }
+
+    // (1 + 2i)(3 + i) + i(1 - i) = 1 + 7i + 1 + i
+    std::vector<hipDoubleComplex> accC = {make_hipDoubleComplex(3.0, 1.0)};
+    std::vector<hipDoubleComplex> cC   = {make_hipDoubleComplex(1.0, -1.0)};
+    std::vector<hipDoubleComplex> dC(1);
+    hiptensor::applyGoldenScalars(dC.data(),
+                                  accC.data(),
+                                  cC.data(),
+                                  1,
+                                  std::complex<double>(1.0, 2.0),
+                                  std::complex<double>(0.0, 1.0));
+    return dC[0].x == 2.0 && dC[0].y == 8.0;
+}
+
+int main()
+{
+    // Private cache directory, set before the cache is first used
+    auto directory = std::filesystem::temp_directory_path()
+                     / ("hiptensor_golden_cache_test_" + std::to_string(getpid()));
+    hiptensor::HiptensorOptions::instance()->setGoldenCacheDir(directory.string());
+
+    bool testPass = hiptensor::GoldenCache::instance()->enabled();
+
+    std::cout << "key: ";
+    bool result = keyTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "storeFind: ";
+    result = storeFindTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "collision: ";
+    result = collisionTest(directory);
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "fetch: ";
+    result = fetchTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "scalars: ";
+    result = scalarsTest();
+    printBool(result);
+    testPass &= result;
+
+    std::filesystem::remove_all(directory);
+
+    std::cout << "goldenCache: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,887 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Packed strides with the first mode fastest
+std::vector<int64_t> packedStrides(std::vector<int64_t> const& lengths)
+{
+    auto    strides = std::vector<int64_t>(lengths.size());
+    int64_t stride  = 1;
+    for(size_t i = 0; i < lengths.size(); i++)
+    {
+        strides[i] = stride;
+        stride *= lengths[i];
+    }
+    return strides;
+}
+
+bool nearlyEqual(std::vector<float> const& result, std::vector<float> const& expected)
+{
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        if(std::abs(result[i] - expected[i]) > 1e-4f * std::max(1.0f, std::abs(expected[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool backendSelectionTest()
+{
+    hiptensorHandle_t* handle;
+    if(hiptensorCreate(&handle) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    hiptensorBackend_t backend;
+    bool               pass = true;
+
+    pass &= hiptensorSetBackend(handle, HIPTENSOR_BACKEND_CPU) == HIPTENSOR_STATUS_SUCCESS
+            && hiptensorGetBackend(handle, &backend) == HIPTENSOR_STATUS_SUCCESS
+            && backend == HIPTENSOR_BACKEND_CPU;
+
+    // AUTO is always valid, whether or not a device is present
+    pass &= hiptensorSetBackend(handle, HIPTENSOR_BACKEND_AUTO) == HIPTENSOR_STATUS_SUCCESS
+            && hiptensorGetBackend(handle, &backend) == HIPTENSOR_STATUS_SUCCESS
+            && backend == HIPTENSOR_BACKEND_AUTO;
+
+    // Test out-of-range input value
+    pass &= hiptensorSetBackend(handle, hiptensorBackend_t(3)) == HIPTENSOR_STATUS_INVALID_VALUE;
+    pass &= hiptensorGetBackend(handle, nullptr) == HIPTENSOR_STATUS_NOT_INITIALIZED;
+
+    hiptensorDestroy(handle);
+    return pass;
+}
+
+bool hostPermutationTest(hiptensorHandle_t* handle)
+{
+    // B[c, a, b] = alpha * A[a, b, c]
+    std::vector<int32_t> modeA{'a', 'b', 'c'};
+    std::vector<int32_t> modeB{'c', 'a', 'b'};
+    std::vector<int64_t> lengthsA{37, 19, 23};
+    std::vector<int64_t> lengthsB{23, 37, 19};
+    auto                 stridesA = packedStrides(lengthsA);
+    auto                 stridesB = packedStrides(lengthsB);
+
+    auto elements = lengthsA[0] * lengthsA[1] * lengthsA[2];
+    auto A        = std::vector<float>(elements);
+    auto B        = std::vector<float>(elements);
+    for(int64_t i = 0; i < elements; i++)
+    {
+        A[i] = float(i % 101) - 50.0f;
+    }
+
+    hiptensorTensorDescriptor_t descA, descB;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descB, 3, lengthsB.data(), stridesB.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    float alpha = 2.0f;
+    if(hiptensorPermutation(handle,
+                            &alpha,
+                            A.data(),
+                            &descA,
+                            modeA.data(),
+                            B.data(),
+                            &descB,
+                            modeB.data(),
+                            HIP_R_32F,
+                            nullptr)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    auto expected = std::vector<float>(elements);
+    for(int64_t c = 0; c < lengthsA[2]; c++)
+    {
+        for(int64_t b = 0; b < lengthsA[1]; b++)
+        {
+            for(int64_t a = 0; a < lengthsA[0]; a++)
+            {
+                expected[c * stridesB[0] + a * stridesB[1] + b * stridesB[2]]
+                    = alpha * A[a * stridesA[0] + b * stridesA[1] + c * stridesA[2]];
+            }
+        }
+    }
+
+    if(!nearlyEqual(B, expected))
+    {
+        return false;
+    }
+
+    // Plans run on the backend they were built for only
+    hiptensorPermutationPlan_t plan;
+    if(hiptensorInitPermutationPlan(
+           handle, &plan, &descA, modeA.data(), &descB, modeB.data(), HIP_R_32F)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+    auto devicePlan     = plan;
+    devicePlan.mBackend = HIPTENSOR_BACKEND_GPU;
+    return hiptensorPermutationExecute(handle, &plan, &alpha, A.data(), B.data(), nullptr)
+               == HIPTENSOR_STATUS_SUCCESS
+           && nearlyEqual(B, expected)
+           && hiptensorPermutationExecute(
+                  handle, &devicePlan, &alpha, A.data(), B.data(), nullptr)
+                  == HIPTENSOR_STATUS_INVALID_VALUE;
+}
+
+bool hostBatchedPermutationTest(hiptensorHandle_t* handle)
+{
+    // B_i[c, a, b] = alpha * A_i[a, b, c] for a batch of small tensors
+    std::vector<int32_t> modeA{'a', 'b', 'c'};
+    std::vector<int32_t> modeB{'c', 'a', 'b'};
+    std::vector<int64_t> lengthsA{16, 16, 8};
+    std::vector<int64_t> lengthsB{8, 16, 16};
+    auto                 stridesA = packedStrides(lengthsA);
+    auto                 stridesB = packedStrides(lengthsB);
+
+    int64_t batchCount = 6;
+    int64_t elements   = lengthsA[0] * lengthsA[1] * lengthsA[2];
+
+    // B is padded between the tensors of the batch
+    int64_t strideA = elements;
+    int64_t strideB = elements + 5;
+
+    auto A = std::vector<float>(batchCount * strideA);
+    for(size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 101) - 50.0f;
+    }
+
+    hiptensorTensorDescriptor_t descA, descB;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descB, 3, lengthsB.data(), stridesB.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    float alpha    = 2.0f;
+    auto  expected = std::vector<float>(batchCount * strideB);
+    for(int64_t n = 0; n < batchCount; n++)
+    {
+        for(int64_t c = 0; c < lengthsA[2]; c++)
+        {
+            for(int64_t b = 0; b < lengthsA[1]; b++)
+            {
+                for(int64_t a = 0; a < lengthsA[0]; a++)
+                {
+                    expected[n * strideB + c * stridesB[0] + a * stridesB[1] + b * stridesB[2]]
+                        = alpha * A[n * strideA + a * stridesA[0] + b * stridesA[1]
+                                    + c * stridesA[2]];
+                }
+            }
+        }
+    }
+
+    auto B = std::vector<float>(expected.size());
+    if(hiptensorPermutationStridedBatched(handle,
+                                          &alpha,
+                                          A.data(),
+                                          &descA,
+                                          modeA.data(),
+                                          strideA,
+                                          B.data(),
+                                          &descB,
+                                          modeB.data(),
+                                          strideB,
+                                          batchCount,
+                                          HIP_R_32F,
+                                          nullptr)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+    bool pass = nearlyEqual(B, expected);
+
+    // Overlapping tensors of B are rejected
+    pass &= hiptensorPermutationStridedBatched(handle,
+                                               &alpha,
+                                               A.data(),
+                                               &descA,
+                                               modeA.data(),
+                                               strideA,
+                                               B.data(),
+                                               &descB,
+                                               modeB.data(),
+                                               elements - 1,
+                                               batchCount,
+                                               HIP_R_32F,
+                                               nullptr)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+
+    // Pointer arrays, equally spaced and then in reverse order
+    auto pointersA = std::vector<const void*>(batchCount);
+    auto pointersB = std::vector<void*>(batchCount);
+    for(bool reverse : {false, true})
+    {
+        for(int64_t n = 0; n < batchCount; n++)
+        {
+            auto tensor  = reverse ? batchCount - 1 - n : n;
+            pointersA[n] = A.data() + tensor * strideA;
+            pointersB[n] = B.data() + tensor * strideB;
+        }
+
+        std::fill(B.begin(), B.end(), 0.0f);
+        if(hiptensorPermutationBatched(handle,
+                                       &alpha,
+                                       pointersA.data(),
+                                       &descA,
+                                       modeA.data(),
+                                       pointersB.data(),
+                                       &descB,
+                                       modeB.data(),
+                                       batchCount,
+                                       HIP_R_32F,
+                                       nullptr)
+           != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return false;
+        }
+        pass &= nearlyEqual(B, expected);
+    }
+
+    // Every other tensor permuted in place, at addresses that are not equally spaced
+    auto work = A;
+    for(int64_t n = 0; n < batchCount; n++)
+    {
+        pointersA[n] = (n % 2 == 0 ? work.data() : A.data()) + n * strideA;
+        pointersB[n] = n % 2 == 0 ? work.data() + n * strideA : B.data() + n * strideB;
+    }
+
+    std::fill(B.begin(), B.end(), 0.0f);
+    if(hiptensorPermutationBatched(handle,
+                                   &alpha,
+                                   pointersA.data(),
+                                   &descA,
+                                   modeA.data(),
+                                   pointersB.data(),
+                                   &descB,
+                                   modeB.data(),
+                                   batchCount,
+                                   HIP_R_32F,
+                                   nullptr)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+    for(int64_t n = 0; n < batchCount; n++)
+    {
+        auto result = static_cast<float const*>(pointersB[n]);
+        auto first  = expected.begin() + n * strideB;
+        pass &= nearlyEqual(std::vector<float>(result, result + elements),
+                            std::vector<float>(first, first + elements));
+    }
+
+    return pass;
+}
+
+bool hostInPlacePermutationTest(hiptensorHandle_t* handle)
+{
+    auto permuteInPlace = [&](std::vector<int64_t> const& lengthsA,
+                              std::vector<int32_t> const& modeA,
+                              std::vector<int32_t> const& modeB,
+                              float                       alpha,
+                              std::vector<float>&         data,
+                              std::vector<float>&         expected,
+                              uint64_t                    workspaceSize) {
+        auto lengthsB = std::vector<int64_t>(modeB.size());
+        for(size_t i = 0; i < modeB.size(); i++)
+        {
+            lengthsB[i] = lengthsA[std::find(modeA.begin(), modeA.end(), modeB[i]) - modeA.begin()];
+        }
+        auto stridesA = packedStrides(lengthsA);
+        auto stridesB = packedStrides(lengthsB);
+
+        int64_t elements = 1;
+        for(auto length : lengthsA)
+        {
+            elements *= length;
+        }
+        data.resize(elements);
+        for(int64_t i = 0; i < elements; i++)
+        {
+            data[i] = float(i % 101) - 50.0f;
+        }
+
+        // Offset of each element of A in B
+        expected.resize(elements);
+        for(int64_t i = 0; i < elements; i++)
+        {
+            int64_t offset = 0;
+            int64_t index  = i;
+            for(size_t j = 0; j < lengthsA.size(); j++)
+            {
+                auto k = std::find(modeB.begin(), modeB.end(), modeA[j]) - modeB.begin();
+                offset += index % lengthsA[j] * stridesB[k];
+                index /= lengthsA[j];
+            }
+            expected[offset] = alpha * data[i];
+        }
+
+        hiptensorTensorDescriptor_t descA, descB;
+        hiptensorInitTensorDescriptor(handle,
+                                      &descA,
+                                      lengthsA.size(),
+                                      lengthsA.data(),
+                                      stridesA.data(),
+                                      HIP_R_32F,
+                                      HIPTENSOR_OP_IDENTITY);
+        hiptensorInitTensorDescriptor(handle,
+                                      &descB,
+                                      lengthsB.size(),
+                                      lengthsB.data(),
+                                      stridesB.data(),
+                                      HIP_R_32F,
+                                      HIPTENSOR_OP_IDENTITY);
+
+        if(workspaceSize == 0)
+        {
+            return hiptensorPermutation(handle,
+                                        &alpha,
+                                        data.data(),
+                                        &descA,
+                                        modeA.data(),
+                                        data.data(),
+                                        &descB,
+                                        modeB.data(),
+                                        HIP_R_32F,
+                                        nullptr);
+        }
+
+        auto workspace = std::vector<char>(workspaceSize);
+        return hiptensorPermutationInPlace(handle,
+                                           &alpha,
+                                           data.data(),
+                                           &descA,
+                                           modeA.data(),
+                                           &descB,
+                                           modeB.data(),
+                                           HIP_R_32F,
+                                           workspace.data(),
+                                           workspaceSize,
+                                           nullptr);
+    };
+
+    std::vector<float> data, expected;
+    bool               pass = true;
+
+    // Scaling and a batch of square transposes need no workspace
+    pass &= permuteInPlace({7, 5, 3}, {'a', 'b', 'c'}, {'a', 'b', 'c'}, 0.5f, data, expected, 0)
+                == HIPTENSOR_STATUS_SUCCESS
+            && nearlyEqual(data, expected);
+    pass &= permuteInPlace({37, 37, 3}, {'a', 'b', 'n'}, {'b', 'a', 'n'}, 2.0f, data, expected, 0)
+                == HIPTENSOR_STATUS_SUCCESS
+            && nearlyEqual(data, expected);
+
+    auto getWorkspaceSize = [&](std::vector<int64_t> const&   lengthsA,
+                                std::vector<int32_t> const&   modeA,
+                                std::vector<int32_t> const&   modeB,
+                                hiptensorWorksizePreference_t pref) {
+        auto lengthsB = std::vector<int64_t>(modeB.size());
+        for(size_t i = 0; i < modeB.size(); i++)
+        {
+            lengthsB[i] = lengthsA[std::find(modeA.begin(), modeA.end(), modeB[i]) - modeA.begin()];
+        }
+        auto stridesA = packedStrides(lengthsA);
+        auto stridesB = packedStrides(lengthsB);
+
+        hiptensorTensorDescriptor_t descA, descB;
+        hiptensorInitTensorDescriptor(handle,
+                                      &descA,
+                                      lengthsA.size(),
+                                      lengthsA.data(),
+                                      stridesA.data(),
+                                      HIP_R_32F,
+                                      HIPTENSOR_OP_IDENTITY);
+        hiptensorInitTensorDescriptor(handle,
+                                      &descB,
+                                      lengthsB.size(),
+                                      lengthsB.data(),
+                                      stridesB.data(),
+                                      HIP_R_32F,
+                                      HIPTENSOR_OP_IDENTITY);
+
+        uint64_t workspaceSize = ~uint64_t(0);
+        hiptensorPermutationGetWorkspaceSize(
+            handle, &descA, modeA.data(), &descB, modeB.data(), pref, &workspaceSize);
+        return workspaceSize;
+    };
+
+    // B[c, a, b, n] = alpha * A[a, b, c, n] permutes the slabs of each n through the
+    // workspace, or follows the cycles of the slabs without one
+    std::vector<int64_t> lengths{4, 6, 5, 3};
+    std::vector<int32_t> modeA{'a', 'b', 'c', 'n'};
+    std::vector<int32_t> modeB{'c', 'a', 'b', 'n'};
+    uint64_t             slabSize = 4 * 6 * 5 * sizeof(float);
+
+    pass &= getWorkspaceSize(lengths, modeA, modeB, HIPTENSOR_WORKSPACE_MIN) == 0;
+    pass &= getWorkspaceSize(lengths, modeA, modeB, HIPTENSOR_WORKSPACE_MAX) == 3 * slabSize;
+    for(auto workspaceSize : {uint64_t(0), slabSize / 2, slabSize, 2 * slabSize, 3 * slabSize})
+    {
+        pass &= permuteInPlace(lengths, modeA, modeB, 2.0f, data, expected, workspaceSize)
+                    == HIPTENSOR_STATUS_SUCCESS
+                && nearlyEqual(data, expected);
+    }
+
+    // Worst cases: the slowest mode moves in a non-square transpose and in B[c, b, a],
+    // so one slab is the whole tensor. They run without a workspace, and with one the
+    // size of the tensor.
+    std::vector<std::vector<int64_t>> worstLengths{{37, 19}, {5, 6, 7}};
+    std::vector<std::vector<int32_t>> worstModeA{{'a', 'b'}, {'a', 'b', 'c'}};
+    std::vector<std::vector<int32_t>> worstModeB{{'b', 'a'}, {'c', 'b', 'a'}};
+    for(size_t i = 0; i < worstLengths.size(); i++)
+    {
+        uint64_t tensorSize = sizeof(float);
+        for(auto length : worstLengths[i])
+        {
+            tensorSize *= length;
+        }
+
+        pass &= getWorkspaceSize(
+                    worstLengths[i], worstModeA[i], worstModeB[i], HIPTENSOR_WORKSPACE_MIN)
+                == 0;
+        pass &= getWorkspaceSize(
+                    worstLengths[i], worstModeA[i], worstModeB[i], HIPTENSOR_WORKSPACE_MAX)
+                == tensorSize;
+        pass &= getWorkspaceSize(worstLengths[i],
+                                 worstModeA[i],
+                                 worstModeB[i],
+                                 HIPTENSOR_WORKSPACE_RECOMMENDED)
+                == tensorSize;
+        for(auto workspaceSize : {uint64_t(0), tensorSize - 1, tensorSize})
+        {
+            pass &= permuteInPlace(worstLengths[i],
+                                   worstModeA[i],
+                                   worstModeB[i],
+                                   0.5f,
+                                   data,
+                                   expected,
+                                   workspaceSize)
+                        == HIPTENSOR_STATUS_SUCCESS
+                    && nearlyEqual(data, expected);
+        }
+    }
+
+    return pass;
+}
+
+bool hostReductionTest(hiptensorHandle_t* handle)
+{
+    // D[a, c] = alpha * sum_b A[a, b, c] + beta * C[a, c]
+    std::vector<int32_t> modeA{'a', 'b', 'c'};
+    std::vector<int32_t> modeD{'a', 'c'};
+    std::vector<int64_t> lengthsA{13, 257, 7};
+    std::vector<int64_t> lengthsD{13, 7};
+    auto                 stridesA = packedStrides(lengthsA);
+    auto                 stridesD = packedStrides(lengthsD);
+
+    auto A = std::vector<float>(lengthsA[0] * lengthsA[1] * lengthsA[2]);
+    auto C = std::vector<float>(lengthsD[0] * lengthsD[1]);
+    auto D = std::vector<float>(C.size());
+    for(size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 17) * 0.25f;
+    }
+    for(size_t i = 0; i < C.size(); i++)
+    {
+        C[i] = float(i);
+    }
+
+    hiptensorTensorDescriptor_t descA, descD;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descD, 2, lengthsD.data(), stridesD.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    float alpha = 0.5f;
+    float beta  = 2.0f;
+    if(hiptensorReduction(handle,
+                          &alpha,
+                          A.data(),
+                          &descA,
+                          modeA.data(),
+                          &beta,
+                          C.data(),
+                          &descD,
+                          modeD.data(),
+                          D.data(),
+                          &descD,
+                          modeD.data(),
+                          HIPTENSOR_OP_ADD,
+                          HIPTENSOR_COMPUTE_32F,
+                          nullptr,
+                          0,
+                          nullptr)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    auto expected = std::vector<float>(D.size());
+    for(int64_t c = 0; c < lengthsA[2]; c++)
+    {
+        for(int64_t a = 0; a < lengthsA[0]; a++)
+        {
+            double sum = 0.0;
+            for(int64_t b = 0; b < lengthsA[1]; b++)
+            {
+                sum += A[a * stridesA[0] + b * stridesA[1] + c * stridesA[2]];
+            }
+            auto offset      = a * stridesD[0] + c * stridesD[1];
+            expected[offset] = float(alpha * sum + beta * C[offset]);
+        }
+    }
+
+    return nearlyEqual(D, expected);
+}
+
+bool hostContractionTest(hiptensorHandle_t* handle)
+{
+    // D[m, n, u, v] = alpha * sum_{h, k} A[m, n, h, k] * B[u, v, h, k]
+    std::vector<int32_t> modeA{'m', 'n', 'h', 'k'};
+    std::vector<int32_t> modeB{'u', 'v', 'h', 'k'};
+    std::vector<int32_t> modeD{'m', 'n', 'u', 'v'};
+    std::vector<int64_t> lengthsA{5, 3, 4, 6};
+    std::vector<int64_t> lengthsB{7, 2, 4, 6};
+    std::vector<int64_t> lengthsD{5, 3, 7, 2};
+    auto                 stridesA = packedStrides(lengthsA);
+    auto                 stridesB = packedStrides(lengthsB);
+    auto                 stridesD = packedStrides(lengthsD);
+
+    auto A = std::vector<float>(5 * 3 * 4 * 6);
+    auto B = std::vector<float>(7 * 2 * 4 * 6);
+    auto D = std::vector<float>(5 * 3 * 7 * 2);
+    for(size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 7) - 3.0f;
+    }
+    for(size_t i = 0; i < B.size(); i++)
+    {
+        B[i] = float(i % 5) * 0.5f;
+    }
+
+    hiptensorTensorDescriptor_t descA, descB, descD;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 4, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descB, 4, lengthsB.data(), stridesB.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descD, 4, lengthsD.data(), stridesD.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    hiptensorContractionDescriptor_t desc;
+    hiptensorContractionFind_t       find;
+    hiptensorContractionPlan_t       plan;
+    uint64_t                         workspaceSize = 0;
+
+    if(hiptensorInitContractionDescriptor(handle,
+                                          &desc,
+                                          &descA,
+                                          modeA.data(),
+                                          4,
+                                          &descB,
+                                          modeB.data(),
+                                          4,
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          &descD,
+                                          modeD.data(),
+                                          4,
+                                          HIPTENSOR_COMPUTE_32F)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorContractionGetWorkspaceSize(
+              handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionPlan(handle, &plan, &desc, &find, workspaceSize)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    auto  workspace = std::vector<char>(workspaceSize);
+    float alpha     = 1.5f;
+    if(hiptensorContraction(handle,
+                            &plan,
+                            &alpha,
+                            A.data(),
+                            B.data(),
+                            nullptr,
+                            nullptr,
+                            D.data(),
+                            workspace.data(),
+                            workspaceSize,
+                            nullptr)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    auto expected = std::vector<float>(D.size());
+    for(int64_t v = 0; v < lengthsD[3]; v++)
+    {
+        for(int64_t u = 0; u < lengthsD[2]; u++)
+        {
+            for(int64_t n = 0; n < lengthsD[1]; n++)
+            {
+                for(int64_t m = 0; m < lengthsD[0]; m++)
+                {
+                    double sum = 0.0;
+                    for(int64_t k = 0; k < lengthsA[3]; k++)
+                    {
+                        for(int64_t h = 0; h < lengthsA[2]; h++)
+                        {
+                            sum += double(A[m * stridesA[0] + n * stridesA[1] + h * stridesA[2]
+                                            + k * stridesA[3]])
+                                   * B[u * stridesB[0] + v * stridesB[1] + h * stridesB[2]
+                                       + k * stridesB[3]];
+                        }
+                    }
+                    expected[m * stridesD[0] + n * stridesD[1] + u * stridesD[2]
+                             + v * stridesD[3]]
+                        = float(alpha * sum);
+                }
+            }
+        }
+    }
+
+    return nearlyEqual(D, expected);
+}
+
+bool hostElementwiseTest(hiptensorHandle_t* handle)
+{
+    // D[a, b, c] = max(alpha * A[a, b, c] * beta * B[c, a], gamma * sqrt(C[a, b, c]))
+    std::vector<int32_t> modeA{'a', 'b', 'c'};
+    std::vector<int32_t> modeB{'c', 'a'};
+    std::vector<int64_t> lengthsA{17, 9, 11};
+    std::vector<int64_t> lengthsB{11, 17};
+    auto                 stridesA = packedStrides(lengthsA);
+    auto                 stridesB = packedStrides(lengthsB);
+
+    auto elements = lengthsA[0] * lengthsA[1] * lengthsA[2];
+    auto A        = std::vector<float>(elements);
+    auto B        = std::vector<float>(lengthsB[0] * lengthsB[1]);
+    auto C        = std::vector<float>(elements);
+    auto D        = std::vector<float>(elements);
+    for(int64_t i = 0; i < elements; i++)
+    {
+        A[i] = float(i % 13) - 6.0f;
+        C[i] = float(i % 29);
+    }
+    for(size_t i = 0; i < B.size(); i++)
+    {
+        B[i] = float(i % 7) * 0.5f;
+    }
+
+    hiptensorTensorDescriptor_t descA, descB, descC, descD;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descB, 2, lengthsB.data(), stridesB.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descC, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_SQRT);
+    hiptensorInitTensorDescriptor(
+        handle, &descD, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    float alpha = 1.5f;
+    float beta  = 2.0f;
+    float gamma = 0.5f;
+    if(hiptensorElementwiseTrinary(handle,
+                                   &alpha,
+                                   A.data(),
+                                   &descA,
+                                   modeA.data(),
+                                   &beta,
+                                   B.data(),
+                                   &descB,
+                                   modeB.data(),
+                                   &gamma,
+                                   C.data(),
+                                   &descC,
+                                   modeA.data(),
+                                   D.data(),
+                                   &descD,
+                                   modeA.data(),
+                                   HIPTENSOR_OP_MUL,
+                                   HIPTENSOR_OP_MAX,
+                                   HIP_R_32F,
+                                   nullptr)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    auto expected = std::vector<float>(elements);
+    for(int64_t c = 0; c < lengthsA[2]; c++)
+    {
+        for(int64_t b = 0; b < lengthsA[1]; b++)
+        {
+            for(int64_t a = 0; a < lengthsA[0]; a++)
+            {
+                auto offset = a * stridesA[0] + b * stridesA[1] + c * stridesA[2];
+                auto ab     = alpha * A[offset] * beta * B[c * stridesB[0] + a * stridesB[1]];
+                expected[offset] = std::max(ab, gamma * std::sqrt(C[offset]));
+            }
+        }
+    }
+
+    if(!nearlyEqual(D, expected))
+    {
+        return false;
+    }
+
+    // D[a, b, c] = alpha * A[a, b, c] + gamma * C[a, b, c] through a reusable plan
+    hiptensorInitTensorDescriptor(
+        handle, &descC, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    hiptensorElementwisePlan_t plan;
+    if(hiptensorInitElementwiseBinaryPlan(handle,
+                                          &plan,
+                                          &descA,
+                                          modeA.data(),
+                                          &descC,
+                                          modeA.data(),
+                                          &descD,
+                                          modeA.data(),
+                                          HIPTENSOR_OP_ADD,
+                                          HIP_R_32F)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    // A binary plan cannot run a trinary operation
+    bool pass = hiptensorElementwiseTrinaryExecute(handle,
+                                                   &plan,
+                                                   &alpha,
+                                                   A.data(),
+                                                   &beta,
+                                                   B.data(),
+                                                   &gamma,
+                                                   C.data(),
+                                                   D.data(),
+                                                   nullptr)
+                == HIPTENSOR_STATUS_INVALID_VALUE;
+
+    // Nor a plan built for the device
+    auto devicePlan     = plan;
+    devicePlan.mBackend = HIPTENSOR_BACKEND_GPU;
+    pass &= hiptensorElementwiseBinaryExecute(
+                handle, &devicePlan, &alpha, A.data(), &gamma, C.data(), D.data(), nullptr)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+
+    for(float scale : {1.0f, -3.0f})
+    {
+        if(hiptensorElementwiseBinaryExecute(
+               handle, &plan, &scale, A.data(), &gamma, C.data(), D.data(), nullptr)
+           != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return false;
+        }
+
+        for(int64_t i = 0; i < elements; i++)
+        {
+            expected[i] = scale * A[i] + gamma * C[i];
+        }
+        pass &= nearlyEqual(D, expected);
+    }
+
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = backendSelectionTest();
+    totalPass &= testPass;
+    std::cout << "Backend Selection: ";
+    printBool(testPass);
+
+    // All remaining tests run on host memory with the CPU backend
+    hiptensorHandle_t* handle;
+    hiptensorCreate(&handle);
+    hiptensorSetBackend(handle, HIPTENSOR_BACKEND_CPU);
+
+    testPass = hostPermutationTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host Permutation: ";
+    printBool(testPass);
+
+    testPass = hostBatchedPermutationTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host Batched Permutation: ";
+    printBool(testPass);
+
+    testPass = hostInPlacePermutationTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host In-place Permutation: ";
+    printBool(testPass);
+
+    testPass = hostReductionTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host Reduction: ";
+    printBool(testPass);
+
+    testPass = hostContractionTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host Contraction: ";
+    printBool(testPass);
+
+    testPass = hostElementwiseTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host Elementwise: ";
+    printBool(testPass);
+
+    hiptensorDestroy(handle);
+
+    if(!totalPass)
+    {
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Permutes a batch of packed 3-D tensors whose base pointers are neither equally
+// spaced nor in address order, and checks every tensor against a host loop. With
+// mixedInPlace, every other tensor of B is its tensor of A.
+bool pointerBatchTest(hiptensorHandle_t*          handle,
+                      std::vector<int32_t> const& modeB,
+                      std::vector<int64_t> const& lengthsA,
+                      bool                        mixedInPlace = false)
+{
+    std::vector<int32_t> modeA{'a', 'b', 'c'};
+    std::vector<int64_t> lengthsB(3);
+    for(int i = 0; i < 3; i++)
+    {
+        lengthsB[i] = lengthsA[modeB[i] - 'a'];
+    }
+
+    hiptensorTensorDescriptor_t descA, descB;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 3, lengthsA.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(
+        handle, &descB, 3, lengthsB.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    // Tensors sit at growing gaps in one allocation, and the batch lists them in reverse
+    int64_t const        elements   = lengthsA[0] * lengthsA[1] * lengthsA[2];
+    int64_t const        batchCount = 5;
+    std::vector<int64_t> offsets(batchCount);
+    int64_t              poolElements = 0;
+    for(int64_t i = 0; i < batchCount; i++)
+    {
+        poolElements += 7 * i;
+        offsets[batchCount - 1 - i] = poolElements;
+        poolElements += elements;
+    }
+
+    std::vector<float> A(poolElements);
+    for(int64_t i = 0; i < poolElements; i++)
+    {
+        A[i] = float(i % 101) - 50.0f;
+    }
+
+    float* A_d    = nullptr;
+    float* B_d    = nullptr;
+    auto   bytes  = poolElements * sizeof(float);
+    bool   result = hipMalloc(&A_d, bytes) == hipSuccess && hipMalloc(&B_d, bytes) == hipSuccess
+                  && hipMemcpy(A_d, A.data(), bytes, hipMemcpyHostToDevice) == hipSuccess
+                  && hipMemset(B_d, 0, bytes) == hipSuccess;
+
+    std::vector<const void*> batchA(batchCount);
+    std::vector<void*>       batchB(batchCount);
+    for(int64_t i = 0; i < batchCount; i++)
+    {
+        bool inPlace = mixedInPlace && i % 2 == 0;
+        batchA[i]    = A_d + offsets[i];
+        batchB[i]    = (inPlace ? A_d : B_d) + offsets[i];
+    }
+
+    float alpha = 2.0f;
+    result      = result
+             && hiptensorPermutationBatched(handle,
+                                            &alpha,
+                                            batchA.data(),
+                                            &descA,
+                                            modeA.data(),
+                                            batchB.data(),
+                                            &descB,
+                                            modeB.data(),
+                                            batchCount,
+                                            HIP_R_32F,
+                                            nullptr)
+                    == HIPTENSOR_STATUS_SUCCESS;
+
+    std::vector<float> B(poolElements);
+    std::vector<float> inPlaceB(poolElements);
+    result = result && hipMemcpy(B.data(), B_d, bytes, hipMemcpyDeviceToHost) == hipSuccess
+             && hipMemcpy(inPlaceB.data(), A_d, bytes, hipMemcpyDeviceToHost) == hipSuccess;
+
+    // Packed strides of B along the modes of A
+    int64_t stridesB[3];
+    int64_t stride = 1;
+    for(int i = 0; i < 3; i++)
+    {
+        stridesB[modeB[i] - 'a'] = stride;
+        stride *= lengthsB[i];
+    }
+    for(int64_t i = 0; result && i < batchCount; i++)
+    {
+        auto& resultB = batchB[i] == batchA[i] ? inPlaceB : B;
+        for(int64_t c = 0; c < lengthsA[2]; c++)
+        {
+            for(int64_t b = 0; b < lengthsA[1]; b++)
+            {
+                for(int64_t a = 0; a < lengthsA[0]; a++)
+                {
+                    auto expected
+                        = alpha * A[offsets[i] + a + lengthsA[0] * (b + lengthsA[1] * c)];
+                    auto actual
+                        = resultB[offsets[i] + a * stridesB[0] + b * stridesB[1] + c * stridesB[2]];
+                    result &= std::abs(actual - expected)
+                              <= 1e-4f * std::max(1.0f, std::abs(expected));
+                }
+            }
+        }
+    }
+
+    hipFree(A_d);
+    hipFree(B_d);
+    return result;
+}
+
+int main()
+{
+    int deviceCount = 0;
+    if(hipGetDeviceCount(&deviceCount) != hipSuccess || deviceCount == 0)
+    {
+        std::cout << "permutationBatched: SKIPPED (no device)" << std::endl;
+        return 0;
+    }
+
+    hiptensorHandle_t* handle;
+    hiptensorCreate(&handle);
+
+    bool testPass = true;
+
+    // The fastest mode moves, so tiles are transposed through shared memory
+    std::cout << "transpose: ";
+    bool result = pointerBatchTest(handle, {'c', 'a', 'b'}, {37, 19, 23});
+    printBool(result);
+    testPass &= result;
+
+    // The fastest mode stays, so both sides are read and written linearly
+    std::cout << "linear: ";
+    result = pointerBatchTest(handle, {'a', 'c', 'b'}, {37, 19, 23});
+    printBool(result);
+    testPass &= result;
+
+    // Tensors permuted in place run one at a time, the others in one launch
+    std::cout << "mixed in-place: ";
+    result = pointerBatchTest(handle, {'c', 'a', 'b'}, {37, 19, 23}, true);
+    printBool(result);
+    testPass &= result;
+
+    hiptensorDestroy(handle);
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+// hiptensor includes
+#include "permutation_cpu_engine_common.hpp"
+
+template <typename Func>
+double bestOfMs(int runs, Func&& func)
+{
+    auto ms = std::numeric_limits<double>::max();
+    for(int i = 0; i < runs; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        ms = std::min(
+            ms,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count());
+    }
+    return ms;
+}
+
+// Reports the engine bandwidth next to the reference loop and a memcpy of the
+// same data. Correctness is covered by permutation_cpu_engine_test; results
+// are only checked here to make sure the timings are of working code.
+template <typename T, typename Op>
+bool permutationBench(Problem const& p, Op&& op)
+{
+    PermutationCase<T> c(p);
+
+    auto refMs    = bestOfMs(1, [&]() { c.reference(op); });
+    auto engineMs = bestOfMs(5, [&]() { c.run(op); });
+    bool match    = c.match();
+    auto memcpyMs = bestOfMs(5, [&]() {
+        std::memcpy(c.mB.data(), c.mA.data(), static_cast<std::size_t>(c.mCount) * sizeof(T));
+    });
+
+    // Bytes read plus bytes written
+    auto gbPerS = [&](double ms) { return 2.0 * c.mCount * sizeof(T) / (ms * 1.0e6); };
+    std::cout << c.mCount << " elements, folded rank " << c.mPlan.mLengths.size()
+              << (c.mPlan.mTranspose ? " (tiled transpose)" : "") << ": reference " << refMs
+              << " ms, engine " << engineMs << " ms (" << gbPerS(engineMs) << " GB/s), memcpy "
+              << gbPerS(memcpyMs) << " GB/s, " << 100.0 * memcpyMs / engineMs
+              << "% of memcpy, speedup " << refMs / engineMs << "x" << std::endl;
+
+    return match;
+}
+
+int main()
+{
+    bool pass = true;
+
+    auto scaleF32  = [](float& out, float const& in) { out = 1.5f * in; };
+    auto copyU16   = [](uint16_t& out, uint16_t const& in) { out = in; };
+    auto squareF64 = [](double& out, double const& in) { out = -0.5 * in * in; };
+
+    // Bandwidth of every rank registered by the host permutation instances
+    std::cout << "rank2F32: ";
+    pass &= permutationBench<float>({{2048, 1024}, {1, 0}}, scaleF32);
+    std::cout << "rank2U16: ";
+    pass &= permutationBench<uint16_t>({{2048, 1024}, {1, 0}}, copyU16);
+    std::cout << "rank3F32: ";
+    pass &= permutationBench<float>({{128, 128, 128}, {2, 1, 0}}, scaleF32);
+    std::cout << "rank4F32: ";
+    pass &= permutationBench<float>({{64, 32, 32, 32}, {1, 3, 0, 2}}, scaleF32);
+    std::cout << "rank4F64: ";
+    pass &= permutationBench<double>({{64, 32, 32, 32}, {3, 2, 1, 0}}, squareF64);
+    std::cout << "rank5U16: ";
+    pass &= permutationBench<uint16_t>({{32, 16, 16, 16, 16}, {4, 2, 0, 3, 1}}, copyU16);
+    std::cout << "rank6F32: ";
+    pass &= permutationBench<float>({{16, 8, 8, 8, 8, 8}, {5, 3, 4, 1, 0, 2}}, scaleF32);
+
+    return pass ? 0 : -1;
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#ifndef HIPTENSOR_TEST_PERMUTATION_CPU_ENGINE_COMMON_HPP
+#define HIPTENSOR_TEST_PERMUTATION_CPU_ENGINE_COMMON_HPP
+
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// hiptensor includes
+#include "permutation/permutation_cpu_engine.hpp"
+
+// Problems and helpers shared by the CPU permutation engine unit test and benchmark
+
+struct Problem
+{
+    std::vector<int64_t> mLengths;
+
+    // Output position of each input mode
+    std::vector<int32_t> mPerm;
+};
+
+template <typename T>
+std::vector<T> randomTensor(int64_t elements, uint32_t seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<T>                        result(elements);
+    for(auto& value : result)
+    {
+        if constexpr(std::is_integral_v<T>)
+        {
+            value = static_cast<T>(gen());
+        }
+        else
+        {
+            value = T(dist(gen));
+        }
+    }
+    return result;
+}
+
+// B = op(A) with the modes of A permuted into B, both packed with the first
+// mode fastest as the library does. The engine writes B and the original
+// reference loop writes R.
+template <typename T>
+struct PermutationCase
+{
+    PermutationCase(Problem const& p)
+        : mProblem(p)
+    {
+        auto const rank = p.mLengths.size();
+        mCount          = std::accumulate(
+            p.mLengths.begin(), p.mLengths.end(), int64_t{1}, std::multiplies<>());
+
+        std::vector<int64_t> outLengths(rank);
+        mInStrides.resize(rank);
+        mOutStrides.resize(rank);
+        for(std::size_t d = 0, stride = 1; d < rank; stride *= p.mLengths[d], d++)
+        {
+            mInStrides[d]          = stride;
+            outLengths[p.mPerm[d]] = p.mLengths[d];
+        }
+        for(std::size_t d = 0, stride = 1; d < rank; stride *= outLengths[d], d++)
+        {
+            for(std::size_t i = 0; i < rank; i++)
+            {
+                if(static_cast<std::size_t>(p.mPerm[i]) == d)
+                {
+                    mOutStrides[i] = stride;
+                }
+            }
+        }
+
+        mA = randomTensor<T>(mCount, 1);
+        mB.resize(mCount);
+        mR.resize(mCount);
+
+        mPlan = hiptensor::makePermutationCpuPlan(p.mLengths, mInStrides, mOutStrides);
+    }
+
+    template <typename Op>
+    void run(Op&& op)
+    {
+        hiptensor::permutationCpu(mPlan, mA.data(), mB.data(), op);
+    }
+
+    // Mirrors the original reference: an index vector and two inner products per element
+    template <typename Op>
+    void reference(Op&& op)
+    {
+        auto const           rank = mProblem.mLengths.size();
+        std::vector<int64_t> index(rank, 0);
+        for(int64_t e = 0; e < mCount; e++)
+        {
+            auto aOffset
+                = std::inner_product(index.begin(), index.end(), mInStrides.begin(), int64_t{0});
+            auto bOffset
+                = std::inner_product(index.begin(), index.end(), mOutStrides.begin(), int64_t{0});
+            op(mR[bOffset], mA[aOffset]);
+            for(std::size_t d = 0; d < rank && ++index[d] == mProblem.mLengths[d]; d++)
+            {
+                index[d] = 0;
+            }
+        }
+    }
+
+    bool match() const
+    {
+        return std::memcmp(mB.data(), mR.data(), static_cast<std::size_t>(mCount) * sizeof(T))
+               == 0;
+    }
+
+    Problem                       mProblem;
+    int64_t                       mCount;
+    std::vector<int64_t>          mInStrides, mOutStrides;
+    std::vector<T>                mA, mB, mR;
+    hiptensor::PermutationCpuPlan mPlan;
+};
+
+#endif // HIPTENSOR_TEST_PERMUTATION_CPU_ENGINE_COMMON_HPP
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <iostream>
+
+// hiptensor includes
+#include "permutation_cpu_engine_common.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Checks the engine against a loop that mirrors the original reference.
+// Bandwidth is reported by permutation_cpu_engine_bench.
+template <typename T, typename Op>
+bool permutationTest(Problem const& p, Op&& op)
+{
+    PermutationCase<T> c(p);
+    c.reference(op);
+    c.run(op);
+
+    std::cout << c.mCount << " elements, folded rank " << c.mPlan.mLengths.size()
+              << (c.mPlan.mTranspose ? " (tiled transpose)" : "") << std::endl;
+    return c.match();
+}
+
+int main()
+{
+    bool testPass = true;
+
+    auto scaleF32  = [](float& out, float const& in) { out = 1.5f * in; };
+    auto copyU16   = [](uint16_t& out, uint16_t const& in) { out = in; };
+    auto squareF64 = [](double& out, double const& in) { out = -0.5 * in * in; };
+
+    // Edge cases: odd extents that leave partial tiles, length-1 modes,
+    // the identity permutation and modes that fold together
+    std::cout << "oddRank3F32: ";
+    testPass &= permutationTest<float>({{37, 53, 7}, {2, 0, 1}}, scaleF32);
+    std::cout << "unitModesRank4U16: ";
+    testPass &= permutationTest<uint16_t>({{1, 45, 1, 19}, {3, 1, 0, 2}}, copyU16);
+    std::cout << "identityRank3F64: ";
+    testPass &= permutationTest<double>({{13, 11, 9}, {0, 1, 2}}, squareF64);
+    std::cout << "foldedRank4F32: ";
+    testPass &= permutationTest<float>({{9, 10, 11, 12}, {2, 3, 0, 1}}, scaleF32);
+
+    // Every rank registered by the host permutation instances
+    std::cout << "rank2F32: ";
+    testPass &= permutationTest<float>({{67, 45}, {1, 0}}, scaleF32);
+    std::cout << "rank2U16: ";
+    testPass &= permutationTest<uint16_t>({{70, 33}, {1, 0}}, copyU16);
+    std::cout << "rank3F32: ";
+    testPass &= permutationTest<float>({{19, 17, 23}, {2, 1, 0}}, scaleF32);
+    std::cout << "rank4F64: ";
+    testPass &= permutationTest<double>({{11, 6, 7, 5}, {3, 2, 1, 0}}, squareF64);
+    std::cout << "rank5U16: ";
+    testPass &= permutationTest<uint16_t>({{13, 5, 4, 3, 6}, {4, 2, 0, 3, 1}}, copyU16);
+    std::cout << "rank6F32: ";
+    testPass &= permutationTest<float>({{9, 3, 2, 4, 3, 5}, {5, 3, 4, 1, 0, 2}}, scaleF32);
+
+    std::cout << "permutationCpuEngine: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
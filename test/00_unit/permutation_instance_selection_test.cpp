@@ -0,0 +1,431 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// hiptensor includes
+#include "hiptensor_options.hpp"
+#include "permutation/permutation_folding.hpp"
+#include "permutation/permutation_instance_selection.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+struct LegacyProblem
+{
+    hipDataType              mType;
+    std::vector<std::size_t> mLengths;
+    std::vector<int32_t>     mOutputMode;
+};
+
+// Parses "HIP_R_<type>_<lengths>_<output modes>" the way the string tables were keyed
+LegacyProblem parseLegacyKey(std::string const& name)
+{
+    std::vector<std::string> tokens;
+    std::istringstream       stream(name);
+    for(std::string token; std::getline(stream, token, '_');)
+    {
+        tokens.push_back(token);
+    }
+
+    LegacyProblem problem;
+    problem.mType = tokens[2] == "16F" ? HIP_R_16F : HIP_R_32F;
+
+    auto rank = (tokens.size() - 3) / 2;
+    for(std::size_t i = 0; i < rank; i++)
+    {
+        problem.mLengths.push_back(std::stoul(tokens[3 + i]));
+        problem.mOutputMode.push_back(std::stoi(tokens[3 + rank + i]));
+    }
+    return problem;
+}
+
+// Rebuilds the string key of a problem as the string lookup did
+std::string legacyKey(hipDataType                     type,
+                      std::vector<std::size_t> const& point,
+                      std::vector<int32_t> const&     outputMode)
+{
+    auto key = hiptensor::hipTypeToString(type);
+    for(auto index : point)
+    {
+        key += '_';
+        key += std::to_string(index);
+    }
+    for(auto mode : outputMode)
+    {
+        key += '_';
+        key += std::to_string(mode);
+    }
+    return key;
+}
+
+bool tableSelectionTest()
+{
+    bool pass = true;
+    for(ck::index_t rank = 2; rank <= 4; rank++)
+    {
+        auto [entries, size] = hiptensor::instanceTable(rank);
+        pass &= size > 0;
+
+        for(std::size_t i = 0; i < size; i++)
+        {
+            auto const& entry   = entries[i];
+            auto        problem = parseLegacyKey(entry.mName);
+
+            pass &= legacyKey(problem.mType, problem.mLengths, problem.mOutputMode)
+                    == entry.mName;
+            pass &= hiptensor::instanceKey(entry.mName)
+                    == hiptensor::instanceKey(
+                        problem.mLengths, problem.mOutputMode, problem.mType);
+
+            // Lengths inside a sub-space select the entry of its upper edge
+            auto lengths = problem.mLengths;
+            pass &= hiptensor::selectInstanceParams(
+                        lengths, problem.mOutputMode, problem.mType, problem.mType, rank)
+                    == entry.mParams;
+            for(auto& length : lengths)
+            {
+                length = length > 32 ? length - 1 : 1;
+            }
+            pass &= hiptensor::selectInstanceParams(
+                        lengths, problem.mOutputMode, problem.mType, problem.mType, rank)
+                    == entry.mParams;
+        }
+    }
+    return pass;
+}
+
+bool defaultSelectionTest()
+{
+    hiptensor::InstanceHyperParams defaultParams = {256, 64, 64, 4, 4, {0, 1}, 4, 4};
+
+    // No table for the type
+    bool pass = hiptensor::selectInstanceParams({32, 32}, {1, 0}, HIP_R_64F, HIP_R_64F, 2)
+                == defaultParams;
+
+    // Beyond the last sub-space
+    pass &= hiptensor::selectInstanceParams(
+                {std::size_t(1) << 30, 32}, {1, 0}, HIP_R_32F, HIP_R_32F, 2)
+            == defaultParams;
+    pass &= hiptensor::instanceKey({std::size_t(1) << 30, 32}, {1, 0}, HIP_R_32F)
+            == hiptensor::InvalidInstanceKey;
+
+    // Malformed string keys
+    pass &= hiptensor::instanceKey("HIP_R_16F_32_32_0") == hiptensor::InvalidInstanceKey;
+    pass &= hiptensor::instanceKey("HIP_C_32F_32_32_0_1") == hiptensor::InvalidInstanceKey;
+    return pass;
+}
+
+bool foldModesTest()
+{
+    std::vector<std::size_t> lengths;
+    std::vector<int32_t>     outputMode;
+
+    // Modes (0, 1) and (3, 4, 5) stay adjacent: rank 6 folds to rank 3
+    hiptensor::foldModes({2, 3, 4, 5, 6, 7}, {3, 4, 5, 2, 0, 1}, lengths, outputMode);
+    bool pass = lengths == std::vector<std::size_t>{6, 4, 210}
+                && outputMode == std::vector<int32_t>{2, 1, 0};
+
+    // Unit modes are dropped, and may separate modes that then fold
+    hiptensor::foldModes({8, 1, 16, 32, 1}, {4, 3, 0, 1, 2}, lengths, outputMode);
+    pass &= lengths == std::vector<std::size_t>{128, 32}
+            && outputMode == std::vector<int32_t>{1, 0};
+
+    // Modes adjacent in A but reversed in B do not fold
+    hiptensor::foldModes({32, 64, 128, 256, 512}, {4, 3, 2, 1, 0}, lengths, outputMode);
+    pass &= lengths == std::vector<std::size_t>{32, 64, 128, 256, 512}
+            && outputMode == std::vector<int32_t>{4, 3, 2, 1, 0};
+
+    // Identity permutation folds to a single mode
+    hiptensor::foldModes({32, 32, 32, 32, 32, 32}, {0, 1, 2, 3, 4, 5}, lengths, outputMode);
+    pass &= lengths == std::vector<std::size_t>{std::size_t(1) << 30}
+            && outputMode == std::vector<int32_t>{0};
+    return pass;
+}
+
+bool continuesFoldedModeTest()
+{
+    // Three tensors with a folded mode of length 4 and unit strides, then a
+    // mode of length 5 with strides 4: slower changing in all of them
+    std::size_t strides[] = {4, 4, 4};
+    std::size_t folded[]  = {1, 1, 1};
+    bool        pass      = hiptensor::continuesFoldedMode(5, strides, 4, folded, 3)
+                && folded[0] == 1 && folded[1] == 1 && folded[2] == 1;
+
+    // Faster changing in all of them: the folded mode takes the unit strides
+    std::size_t fasterStrides[] = {1, 1, 1};
+    std::size_t fasterFolded[]  = {5, 5, 5};
+    pass &= hiptensor::continuesFoldedMode(5, fasterStrides, 4, fasterFolded, 3)
+            && fasterFolded[0] == 1 && fasterFolded[1] == 1 && fasterFolded[2] == 1;
+
+    // A broadcast input continues on either side, a transposed one on neither
+    std::size_t broadcastStrides[] = {4, 0, 4};
+    std::size_t broadcastFolded[]  = {1, 0, 1};
+    pass &= hiptensor::continuesFoldedMode(5, broadcastStrides, 4, broadcastFolded, 3);
+
+    std::size_t mixedStrides[] = {4, 1, 4};
+    std::size_t mixedFolded[]  = {1, 5, 1};
+    pass &= !hiptensor::continuesFoldedMode(5, mixedStrides, 4, mixedFolded, 3)
+            && mixedFolded[1] == 5;
+    return pass;
+}
+
+bool foldedSelectionTest()
+{
+    // A rank 6 permutation folded before selection selects the rank 3 entry
+    auto [entries, size] = hiptensor::instanceTable(3);
+
+    bool        pass    = size > 0;
+    std::size_t checked = 0;
+    for(std::size_t i = 0; i < size; i++)
+    {
+        auto problem = parseLegacyKey(entries[i].mName);
+
+        // Only entries that do not fold further are reachable
+        std::vector<std::size_t> foldedLengths;
+        std::vector<int32_t>     foldedOutputMode;
+        hiptensor::foldModes(
+            problem.mLengths, problem.mOutputMode, foldedLengths, foldedOutputMode);
+        if(foldedLengths.size() != problem.mLengths.size())
+        {
+            continue;
+        }
+        checked++;
+
+        // Split each mode into (2, length / 2), which stay adjacent in B
+        std::vector<std::size_t> lengths;
+        for(auto length : problem.mLengths)
+        {
+            lengths.push_back(2);
+            lengths.push_back(length / 2);
+        }
+        std::vector<int32_t> outputMode;
+        for(auto mode : problem.mOutputMode)
+        {
+            outputMode.push_back(2 * mode);
+            outputMode.push_back(2 * mode + 1);
+        }
+
+        // Permutations are folded before their instances are selected, and the rank 6
+        // tables stay empty until they are measured
+        std::vector<std::size_t> refoldedLengths;
+        std::vector<int32_t>     refoldedOutputMode;
+        hiptensor::foldModes(lengths, outputMode, refoldedLengths, refoldedOutputMode);
+        pass &= refoldedLengths == problem.mLengths && refoldedOutputMode == problem.mOutputMode;
+        pass &= hiptensor::selectInstanceParams(
+                    refoldedLengths, refoldedOutputMode, problem.mType, problem.mType, 3)
+                == entries[i].mParams;
+        pass &= hiptensor::selectInstanceParams(
+                    lengths, outputMode, problem.mType, problem.mType, 6)
+                == hiptensor::InstanceHyperParams{256, 64, 64, 4, 4, {0, 1}, 4, 4};
+    }
+    return pass && checked > 0;
+}
+
+bool foldPermutationTest()
+{
+    auto desc = [](std::vector<std::size_t> const& lengths) {
+        return hiptensorTensorDescriptor_t{HIP_R_32F, lengths, {}, HIPTENSOR_OP_IDENTITY};
+    };
+
+    // (a, b) and (c, d) stay adjacent: rank 4 folds to a rank 2 transpose
+    hiptensor::FoldedPermutation folded;
+    auto                         descA   = desc({4, 8, 16, 32});
+    auto                         descB   = desc({16, 32, 4, 8});
+    int32_t                      modeA[] = {'a', 'b', 'c', 'd'};
+    int32_t                      modeB[] = {'c', 'd', 'a', 'b'};
+
+    bool pass = hiptensor::foldPermutation(&descA, modeA, &descB, modeB, folded);
+    pass &= !folded.isFlat() && folded.mDescA.mLengths == std::vector<std::size_t>{32, 512}
+            && folded.mDescB.mLengths == std::vector<std::size_t>{512, 32}
+            && folded.mModeA == std::vector<int32_t>{0, 1}
+            && folded.mModeB == std::vector<int32_t>{1, 0} && folded.elementCount() == 16384;
+
+    // Only unit modes move: a flat problem
+    descA           = desc({1, 8, 1});
+    descB           = desc({1, 8, 1});
+    int32_t modeC[] = {'c', 'b', 'a'};
+    pass &= hiptensor::foldPermutation(&descA, modeA, &descB, modeC, folded);
+    pass &= folded.isFlat() && folded.elementCount() == 8;
+
+    // An irreducible transpose, and an empty problem, are not folded
+    descA           = desc({32, 64});
+    descB           = desc({64, 32});
+    int32_t modeD[] = {'b', 'a'};
+    pass &= !hiptensor::foldPermutation(&descA, modeA, &descB, modeD, folded);
+
+    descA = desc({0, 8, 4});
+    descB = desc({0, 8, 4});
+    pass &= !hiptensor::foldPermutation(&descA, modeA, &descB, modeA, folded);
+
+    // A padded batch stride stops folding, and the strides are kept
+    descA          = desc({8, 4, 3});
+    descB          = desc({8, 4, 3});
+    descA.mStrides = {1, 8, 32};
+    descB.mStrides = {1, 8, 40};
+    pass &= hiptensor::foldPermutation(&descA, modeA, &descB, modeA, folded);
+    pass &= !folded.isFlat() && folded.mDescA.mLengths == std::vector<std::size_t>{32, 3}
+            && folded.mDescA.mStrides == std::vector<std::size_t>{1, 32}
+            && folded.mDescB.mStrides == std::vector<std::size_t>{1, 40};
+
+    // A padded leading dimension splits the modes on either side of it
+    descA.mStrides = {1, 10, 40};
+    descB.mStrides = {1, 8, 32};
+    pass &= hiptensor::foldPermutation(&descA, modeA, &descB, modeA, folded);
+    pass &= folded.mDescA.mLengths == std::vector<std::size_t>{8, 12}
+            && folded.mDescA.mStrides == std::vector<std::size_t>{1, 10}
+            && folded.mDescB.mStrides == std::vector<std::size_t>{1, 8};
+
+    // A strided single mode is not a flat copy
+    descA          = desc({8, 4});
+    descB          = desc({8, 4});
+    descA.mStrides = {2, 16};
+    descB.mStrides = {1, 8};
+    pass &= hiptensor::foldPermutation(&descA, modeA, &descB, modeA, folded);
+    pass &= !folded.isFlat() && folded.elementCount() == 32;
+    return pass;
+}
+
+bool vectorWidthTest()
+{
+    auto desc = [](std::vector<std::size_t> const& lengths, std::vector<std::size_t> strides) {
+        return hiptensorTensorDescriptor_t{HIP_R_32F, lengths, strides, HIPTENSOR_OP_IDENTITY};
+    };
+
+    // Packed tensors are left to the instance tables
+    auto descA = desc({64, 30}, {});
+    auto descB = desc({30, 64}, {});
+    bool pass  = hiptensor::permutationVectorWidth(&descA, nullptr, &descB, nullptr, 8) == 8;
+
+    // Padded leading dimensions that the vectors divide
+    descA = desc({64, 30}, {1, 72});
+    descB = desc({32, 64}, {1, 36});
+    pass &= hiptensor::permutationVectorWidth(&descA, nullptr, &descB, nullptr, 8) == 4;
+
+    // The unit stride mode must be a multiple of the vectors too
+    descB = desc({30, 64}, {1, 32});
+    pass &= hiptensor::permutationVectorWidth(&descA, nullptr, &descB, nullptr, 8) == 2;
+
+    // Without a unit stride mode, there are no vectors
+    descB = desc({30, 64}, {2, 64});
+    pass &= hiptensor::permutationVectorWidth(&descA, nullptr, &descB, nullptr, 8) == 1;
+
+    // Nor with an address that is not aligned to them
+    alignas(32) float data[8];
+    descB = desc({30, 64}, {});
+    pass &= hiptensor::permutationVectorWidth(&descA, data, &descB, data + 2, 8) == 2;
+    return pass;
+}
+
+bool complexPermutationTest()
+{
+    // Column-major by default: the parts are prepended as the fastest mode
+    auto& options  = hiptensor::HiptensorOptions::instance();
+    bool  colMajor = options->isColMajorStrides();
+    auto  withParts
+        = [colMajor](std::vector<std::size_t> values, std::size_t parts) {
+              values.insert(colMajor ? values.begin() : values.end(), parts);
+              return values;
+          };
+
+    auto    descA   = hiptensorTensorDescriptor_t{HIP_C_32F, {4, 8}, {1, 4}, HIPTENSOR_OP_IDENTITY};
+    auto    descB   = hiptensorTensorDescriptor_t{HIP_C_64F, {8, 4}, {1, 8}, HIPTENSOR_OP_IDENTITY};
+    int32_t modeA[] = {'a', 'b'};
+    int32_t modeB[] = {'b', 'a'};
+
+    hiptensor::FoldedPermutation real;
+
+    bool pass = hiptensor::complexAsRealPermutation(&descA, modeA, &descB, modeB, real);
+    pass &= real.mDescA.mType == HIP_R_32F && real.mDescB.mType == HIP_R_64F
+            && real.mDescA.mLengths == withParts({4, 8}, 2)
+            && real.mDescA.mStrides == withParts({2, 8}, 1)
+            && real.mDescB.mLengths == withParts({8, 4}, 2)
+            && real.mDescB.mStrides == withParts({2, 16}, 1);
+
+    // The parts mode has a label of neither A nor B
+    auto partsAt = colMajor ? 0 : 2;
+    pass &= real.mModeA[partsAt] == 'c' && real.mModeB[partsAt] == 'c';
+
+    // Real tensors are not viewed
+    descA.mType = HIP_R_32F;
+    descB.mType = HIP_R_32F;
+    pass &= !hiptensor::complexAsRealPermutation(&descA, modeA, &descB, modeB, real);
+
+    // Only real alphas apply to the real view
+    double value        = 0.0;
+    auto   realAlpha    = make_hipFloatComplex(2.0F, 0.0F);
+    auto   complexAlpha = make_hipDoubleComplex(2.0, 1.0);
+    float  floatAlpha   = 3.0F;
+    pass &= hiptensor::realPermutationAlpha(&realAlpha, HIP_C_32F, value) && value == 2.0;
+    pass &= !hiptensor::realPermutationAlpha(&complexAlpha, HIP_C_64F, value);
+    pass &= hiptensor::realPermutationAlpha(&floatAlpha, HIP_R_32F, value) && value == 3.0;
+    return pass;
+}
+
+int main()
+{
+    bool tablePass = tableSelectionTest();
+    std::cout << "tableSelection: ";
+    printBool(tablePass);
+
+    bool defaultPass = defaultSelectionTest();
+    std::cout << "defaultSelection: ";
+    printBool(defaultPass);
+
+    bool foldPass = foldModesTest();
+    std::cout << "foldModes: ";
+    printBool(foldPass);
+
+    bool continuesPass = continuesFoldedModeTest();
+    std::cout << "continuesFoldedMode: ";
+    printBool(continuesPass);
+
+    bool foldedPass = foldedSelectionTest();
+    std::cout << "foldedSelection: ";
+    printBool(foldedPass);
+
+    bool foldPermutationPass = foldPermutationTest();
+    std::cout << "foldPermutation: ";
+    printBool(foldPermutationPass);
+
+    bool vectorWidthPass = vectorWidthTest();
+    std::cout << "vectorWidth: ";
+    printBool(vectorWidthPass);
+
+    bool complexPass = complexPermutationTest();
+    std::cout << "complexPermutation: ";
+    printBool(complexPass);
+
+    return tablePass && defaultPass && foldPass && continuesPass && foldedPass
+                   && foldPermutationPass && vectorWidthPass && complexPass
+               ? 0
+               : -1;
+}
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+std::size_t lineCount(std::filesystem::path const& path)
+{
+    std::ifstream file(path);
+    std::string   line;
+    std::size_t   count = 0;
+    while(std::getline(file, line))
+    {
+        count++;
+    }
+    return count;
+}
+
+struct PermutationProblem
+{
+    // B[c, a, b] = alpha * A[a, b, c]
+    std::vector<int32_t> modeA{'a', 'b', 'c'};
+    std::vector<int32_t> modeB{'c', 'a', 'b'};
+    std::vector<int64_t> lengthsA{37, 19, 23};
+    std::vector<int64_t> lengthsB{23, 37, 19};
+
+    hiptensorTensorDescriptor_t descA, descB;
+
+    std::vector<float> A, expected;
+    float*             A_d = nullptr;
+    float*             B_d = nullptr;
+
+    float alpha = 2.0f;
+
+    bool init(hiptensorHandle_t* handle)
+    {
+        auto elements = lengthsA[0] * lengthsA[1] * lengthsA[2];
+        A.resize(elements);
+        expected.resize(elements);
+        for(int64_t i = 0; i < elements; i++)
+        {
+            A[i] = float(i % 101) - 50.0f;
+        }
+        for(int64_t c = 0; c < lengthsA[2]; c++)
+        {
+            for(int64_t b = 0; b < lengthsA[1]; b++)
+            {
+                for(int64_t a = 0; a < lengthsA[0]; a++)
+                {
+                    expected[c + a * lengthsB[0] + b * lengthsB[0] * lengthsB[1]]
+                        = alpha * A[a + b * lengthsA[0] + c * lengthsA[0] * lengthsA[1]];
+                }
+            }
+        }
+
+        // Packed strides with the first mode fastest
+        std::vector<int64_t> stridesA{1, lengthsA[0], lengthsA[0] * lengthsA[1]};
+        std::vector<int64_t> stridesB{1, lengthsB[0], lengthsB[0] * lengthsB[1]};
+        hiptensorInitTensorDescriptor(
+            handle, &descA, 3, lengthsA.data(), stridesA.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+        hiptensorInitTensorDescriptor(
+            handle, &descB, 3, lengthsB.data(), stridesB.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+        auto bytes = elements * sizeof(float);
+        return hipMalloc(&A_d, bytes) == hipSuccess && hipMalloc(&B_d, bytes) == hipSuccess
+               && hipMemcpy(A_d, A.data(), bytes, hipMemcpyHostToDevice) == hipSuccess;
+    }
+
+    bool check()
+    {
+        auto B = std::vector<float>(expected.size());
+        if(hipMemcpy(B.data(), B_d, B.size() * sizeof(float), hipMemcpyDeviceToHost)
+           != hipSuccess)
+        {
+            return false;
+        }
+        for(std::size_t i = 0; i < B.size(); i++)
+        {
+            if(std::abs(B[i] - expected[i]) > 1e-4f * std::max(1.0f, std::abs(expected[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool clear()
+    {
+        return hipMemset(B_d, 0, expected.size() * sizeof(float)) == hipSuccess;
+    }
+
+    ~PermutationProblem()
+    {
+        hipFree(A_d);
+        hipFree(B_d);
+    }
+};
+
+// A[a, b] = alpha * sqrt(A[a, b]) keeps the memory layout, but the unary operator
+// keeps it off the flat kernels
+bool inPlaceTest(hiptensorHandle_t* handle)
+{
+    std::vector<int32_t> modes{'a', 'b'};
+    std::vector<int64_t> lengths{61, 47};
+
+    hiptensorTensorDescriptor_t descA, descB;
+    hiptensorInitTensorDescriptor(
+        handle, &descA, 2, lengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_SQRT);
+    hiptensorInitTensorDescriptor(
+        handle, &descB, 2, lengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY);
+
+    auto               elements = lengths[0] * lengths[1];
+    std::vector<float> A(elements);
+    for(int64_t i = 0; i < elements; i++)
+    {
+        A[i] = float(i % 97);
+    }
+
+    float* A_d   = nullptr;
+    auto   bytes = elements * sizeof(float);
+    float  alpha = 2.0f;
+    bool   result = hipMalloc(&A_d, bytes) == hipSuccess
+                  && hipMemcpy(A_d, A.data(), bytes, hipMemcpyHostToDevice) == hipSuccess
+                  && hiptensorPermutation(handle,
+                                          &alpha,
+                                          A_d,
+                                          &descA,
+                                          modes.data(),
+                                          A_d,
+                                          &descB,
+                                          modes.data(),
+                                          HIP_R_32F,
+                                          nullptr)
+                         == HIPTENSOR_STATUS_SUCCESS;
+
+    std::vector<float> B(elements);
+    result = result && hipMemcpy(B.data(), A_d, bytes, hipMemcpyDeviceToHost) == hipSuccess;
+    for(int64_t i = 0; result && i < elements; i++)
+    {
+        auto expected = alpha * std::sqrt(A[i]);
+        result &= std::abs(B[i] - expected) <= 1e-4f * std::max(1.0f, expected);
+    }
+
+    hipFree(A_d);
+    return result;
+}
+
+int main()
+{
+    int deviceCount = 0;
+    if(hipGetDeviceCount(&deviceCount) != hipSuccess || deviceCount == 0)
+    {
+        std::cout << "permutationTuning: SKIPPED (no device)" << std::endl;
+        return 0;
+    }
+
+    // Private tuning file, set before the tuning is first used
+    auto path = std::filesystem::temp_directory_path()
+                / ("hiptensor_permutation_tuning_test_" + std::to_string(getpid()));
+    setenv("HIPTENSOR_PERMUTATION_TUNING", "ON", 1);
+    setenv("HIPTENSOR_PERMUTATION_TUNING_FILE", path.string().c_str(), 1);
+
+    hiptensorHandle_t* handle;
+    hiptensorCreate(&handle);
+
+    bool               testPass = true;
+    PermutationProblem problem;
+    if(!problem.init(handle))
+    {
+        hiptensorDestroy(handle);
+        return -1;
+    }
+
+    auto permute = [&]() {
+        return problem.clear()
+               && hiptensorPermutation(handle,
+                                       &problem.alpha,
+                                       problem.A_d,
+                                       &problem.descA,
+                                       problem.modeA.data(),
+                                       problem.B_d,
+                                       &problem.descB,
+                                       problem.modeB.data(),
+                                       HIP_R_32F,
+                                       nullptr)
+                      == HIPTENSOR_STATUS_SUCCESS
+               && problem.check();
+    };
+
+    // The first call tunes the problem and records its winner
+    std::cout << "tune: ";
+    bool result = permute() && lineCount(path) == 1;
+    printBool(result);
+    testPass &= result;
+
+    // Later calls reuse the winner without tuning again
+    std::cout << "reuse: ";
+    result = permute() && lineCount(path) == 1;
+    printBool(result);
+    testPass &= result;
+
+    // Plans of the same problem select the winner too
+    std::cout << "plan: ";
+    hiptensorPermutationPlan_t plan;
+    result = problem.clear()
+             && hiptensorInitPermutationPlan(handle,
+                                             &plan,
+                                             &problem.descA,
+                                             problem.modeA.data(),
+                                             &problem.descB,
+                                             problem.modeB.data(),
+                                             HIP_R_32F)
+                    == HIPTENSOR_STATUS_SUCCESS
+             && hiptensorPermutationExecute(
+                    handle, &plan, &problem.alpha, problem.A_d, problem.B_d, nullptr)
+                    == HIPTENSOR_STATUS_SUCCESS
+             && problem.check();
+    printBool(result);
+    testPass &= result;
+
+    // Permutations in place are not tuned, which would apply the operator and
+    // alpha once per timed run
+    std::cout << "inPlace: ";
+    result = inPlaceTest(handle) && lineCount(path) == 1;
+    printBool(result);
+    testPass &= result;
+
+    hiptensorDestroy(handle);
+    std::filesystem::remove(path);
+
+    std::cout << "permutationTuning: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+// hiptensor includes
+#include "reduction_cpu_engine_common.hpp"
+
+using hiptensor::ReductionCpuAccumulation;
+
+template <typename Func>
+double bestOfMs(int runs, Func&& func)
+{
+    auto ms = std::numeric_limits<double>::max();
+    for(int i = 0; i < runs; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        ms = std::min(
+            ms,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count());
+    }
+    return ms;
+}
+
+// Reports the time and error of the engine next to the naive serial loop.
+// Correctness is covered by reduction_cpu_engine_test; the engine error is
+// only checked here to make sure the timings are of working code.
+template <typename Reduce>
+bool reductionBench(Problem const&           p,
+                    ReductionCpuAccumulation accumulation,
+                    Reduce&&                 reduce,
+                    float                    identity,
+                    float                    mean)
+{
+    ReductionCase c(p, identity, mean);
+
+    auto naiveMs  = bestOfMs(1, [&]() { c.naive(reduce); });
+    auto engineMs = bestOfMs(5, [&]() { c.run(accumulation, reduce); });
+
+    auto naiveError  = c.relativeError(c.mN);
+    auto engineError = c.relativeError(c.mC);
+    std::cout << c.mLayout.mOutCount << " outputs x " << c.mReduceCount << " values, "
+              << (c.mPlan.mKeptInner ? "kept" : "reduced") << " mode innermost: naive " << naiveMs
+              << " ms (rel error " << naiveError << "), engine " << engineMs
+              << " ms (rel error " << engineError << "), speedup " << naiveMs / engineMs << "x"
+              << std::endl;
+
+    return engineError <= 8.0 * std::numeric_limits<float>::epsilon();
+}
+
+int main()
+{
+    bool pass = true;
+
+    auto const pairwise = ReductionCpuAccumulation::PAIRWISE;
+    auto const kahan    = ReductionCpuAccumulation::KAHAN;
+
+    std::cout << "sumAllPairwise: ";
+    pass &= reductionBench({{1 << 22}, {true}}, pairwise, addOp, 0.0f, 1.0f);
+    std::cout << "sumAllKahan: ";
+    pass &= reductionBench({{1 << 22}, {true}}, kahan, addOp, 0.0f, 1.0f);
+    std::cout << "sumRowsPairwise: ";
+    pass &= reductionBench({{4096, 512}, {true, false}}, pairwise, addOp, 0.0f, 1.0f);
+    std::cout << "sumColumnsKahan: ";
+    pass &= reductionBench({{512, 4096}, {false, true}}, kahan, addOp, 0.0f, 1.0f);
+    std::cout << "sumInterleavedRank4Pairwise: ";
+    pass &= reductionBench(
+        {{33, 17, 65, 9}, {false, true, false, true}}, pairwise, addOp, 0.0f, 1.0f);
+    std::cout << "maxRank3: ";
+    pass &= reductionBench({{100, 50, 70}, {false, true, true}},
+                           pairwise,
+                           maxOp,
+                           std::numeric_limits<float>::lowest(),
+                           0.0f);
+
+    return pass ? 0 : -1;
+}
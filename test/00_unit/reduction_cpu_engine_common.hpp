@@ -0,0 +1,204 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_TEST_REDUCTION_CPU_ENGINE_COMMON_HPP
+#define HIPTENSOR_TEST_REDUCTION_CPU_ENGINE_COMMON_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// hiptensor includes
+#include "reduction/reduction_cpu_engine.hpp"
+
+// Problems and helpers shared by the CPU reduction engine unit test and benchmark
+
+struct Problem
+{
+    std::vector<int64_t> mLengths;
+
+    // Whether each mode is reduced
+    std::vector<bool> mReduced;
+};
+
+struct Layout
+{
+    std::vector<int64_t> mKeptLengths, mKeptInStrides, mKeptOutStrides;
+    std::vector<int64_t> mReduceLengths, mReduceInStrides;
+    int64_t              mInCount, mOutCount;
+};
+
+// Packed A with the first mode fastest, and packed C over the kept modes
+inline Layout makeLayout(Problem const& p)
+{
+    Layout  layout;
+    int64_t inStride = 1, outStride = 1;
+    for(std::size_t d = 0; d < p.mLengths.size(); d++)
+    {
+        if(p.mReduced[d])
+        {
+            layout.mReduceLengths.push_back(p.mLengths[d]);
+            layout.mReduceInStrides.push_back(inStride);
+        }
+        else
+        {
+            layout.mKeptLengths.push_back(p.mLengths[d]);
+            layout.mKeptInStrides.push_back(inStride);
+            layout.mKeptOutStrides.push_back(outStride);
+            outStride *= p.mLengths[d];
+        }
+        inStride *= p.mLengths[d];
+    }
+    layout.mInCount  = inStride;
+    layout.mOutCount = outStride;
+    return layout;
+}
+
+inline std::vector<float> randomTensor(int64_t elements, float mean, uint32_t seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_real_distribution<float> dist(mean - 1.0f, mean + 1.0f);
+    std::vector<float>                    result(elements);
+    for(auto& value : result)
+    {
+        value = dist(gen);
+    }
+    return result;
+}
+
+inline auto addOp = [](float& acc, float value) { acc += value; };
+inline auto maxOp = [](float& acc, float value) {
+    // Propagates NaN as the reference does
+    if(std::isnan(value) || acc < value)
+    {
+        acc = value;
+    }
+};
+
+// C = reduce(A) over the reduced modes. The engine writes C, the naive serial
+// loop that mirrors the CK reference (index decomposition and sequential f32
+// accumulation per output) writes N, and an f64 loop writes the exact result.
+struct ReductionCase
+{
+    ReductionCase(Problem const& p, float identity, float mean)
+        : mLayout(makeLayout(p))
+        , mIdentity(identity)
+    {
+        mA = randomTensor(mLayout.mInCount, mean, 7);
+        mC.resize(mLayout.mOutCount);
+        mN.resize(mLayout.mOutCount);
+        mExact.resize(mLayout.mOutCount);
+        mReduceCount = mLayout.mInCount / mLayout.mOutCount;
+
+        for(int64_t o = 0; o < mLayout.mOutCount; o++)
+        {
+            double acc = identity;
+            for(int64_t r = 0; r < mReduceCount; r++)
+            {
+                double value = mA[keptIndexOffset(o, true) + reduceIndexOffset(r)];
+                acc          = identity == 0.0f ? acc + value : std::max(acc, value);
+            }
+            mExact[keptIndexOffset(o, false)] = acc;
+        }
+
+        mPlan = hiptensor::makeReductionCpuPlan(mLayout.mKeptLengths,
+                                                mLayout.mKeptInStrides,
+                                                mLayout.mKeptOutStrides,
+                                                mLayout.mReduceLengths,
+                                                mLayout.mReduceInStrides);
+    }
+
+    int64_t keptIndexOffset(int64_t flat, bool input) const
+    {
+        int64_t offset = 0;
+        for(std::size_t d = 0; d < mLayout.mKeptLengths.size(); d++)
+        {
+            auto index = flat % mLayout.mKeptLengths[d];
+            offset += index * (input ? mLayout.mKeptInStrides[d] : mLayout.mKeptOutStrides[d]);
+            flat /= mLayout.mKeptLengths[d];
+        }
+        return offset;
+    }
+
+    int64_t reduceIndexOffset(int64_t flat) const
+    {
+        int64_t offset = 0;
+        for(std::size_t d = 0; d < mLayout.mReduceLengths.size(); d++)
+        {
+            offset += (flat % mLayout.mReduceLengths[d]) * mLayout.mReduceInStrides[d];
+            flat /= mLayout.mReduceLengths[d];
+        }
+        return offset;
+    }
+
+    template <typename Reduce>
+    void run(hiptensor::ReductionCpuAccumulation accumulation, Reduce&& reduce)
+    {
+        hiptensor::reductionCpu<float>(
+            mPlan,
+            accumulation,
+            mIdentity,
+            [&](int64_t offset) { return mA[offset]; },
+            reduce,
+            [&](int64_t offset, float acc) { mC[offset] = acc; });
+    }
+
+    template <typename Reduce>
+    void naive(Reduce&& reduce)
+    {
+        for(int64_t o = 0; o < mLayout.mOutCount; o++)
+        {
+            float acc = mIdentity;
+            for(int64_t r = 0; r < mReduceCount; r++)
+            {
+                reduce(acc, mA[keptIndexOffset(o, true) + reduceIndexOffset(r)]);
+            }
+            mN[keptIndexOffset(o, false)] = acc;
+        }
+    }
+
+    // Largest error of the given result relative to the exact result
+    double relativeError(std::vector<float> const& result) const
+    {
+        double error = 0.0;
+        for(int64_t o = 0; o < mLayout.mOutCount; o++)
+        {
+            auto scale = std::max(1.0, std::abs(mExact[o]));
+            error      = std::max(error, std::abs(result[o] - mExact[o]) / scale);
+        }
+        return error;
+    }
+
+    Layout                      mLayout;
+    float                       mIdentity;
+    int64_t                     mReduceCount;
+    std::vector<float>          mA, mC, mN;
+    std::vector<double>         mExact;
+    hiptensor::ReductionCpuPlan mPlan;
+};
+
+#endif // HIPTENSOR_TEST_REDUCTION_CPU_ENGINE_COMMON_HPP
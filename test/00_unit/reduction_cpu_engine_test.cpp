@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+// hiptensor includes
+#include "reduction_cpu_engine_common.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+using hiptensor::ReductionCpuAccumulation;
+
+// Reduces A with the engine and checks that its error against the f64 reference
+// is within tolerance. Timings are reported by reduction_cpu_engine_bench.
+template <typename Reduce>
+bool reductionTest(Problem const&           p,
+                   ReductionCpuAccumulation accumulation,
+                   Reduce&&                 reduce,
+                   float                    identity,
+                   float                    mean)
+{
+    ReductionCase c(p, identity, mean);
+    c.run(accumulation, reduce);
+
+    // The accumulation stays within a few ulps of the exact result
+    bool pass = c.relativeError(c.mC) <= 8.0 * std::numeric_limits<float>::epsilon();
+    printBool(pass);
+    return pass;
+}
+
+// Reduces the same values into one output and into many outputs that all read
+// them (zero kept stride). The first runs in parallel segments and the second
+// reduces each output whole, which must give bitwise identical results.
+bool deterministicTest(ReductionCpuAccumulation accumulation)
+{
+    int64_t const count = 100003;
+    int64_t const outs  = 1024;
+    auto          A     = randomTensor(count, 0.5f, 11);
+    auto          load  = [&](int64_t offset) { return A[offset]; };
+
+    float single = 0.0f;
+    auto  plan1  = hiptensor::makeReductionCpuPlan({}, {}, {}, {count}, {1});
+    hiptensor::reductionCpu<float>(
+        plan1, accumulation, 0.0f, load, addOp, [&](int64_t, float acc) { single = acc; });
+
+    std::vector<float> several(outs);
+    auto               planOuts = hiptensor::makeReductionCpuPlan({outs}, {0}, {1}, {count}, {1});
+    hiptensor::reductionCpu<float>(
+        planOuts, accumulation, 0.0f, load, addOp, [&](int64_t o, float acc) { several[o] = acc; });
+
+    bool identical = true;
+    for(auto value : several)
+    {
+        identical &= std::memcmp(&value, &single, sizeof(float)) == 0;
+    }
+    return identical;
+}
+
+int main()
+{
+    bool testPass = true;
+
+    auto const pairwise = ReductionCpuAccumulation::PAIRWISE;
+    auto const kahan    = ReductionCpuAccumulation::KAHAN;
+
+    // Long sums of positive values, where sequential f32 accumulation drifts
+    std::cout << "sumAllPairwise: ";
+    testPass &= reductionTest({{1 << 22}, {true}}, pairwise, addOp, 0.0f, 1.0f);
+    std::cout << "sumAllKahan: ";
+    testPass &= reductionTest({{1 << 22}, {true}}, kahan, addOp, 0.0f, 1.0f);
+
+    // Reduced mode innermost, kept mode innermost, and interleaved modes
+    std::cout << "sumRowsPairwise: ";
+    testPass &= reductionTest({{4096, 512}, {true, false}}, pairwise, addOp, 0.0f, 1.0f);
+    std::cout << "sumColumnsKahan: ";
+    testPass &= reductionTest({{512, 4096}, {false, true}}, kahan, addOp, 0.0f, 1.0f);
+    std::cout << "sumInterleavedRank4Pairwise: ";
+    testPass &= reductionTest(
+        {{33, 17, 65, 9}, {false, true, false, true}}, pairwise, addOp, 0.0f, 1.0f);
+    std::cout << "sumUnitModesRank6Kahan: ";
+    testPass &= reductionTest({{1, 300, 1, 7, 1, 500}, {true, false, true, true, false, true}},
+                              kahan,
+                              addOp,
+                              0.0f,
+                              0.0f);
+    std::cout << "maxRank3: ";
+    testPass &= reductionTest({{100, 50, 70}, {false, true, true}},
+                              pairwise,
+                              maxOp,
+                              std::numeric_limits<float>::lowest(),
+                              0.0f);
+
+    std::cout << "deterministicPairwise: ";
+    auto deterministic = deterministicTest(pairwise);
+    printBool(deterministic);
+    testPass &= deterministic;
+    std::cout << "deterministicKahan: ";
+    deterministic = deterministicTest(kahan);
+    printBool(deterministic);
+    testPass &= deterministic;
+
+    std::cout << "reductionCpuEngine: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstring>
+#include <iostream>
+
+// hiptensor includes
+#include "logger.hpp"
+#include "registry_profiler.hpp"
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+static bool sRegistryTraced = false;
+
+bool registryInitMetricsTest()
+{
+    // Capture the registry init trace
+    auto callBackFunc = [](int32_t logContext, const char* funcName, const char* msg) {
+        if(logContext
+               == static_cast<int32_t>(hiptensor::Logger::LogLevel_t::LOG_LEVEL_PERF_TRACE)
+           && !strcmp(funcName, "hiptensorRegistryInit")
+           && (strstr(msg, "ContractionSolutionInstances") != NULL))
+        {
+            sRegistryTraced = true;
+        }
+    };
+
+    if(hiptensorLoggerSetCallback(callBackFunc) != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorLoggerSetMask(HIPTENSOR_LOG_LEVEL_PERF_TRACE) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    // Finding contraction candidates constructs the contraction registry
+    hiptensorHandle_t*         handle;
+    hiptensorContractionFind_t find;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+
+    hiptensorLoggerSetCallback(nullptr);
+
+    bool found = false;
+    for(auto const& metrics : hiptensor::RegistryProfiler::instance()->metrics())
+    {
+        std::cout << metrics;
+        if(metrics.mRegistryName == "ContractionSolutionInstances")
+        {
+            found = metrics.mSolutionCount > 0 && metrics.mHostBytes > 0
+                    && metrics.mInitTimeMs >= 0.0f;
+        }
+    }
+
+    return found && sRegistryTraced;
+}
+
+int main()
+{
+    bool testPass = registryInitMetricsTest();
+    std::cout << "registryInitMetrics: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_runtime.h>
+
+#include "device/philox.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Known answers of the Random123 reference implementation
+bool philoxTest()
+{
+    struct KnownAnswer
+    {
+        Philox4x32 mCounter;
+        uint64_t   mKey;
+        Philox4x32 mExpected;
+    };
+
+    KnownAnswer answers[] = {
+        {{{0u, 0u, 0u, 0u}}, 0ull, {{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}}},
+        {{{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}},
+         0xffffffffffffffffull,
+         {{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}}},
+        {{{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}},
+         0x299f31d0a4093822ull,
+         {{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}}}};
+
+    for(auto const& answer : answers)
+    {
+        auto result = philox4x32(answer.mCounter, answer.mKey);
+        if(std::memcmp(result.mWords, answer.mExpected.mWords, sizeof(result.mWords)) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Sample mean and variance of 'count' scalars
+void moments(InitParams const& params, uint64_t seed, uint64_t count, double& mean, double& var)
+{
+    double sum = 0.0, sumSquares = 0.0;
+    for(uint64_t block = 0; block < count / InitScalarsPerBlock; block++)
+    {
+        double scalars[InitScalarsPerBlock];
+        initScalars(params, seed, block, scalars);
+        for(auto value : scalars)
+        {
+            sum += value;
+            sumSquares += value * value;
+        }
+    }
+    mean = sum / count;
+    var  = sumSquares / count - mean * mean;
+}
+
+bool distributionTest()
+{
+    constexpr uint64_t Count = 1u << 20;
+    double             mean, var;
+
+    // Uniform in [-1, 1): mean 0, variance 1 / 3
+    moments(InitParams{}, 7, Count, mean, var);
+    if(std::abs(mean) > 5e-3 || std::abs(var - 1.0 / 3.0) > 5e-3)
+    {
+        return false;
+    }
+
+    moments({InitDistribution::NORMAL, 2.0, 0.5}, 7, Count, mean, var);
+    if(std::abs(mean - 2.0) > 5e-3 || std::abs(var - 0.25) > 5e-3)
+    {
+        return false;
+    }
+
+    // Integers in [-3, 3], hitting both ends
+    auto params = InitParams{InitDistribution::UNIFORM_INT, -3.0, 3.0};
+    bool low = false, high = false;
+    for(uint64_t block = 0; block < 4096; block++)
+    {
+        double scalars[InitScalarsPerBlock];
+        initScalars(params, 7, block, scalars);
+        for(auto value : scalars)
+        {
+            if(value != std::floor(value) || value < -3.0 || value > 3.0)
+            {
+                return false;
+            }
+            low |= value == -3.0;
+            high |= value == 3.0;
+        }
+    }
+
+    return low && high;
+}
+
+// Values depend only on the seed and the full 64-bit index
+bool indexTest()
+{
+    double first[InitScalarsPerBlock], aliased[InitScalarsPerBlock], again[InitScalarsPerBlock];
+    initScalars(InitParams{}, 1, 0, first);
+    initScalars(InitParams{}, 1, 1ull << 32, aliased);
+    initScalars(InitParams{}, 1, 0, again);
+
+    double other[InitScalarsPerBlock];
+    initScalars(InitParams{}, 2, 0, other);
+
+    return std::memcmp(first, again, sizeof(first)) == 0
+           && std::memcmp(first, aliased, sizeof(first)) != 0
+           && std::memcmp(first, other, sizeof(first)) != 0;
+}
+
+// Stores are clipped to the tensor, and complex and narrow types
+// take the same scalar stream rounded to their type.
+bool storeTest()
+{
+    constexpr uint64_t Elements = 7;
+    constexpr uint64_t Seed     = 11;
+    constexpr uint64_t Blocks   = (2 * Elements + InitScalarsPerBlock - 1) / InitScalarsPerBlock;
+
+    auto complexData = std::vector<hipFloatComplex>(Elements + 1);
+    auto bhalfData   = std::vector<hip_bfloat16>(2 * Elements + 1);
+    std::memset(complexData.data(), 0xff, complexData.size() * sizeof(hipFloatComplex));
+    std::memset(bhalfData.data(), 0xff, bhalfData.size() * sizeof(hip_bfloat16));
+
+    for(uint64_t block = 0; block < Blocks; block++)
+    {
+        initStoreBlock(complexData.data(), 2 * Elements, Seed, block, InitParams{});
+        initStoreBlock(bhalfData.data(), 2 * Elements, Seed, block, InitParams{});
+    }
+
+    for(uint64_t i = 0; i < Elements; i++)
+    {
+        double scalars[InitScalarsPerBlock];
+        initScalars(InitParams{}, Seed, (2 * i) / InitScalarsPerBlock, scalars);
+        auto real = scalars[(2 * i) % InitScalarsPerBlock];
+        auto imag = scalars[(2 * i + 1) % InitScalarsPerBlock];
+
+        if(complexData[i].x != static_cast<float>(real)
+           || complexData[i].y != static_cast<float>(imag)
+           || static_cast<float>(bhalfData[2 * i])
+                  != static_cast<float>(hip_bfloat16(static_cast<float>(real))))
+        {
+            return false;
+        }
+    }
+
+    // Past the end is untouched
+    uint32_t guard;
+    std::memcpy(&guard, &complexData[Elements].x, sizeof(guard));
+    return guard == 0xffffffffu && bhalfData[2 * Elements].data == 0xffffu;
+}
+
+int main()
+{
+    bool testPass = true;
+
+    std::cout << "philox: ";
+    bool result = philoxTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "distribution: ";
+    result = distributionTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "index: ";
+    result = indexTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "store: ";
+    result = storeTest();
+    printBool(result);
+    testPass &= result;
+
+    std::cout << "tensorInit: ";
+    printBool(testPass);
+
+    return testPass ? 0 : -1;
+}
@@ -0,0 +1,260 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+// hiptensor includes
+#include "thread_pool.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool parallelForCoverageTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+
+    // Every index runs exactly once, for counts below, at and above the thread count
+    for(std::size_t count : {std::size_t(1), pool->threadCount(), std::size_t(100003)})
+    {
+        auto hits = std::vector<std::atomic<int>>(count);
+        pool->parallelFor(count, [&](std::size_t i) { hits[i]++; });
+        for(auto& hit : hits)
+        {
+            if(hit != 1)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool workStealingTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+
+    // The first range is much more expensive than the others: it must be stolen from
+    // for the work to balance, and the result must not depend on who ran what.
+    std::size_t        count = 256;
+    std::vector<float> out(count);
+    pool->parallelFor(count, [&](std::size_t i) {
+        auto  iterations = (i < count / pool->threadCount()) ? 20000 : 100;
+        float value      = 0.0f;
+        for(int j = 0; j < iterations; j++)
+        {
+            value += float(i ^ j) * 1e-6f;
+        }
+        out[i] = value;
+    });
+
+    for(std::size_t i = 0; i < count; i++)
+    {
+        auto  iterations = (i < count / pool->threadCount()) ? 20000 : 100;
+        float value      = 0.0f;
+        for(int j = 0; j < iterations; j++)
+        {
+            value += float(i ^ j) * 1e-6f;
+        }
+        if(out[i] != value)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool nestedParallelForTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+
+    // Few outer tasks with wide inner loops: idle threads must join the inner jobs
+    std::size_t outer = 3;
+    std::size_t inner = 4099;
+    auto        sums  = std::vector<std::atomic<std::size_t>>(outer);
+    pool->parallelFor(outer, [&](std::size_t o) {
+        pool->parallelFor(inner, [&](std::size_t i) { sums[o] += i + o; });
+    });
+
+    for(std::size_t o = 0; o < outer; o++)
+    {
+        if(sums[o] != inner * (inner - 1) / 2 + inner * o)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool parallelForRangeTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+
+    std::size_t count = 10007;
+    auto        hits  = std::vector<std::atomic<int>>(count);
+    pool->parallelForRange(count, 64, [&](std::size_t begin, std::size_t end) {
+        if(end - begin > 64)
+        {
+            return;
+        }
+        for(auto i = begin; i < end; i++)
+        {
+            hits[i]++;
+        }
+    });
+
+    for(auto& hit : hits)
+    {
+        if(hit != 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool parallelForIndexSpaceTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+
+    std::vector<std::size_t> lengths{7, 5, 3, 11};
+    auto                     count = std::accumulate(
+        lengths.begin(), lengths.end(), std::size_t(1), std::multiplies<std::size_t>());
+    auto hits = std::vector<std::atomic<int>>(count);
+
+    auto task = [&](std::vector<std::size_t> const& start, std::size_t begin, std::size_t end) {
+        // Walk the chunk with an odometer and check it against the flat offset
+        auto index = start;
+        for(auto offset = begin; offset < end; offset++)
+        {
+            std::size_t flat   = 0;
+            std::size_t stride = 1;
+            for(std::size_t mode = 0; mode < lengths.size(); mode++)
+            {
+                flat += index[mode] * stride;
+                stride *= lengths[mode];
+            }
+            if(flat == offset)
+            {
+                hits[offset]++;
+            }
+
+            for(std::size_t mode = 0;
+                mode < lengths.size() && ++index[mode] == lengths[mode];
+                mode++)
+            {
+                index[mode] = 0;
+            }
+        }
+    };
+    pool->parallelForIndexSpace(lengths, 10, task);
+
+    for(auto& hit : hits)
+    {
+        if(hit != 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool concurrentCallersTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+
+    // Jobs submitted from several external threads share the same workers
+    std::size_t              count = 5003;
+    std::atomic<std::size_t> total(0);
+    std::vector<std::thread> callers;
+    for(int t = 0; t < 4; t++)
+    {
+        callers.emplace_back(
+            [&]() { pool->parallelFor(count, [&](std::size_t i) { total += i; }); });
+    }
+    for(auto& caller : callers)
+    {
+        caller.join();
+    }
+
+    return total == 4 * (count * (count - 1) / 2);
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    std::cout << "Threads: " << hiptensor::ThreadPool::instance()->threadCount() << std::endl;
+
+    testPass = parallelForCoverageTest();
+    totalPass &= testPass;
+    std::cout << "parallelFor Coverage: ";
+    printBool(testPass);
+
+    testPass = workStealingTest();
+    totalPass &= testPass;
+    std::cout << "Work Stealing: ";
+    printBool(testPass);
+
+    testPass = nestedParallelForTest();
+    totalPass &= testPass;
+    std::cout << "Nested parallelFor: ";
+    printBool(testPass);
+
+    testPass = parallelForRangeTest();
+    totalPass &= testPass;
+    std::cout << "parallelForRange: ";
+    printBool(testPass);
+
+    testPass = parallelForIndexSpaceTest();
+    totalPass &= testPass;
+    std::cout << "parallelForIndexSpace: ";
+    printBool(testPass);
+
+    testPass = concurrentCallersTest();
+    totalPass &= testPass;
+    std::cout << "Concurrent Callers: ";
+    printBool(testPass);
+
+    if(!totalPass)
+    {
+        return -1;
+    }
+
+    return 0;
+}
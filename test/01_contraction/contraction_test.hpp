@@ -128,6 +128,9 @@ namespace hiptensor
 
         static bool mHeaderPrinted;
 
+        // Seed of the random inputs, part of the golden-result cache key
+        static constexpr uint32_t sInputSeed = 256;
+
         // Output buffer
         static std::stringstream sAPILogBuff;
 
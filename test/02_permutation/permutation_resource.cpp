@@ -41,7 +41,8 @@ namespace hiptensor
         , mHostA(Base::allocHost(0))
         , mHostB(Base::allocHost(0))
         , mCurrentMatrixElement(0)
-        , mCurrentDataType(HIP_R_32F)
+        , mCurrentDataTypeA(HIP_R_32F)
+        , mCurrentDataTypeB(HIP_R_32F)
         , mCurrentAllocByte(0)
     {
     }
@@ -53,31 +54,38 @@ namespace hiptensor
         , mHostA(std::move(rhs.mHostA))
         , mHostB(std::move(rhs.mHostB))
         , mCurrentMatrixElement(rhs.mCurrentMatrixElement)
-        , mCurrentDataType(rhs.mCurrentDataType)
+        , mCurrentDataTypeA(rhs.mCurrentDataTypeA)
+        , mCurrentDataTypeB(rhs.mCurrentDataTypeB)
         , mCurrentAllocByte(rhs.mCurrentAllocByte)
     {
     }
 
-    void PermutationResource::setupStorage(ProblemDims const& dimSizes, hipDataType dataType)
+    void PermutationResource::setupStorage(ProblemDims const& dimSizes,
+                                           hipDataType        dataTypeA,
+                                           hipDataType        dataTypeB)
     {
+        // A and B share the allocation size of the wider data type
         auto requiredElementCount = getProduct(dimSizes);
-        auto requiredMemorySize   = requiredElementCount * hipDataTypeSize(dataType);
+        auto requiredMemorySize
+            = requiredElementCount
+              * std::max(hipDataTypeSize(dataTypeA), hipDataTypeSize(dataTypeB));
 
         bool needFillData = false;
         if(requiredMemorySize > mCurrentAllocByte)
         {
             Base::reallocDeviceHostPair(mDeviceA, mHostA, requiredMemorySize);
             Base::reallocDeviceHostPair(mDeviceB, mHostB, requiredMemorySize);
-            Base::reallocDeviceHostPair(mDeviceReference, mHostReference, requiredMemorySize);
+            Base::reallocHost(mHostReference, requiredMemorySize);
             mCurrentAllocByte = requiredMemorySize;
             needFillData      = true;
         }
-        if(mCurrentDataType != dataType || mCurrentMatrixElement < requiredElementCount)
+        if(mCurrentDataTypeA != dataTypeA || mCurrentMatrixElement < requiredElementCount)
         {
             needFillData = true;
         }
         mCurrentMatrixElement = requiredElementCount;
-        mCurrentDataType      = dataType;
+        mCurrentDataTypeA     = dataTypeA;
+        mCurrentDataTypeB     = dataTypeB;
         if(needFillData)
         {
             fillRandToA();
@@ -88,25 +96,48 @@ namespace hiptensor
     {
         Base::reallocDeviceHostPair(mDeviceA, mHostA, 0);
         Base::reallocDeviceHostPair(mDeviceB, mHostB, 0);
-        Base::reallocDeviceHostPair(mDeviceReference, mHostReference, 0);
+        Base::reallocHost(mHostReference, 0);
         mCurrentMatrixElement = 0;
-        mCurrentDataType      = HIP_R_32F;
+        mCurrentDataTypeA     = HIP_R_32F;
+        mCurrentDataTypeB     = HIP_R_32F;
         mCurrentAllocByte     = 0;
     }
 
     void PermutationResource::fillRandToA()
     {
-        uint32_t seed = static_cast<uint32_t>(256);
-        
-        if(mCurrentDataType == HIP_R_32F)
+        uint64_t seed = sInputSeed;
+
+        // The host fill generates the same values, so A is not copied back
+        auto fill = [&](auto typed) {
+            using DataT = decltype(typed);
+            fillLaunchKernel<DataT>((DataT*)deviceA().get(), mCurrentMatrixElement, seed);
+            fillHost<DataT>((DataT*)hostA().get(), mCurrentMatrixElement, seed);
+        };
+
+        if(mCurrentDataTypeA == HIP_R_16F)
+        {
+            fill(_Float16{});
+        }
+        else if(mCurrentDataTypeA == HIP_R_16BF)
+        {
+            fill(hip_bfloat16{});
+        }
+        else if(mCurrentDataTypeA == HIP_R_32F)
+        {
+            fill(float{});
+        }
+        else if(mCurrentDataTypeA == HIP_R_64F)
         {
-            fillLaunchKernel<float>((float*)deviceA().get(), mCurrentMatrixElement, seed);
+            fill(double{});
         }
-        else
+        else if(mCurrentDataTypeA == HIP_C_32F)
         {
-            fillLaunchKernel<_Float16>((_Float16*)deviceA().get(), mCurrentMatrixElement, seed);
+            fill(hipFloatComplex{});
+        }
+        else if(mCurrentDataTypeA == HIP_C_64F)
+        {
+            fill(hipDoubleComplex{});
         }
-        Base::copyData(hostA(), deviceA(), getCurrentMatrixMemorySize());
     }
 
     void PermutationResource::copyBToHost()
@@ -114,11 +145,6 @@ namespace hiptensor
         Base::copyData(hostB(), deviceB(), getCurrentMatrixMemorySize());
     }
 
-    void PermutationResource::copyReferenceToDevice()
-    {
-        Base::copyData(deviceReference(), hostReference(), getCurrentMatrixMemorySize());
-    }
-
     size_t PermutationResource::getCurrentMatrixElement() const
     {
         return mCurrentMatrixElement;
@@ -126,7 +152,7 @@ namespace hiptensor
 
     size_t PermutationResource::getCurrentMatrixMemorySize() const
     {
-        return mCurrentMatrixElement * hipDataTypeSize(mCurrentDataType);
+        return mCurrentMatrixElement * hipDataTypeSize(mCurrentDataTypeB);
     }
 
     auto PermutationResource::hostA() -> HostPtrT&
@@ -153,11 +179,6 @@ namespace hiptensor
     {
         return mDeviceB;
     }
-
-    auto PermutationResource::deviceReference() -> DevicePtrT&
-    {
-        return mDeviceReference;
-    }
 } // namespace hiptensor
 
 #endif // HIPTENSOR_PERMUTATION_RESOURCE_IMPL_HPP
@@ -62,6 +62,9 @@ namespace hiptensor
         // N, C, W, H
         using ProblemDims = std::vector<std::size_t>;
 
+        // Seed of the random input, part of the golden-result cache key
+        static constexpr uint32_t sInputSeed = 256;
+
     private: // No public instantiation except make_unique.
              // No copy
         PermutationResource();
@@ -72,10 +75,11 @@ namespace hiptensor
         PermutationResource(PermutationResource&&);
         virtual ~PermutationResource() = default;
 
-        void setupStorage(ProblemDims const& dimSizes, hipDataType dataType);
+        void setupStorage(ProblemDims const& dimSizes,
+                          hipDataType        dataTypeA,
+                          hipDataType        dataTypeB);
         void fillRandToA();
         void copyBToHost();
-        void copyReferenceToDevice();
 
         HostPtrT& hostA();
         HostPtrT& hostB();
@@ -83,19 +87,18 @@ namespace hiptensor
 
         DevicePtrT& deviceA();
         DevicePtrT& deviceB();
-        DevicePtrT& deviceReference();
 
         size_t getCurrentMatrixElement() const;
-        size_t getCurrentMatrixMemorySize() const;
+        size_t getCurrentMatrixMemorySize() const; // Bytes of B
         void   reset() final;
 
     protected:
-        DevicePtrT mDeviceA, mDeviceB, mDeviceReference;
+        DevicePtrT mDeviceA, mDeviceB;
         HostPtrT   mHostA, mHostB, mHostReference;
 
-        size_t mCurrentMatrixElement; /**< Element count of A/B */
-        hipDataType
-            mCurrentDataType; /**< Type size of element of A/B, only support HIP_R_16F, HIP_R_32F */
+        size_t      mCurrentMatrixElement; /**< Element count of A/B */
+        hipDataType mCurrentDataTypeA; /**< Data type of A */
+        hipDataType mCurrentDataTypeB; /**< Data type of B */
         size_t mCurrentAllocByte; /**< Allocated size of memory */
     };
 
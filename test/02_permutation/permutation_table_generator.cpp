@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Measures the registered permutation instances over the bucketed problem sizes
+// of a rank, and prints the fastest instance of each problem as entries of the
+// instance lookup tables in permutation_instance_selection.cpp.
+//
+// Usage: permutation_table_generator <rank> <f16|f32> [cold runs] [hot runs]
+//
+// For ranks 5 and 6, only the permutations that can not be folded to a lower
+// rank are measured, since the others select through the lower rank tables.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "data_types.hpp"
+#include "hiptensor_options.hpp"
+#include "permutation/permutation_instance_selection.hpp"
+#include "permutation/permutation_solution.hpp"
+#include "permutation/permutation_solution_instances.hpp"
+#include "util.hpp"
+#include "utils.hpp"
+
+namespace
+{
+    // Largest problem measured, in elements
+    constexpr std::size_t MaxElements = std::size_t(1) << 26;
+
+    // Calls f with every combination of the edges as lengths, up to MaxElements,
+    // in the order of the table keys
+    template <typename Func>
+    void forEachLengths(std::size_t const* edges, std::size_t edgeCount, int rank, Func&& f)
+    {
+        std::vector<std::size_t> index(rank, 0);
+        while(true)
+        {
+            std::vector<std::size_t> lengths(rank);
+            std::size_t              elements = 1;
+            for(int i = 0; i < rank; i++)
+            {
+                lengths[i] = edges[index[i]];
+                elements *= lengths[i];
+            }
+            if(elements <= MaxElements)
+            {
+                f(lengths);
+            }
+
+            int i = rank - 1;
+            while(i >= 0 && ++index[i] == edgeCount)
+            {
+                index[i--] = 0;
+            }
+            if(i < 0)
+            {
+                return;
+            }
+        }
+    }
+
+    // Table entry of a kernel type string "NumDim_Block_M0B_M1B_M0T_M1T_o0_o1_in_out"
+    std::string tableParams(std::string const& kernelName)
+    {
+        std::vector<std::string> fields;
+        std::stringstream        ss(kernelName);
+        for(std::string field; std::getline(ss, field, '_');)
+        {
+            fields.push_back(field);
+        }
+        if(fields.size() != 10)
+        {
+            return "{" + kernelName + "}";
+        }
+
+        return "{" + fields[1] + " , " + fields[2] + " , " + fields[3] + " , " + fields[4] + " , "
+               + fields[5] + " , {" + fields[6] + " , " + fields[7] + "} , " + fields[8] + " , "
+               + fields[9] + "}";
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        std::fprintf(stderr, "Usage: %s <rank> <f16|f32> [cold runs] [hot runs]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int  rank = std::atoi(argv[1]);
+    auto type = std::strcmp(argv[2], "f16") == 0 ? HIP_R_16F : HIP_R_32F;
+    int  cold = argc > 3 ? std::atoi(argv[3]) : 5;
+    int  hot  = argc > 4 ? std::atoi(argv[4]) : 50;
+
+    auto [edges, edgeCount] = hiptensor::instanceTableEdges(rank);
+    if(edges == nullptr)
+    {
+        std::fprintf(stderr, "Rank %d has no instance table\n", rank);
+        return EXIT_FAILURE;
+    }
+
+    auto& instances  = hiptensor::PermutationSolutionInstances::instance();
+    auto  candidates = instances->query(type,
+                                        type,
+                                        HIPTENSOR_OP_IDENTITY,
+                                        HIPTENSOR_OP_IDENTITY,
+                                        hiptensor::PermutationOpId_t::SCALE,
+                                        rank);
+    if(candidates.empty())
+    {
+        std::fprintf(stderr, "No instances of rank %d for %s\n", rank, argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    auto  elementBytes = hiptensor::hipDataTypeSize(type);
+    void* A            = nullptr;
+    void* B            = nullptr;
+    CHECK_HIP_ERROR(hipMalloc(&A, MaxElements * elementBytes));
+    CHECK_HIP_ERROR(hipMalloc(&B, MaxElements * elementBytes));
+    CHECK_HIP_ERROR(hipMemset(A, 0, MaxElements * elementBytes));
+
+    bool  colMajor = hiptensor::HiptensorOptions::instance()->isColMajorStrides();
+    float alpha    = 2.0F;
+
+    std::vector<int32_t> modeA(rank);
+    std::iota(modeA.begin(), modeA.end(), 0);
+    auto typeName = hiptensor::hipTypeToString(type);
+
+    forEachLengths(edges, edgeCount, rank, [&](std::vector<std::size_t> const& aLengths) {
+        auto aStrides = hiptensor::stridesFromLengths(aLengths, colMajor);
+
+        // outputMode holds the mode of A at each position of B
+        std::vector<int32_t> outputMode = modeA;
+        do
+        {
+            if(rank >= 5)
+            {
+                std::vector<std::size_t> foldedLengths;
+                std::vector<int32_t>     foldedOutputMode;
+                hiptensor::foldModes(aLengths, outputMode, foldedLengths, foldedOutputMode);
+                if(foldedLengths.size() < std::size_t(rank))
+                {
+                    continue;
+                }
+            }
+
+            std::vector<std::size_t> bLengths(rank);
+            for(int i = 0; i < rank; i++)
+            {
+                bLengths[i] = aLengths[outputMode[i]];
+            }
+            auto bStrides = hiptensor::stridesFromLengths(bLengths, colMajor);
+
+            float       bestTime = 0.0F;
+            std::string bestName;
+            for(auto* solution : candidates)
+            {
+                if(!solution->initArgs(&alpha,
+                                       A,
+                                       B,
+                                       aLengths,
+                                       aStrides,
+                                       modeA.data(),
+                                       bLengths,
+                                       bStrides,
+                                       outputMode.data(),
+                                       HIP_R_32F))
+                {
+                    continue;
+                }
+
+                auto time = (*solution)(StreamConfig{nullptr, true, 0, cold, hot});
+                if(bestName.empty() || time < bestTime)
+                {
+                    bestTime = time;
+                    bestName = solution->kernelName();
+                }
+            }
+
+            if(bestName.empty())
+            {
+                continue;
+            }
+
+            std::string key = typeName;
+            for(auto length : aLengths)
+            {
+                key += "_" + std::to_string(length);
+            }
+            for(auto mode : outputMode)
+            {
+                key += "_" + std::to_string(mode);
+            }
+            std::printf("        {\"%s\" , %s} ,\n", key.c_str(), tableParams(bestName).c_str());
+        } while(std::next_permutation(outputMode.begin(), outputMode.end()));
+    });
+
+    HIPTENSOR_FREE_DEVICE(A);
+    HIPTENSOR_FREE_DEVICE(B);
+
+    return EXIT_SUCCESS;
+}
@@ -23,13 +23,17 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <cstring>
+
 #include <hiptensor/hiptensor.hpp>
 
 #include "data_types.hpp"
+#include "golden_cache.hpp"
 #include "hiptensor_options.hpp"
 #include "logger.hpp"
 #include "permutation/permutation_cpu_reference.hpp"
 #include "permutation_test.hpp"
+#include "util.hpp"
 #include "utils.hpp"
 
 namespace hiptensor
@@ -42,6 +46,14 @@ namespace hiptensor
         PermutationTest::sAPILogBuff << msg;
     }
 
+    // Lengths with the leading dimension padded, in the layout of the test options
+    static std::vector<int64_t> paddedLengths(std::vector<int64_t> lengths, std::size_t padding)
+    {
+        auto& testOptions = HiptensorOptions::instance();
+        lengths[testOptions->isColMajorStrides() ? 0 : lengths.size() - 1] += padding;
+        return lengths;
+    }
+
     PermutationTest::PermutationTest()
         : Base()
     {
@@ -57,7 +69,10 @@ namespace hiptensor
     // False = skip test
     bool PermutationTest::checkDevice(hipDataType datatype) const
     {
-        return isF32Supported() && ((datatype == HIP_R_32F) || (datatype == HIP_R_16F));
+        return (isF32Supported()
+                && (datatype == HIP_R_32F || datatype == HIP_R_16F || datatype == HIP_R_16BF
+                    || datatype == HIP_C_32F))
+               || (isF64Supported() && (datatype == HIP_R_64F || datatype == HIP_C_64F));
     }
 
     bool PermutationTest::checkSizes() const
@@ -79,9 +94,9 @@ namespace hiptensor
 
     std::ostream& PermutationTest::printHeader(std::ostream& stream /* = std::cout */) const
     {
-        return stream << "TypeIn, TypeCompute, "
+        return stream << "TypeIn, TypeOut, TypeCompute, "
                       << "Operators             , LogLevel, "
-                      << "Lengths, PermutedOrder, "
+                      << "Lengths, PermutedOrder, Padding, "
                       << "Alpha, elapsedMs, "
                       << "Problem Size(GFlops), "
                       << "TFlops/s, "
@@ -98,9 +113,11 @@ namespace hiptensor
         auto permutedDims = std::get<3>(param);
         auto alpha        = std::get<4>(param);
         auto operators    = std::get<5>(param);
+        auto padding      = std::get<6>(param);
 
-        stream << hipTypeToString(testType[0]) << ", "
-               << computeTypeToString(convertToComputeType(testType[1])) << ", "
+        stream << hipTypeToString(testType.front()) << ", "
+               << hipTypeToString(testType.size() == 3 ? testType[1] : testType.front()) << ", "
+               << computeTypeToString(convertToComputeType(testType.back())) << ", "
                << opTypeToString(operators[0]) << ", " << opTypeToString(operators[1]) << ", "
                << logLevelToString(logLevel) << ", [";
 
@@ -125,7 +142,7 @@ namespace hiptensor
                 stream << permutedDims[i];
             }
         }
-        stream << "], " << alpha << ", ";
+        stream << "], [" << padding[0] << ", " << padding[1] << "], " << alpha << ", ";
 
         if(!mRunFlag)
         {
@@ -177,19 +194,23 @@ namespace hiptensor
         auto permutedDims = std::get<3>(param);
         auto alpha        = std::get<4>(param);
         auto operators    = std::get<5>(param);
+        auto padding      = std::get<6>(param);
 
         EXPECT_TRUE((lengths.size() > 1) && (lengths.size() <= 6));
         EXPECT_TRUE((permutedDims.size() > 1) && (permutedDims.size() <= 6));
 
+        EXPECT_EQ(padding.size(), 2); // Leading dimension padding of A and B
+
         EXPECT_EQ(operators.size(), 2); // HIPTENSOR_OP_IDENTITY or HIPTENSOR_OP_SQRT
         auto op = operators[0];
         EXPECT_TRUE((op == HIPTENSOR_OP_IDENTITY) || (op == HIPTENSOR_OP_SQRT));
 
-        EXPECT_EQ(dataTypes.size(), 2); // HIP_R_16F or HIP_R_32F
-        auto abDataType = dataTypes[0];
-        EXPECT_TRUE((abDataType == HIP_R_16F) || (abDataType == HIP_R_32F));
+        // [A/B, alpha] or [A, B, alpha]
+        EXPECT_TRUE((dataTypes.size() == 2) || (dataTypes.size() == 3));
+        auto aDataType = dataTypes.front();
+        auto bDataType = dataTypes.size() == 3 ? dataTypes[1] : aDataType;
 
-        mRunFlag &= checkDevice(abDataType);
+        mRunFlag &= checkDevice(aDataType) && checkDevice(bDataType);
 
         if(!mRunFlag)
         {
@@ -197,7 +218,17 @@ namespace hiptensor
         }
         else
         {
-            getResource()->setupStorage(lengths, abDataType);
+            // Padded tensors span more elements than the problem has
+            std::vector<int64_t> lengthsA(lengths.cbegin(), lengths.cend());
+            std::vector<int64_t> lengthsB;
+            for(auto dim : permutedDims)
+            {
+                lengthsB.push_back(lengthsA[dim]);
+            }
+            auto elements = std::max(getProduct(paddedLengths(lengthsA, padding[0])),
+                                     getProduct(paddedLengths(lengthsB, padding[1])));
+
+            getResource()->setupStorage({std::size_t(elements)}, aDataType, bDataType);
 
             // set mPrintElements to true to print element
             mPrintElements = false;
@@ -205,7 +236,8 @@ namespace hiptensor
     }
 
     void PermutationTest::reportResults(std::ostream& stream,
-                                        hipDataType   dataType,
+                                        hipDataType   aDataType,
+                                        hipDataType   bDataType,
                                         bool          omitHeader,
                                         bool          omitSkipped,
                                         bool          omitFailed,
@@ -228,33 +260,35 @@ namespace hiptensor
             {
                 auto resource = getResource();
 
-                size_t elementsA = resource->getCurrentMatrixElement();
-                size_t elementsB = elementsA;
-
-                if(dataType == HIP_R_32F)
-                {
-                    stream << "Tensor A elements (" << elementsA << "):\n";
-                    hiptensorPrintArrayElements<float>(
-                        stream, (float*)resource->hostA().get(), elementsA);
+                size_t elements = resource->getCurrentMatrixElement();
+
+                // Complex elements are printed as their real and imaginary parts
+                auto printElements = [&](const char* name, hipDataType dataType, void* data) {
+                    stream << "Tensor " << name << " elements (" << elements << "):\n";
+                    if(dataType == HIP_R_16F)
+                    {
+                        hiptensorPrintArrayElements<_Float16>(stream, (_Float16*)data, elements);
+                    }
+                    else if(dataType == HIP_R_16BF)
+                    {
+                        hiptensorPrintArrayElements<hip_bfloat16>(
+                            stream, (hip_bfloat16*)data, elements);
+                    }
+                    else if(dataType == HIP_R_32F || dataType == HIP_C_32F)
+                    {
+                        hiptensorPrintArrayElements<float>(
+                            stream, (float*)data, elements * (dataType == HIP_C_32F ? 2 : 1));
+                    }
+                    else
+                    {
+                        hiptensorPrintArrayElements<double>(
+                            stream, (double*)data, elements * (dataType == HIP_C_64F ? 2 : 1));
+                    }
                     stream << std::endl;
+                };
 
-                    stream << "Tensor B elements (" << elementsB << "):\n";
-                    hiptensorPrintArrayElements<float>(
-                        stream, (float*)resource->hostB().get(), elementsB);
-                    stream << std::endl;
-                }
-                else
-                {
-                    stream << "Tensor A elements (" << elementsA << "):\n";
-                    hiptensorPrintArrayElements<_Float16>(
-                        stream, (_Float16*)resource->hostA().get(), elementsA);
-                    stream << std::endl;
-
-                    stream << "Tensor B elements (" << elementsB << "):\n";
-                    hiptensorPrintArrayElements<_Float16>(
-                        stream, (_Float16*)resource->hostB().get(), elementsB);
-                    stream << std::endl;
-                }
+                printElements("A", aDataType, resource->hostA().get());
+                printElements("B", bDataType, resource->hostB().get());
             }
         }
     }
@@ -268,9 +302,12 @@ namespace hiptensor
         auto permutedDims = std::get<3>(param);
         auto alpha        = std::get<4>(param);
         auto operators    = std::get<5>(param);
+        auto padding      = std::get<6>(param);
 
-        auto abDataType      = dataTypes[0];
-        auto computeDataType = dataTypes[1];
+        // [A/B, alpha] or [A, B, alpha]
+        auto aDataType       = dataTypes.front();
+        auto bDataType       = dataTypes.size() == 3 ? dataTypes[1] : aDataType;
+        auto computeDataType = dataTypes.back();
 
         auto Aop = operators[0];
         auto Bop = operators[1];
@@ -313,23 +350,61 @@ namespace hiptensor
             for(auto mode : modeB)
                 extentB.push_back(extent[mode]);
 
+            // Padded leading dimensions, packed otherwise
+            auto& testOptions = HiptensorOptions::instance();
+            bool  colMajor    = testOptions->isColMajorStrides();
+            bool  padded      = padding[0] != 0 || padding[1] != 0;
+            auto  strideA     = stridesFromLengths(paddedLengths(extentA, padding[0]), colMajor);
+            auto  strideB     = stridesFromLengths(paddedLengths(extentB, padding[1]), colMajor);
+
             hiptensorStatus_t  err;
             hiptensorHandle_t* handle;
             CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
 
             hiptensorTensorDescriptor_t descA;
-            CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
-                handle, &descA, nmodeA, extentA.data(), NULL /* stride */, abDataType, Aop));
+            CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(handle,
+                                                                &descA,
+                                                                nmodeA,
+                                                                extentA.data(),
+                                                                padded ? strideA.data() : NULL,
+                                                                aDataType,
+                                                                Aop));
 
             hiptensorTensorDescriptor_t descB;
-            CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
-                handle, &descB, nmodeB, extentB.data(), NULL /* stride */, abDataType, Bop));
+            CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(handle,
+                                                                &descB,
+                                                                nmodeB,
+                                                                extentB.data(),
+                                                                padded ? strideB.data() : NULL,
+                                                                bDataType,
+                                                                Bop));
+
+            // The padding of B is never written, so it is cleared for validation
+            if(padded)
+            {
+                CHECK_HIP_ERROR(hipMemset(
+                    resource->deviceB().get(), 0, resource->getCurrentMatrixMemorySize()));
+            }
 
-            float alphaValue{};
+            // Large enough for alpha of any scalar type
+            hipDoubleComplex alphaValue{};
             if(computeDataType == HIP_R_16F)
             {
                 *(reinterpret_cast<_Float16*>(&alphaValue)) = static_cast<_Float16>(alpha);
             }
+            else if(computeDataType == HIP_R_64F)
+            {
+                *(reinterpret_cast<double*>(&alphaValue)) = static_cast<double>(alpha);
+            }
+            else if(computeDataType == HIP_C_32F)
+            {
+                *(reinterpret_cast<hipFloatComplex*>(&alphaValue))
+                    = make_hipFloatComplex(static_cast<float>(alpha), 0.0F);
+            }
+            else if(computeDataType == HIP_C_64F)
+            {
+                alphaValue = make_hipDoubleComplex(static_cast<double>(alpha), 0.0);
+            }
             else
             {
                 *(reinterpret_cast<float*>(&alphaValue)) = static_cast<float>(alpha);
@@ -340,16 +415,23 @@ namespace hiptensor
             CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
             CHECK_HIP_ERROR(hipEventRecord(startEvent));
 
-            CHECK_HIPTENSOR_ERROR(hiptensorPermutation(handle,
-                                                       &alphaValue,
-                                                       resource->deviceA().get(),
-                                                       &descA,
-                                                       modeA.data(),
-                                                       resource->deviceB().get(),
-                                                       &descB,
-                                                       modeB.data(),
-                                                       computeDataType,
-                                                       0 /* stream */));
+            auto status = hiptensorPermutation(handle,
+                                               &alphaValue,
+                                               resource->deviceA().get(),
+                                               &descA,
+                                               modeA.data(),
+                                               resource->deviceB().get(),
+                                               &descB,
+                                               modeB.data(),
+                                               computeDataType,
+                                               0 /* stream */);
+            if(status == HIPTENSOR_STATUS_NOT_SUPPORTED)
+            {
+                // Kernels for this problem were excluded by the kernel manifest
+                mRunFlag = false;
+                GTEST_SKIP();
+            }
+            CHECK_HIPTENSOR_ERROR(status);
 
             CHECK_HIP_ERROR(hipEventRecord(stopEvent));
             CHECK_HIP_ERROR(hipEventSynchronize(stopEvent))
@@ -359,16 +441,16 @@ namespace hiptensor
 
             size_t sizeA = std::accumulate(extentA.begin(),
                                            extentA.end(),
-                                           hipDataTypeSize(abDataType),
+                                           hipDataTypeSize(aDataType),
                                            std::multiplies<size_t>());
 
             size_t sizeB = std::accumulate(extentB.begin(),
                                            extentB.end(),
-                                           hipDataTypeSize(abDataType),
+                                           hipDataTypeSize(bDataType),
                                            std::multiplies<size_t>());
 
             mElapsedTimeMs        = float64_t(timeMs);
-            mTotalGFlops          = 2.0 * ((sizeA * sizeB) / hipDataTypeSize(abDataType));
+            mTotalGFlops          = 2.0 * ((sizeA * sizeB) / hipDataTypeSize(bDataType));
             mMeasuredTFlopsPerSec = mTotalGFlops / mElapsedTimeMs;
 
             mTotalBytes = sizeA + sizeB;
@@ -379,57 +461,176 @@ namespace hiptensor
 
             resource->copyBToHost();
 
-            auto& testOptions = HiptensorOptions::instance();
-
             if(testOptions->performValidation())
             {
                 resource->copyBToHost();
 
-                if(abDataType == HIP_R_32F)
-                {
+                // The reference depends only on the problem and the seeded input
+                auto& goldenCache = GoldenCache::instance();
+                auto  key         = GoldenKey("permutation");
+                key.add(PermutationResource::sInputSeed)
+                    .add(extentA)
+                    .add(modeA)
+                    .add(modeB)
+                    .add(aDataType)
+                    .add(bDataType)
+                    .add(computeDataType)
+                    .add(Aop)
+                    .add(Bop)
+                    .add(alpha)
+                    .add(padding);
+                auto referenceBytes = resource->getCurrentMatrixMemorySize();
+                std::memset(resource->hostReference().get(), 0, referenceBytes);
+
+                ValidationStats stats{};
+
+                goldenCache->fetch(key, resource->hostReference().get(), referenceBytes, [&]() {
                     CHECK_HIPTENSOR_ERROR(
                         hiptensorPermutationReference(handle,
                                                       &alphaValue,
-                                                      (const float*)resource->hostA().get(),
+                                                      resource->hostA().get(),
                                                       &descA,
                                                       modeA.data(),
-                                                      (float*)resource->hostReference().get(),
+                                                      resource->hostReference().get(),
                                                       &descB,
                                                       modeB.data(),
                                                       computeDataType,
                                                       0 /* stream */));
-
-                    resource->copyReferenceToDevice();
-                    std::tie(mValidationResult, mMaxRelativeError)
-                        = compareEqualLaunchKernel<float>((float*)resource->deviceB().get(),
-                                                          (float*)resource->deviceReference().get(),
-                                                          resource->getCurrentMatrixElement(),
-                                                          convertToComputeType(computeDataType));
-                }
-                else if(abDataType == HIP_R_16F)
+                });
+
+                // Conversions to bf16 may round differently in the flat kernels
+                double tolerance = bDataType == HIP_R_16BF ? 2 * std::pow(2, -7) : 0.0;
+
+                // Compare complex data as reals
+                auto compareB = [&]() {
+                    auto validate = [&](auto typed) {
+                        using DataT = decltype(typed);
+                        return compareEqualStreamLaunchKernel(
+                            (DataT const*)resource->deviceB().get(),
+                            (DataT const*)resource->hostReference().get(),
+                            resource->getCurrentMatrixMemorySize() / sizeof(DataT),
+                            convertToComputeType(computeDataType),
+                            tolerance);
+                    };
+
+                    if(bDataType == HIP_R_16F)
+                    {
+                        return validate(_Float16{});
+                    }
+                    else if(bDataType == HIP_R_16BF)
+                    {
+                        return validate(hip_bfloat16{});
+                    }
+                    else if(bDataType == HIP_R_32F || bDataType == HIP_C_32F)
+                    {
+                        return validate(float{});
+                    }
+                    return validate(double{});
+                };
+
+                stats             = compareB();
+                mValidationResult = stats.mPassed;
+                mMaxRelativeError = stats.mMaxRelativeError;
+
+                EXPECT_TRUE(mValidationResult) << validationReport(stats, extentB, strideB);
+
+                // A plan executed against the cleared output must reproduce the result
+                hiptensorPermutationPlan_t plan;
+                CHECK_HIPTENSOR_ERROR(hiptensorInitPermutationPlan(
+                    handle, &plan, &descA, modeA.data(), &descB, modeB.data(), computeDataType));
+
+                CHECK_HIP_ERROR(hipMemset(
+                    resource->deviceB().get(), 0, resource->getCurrentMatrixMemorySize()));
+                CHECK_HIPTENSOR_ERROR(hiptensorPermutationExecute(handle,
+                                                                  &plan,
+                                                                  &alphaValue,
+                                                                  resource->deviceA().get(),
+                                                                  resource->deviceB().get(),
+                                                                  0 /* stream */));
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+                stats = compareB();
+                mValidationResult &= stats.mPassed;
+                EXPECT_TRUE(stats.mPassed) << "Plan: " << validationReport(stats, extentB, strideB);
+
+                // Tensors offset by one element into their allocations are not aligned for
+                // the vectors of the plan, which then runs with scalar accesses
+                auto  bytesA     = resource->getCurrentMatrixElement() * hipDataTypeSize(aDataType);
+                auto  bytesB     = resource->getCurrentMatrixMemorySize();
+                char* unalignedA = nullptr;
+                char* unalignedB = nullptr;
+                CHECK_HIP_ERROR(hipMalloc(&unalignedA, bytesA + hipDataTypeSize(aDataType)));
+                CHECK_HIP_ERROR(hipMalloc(&unalignedB, bytesB + hipDataTypeSize(bDataType)));
+                auto offsetA = unalignedA + hipDataTypeSize(aDataType);
+                auto offsetB = unalignedB + hipDataTypeSize(bDataType);
+
+                CHECK_HIP_ERROR(hipMemcpy(
+                    offsetA, resource->deviceA().get(), bytesA, hipMemcpyDeviceToDevice));
+                CHECK_HIP_ERROR(hipMemset(offsetB, 0, bytesB));
+                CHECK_HIPTENSOR_ERROR(hiptensorPermutationExecute(
+                    handle, &plan, &alphaValue, offsetA, offsetB, 0 /* stream */));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    resource->deviceB().get(), offsetB, bytesB, hipMemcpyDeviceToDevice));
+                CHECK_HIP_ERROR(hipFree(unalignedA));
+                CHECK_HIP_ERROR(hipFree(unalignedB));
+
+                stats = compareB();
+                mValidationResult &= stats.mPassed;
+                EXPECT_TRUE(stats.mPassed)
+                    << "Unaligned plan: " << validationReport(stats, extentB, strideB);
+
+                // Packed tensors of one data type are also permuted in place, without a
+                // workspace, which transposes square matrices or follows the cycles of
+                // the permutation, and with the recommended workspace
+                if(aDataType == bDataType && !padded)
                 {
+                    uint64_t workspaceSize = 0;
                     CHECK_HIPTENSOR_ERROR(
-                        hiptensorPermutationReference(handle,
-                                                      &alphaValue,
-                                                      (const _Float16*)resource->hostA().get(),
-                                                      &descA,
-                                                      modeA.data(),
-                                                      (_Float16*)resource->hostReference().get(),
-                                                      &descB,
-                                                      modeB.data(),
-                                                      computeDataType,
-                                                      0 /* stream */));
-
-                    resource->copyReferenceToDevice();
-
-                    std::tie(mValidationResult, mMaxRelativeError)
-                        = compareEqualLaunchKernel<_Float16>(
-                            (_Float16*)resource->deviceB().get(),
-                            (_Float16*)resource->deviceReference().get(),
-                            resource->getCurrentMatrixElement(),
-                            convertToComputeType(computeDataType));
+                        hiptensorPermutationGetWorkspaceSize(handle,
+                                                             &descA,
+                                                             modeA.data(),
+                                                             &descB,
+                                                             modeB.data(),
+                                                             HIPTENSOR_WORKSPACE_RECOMMENDED,
+                                                             &workspaceSize));
+
+                    void* tensor    = nullptr;
+                    void* workspace = nullptr;
+                    CHECK_HIP_ERROR(hipMalloc(&tensor, bytesB));
+                    if(workspaceSize > 0)
+                    {
+                        CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceSize));
+                    }
+
+                    for(auto size : {uint64_t(0), workspaceSize})
+                    {
+                        CHECK_HIP_ERROR(hipMemcpy(
+                            tensor, resource->deviceA().get(), bytesB, hipMemcpyDeviceToDevice));
+                        CHECK_HIPTENSOR_ERROR(
+                            hiptensorPermutationInPlace(handle,
+                                                        &alphaValue,
+                                                        tensor,
+                                                        &descA,
+                                                        modeA.data(),
+                                                        &descB,
+                                                        modeB.data(),
+                                                        computeDataType,
+                                                        size > 0 ? workspace : nullptr,
+                                                        size,
+                                                        0 /* stream */));
+                        CHECK_HIP_ERROR(hipMemcpy(
+                            resource->deviceB().get(), tensor, bytesB, hipMemcpyDeviceToDevice));
+
+                        stats = compareB();
+                        mValidationResult &= stats.mPassed;
+                        EXPECT_TRUE(stats.mPassed)
+                            << "In place, workspace " << size << ": "
+                            << validationReport(stats, extentB, strideB);
+                    }
+
+                    CHECK_HIP_ERROR(hipFree(tensor));
+                    CHECK_HIP_ERROR(hipFree(workspace));
                 }
-                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
             } // if (testOptions->performValidation())
 
             CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
@@ -441,7 +642,8 @@ namespace hiptensor
         if(!loggingOptions->omitCout())
         {
             reportResults(std::cout,
-                          abDataType,
+                          aDataType,
+                          bDataType,
                           mHeaderPrinted,
                           loggingOptions->omitSkipped(),
                           loggingOptions->omitFailed(),
@@ -451,7 +653,8 @@ namespace hiptensor
         if(loggingOptions->ostream().isOpen())
         {
             reportResults(loggingOptions->ostream().fstream(),
-                          abDataType,
+                          aDataType,
+                          bDataType,
                           mHeaderPrinted,
                           loggingOptions->omitSkipped(),
                           loggingOptions->omitFailed(),
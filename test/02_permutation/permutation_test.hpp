@@ -46,7 +46,8 @@ namespace hiptensor
                                                typename PermutationTestParams::LengthsT,
                                                typename PermutationTestParams::PermutedDimsT,
                                                typename PermutationTestParams::AlphaT,
-                                               typename PermutationTestParams::OperatorT>;
+                                               typename PermutationTestParams::OperatorT,
+                                               typename PermutationTestParams::PaddingT>;
     class PermutationTest : public ::testing::TestWithParam<PermutationTestParams_t>
     {
     protected: // Types
@@ -83,7 +84,8 @@ namespace hiptensor
         void RunKernel();
 
         void reportResults(std::ostream& stream,
-                           hipDataType   DDataType,
+                           hipDataType   aDataType,
+                           hipDataType   bDataType,
                            bool          omitHeader,
                            bool          omitSkipped,
                            bool          omitFailed,
@@ -47,6 +47,7 @@ namespace hiptensor
         using AlphaT        = double;
         using PermutedDimsT = std::vector<std::size_t>;
         using OperatorT     = std::vector<hiptensorOperator_t>;
+        using PaddingT      = std::vector<std::size_t>;
 
     public:
         std::vector<DataTypesT>& dataTypes()
@@ -79,6 +80,11 @@ namespace hiptensor
             return mAlphas;
         }
 
+        std::vector<PaddingT>& paddings()
+        {
+            return mPaddings;
+        }
+
         void printParams()
         {
             std::cout << "DataTypes: " << mDataTypes << "\n"
@@ -86,7 +92,8 @@ namespace hiptensor
                       << "ProblemLengths: " << mProblemLengths << "\n"
                       << "Operators: " << mOperators << "\n"
                       << "Alphas: " << mAlphas << "\n"
-                      << "PermutedDims: " << mPermutedDims << "\n";
+                      << "PermutedDims: " << mPermutedDims << "\n"
+                      << "Paddings: " << mPaddings << "\n";
         }
 
     private:
@@ -97,6 +104,9 @@ namespace hiptensor
         std::vector<AlphaT>        mAlphas;
         std::vector<OperatorT>     mOperators;
         std::vector<PermutedDimsT> mPermutedDims;
+
+        // Elements added to the leading dimension of A and of B
+        std::vector<PaddingT> mPaddings;
     };
 
 } // namespace hiptensor
@@ -96,7 +96,7 @@ namespace hiptensor
         {
             Base::reallocDeviceHostPair(mDeviceC, mHostC, requiredOutputMemorySize);
             Base::reallocDeviceHostPair(mDeviceD, mHostD, requiredOutputMemorySize);
-            Base::reallocDeviceHostPair(mDeviceReference, mHostReference, requiredOutputMemorySize);
+            Base::reallocHost(mHostReference, requiredOutputMemorySize);
             mCurrentOutputAllocByte = requiredOutputMemorySize;
             needFillDataC           = true;
         }
@@ -108,16 +108,14 @@ namespace hiptensor
 
         mCurrentDataType = dataType;
 
-        const uint32_t seedA = 17;
-        const uint32_t seedC = 19;
         if(needFillDataA)
         {
-            fillRand(hostA(), deviceA(), dataType, getCurrentInputElementCount(), seedA);
+            fillRand(hostA(), deviceA(), dataType, getCurrentInputElementCount(), sSeedA);
         }
 
         if(needFillDataC)
         {
-            fillRand(hostC(), deviceC(), dataType, getCurrentOutputElementCount(), seedC);
+            fillRand(hostC(), deviceC(), dataType, getCurrentOutputElementCount(), sSeedC);
         }
         fillConstant(hostD(), deviceD(), dataType, getCurrentOutputElementCount(), 0);
         copyData(hostReference(), hostD(), getCurrentOutputMemorySize());
@@ -133,7 +131,7 @@ namespace hiptensor
         Base::reallocDeviceHostPair(mDeviceA, mHostA, 0);
         Base::reallocDeviceHostPair(mDeviceC, mHostC, 0);
         Base::reallocDeviceHostPair(mDeviceD, mHostD, 0);
-        Base::reallocDeviceHostPair(mDeviceReference, mHostReference, 0);
+        Base::reallocHost(mHostReference, 0);
         mCurrentDataType           = HIP_R_32F;
         mCurrentInputElementCount  = 0;
         mCurrentInputAllocByte     = 0;
@@ -145,25 +143,31 @@ namespace hiptensor
                                      DevicePtrT& deviceBuf,
                                      hipDataType dataType,
                                      size_t      elementCount,
-                                     uint32_t    seed)
+                                     uint64_t    seed)
     {
+        // The host fill generates the same values, so the buffer is not copied back
+        auto fill = [&](auto typed) {
+            using DataT = decltype(typed);
+            fillLaunchKernel<DataT>((DataT*)deviceBuf.get(), elementCount, seed);
+            fillHost<DataT>((DataT*)hostBuf.get(), elementCount, seed);
+        };
+
         if(dataType == HIP_R_16F)
         {
-            fillLaunchKernel<float16_t>((float16_t*)deviceBuf.get(), elementCount, seed);
+            fill(float16_t{});
         }
         else if(dataType == HIP_R_16BF)
         {
-            fillLaunchKernel<bfloat16_t>((bfloat16_t*)deviceBuf.get(), elementCount, seed);
+            fill(bfloat16_t{});
         }
         else if(dataType == HIP_R_32F)
         {
-            fillLaunchKernel<float32_t>((float32_t*)deviceBuf.get(), elementCount, seed);
+            fill(float32_t{});
         }
         else if(dataType == HIP_R_64F)
         {
-            fillLaunchKernel<float64_t>((float64_t*)deviceBuf.get(), elementCount, seed);
+            fill(float64_t{});
         }
-        Base::copyData(hostBuf, deviceBuf, elementCount * hipDataTypeSize(dataType));
     }
 
     void ReductionResource::fillConstant(HostPtrT&   hostBuf,
@@ -172,27 +176,28 @@ namespace hiptensor
                                          size_t      elementCount,
                                          double      value)
     {
+        auto fill = [&](auto typed) {
+            using DataT = decltype(typed);
+            fillValLaunchKernel<DataT>((DataT*)deviceBuf.get(), elementCount, (DataT)value);
+            fillValHost<DataT>((DataT*)hostBuf.get(), elementCount, (DataT)value);
+        };
+
         if(dataType == HIP_R_16F)
         {
-            fillValLaunchKernel<float16_t>(
-                (float16_t*)deviceBuf.get(), elementCount, (float16_t)value);
+            fill(float16_t{});
         }
         else if(dataType == HIP_R_16BF)
         {
-            fillValLaunchKernel<bfloat16_t>(
-                (bfloat16_t*)deviceBuf.get(), elementCount, (bfloat16_t)value);
+            fill(bfloat16_t{});
         }
         else if(dataType == HIP_R_32F)
         {
-            fillValLaunchKernel<float32_t>(
-                (float32_t*)deviceBuf.get(), elementCount, (float32_t)value);
+            fill(float32_t{});
         }
         else if(dataType == HIP_R_64F)
         {
-            fillValLaunchKernel<float64_t>(
-                (float64_t*)deviceBuf.get(), elementCount, (float64_t)value);
+            fill(float64_t{});
         }
-        Base::copyData(hostBuf, deviceBuf, elementCount * hipDataTypeSize(dataType));
     }
 
     void ReductionResource::copyOutputToHost()
@@ -200,11 +205,6 @@ namespace hiptensor
         Base::copyData(hostD(), deviceD(), getCurrentOutputMemorySize());
     }
 
-    void ReductionResource::copyReferenceToDevice()
-    {
-        Base::copyData(deviceReference(), hostReference(), getCurrentOutputMemorySize());
-    }
-
     size_t ReductionResource::getCurrentInputElementCount() const
     {
         return mCurrentInputElementCount;
@@ -260,11 +260,6 @@ namespace hiptensor
         return mDeviceD;
     }
 
-    auto ReductionResource::deviceReference() -> DevicePtrT&
-    {
-        return mDeviceReference;
-    }
-
     auto ReductionResource::deviceWorkspace() -> DevicePtrT&
     {
         return mDeviceWorkspace;
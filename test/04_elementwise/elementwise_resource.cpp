@@ -0,0 +1,199 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_RESOURCE_IMPL_HPP
+#define HIPTENSOR_ELEMENTWISE_RESOURCE_IMPL_HPP
+
+#include "elementwise_resource.hpp"
+#include "data_types.hpp"
+#include "utils.hpp"
+
+namespace hiptensor
+{
+
+    ElementwiseResource::ElementwiseResource()
+        : HipResource()
+        , mDeviceA(Base::allocDevice(0))
+        , mDeviceB(Base::allocDevice(0))
+        , mDeviceC(Base::allocDevice(0))
+        , mDeviceD(Base::allocDevice(0))
+        , mHostA(Base::allocHost(0))
+        , mHostB(Base::allocHost(0))
+        , mHostC(Base::allocHost(0))
+        , mHostD(Base::allocHost(0))
+        , mHostReference(Base::allocHost(0))
+        , mCurrentMatrixElement(0)
+        , mCurrentDataType(HIP_R_32F)
+        , mCurrentAllocByte(0)
+    {
+    }
+
+    ElementwiseResource::ElementwiseResource(ElementwiseResource&& rhs)
+        : HipResource()
+        , mDeviceA(std::move(rhs.mDeviceA))
+        , mDeviceB(std::move(rhs.mDeviceB))
+        , mDeviceC(std::move(rhs.mDeviceC))
+        , mDeviceD(std::move(rhs.mDeviceD))
+        , mHostA(std::move(rhs.mHostA))
+        , mHostB(std::move(rhs.mHostB))
+        , mHostC(std::move(rhs.mHostC))
+        , mHostD(std::move(rhs.mHostD))
+        , mHostReference(std::move(rhs.mHostReference))
+        , mCurrentMatrixElement(rhs.mCurrentMatrixElement)
+        , mCurrentDataType(rhs.mCurrentDataType)
+        , mCurrentAllocByte(rhs.mCurrentAllocByte)
+    {
+    }
+
+    void ElementwiseResource::setupStorage(std::size_t elementCount, hipDataType dataType)
+    {
+        auto requiredMemorySize = elementCount * hipDataTypeSize(dataType);
+
+        bool needFillData = false;
+        if(requiredMemorySize > mCurrentAllocByte)
+        {
+            Base::reallocDeviceHostPair(mDeviceA, mHostA, requiredMemorySize);
+            Base::reallocDeviceHostPair(mDeviceB, mHostB, requiredMemorySize);
+            Base::reallocDeviceHostPair(mDeviceC, mHostC, requiredMemorySize);
+            Base::reallocDeviceHostPair(mDeviceD, mHostD, requiredMemorySize);
+            Base::reallocHost(mHostReference, requiredMemorySize);
+            mCurrentAllocByte = requiredMemorySize;
+            needFillData      = true;
+        }
+        if(mCurrentDataType != dataType || mCurrentMatrixElement < elementCount)
+        {
+            needFillData = true;
+        }
+        mCurrentMatrixElement = elementCount;
+        mCurrentDataType      = dataType;
+        if(needFillData)
+        {
+            fillRandToInputs();
+        }
+    }
+
+    void ElementwiseResource::reset()
+    {
+        Base::reallocDeviceHostPair(mDeviceA, mHostA, 0);
+        Base::reallocDeviceHostPair(mDeviceB, mHostB, 0);
+        Base::reallocDeviceHostPair(mDeviceC, mHostC, 0);
+        Base::reallocDeviceHostPair(mDeviceD, mHostD, 0);
+        Base::reallocHost(mHostReference, 0);
+        mCurrentMatrixElement = 0;
+        mCurrentDataType      = HIP_R_32F;
+        mCurrentAllocByte     = 0;
+    }
+
+    void ElementwiseResource::fillRandToInputs()
+    {
+        // Non-negative inputs keep HIPTENSOR_OP_SQRT real
+        auto params = InitParams{InitDistribution::UNIFORM, 0.0, 1.0};
+
+        // The host fill generates the same values, so the inputs are not copied back
+        auto fill = [&](auto typed, DevicePtrT& device, HostPtrT& host, uint64_t seed) {
+            using DataT = decltype(typed);
+            fillLaunchKernel<DataT>((DataT*)device.get(), mCurrentMatrixElement, seed, params);
+            fillHost<DataT>((DataT*)host.get(), mCurrentMatrixElement, seed, params);
+        };
+
+        auto fillInputs = [&](auto typed) {
+            fill(typed, deviceA(), hostA(), sInputSeed);
+            fill(typed, deviceB(), hostB(), sInputSeed + 1);
+            fill(typed, deviceC(), hostC(), sInputSeed + 2);
+        };
+
+        if(mCurrentDataType == HIP_R_16F)
+        {
+            fillInputs(_Float16{});
+        }
+        else if(mCurrentDataType == HIP_R_32F)
+        {
+            fillInputs(float{});
+        }
+    }
+
+    void ElementwiseResource::copyDToHost()
+    {
+        Base::copyData(hostD(), deviceD(), getCurrentMatrixMemorySize());
+    }
+
+    size_t ElementwiseResource::getCurrentMatrixElement() const
+    {
+        return mCurrentMatrixElement;
+    }
+
+    size_t ElementwiseResource::getCurrentMatrixMemorySize() const
+    {
+        return mCurrentMatrixElement * hipDataTypeSize(mCurrentDataType);
+    }
+
+    auto ElementwiseResource::hostA() -> HostPtrT&
+    {
+        return mHostA;
+    }
+
+    auto ElementwiseResource::hostB() -> HostPtrT&
+    {
+        return mHostB;
+    }
+
+    auto ElementwiseResource::hostC() -> HostPtrT&
+    {
+        return mHostC;
+    }
+
+    auto ElementwiseResource::hostD() -> HostPtrT&
+    {
+        return mHostD;
+    }
+
+    auto ElementwiseResource::hostReference() -> HostPtrT&
+    {
+        return mHostReference;
+    }
+
+    auto ElementwiseResource::deviceA() -> DevicePtrT&
+    {
+        return mDeviceA;
+    }
+
+    auto ElementwiseResource::deviceB() -> DevicePtrT&
+    {
+        return mDeviceB;
+    }
+
+    auto ElementwiseResource::deviceC() -> DevicePtrT&
+    {
+        return mDeviceC;
+    }
+
+    auto ElementwiseResource::deviceD() -> DevicePtrT&
+    {
+        return mDeviceD;
+    }
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_RESOURCE_IMPL_HPP
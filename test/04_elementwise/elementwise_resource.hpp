@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_RESOURCE_HPP
+#define HIPTENSOR_ELEMENTWISE_RESOURCE_HPP
+
+#include <memory>
+#include <tuple>
+
+#include "hip_resource.hpp"
+#include "singleton.hpp"
+
+// ElementwiseResource class is intended to manage a shared pool of resources for
+// testing hiptensor elementwise kernels on the GPU.
+//
+// It minimizes the memory handling overhead for launching thousands of GPU
+// kernels by allowing re-use of existing memory allocations. Memory is only
+// re-allocated as necessary to satisfy minimum size requirements.
+//
+// The interface indicates memory ownership by this class and shall only be
+// used to access for read/write purposes.
+//
+// Currently uses HIP as the backend for device allocation.
+
+namespace hiptensor
+{
+
+    struct ElementwiseResource : public HipResource, public LazySingleton<ElementwiseResource>
+    {
+        // For static initialization
+        friend std::unique_ptr<ElementwiseResource> std::make_unique<ElementwiseResource>();
+
+        using Base = HipResource;
+
+    public:
+        using DevicePtrT = Base::DevicePtrT;
+        using HostPtrT   = Base::HostPtrT;
+
+        // Seed of the random input A; B and C follow on the next seeds.
+        // Part of the golden-result cache key.
+        static constexpr uint32_t sInputSeed = 512;
+
+    private: // No public instantiation except make_unique.
+             // No copy
+        ElementwiseResource();
+        ElementwiseResource(const ElementwiseResource&)            = delete;
+        ElementwiseResource& operator=(const ElementwiseResource&) = delete;
+
+    public:
+        ElementwiseResource(ElementwiseResource&&);
+        virtual ~ElementwiseResource() = default;
+
+        // All tensors have the same element count and data type
+        void setupStorage(std::size_t elementCount, hipDataType dataType);
+        void fillRandToInputs();
+        void copyDToHost();
+
+        HostPtrT& hostA();
+        HostPtrT& hostB();
+        HostPtrT& hostC();
+        HostPtrT& hostD();
+        HostPtrT& hostReference();
+
+        DevicePtrT& deviceA();
+        DevicePtrT& deviceB();
+        DevicePtrT& deviceC();
+        DevicePtrT& deviceD();
+
+        size_t getCurrentMatrixElement() const;
+        size_t getCurrentMatrixMemorySize() const;
+        void   reset() final;
+
+    protected:
+        DevicePtrT mDeviceA, mDeviceB, mDeviceC, mDeviceD;
+        HostPtrT   mHostA, mHostB, mHostC, mHostD, mHostReference;
+
+        size_t      mCurrentMatrixElement; /**< Element count of each tensor */
+        hipDataType mCurrentDataType; /**< Data type of the tensors */
+        size_t      mCurrentAllocByte; /**< Allocated size of memory */
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_RESOURCE_HPP
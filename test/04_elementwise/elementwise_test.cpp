@@ -0,0 +1,602 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstring>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "data_types.hpp"
+#include "elementwise_test.hpp"
+#include "golden_cache.hpp"
+#include "hiptensor_options.hpp"
+#include "logger.hpp"
+#include "util.hpp"
+#include "utils.hpp"
+
+namespace hiptensor
+{
+    /*static*/ bool              ElementwiseTest::mHeaderPrinted = false;
+    /*static*/ std::stringstream ElementwiseTest::sAPILogBuff    = std::stringstream();
+
+    static void logMessage(int32_t logLevel, const char* funcName /*=""*/, const char* msg /*=""*/)
+    {
+        ElementwiseTest::sAPILogBuff << msg;
+    }
+
+    ElementwiseTest::ElementwiseTest()
+        : Base()
+    {
+        reset();
+
+        // Handle our own outputs
+        hiptensorLoggerOpenFile("/dev/null");
+        hiptensorLoggerSetCallback(logMessage);
+    }
+
+    // Kernel run checks. Virtual as different Elementwise kernels have different requirements
+    // True = run test
+    // False = skip test
+    bool ElementwiseTest::checkDevice(hipDataType datatype) const
+    {
+        return isF32Supported() && (datatype == HIP_R_32F || datatype == HIP_R_16F);
+    }
+
+    bool ElementwiseTest::checkSizes() const
+    {
+        return true;
+    }
+
+    void ElementwiseTest::reset()
+    {
+        handle          = nullptr;
+        referenceHandle = nullptr;
+
+        mRepeats          = 1u;
+        mRunFlag          = true;
+        mValidationResult = false;
+        mMaxRelativeError = 0.0;
+
+        mElapsedTimeMs = mTotalGFlops = mMeasuredTFlopsPerSec = mTotalBytes = 0.0;
+    }
+
+    std::ostream& ElementwiseTest::printHeader(std::ostream& stream /* = std::cout */) const
+    {
+        return stream << "TypeIn, TypeScalar, "
+                      << "UnaryOperators, BinaryOperators, LogLevel, "
+                      << "Lengths, PermutedOrder, "
+                      << "Scalars, elapsedMs, "
+                      << "Problem Size(GFlops), "
+                      << "TFlops/s, "
+                      << "TotalBytes, "
+                      << "Result" << std::endl;
+    }
+
+    std::ostream& ElementwiseTest::printKernel(std::ostream& stream) const
+    {
+        auto param        = Base::GetParam();
+        auto dataTypes    = std::get<0>(param);
+        auto logLevel     = std::get<1>(param);
+        auto lengths      = std::get<2>(param);
+        auto permutedDims = std::get<3>(param);
+        auto scalars      = std::get<4>(param);
+        auto unaryOps     = std::get<5>(param);
+        auto binaryOps    = std::get<6>(param);
+
+        auto printList = [&](auto const& values, auto&& print) {
+            stream << "[";
+            for(int i = 0; i < values.size(); i++)
+            {
+                if(i != 0)
+                {
+                    stream << ", ";
+                }
+                print(values[i]);
+            }
+            stream << "]";
+        };
+        auto printValue = [&](auto value) { stream << value; };
+        auto printOp    = [&](auto op) { stream << opTypeToString(op); };
+
+        stream << hipTypeToString(dataTypes[0]) << ", " << hipTypeToString(dataTypes[1]) << ", ";
+        printList(unaryOps, printOp);
+        stream << ", ";
+        printList(binaryOps, printOp);
+        stream << ", " << logLevelToString(logLevel) << ", ";
+        printList(lengths, printValue);
+        stream << ", ";
+        printList(permutedDims, printValue);
+        stream << ", ";
+        printList(scalars, printValue);
+        stream << ", ";
+
+        if(!mRunFlag)
+        {
+            stream << "n/a"
+                   << ", "
+                   << "n/a"
+                   << ", "
+                   << "n/a"
+                   << ", "
+                   << "n/a"
+                   << ", "
+                   << "SKIPPED" << std::endl;
+        }
+        else
+        {
+
+            stream << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
+                   << ", " << mTotalBytes << ", ";
+
+            auto& testOptions = HiptensorOptions::instance();
+
+            if(testOptions->performValidation())
+            {
+                stream << ((bool)mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+            else
+            {
+                stream << "BENCH" << std::endl;
+            }
+        }
+
+        return stream;
+    }
+
+    ElementwiseResource* ElementwiseTest::getResource() const
+    {
+        return DataStorage::instance().get();
+    }
+
+    void ElementwiseTest::SetUp()
+    {
+        // reset API log buffer
+        sAPILogBuff.str(std::string());
+
+        auto param        = Base::GetParam();
+        auto dataTypes    = std::get<0>(param);
+        auto logLevel     = std::get<1>(param);
+        auto lengths      = std::get<2>(param);
+        auto permutedDims = std::get<3>(param);
+        auto scalars      = std::get<4>(param);
+        auto unaryOps     = std::get<5>(param);
+        auto binaryOps    = std::get<6>(param);
+
+        EXPECT_TRUE((lengths.size() > 1) && (lengths.size() <= 6));
+        EXPECT_EQ(permutedDims.size(), lengths.size());
+
+        // [tensors, scalars]
+        EXPECT_EQ(dataTypes.size(), 2);
+
+        // [alpha, beta, gamma]
+        EXPECT_EQ(scalars.size(), 3);
+
+        // [opA, opB, opC], HIPTENSOR_OP_IDENTITY or HIPTENSOR_OP_SQRT
+        EXPECT_EQ(unaryOps.size(), 3);
+        for(auto op : unaryOps)
+        {
+            EXPECT_TRUE((op == HIPTENSOR_OP_IDENTITY) || (op == HIPTENSOR_OP_SQRT));
+        }
+
+        // [opAC] or [opAB, opABC]
+        EXPECT_TRUE((binaryOps.size() == 1) || (binaryOps.size() == 2));
+
+        auto dataType = dataTypes.front();
+
+        mRunFlag &= checkDevice(dataType);
+
+        if(!mRunFlag)
+        {
+            GTEST_SKIP();
+        }
+        else
+        {
+            getResource()->setupStorage(getProduct(lengths), dataType);
+
+            // set mPrintElements to true to print element
+            mPrintElements = false;
+        }
+    }
+
+    void ElementwiseTest::reportResults(std::ostream& stream,
+                                        hipDataType   dataType,
+                                        bool          omitHeader,
+                                        bool          omitSkipped,
+                                        bool          omitFailed,
+                                        bool          omitPassed) const
+    {
+        if(!omitHeader)
+        {
+            printHeader(stream);
+        }
+
+        // Conditionally print outputs
+        if((mRunFlag || !omitSkipped) && (mValidationResult || !omitFailed)
+           && (!mValidationResult || !omitPassed))
+        {
+            stream << ElementwiseTest::sAPILogBuff.str();
+
+            printKernel(stream);
+
+            if(mPrintElements)
+            {
+                auto resource = getResource();
+
+                size_t elements = resource->getCurrentMatrixElement();
+
+                auto printElements = [&](const char* name, void* data) {
+                    stream << "Tensor " << name << " elements (" << elements << "):\n";
+                    if(dataType == HIP_R_16F)
+                    {
+                        hiptensorPrintArrayElements<_Float16>(stream, (_Float16*)data, elements);
+                    }
+                    else
+                    {
+                        hiptensorPrintArrayElements<float>(stream, (float*)data, elements);
+                    }
+                    stream << std::endl;
+                };
+
+                printElements("A", resource->hostA().get());
+                printElements("B", resource->hostB().get());
+                printElements("C", resource->hostC().get());
+                printElements("D", resource->hostD().get());
+            }
+        }
+    }
+
+    void ElementwiseTest::RunKernel()
+    {
+        auto param        = Base::GetParam();
+        auto dataTypes    = std::get<0>(param);
+        auto logLevel     = std::get<1>(param);
+        auto lengths      = std::get<2>(param);
+        auto permutedDims = std::get<3>(param);
+        auto scalars      = std::get<4>(param);
+        auto unaryOps     = std::get<5>(param);
+        auto binaryOps    = std::get<6>(param);
+
+        // [tensors, scalars]
+        auto dataType   = dataTypes[0];
+        auto scalarType = dataTypes[1];
+        bool trinary    = binaryOps.size() == 2;
+
+        if(!mRunFlag)
+        {
+            GTEST_SKIP();
+        }
+        auto resource = getResource();
+
+        if(mRunFlag)
+        {
+            /**********************
+              D_{n, c, w, h} = opAC(alpha * opA(A_{n, c, w, h}), gamma * opC(C_{w, h, c, n}))
+             **********************/
+
+            int nDim     = lengths.size();
+            int arrDim[] = {'n', 'c', 'w', 'h', 'd', 'm'};
+
+            // A has the modes of D, B and C are permuted
+            std::vector<int> modeD(arrDim, arrDim + nDim);
+            std::vector<int> modeA = modeD;
+            std::vector<int> modeC;
+            for(auto dim : permutedDims)
+            {
+                modeC.push_back(modeD[dim]);
+            }
+            std::vector<int> modeB = modeC;
+
+            std::vector<int64_t> extentD(lengths.cbegin(), lengths.cend());
+            std::vector<int64_t> extentC;
+            for(auto dim : permutedDims)
+            {
+                extentC.push_back(extentD[dim]);
+            }
+
+            CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+            CHECK_HIPTENSOR_ERROR(hiptensorCreate(&referenceHandle));
+            CHECK_HIPTENSOR_ERROR(hiptensorSetBackend(referenceHandle, HIPTENSOR_BACKEND_CPU));
+
+            // Descriptors are shared by both handles
+            auto initDescriptor = [&](hiptensorTensorDescriptor_t* desc,
+                                      std::vector<int64_t> const&  extent,
+                                      hiptensorOperator_t          op) {
+                CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+                    handle, desc, extent.size(), extent.data(), NULL, dataType, op));
+            };
+
+            hiptensorTensorDescriptor_t descA, descB, descC, descD;
+            initDescriptor(&descA, extentD, unaryOps[0]);
+            initDescriptor(&descB, extentC, unaryOps[1]);
+            initDescriptor(&descC, extentC, unaryOps[2]);
+            initDescriptor(&descD, extentD, HIPTENSOR_OP_IDENTITY);
+
+            // Large enough for a scalar of any type
+            double scalarValues[3];
+            for(int i = 0; i < 3; i++)
+            {
+                if(scalarType == HIP_R_16F)
+                {
+                    *(reinterpret_cast<_Float16*>(&scalarValues[i]))
+                        = static_cast<_Float16>(scalars[i]);
+                }
+                else if(scalarType == HIP_R_64F)
+                {
+                    scalarValues[i] = scalars[i];
+                }
+                else
+                {
+                    *(reinterpret_cast<float*>(&scalarValues[i])) = static_cast<float>(scalars[i]);
+                }
+            }
+
+            // The operation on either handle, with the tensors of one side
+            auto run = [&](hiptensorHandle_t* runHandle,
+                           void const*        A,
+                           void const*        B,
+                           void const*        C,
+                           void*              D) {
+                if(trinary)
+                {
+                    return hiptensorElementwiseTrinary(runHandle,
+                                                       &scalarValues[0],
+                                                       A,
+                                                       &descA,
+                                                       modeA.data(),
+                                                       &scalarValues[1],
+                                                       B,
+                                                       &descB,
+                                                       modeB.data(),
+                                                       &scalarValues[2],
+                                                       C,
+                                                       &descC,
+                                                       modeC.data(),
+                                                       D,
+                                                       &descD,
+                                                       modeD.data(),
+                                                       binaryOps[0],
+                                                       binaryOps[1],
+                                                       scalarType,
+                                                       0 /* stream */);
+                }
+                return hiptensorElementwiseBinary(runHandle,
+                                                  &scalarValues[0],
+                                                  A,
+                                                  &descA,
+                                                  modeA.data(),
+                                                  &scalarValues[2],
+                                                  C,
+                                                  &descC,
+                                                  modeC.data(),
+                                                  D,
+                                                  &descD,
+                                                  modeD.data(),
+                                                  binaryOps[0],
+                                                  scalarType,
+                                                  0 /* stream */);
+            };
+
+            hipEvent_t startEvent, stopEvent;
+            CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+            CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+            CHECK_HIP_ERROR(hipEventRecord(startEvent));
+
+            auto status = run(handle,
+                              resource->deviceA().get(),
+                              resource->deviceB().get(),
+                              resource->deviceC().get(),
+                              resource->deviceD().get());
+            if(status == HIPTENSOR_STATUS_NOT_SUPPORTED)
+            {
+                // Kernels for this problem were excluded by the kernel manifest
+                mRunFlag = false;
+                GTEST_SKIP();
+            }
+            CHECK_HIPTENSOR_ERROR(status);
+
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent))
+
+            auto timeMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+
+            // One scale per input, and one binary operator per input after the first
+            auto inputs   = trinary ? 3 : 2;
+            auto elements = resource->getCurrentMatrixElement();
+            auto bytes    = (inputs + 1) * resource->getCurrentMatrixMemorySize();
+
+            mElapsedTimeMs        = float64_t(timeMs);
+            mTotalGFlops          = float64_t((2 * inputs - 1) * elements) / 1e9;
+            mMeasuredTFlopsPerSec = mTotalGFlops / mElapsedTimeMs;
+
+            mTotalBytes = bytes;
+            mTotalBytes /= (1e9 * mElapsedTimeMs);
+
+            CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+            resource->copyDToHost();
+
+            auto& testOptions = HiptensorOptions::instance();
+
+            if(testOptions->performValidation())
+            {
+                // The reference depends only on the problem and the seeded inputs
+                auto& goldenCache = GoldenCache::instance();
+                auto  key         = GoldenKey("elementwise");
+                key.add(ElementwiseResource::sInputSeed)
+                    .add(extentD)
+                    .add(modeC)
+                    .add(dataType)
+                    .add(scalarType)
+                    .add(scalars)
+                    .add(unaryOps)
+                    .add(binaryOps);
+                auto referenceBytes = resource->getCurrentMatrixMemorySize();
+
+                goldenCache->fetch(key, resource->hostReference().get(), referenceBytes, [&]() {
+                    CHECK_HIPTENSOR_ERROR(run(referenceHandle,
+                                              resource->hostA().get(),
+                                              resource->hostB().get(),
+                                              resource->hostC().get(),
+                                              resource->hostReference().get()));
+                });
+
+                auto compareD = [&]() {
+                    auto validate = [&](auto typed) {
+                        using DataT = decltype(typed);
+                        return compareEqualStreamLaunchKernel(
+                            (DataT const*)resource->deviceD().get(),
+                            (DataT const*)resource->hostReference().get(),
+                            elements,
+                            convertToComputeType(dataType));
+                    };
+
+                    if(dataType == HIP_R_16F)
+                    {
+                        return validate(_Float16{});
+                    }
+                    return validate(float{});
+                };
+
+                auto stridesD = stridesFromLengths(extentD, testOptions->isColMajorStrides());
+
+                ValidationStats stats = compareD();
+                mValidationResult     = stats.mPassed;
+                mMaxRelativeError     = stats.mMaxRelativeError;
+
+                EXPECT_TRUE(mValidationResult) << validationReport(stats, extentD, stridesD);
+
+                // A plan executed against the cleared output must reproduce the result
+                hiptensorElementwisePlan_t plan;
+                if(trinary)
+                {
+                    CHECK_HIPTENSOR_ERROR(hiptensorInitElementwiseTrinaryPlan(handle,
+                                                                              &plan,
+                                                                              &descA,
+                                                                              modeA.data(),
+                                                                              &descB,
+                                                                              modeB.data(),
+                                                                              &descC,
+                                                                              modeC.data(),
+                                                                              &descD,
+                                                                              modeD.data(),
+                                                                              binaryOps[0],
+                                                                              binaryOps[1],
+                                                                              scalarType));
+                }
+                else
+                {
+                    CHECK_HIPTENSOR_ERROR(hiptensorInitElementwiseBinaryPlan(handle,
+                                                                             &plan,
+                                                                             &descA,
+                                                                             modeA.data(),
+                                                                             &descC,
+                                                                             modeC.data(),
+                                                                             &descD,
+                                                                             modeD.data(),
+                                                                             binaryOps[0],
+                                                                             scalarType));
+                }
+
+                CHECK_HIP_ERROR(hipMemset(
+                    resource->deviceD().get(), 0, resource->getCurrentMatrixMemorySize()));
+                if(trinary)
+                {
+                    CHECK_HIPTENSOR_ERROR(
+                        hiptensorElementwiseTrinaryExecute(handle,
+                                                           &plan,
+                                                           &scalarValues[0],
+                                                           resource->deviceA().get(),
+                                                           &scalarValues[1],
+                                                           resource->deviceB().get(),
+                                                           &scalarValues[2],
+                                                           resource->deviceC().get(),
+                                                           resource->deviceD().get(),
+                                                           0 /* stream */));
+                }
+                else
+                {
+                    CHECK_HIPTENSOR_ERROR(
+                        hiptensorElementwiseBinaryExecute(handle,
+                                                          &plan,
+                                                          &scalarValues[0],
+                                                          resource->deviceA().get(),
+                                                          &scalarValues[2],
+                                                          resource->deviceC().get(),
+                                                          resource->deviceD().get(),
+                                                          0 /* stream */));
+                }
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+                stats = compareD();
+                mValidationResult &= stats.mPassed;
+                EXPECT_TRUE(stats.mPassed) << "Plan: " << validationReport(stats, extentD, stridesD);
+            } // if (testOptions->performValidation())
+        }
+
+        using Options        = hiptensor::HiptensorOptions;
+        auto& loggingOptions = Options::instance();
+
+        if(!loggingOptions->omitCout())
+        {
+            reportResults(std::cout,
+                          dataType,
+                          mHeaderPrinted,
+                          loggingOptions->omitSkipped(),
+                          loggingOptions->omitFailed(),
+                          loggingOptions->omitPassed());
+        }
+
+        if(loggingOptions->ostream().isOpen())
+        {
+            reportResults(loggingOptions->ostream().fstream(),
+                          dataType,
+                          mHeaderPrinted,
+                          loggingOptions->omitSkipped(),
+                          loggingOptions->omitFailed(),
+                          loggingOptions->omitPassed());
+        }
+
+        // Print the header only once
+        if(!mHeaderPrinted)
+        {
+            mHeaderPrinted = true;
+        }
+    }
+
+    void ElementwiseTest::TearDown()
+    {
+        if(handle != nullptr)
+        {
+            CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+        }
+        if(referenceHandle != nullptr)
+        {
+            CHECK_HIPTENSOR_ERROR(hiptensorDestroy(referenceHandle));
+        }
+    }
+
+} // namespace hiptensor
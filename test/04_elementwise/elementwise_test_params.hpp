@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENTWISE_TEST_PARAMS_HPP
+#define HIPTENSOR_ELEMENTWISE_TEST_PARAMS_HPP
+
+#include <tuple>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "utils.hpp"
+
+namespace hiptensor
+{
+
+    struct ElementwiseTestParams
+    {
+        using DataTypesT = std::vector<hipDataType>;
+
+        using LogLevelT       = hiptensorLogLevel_t;
+        using LengthsT        = std::vector<std::size_t>;
+        using PermutedDimsT   = std::vector<std::size_t>;
+        using ScalarsT        = std::vector<double>;
+        using UnaryOperatorT  = std::vector<hiptensorOperator_t>;
+        using BinaryOperatorT = std::vector<hiptensorOperator_t>;
+
+    public:
+        std::vector<DataTypesT>& dataTypes()
+        {
+            return mDataTypes;
+        }
+
+        LogLevelT& logLevelMask()
+        {
+            return mLogLevelMask;
+        }
+
+        std::vector<LengthsT>& problemLengths()
+        {
+            return mProblemLengths;
+        }
+
+        std::vector<PermutedDimsT>& permutedDims()
+        {
+            return mPermutedDims;
+        }
+
+        std::vector<ScalarsT>& scalars()
+        {
+            return mScalars;
+        }
+
+        std::vector<UnaryOperatorT>& unaryOperators()
+        {
+            return mUnaryOperators;
+        }
+
+        std::vector<BinaryOperatorT>& binaryOperators()
+        {
+            return mBinaryOperators;
+        }
+
+        void printParams()
+        {
+            std::cout << "DataTypes: " << mDataTypes << "\n"
+                      << "LogLevelMask: " << mLogLevelMask << "\n"
+                      << "ProblemLengths: " << mProblemLengths << "\n"
+                      << "PermutedDims: " << mPermutedDims << "\n"
+                      << "Scalars: " << mScalars << "\n"
+                      << "UnaryOperators: " << mUnaryOperators << "\n"
+                      << "BinaryOperators: " << mBinaryOperators << "\n";
+        }
+
+    private:
+        // Data types of the tensors and of the scalars
+        std::vector<DataTypesT>    mDataTypes;
+        LogLevelT                  mLogLevelMask;
+        std::vector<LengthsT>      mProblemLengths;
+        std::vector<PermutedDimsT> mPermutedDims;
+
+        // [alpha, beta, gamma]
+        std::vector<ScalarsT> mScalars;
+
+        // [opA, opB, opC]
+        std::vector<UnaryOperatorT> mUnaryOperators;
+
+        // [opAC] of a binary operation or [opAB, opABC] of a trinary operation
+        std::vector<BinaryOperatorT> mBinaryOperators;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_ELEMENTWISE_TEST_PARAMS_HPP
@@ -27,125 +27,281 @@
 #ifndef HIPTENSOR_TEST_CONTRACTION_DEVICE_COMMON_HPP
 #define HIPTENSOR_TEST_CONTRACTION_DEVICE_COMMON_HPP
 
-template <typename T>
-__device__ inline double toDouble(T const& val)
+#include "philox.hpp"
+
+// Fills 'elementSize' elements with the values of the seeded stream. Each thread
+// generates one Philox block of scalars at a time, so the indices are 64-bit and the
+// launch geometry does not change the values, which match fillHost.
+template <typename DataType>
+__global__ void
+    fillKernel(DataType* data, uint64_t elementSize, uint64_t seed, InitParams params)
 {
-    // TODO: deprecate. Not needed anymore because bfloat16_t has float operator
-    return static_cast<double>(val);
+    auto scalarCount = elementSize * InitScalarType<DataType>::Components;
+    auto blocks      = (scalarCount + InitScalarsPerBlock - 1) / InitScalarsPerBlock;
+    auto stride      = static_cast<uint64_t>(gridDim.x) * blockDim.x;
+
+    for(uint64_t block = blockIdx.x * blockDim.x + threadIdx.x; block < blocks; block += stride)
+    {
+        initStoreBlock(data, scalarCount, seed, block, params);
+    }
 }
 
-__device__ inline double maxDouble(double a, double b)
+// fill kernel wrapper for 'elementSize' elements with a specific value
+template <typename DataType>
+__global__ void fillValKernel(DataType* data, uint64_t elementSize, DataType value)
 {
-    if(std::isinf(a) || std::isinf(b))
+    auto stride = static_cast<uint64_t>(gridDim.x) * blockDim.x;
+
+    for(uint64_t index = blockIdx.x * blockDim.x + threadIdx.x; index < elementSize;
+        index += stride)
     {
-        return std::numeric_limits<double>::infinity();
+        data[index] = value;
     }
-    // Check for NaN
-    else if(std::isnan(a) || std::isnan(b))
+}
+
+// Number of bins of the ulp histogram of a validation pass. Bin 0 counts exact matches,
+// bin b counts errors of [2^(b-1), 2^b) ulps and the last bin everything beyond.
+constexpr uint32_t ValidationUlpBins = 16;
+
+// Partial result of the fused validation pass over a slice of D
+struct ValidationPartial
+{
+    double             mMaxRelativeError;
+    double             mSumSquaredError;
+    unsigned long long mWorstOffset;
+    unsigned long long mFirstNonFiniteOffset;
+    unsigned long long mInfCount;
+    unsigned long long mNaNCount;
+    unsigned long long mUlpHistogram[ValidationUlpBins];
+};
+
+__host__ __device__ inline void validationReset(ValidationPartial& partial)
+{
+    partial.mMaxRelativeError     = 0.0;
+    partial.mSumSquaredError      = 0.0;
+    partial.mWorstOffset          = 0ull;
+    partial.mFirstNonFiniteOffset = ~0ull;
+    partial.mInfCount             = 0ull;
+    partial.mNaNCount             = 0ull;
+    for(uint32_t i = 0; i < ValidationUlpBins; i++)
     {
-        return std::numeric_limits<double>::signaling_NaN();
+        partial.mUlpHistogram[i] = 0ull;
     }
-    return a > b ? a : b;
 }
 
-__global__ static void
-    maxReduceKernel(double* relativeError, uint32_t elements, uint32_t offset, uint32_t maxElements)
+template <typename T>
+__host__ __device__ inline double validationWiden(T const& val)
 {
-    double* localRelativeError = relativeError + (offset * elements * blockIdx.x);
-
-    for(int i = elements >> 1; i > 0; i = i >> 1)
+    if constexpr(std::is_same_v<T, double>)
     {
-        if(threadIdx.x < i && offset * (elements * blockIdx.x + threadIdx.x + i) < maxElements)
-        {
-            localRelativeError[offset * threadIdx.x]
-                = maxDouble(localRelativeError[offset * threadIdx.x],
-                            localRelativeError[offset * (threadIdx.x + i)]);
-        }
-        __syncthreads();
+        return val;
+    }
+    else
+    {
+        return static_cast<double>(static_cast<float>(val));
     }
 }
 
-__device__ inline unsigned pcg_hash(unsigned input)
+// Maps the bits of a floating point value onto a monotonic integer scale,
+// so that the distance of two values on it is their distance in ulps.
+template <typename T>
+__host__ __device__ inline int64_t validationOrderedBits(T const& val)
 {
-    unsigned state = input * 747796405u + 2891336453u;
-    unsigned word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
-    return (word >> 22u) ^ word;
+    using BitsT = std::conditional_t<
+        sizeof(T) == 8,
+        uint64_t,
+        std::conditional_t<sizeof(T) == 4, uint32_t, uint16_t>>;
+
+    BitsT bits;
+    __builtin_memcpy(&bits, &val, sizeof(T));
+
+    constexpr auto SignBit   = static_cast<BitsT>(BitsT(1) << (sizeof(T) * 8 - 1));
+    auto           magnitude = static_cast<int64_t>(bits & static_cast<BitsT>(SignBit - 1));
+    return (bits & SignBit) ? -magnitude : magnitude;
 }
 
-// gen random float in range [-range, range)
-template <unsigned range = 1>
-__device__ inline float gen_random_float(unsigned input)
+template <typename T>
+__host__ __device__ inline uint32_t validationUlpBin(T const& a, T const& b)
 {
-    return (static_cast<float>(pcg_hash(input)) / static_cast<float>(UINT_MAX) - 0.5f)
-           * static_cast<float>(range) * 2;
+    auto orderedA = validationOrderedBits(a);
+    auto orderedB = validationOrderedBits(b);
+
+    // The difference is taken unsigned, as it can exceed int64_t for doubles
+    auto ulps = orderedA > orderedB ? uint64_t(orderedA) - uint64_t(orderedB)
+                                    : uint64_t(orderedB) - uint64_t(orderedA);
+    if(ulps == 0ull)
+    {
+        return 0u;
+    }
+    auto bin = 64u - static_cast<uint32_t>(__builtin_clzll(ulps));
+    return bin < ValidationUlpBins ? bin : ValidationUlpBins - 1u;
 }
 
-// fill kernel for 'elementSize' elements
-template <typename DataType>
-__global__ void fillKernel(DataType* data, uint32_t elementSize, uint32_t seed)
+// Accumulates the errors of one element of D at 'offset' into the partial,
+// except for the ulp histogram: returns the bin to count the element in,
+// or ValidationUlpBins if the error is not finite.
+template <typename DDataType>
+__host__ __device__ inline uint32_t validationAccumulate(ValidationPartial& partial,
+                                                         DDataType const&   valD,
+                                                         DDataType const&   valReference,
+                                                         unsigned long long offset)
 {
-    uint32_t index       = (blockIdx.x * blockDim.x + threadIdx.x);
-    uint32_t seededIndex = static_cast<uint32_t>(uint64_t(index + seed) % UINT_MAX);
+    auto d         = validationWiden(valD);
+    auto reference = validationWiden(valReference);
 
-    if(index < elementSize)
+    auto numerator = fabs(d - reference);
+    auto divisor   = fabs(d) + fabs(reference) + 1.0;
+
+    if(std::isinf(numerator) || std::isinf(divisor) || std::isnan(numerator)
+       || std::isnan(divisor))
     {
-        if constexpr(std::is_same_v<DataType, hipFloatComplex>)
-        {
-            auto value  = gen_random_float(seededIndex);
-            data[index] = make_hipFloatComplex(value, value);
-        }
-        else if constexpr(std::is_same_v<DataType, hipDoubleComplex>)
+        if(std::isnan(numerator) || std::isnan(divisor))
         {
-            auto value  = static_cast<double>(gen_random_float(seededIndex));
-            data[index] = make_hipDoubleComplex(value, value);
+            partial.mNaNCount++;
         }
         else
         {
-            auto value  = gen_random_float(seededIndex);
-            data[index] = static_cast<DataType>(value);
+            partial.mInfCount++;
         }
+        partial.mFirstNonFiniteOffset = offset < partial.mFirstNonFiniteOffset
+                                            ? offset
+                                            : partial.mFirstNonFiniteOffset;
+        return ValidationUlpBins;
     }
+
+    auto relativeError = numerator / divisor;
+    if(relativeError > partial.mMaxRelativeError)
+    {
+        partial.mMaxRelativeError = relativeError;
+        partial.mWorstOffset      = offset;
+    }
+    partial.mSumSquaredError += numerator * numerator;
+
+    return validationUlpBin(valD, valReference);
 }
 
-// fill kernel wrapper for 'elementSize' elements with a specific value
-template <typename DataType>
-__global__ void fillValKernel(DataType* data, uint32_t elementSize, DataType value)
+// Merges two partials. Ties of the max relative error resolve to the lowest offset,
+// so that the result does not depend on the order of the merges.
+__host__ __device__ inline void validationMergeErrors(ValidationPartial&       into,
+                                                      ValidationPartial const& from)
 {
-    uint32_t index = (blockIdx.x * blockDim.x + threadIdx.x);
+    if(from.mMaxRelativeError > into.mMaxRelativeError
+       || (from.mMaxRelativeError == into.mMaxRelativeError
+           && from.mWorstOffset < into.mWorstOffset))
+    {
+        into.mMaxRelativeError = from.mMaxRelativeError;
+        into.mWorstOffset      = from.mWorstOffset;
+    }
+    into.mSumSquaredError += from.mSumSquaredError;
+    into.mFirstNonFiniteOffset = from.mFirstNonFiniteOffset < into.mFirstNonFiniteOffset
+                                     ? from.mFirstNonFiniteOffset
+                                     : into.mFirstNonFiniteOffset;
+    into.mInfCount += from.mInfCount;
+    into.mNaNCount += from.mNaNCount;
+}
 
-    if(index < elementSize)
+__host__ __device__ inline void validationMerge(ValidationPartial&       into,
+                                                ValidationPartial const& from)
+{
+    validationMergeErrors(into, from);
+    for(uint32_t i = 0; i < ValidationUlpBins; i++)
     {
-        data[index] = value;
+        into.mUlpHistogram[i] += from.mUlpHistogram[i];
     }
 }
 
+constexpr uint32_t ValidationBlockSize = 256;
+constexpr uint32_t ValidationGridSize  = 1024;
+
+// Fused validation pass over 'elements' values of D starting at flat offset 'baseOffset'.
+// Each block reduces its grid-stride slice into partials[blockIdx.x], merging with the
+// slices of previous launches if 'accumulate' is set, so that the device memory used
+// does not grow with the size of D.
 template <typename DDataType>
-__global__ void compareEqualKernel(DDataType* deviceD,
-                                   DDataType* hostD,
-                                   double*    relativeError,
-                                   uint32_t   elementsD)
+__global__ void compareEqualBlockedKernel(DDataType const*   deviceD,
+                                          DDataType const*   reference,
+                                          unsigned long long elements,
+                                          unsigned long long baseOffset,
+                                          ValidationPartial* partials,
+                                          bool               accumulate)
 {
-    uint32_t index = blockIdx.x * blockDim.x + threadIdx.x;
+    __shared__ double             sMaxRelativeError[ValidationBlockSize];
+    __shared__ double             sSumSquaredError[ValidationBlockSize];
+    __shared__ unsigned long long sWorstOffset[ValidationBlockSize];
+    __shared__ unsigned long long sFirstNonFiniteOffset[ValidationBlockSize];
+    __shared__ unsigned long long sCounts[ValidationUlpBins + 2];
+
+    if(threadIdx.x < ValidationUlpBins + 2)
+    {
+        sCounts[threadIdx.x] = 0ull;
+    }
+    __syncthreads();
+
+    ValidationPartial local;
+    validationReset(local);
 
-    if(index < elementsD)
+    unsigned long long stride = static_cast<unsigned long long>(gridDim.x) * blockDim.x;
+    for(unsigned long long i = blockIdx.x * blockDim.x + threadIdx.x; i < elements; i += stride)
     {
-        DDataType valDevice = deviceD[index];
-        DDataType valHost   = hostD[index];
+        auto bin = validationAccumulate(local, deviceD[i], reference[i], baseOffset + i);
+        if(bin < ValidationUlpBins)
+        {
+            atomicAdd(&sCounts[bin], 1ull);
+        }
+    }
 
-        auto numerator = fabs(toDouble(valDevice) - toDouble(valHost));
-        auto divisor   = fabs(toDouble(valDevice)) + fabs(toDouble(valHost)) + 1.0;
+    if(local.mInfCount > 0ull)
+    {
+        atomicAdd(&sCounts[ValidationUlpBins], local.mInfCount);
+    }
+    if(local.mNaNCount > 0ull)
+    {
+        atomicAdd(&sCounts[ValidationUlpBins + 1], local.mNaNCount);
+    }
 
-        if(std::isinf(numerator) || std::isinf(divisor))
+    sMaxRelativeError[threadIdx.x]     = local.mMaxRelativeError;
+    sSumSquaredError[threadIdx.x]      = local.mSumSquaredError;
+    sWorstOffset[threadIdx.x]          = local.mWorstOffset;
+    sFirstNonFiniteOffset[threadIdx.x] = local.mFirstNonFiniteOffset;
+    __syncthreads();
+
+    for(uint32_t i = ValidationBlockSize >> 1; i > 0; i = i >> 1)
+    {
+        if(threadIdx.x < i)
         {
-            relativeError[index] = std::numeric_limits<DDataType>::infinity();
+            ValidationPartial other;
+            other.mMaxRelativeError     = sMaxRelativeError[threadIdx.x + i];
+            other.mSumSquaredError      = sSumSquaredError[threadIdx.x + i];
+            other.mWorstOffset          = sWorstOffset[threadIdx.x + i];
+            other.mFirstNonFiniteOffset = sFirstNonFiniteOffset[threadIdx.x + i];
+            other.mInfCount             = 0ull;
+            other.mNaNCount             = 0ull;
+            validationMergeErrors(local, other);
+
+            sMaxRelativeError[threadIdx.x]     = local.mMaxRelativeError;
+            sSumSquaredError[threadIdx.x]      = local.mSumSquaredError;
+            sWorstOffset[threadIdx.x]          = local.mWorstOffset;
+            sFirstNonFiniteOffset[threadIdx.x] = local.mFirstNonFiniteOffset;
+        }
+        __syncthreads();
+    }
+
+    if(threadIdx.x == 0)
+    {
+        local.mInfCount = sCounts[ValidationUlpBins];
+        local.mNaNCount = sCounts[ValidationUlpBins + 1];
+        for(uint32_t i = 0; i < ValidationUlpBins; i++)
+        {
+            local.mUlpHistogram[i] = sCounts[i];
         }
-        else if(std::isnan(numerator) || std::isnan(divisor))
+
+        if(accumulate)
         {
-            relativeError[index] = std::numeric_limits<DDataType>::signaling_NaN();
+            validationMerge(partials[blockIdx.x], local);
         }
         else
         {
-            relativeError[index] = numerator / divisor;
+            partials[blockIdx.x] = local;
         }
     }
 }
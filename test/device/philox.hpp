@@ -0,0 +1,205 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_TEST_DEVICE_PHILOX_HPP
+#define HIPTENSOR_TEST_DEVICE_PHILOX_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+
+// Counter-based tensor initialization, shared by the host and the device.
+//
+// Values are a pure function of (seed, 64-bit scalar index, distribution), so that
+// host and device fills of the same tensor match bit for bit without copying data,
+// independent of the thread count or launch geometry. Every value is computed in
+// double with exactly rounded operations only, and then rounded to the data type.
+
+// Distributions of the initialized values, with parameters (a, b):
+enum class InitDistribution : uint32_t
+{
+    UNIFORM, /*!< Uniform in [a, b) */
+    NORMAL, /*!< Mean a, standard deviation b (Irwin-Hall sum of 8 uniforms) */
+    UNIFORM_INT /*!< Uniform integers in [a, b], exact in every data type */
+};
+
+struct InitParams
+{
+    InitDistribution mDistribution = InitDistribution::UNIFORM;
+    double           mA            = -1.0;
+    double           mB            = 1.0;
+};
+
+// Philox4x32-10 of Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"
+struct Philox4x32
+{
+    uint32_t mWords[4];
+};
+
+__host__ __device__ inline Philox4x32 philox4x32(Philox4x32 counter, uint64_t key)
+{
+    constexpr uint32_t M0 = 0xD2511F53u;
+    constexpr uint32_t M1 = 0xCD9E8D57u;
+    constexpr uint32_t W0 = 0x9E3779B9u;
+    constexpr uint32_t W1 = 0xBB67AE85u;
+
+    auto k0 = static_cast<uint32_t>(key);
+    auto k1 = static_cast<uint32_t>(key >> 32);
+    auto& c = counter.mWords;
+
+    for(int round = 0; round < 10; round++)
+    {
+        auto product0 = static_cast<uint64_t>(M0) * c[0];
+        auto product1 = static_cast<uint64_t>(M1) * c[2];
+
+        uint32_t next[4] = {static_cast<uint32_t>(product1 >> 32) ^ c[1] ^ k0,
+                            static_cast<uint32_t>(product1),
+                            static_cast<uint32_t>(product0 >> 32) ^ c[3] ^ k1,
+                            static_cast<uint32_t>(product0)};
+        c[0] = next[0];
+        c[1] = next[1];
+        c[2] = next[2];
+        c[3] = next[3];
+
+        k0 += W0;
+        k1 += W1;
+    }
+
+    return counter;
+}
+
+// Number of consecutive scalars generated together by initScalars
+constexpr uint32_t InitScalarsPerBlock = 4;
+
+// Scalars [4 * block, 4 * block + 4) of the stream of 'seed'. Complex tensors
+// take their real and imaginary parts from consecutive scalars.
+__host__ __device__ inline void
+    initScalars(InitParams const& params, uint64_t seed, uint64_t block, double (&scalars)[4])
+{
+    constexpr double TwoPowMinus32 = 1.0 / 4294967296.0;
+
+    auto counter = Philox4x32{{static_cast<uint32_t>(block),
+                               static_cast<uint32_t>(block >> 32),
+                               0u,
+                               static_cast<uint32_t>(params.mDistribution)}};
+
+    if(params.mDistribution == InitDistribution::NORMAL)
+    {
+        // One Philox block per scalar, split into 8 uniform 16-bit halves. The sum is
+        // exact in double, so it does not depend on the order of the operations.
+        constexpr double Scale = 1.224744871391589; // sqrt(12 / 8)
+        for(uint32_t i = 0; i < InitScalarsPerBlock; i++)
+        {
+            counter.mWords[2] = i;
+            auto   random     = philox4x32(counter, seed);
+            double sum        = 0.0;
+            for(auto word : random.mWords)
+            {
+                sum += ((word >> 16) + 0.5) + ((word & 0xFFFFu) + 0.5);
+            }
+            auto normal = (sum / 65536.0 - 4.0) * Scale;
+            scalars[i]  = __builtin_fma(params.mB, normal, params.mA);
+        }
+        return;
+    }
+
+    auto random = philox4x32(counter, seed);
+    for(uint32_t i = 0; i < InitScalarsPerBlock; i++)
+    {
+        auto uniform = (random.mWords[i] + 0.5) * TwoPowMinus32;
+        if(params.mDistribution == InitDistribution::UNIFORM_INT)
+        {
+            auto count = __builtin_floor(params.mB - params.mA) + 1.0;
+            scalars[i] = params.mA + __builtin_floor(uniform * count);
+        }
+        else
+        {
+            scalars[i] = __builtin_fma(params.mB - params.mA, uniform, params.mA);
+        }
+    }
+}
+
+// Real scalar type of a data type, e.g. float for hipFloatComplex
+template <typename DataType>
+struct InitScalarType
+{
+    using Type = DataType;
+    static constexpr uint32_t Components = 1;
+};
+
+template <>
+struct InitScalarType<hipFloatComplex>
+{
+    using Type = float;
+    static constexpr uint32_t Components = 2;
+};
+
+template <>
+struct InitScalarType<hipDoubleComplex>
+{
+    using Type = double;
+    static constexpr uint32_t Components = 2;
+};
+
+// Rounds a generated scalar to the data type. Narrow types round through float,
+// which both the host and the device convert from double exactly rounded.
+template <typename ScalarType>
+__host__ __device__ inline ScalarType initRound(double value)
+{
+    if constexpr(std::is_same_v<ScalarType, double>)
+    {
+        return value;
+    }
+    else
+    {
+        return static_cast<ScalarType>(static_cast<float>(value));
+    }
+}
+
+// Fills the scalars of one block, clipped to 'scalarCount'
+template <typename DataType>
+__host__ __device__ inline void initStoreBlock(DataType*         data,
+                                               uint64_t          scalarCount,
+                                               uint64_t          seed,
+                                               uint64_t          block,
+                                               InitParams const& params)
+{
+    using ScalarType = typename InitScalarType<DataType>::Type;
+    auto scalarData  = reinterpret_cast<ScalarType*>(data);
+
+    double scalars[InitScalarsPerBlock];
+    initScalars(params, seed, block, scalars);
+
+    auto first = block * InitScalarsPerBlock;
+    for(uint32_t i = 0; i < InitScalarsPerBlock && first + i < scalarCount; i++)
+    {
+        scalarData[first + i] = initRound<ScalarType>(scalars[i]);
+    }
+}
+
+#endif // HIPTENSOR_TEST_DEVICE_PHILOX_HPP
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <hiptensor/hiptensor-version.hpp>
+
+#include "golden_cache.hpp"
+#include "hiptensor_options.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Bumped whenever the entry layout changes, which invalidates every
+        // existing entry
+        constexpr char GoldenMagic[8] = {'H', 'T', 'G', 'O', 'L', 'D', '0', '3'};
+
+        // Entry header, padded so that the data is aligned for any element type.
+        // The data follows the header and the key bytes follow the data.
+        struct alignas(64) GoldenHeader
+        {
+            char     mMagic[8];
+            uint64_t mKeyBytes;
+            uint64_t mBytes;
+        };
+    } // namespace
+
+    GoldenKey::GoldenKey(std::string const& kind)
+        : mHash(14695981039346656037ull)
+    {
+        add(uint64_t(hiptensorGetVersion())).add(GoldenReferenceVersion).add(kind);
+    }
+
+    GoldenKey& GoldenKey::add(std::string const& value)
+    {
+        add(value.size());
+        return addBytes(value.data(), value.size());
+    }
+
+    uint64_t GoldenKey::value() const
+    {
+        return mHash;
+    }
+
+    std::vector<unsigned char> const& GoldenKey::bytes() const
+    {
+        return mBytes;
+    }
+
+    GoldenKey& GoldenKey::addBytes(void const* data, std::size_t bytes)
+    {
+        auto bytePtr = static_cast<unsigned char const*>(data);
+        for(std::size_t i = 0; i < bytes; i++)
+        {
+            mHash = (mHash ^ bytePtr[i]) * 1099511628211ull;
+        }
+        mBytes.insert(mBytes.end(), bytePtr, bytePtr + bytes);
+        return *this;
+    }
+
+    GoldenResult::GoldenResult(GoldenResult&& other)
+        : mMapping(other.mMapping)
+        , mMappingBytes(other.mMappingBytes)
+        , mDataBytes(other.mDataBytes)
+    {
+        other.mMapping      = nullptr;
+        other.mMappingBytes = 0;
+        other.mDataBytes    = 0;
+    }
+
+    GoldenResult& GoldenResult::operator=(GoldenResult&& other)
+    {
+        std::swap(mMapping, other.mMapping);
+        std::swap(mMappingBytes, other.mMappingBytes);
+        std::swap(mDataBytes, other.mDataBytes);
+        return *this;
+    }
+
+    GoldenResult::~GoldenResult()
+    {
+        if(mMapping != nullptr)
+        {
+            munmap(mMapping, mMappingBytes);
+        }
+    }
+
+    GoldenResult::operator bool() const
+    {
+        return mMapping != nullptr;
+    }
+
+    void const* GoldenResult::data() const
+    {
+        return static_cast<char const*>(mMapping) + sizeof(GoldenHeader);
+    }
+
+    std::size_t GoldenResult::size() const
+    {
+        return mMapping != nullptr ? mDataBytes : 0;
+    }
+
+    GoldenCache::GoldenCache()
+        : mDirectory(HiptensorOptions::instance()->goldenCacheDir())
+    {
+        if(!mDirectory.empty())
+        {
+            std::error_code error;
+            std::filesystem::create_directories(mDirectory, error);
+            if(error)
+            {
+                fprintf(stderr,
+                        "Golden cache disabled, cannot create %s: %s\n",
+                        mDirectory.c_str(),
+                        error.message().c_str());
+                mDirectory.clear();
+            }
+        }
+    }
+
+    bool GoldenCache::enabled() const
+    {
+        return !mDirectory.empty();
+    }
+
+    GoldenResult GoldenCache::find(GoldenKey const& key, std::size_t bytes) const
+    {
+        GoldenResult result;
+        if(!enabled())
+        {
+            return result;
+        }
+
+        int fd = open(path(key).c_str(), O_RDONLY);
+        if(fd < 0)
+        {
+            return result;
+        }
+
+        auto const& keyBytes = key.bytes();
+
+        struct stat status;
+        if(fstat(fd, &status) == 0
+           && static_cast<std::size_t>(status.st_size)
+                  == sizeof(GoldenHeader) + bytes + keyBytes.size())
+        {
+            auto mapping = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapping != MAP_FAILED)
+            {
+                result.mMapping      = mapping;
+                result.mMappingBytes = status.st_size;
+                result.mDataBytes    = bytes;
+
+                // Guard against entries of an older layout, and against other keys with
+                // the same hash by comparing the full key bytes
+                auto header = static_cast<GoldenHeader const*>(mapping);
+                auto stored = static_cast<char const*>(mapping) + sizeof(GoldenHeader) + bytes;
+                if(std::memcmp(header->mMagic, GoldenMagic, sizeof(GoldenMagic)) != 0
+                   || header->mKeyBytes != keyBytes.size() || header->mBytes != bytes
+                   || std::memcmp(stored, keyBytes.data(), keyBytes.size()) != 0)
+                {
+                    result = GoldenResult();
+                }
+            }
+        }
+        close(fd);
+
+        return result;
+    }
+
+    bool GoldenCache::store(GoldenKey const& key, void const* data, std::size_t bytes) const
+    {
+        if(!enabled())
+        {
+            return false;
+        }
+
+        static std::atomic<uint32_t> sCounter{0};
+
+        auto target = path(key);
+        auto temp   = target + ".tmp." + std::to_string(getpid()) + "."
+                    + std::to_string(sCounter++);
+
+        GoldenHeader header{};
+        std::memcpy(header.mMagic, GoldenMagic, sizeof(GoldenMagic));
+        header.mKeyBytes = key.bytes().size();
+        header.mBytes    = bytes;
+
+        auto file = fopen(temp.c_str(), "wb");
+        if(file == nullptr)
+        {
+            return false;
+        }
+        bool written = fwrite(&header, sizeof(header), 1, file) == 1
+                       && (bytes == 0 || fwrite(data, bytes, 1, file) == 1)
+                       && fwrite(key.bytes().data(), key.bytes().size(), 1, file) == 1;
+        written &= fclose(file) == 0;
+
+        if(!written || rename(temp.c_str(), target.c_str()) != 0)
+        {
+            remove(temp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    std::string GoldenCache::path(GoldenKey const& key) const
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.golden", (unsigned long long)key.value());
+        return mDirectory + "/" + name;
+    }
+
+} // namespace hiptensor
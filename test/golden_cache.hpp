@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_TEST_GOLDEN_CACHE_HPP
+#define HIPTENSOR_TEST_GOLDEN_CACHE_HPP
+
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hip/hip_complex.h>
+
+#include "singleton.hpp"
+#include "thread_pool.hpp"
+
+// The GoldenCache keeps CPU reference results of the validation tests on disk, so that test
+// cases and runs sharing the same inputs do not recompute them. Entries are keyed by
+// everything the reference depends on, including the library version and the version of
+// the references, and are memory-mapped when read back.
+// The cache is enabled by the -golden_cache <dir> test option or HIPTENSOR_GOLDEN_CACHE_DIR.
+
+namespace hiptensor
+{
+    // Bumped whenever a CPU reference or an input generator of the validation tests
+    // changes, so that a reused cache directory does not serve results of the old ones
+    constexpr uint32_t GoldenReferenceVersion = 1;
+
+    // The raw bytes of every added field, after the library and reference versions.
+    // Entries are named by the FNV-1a hash of the bytes and store the bytes themselves.
+    class GoldenKey
+    {
+    public:
+        explicit GoldenKey(std::string const& kind);
+
+        template <typename T>
+        GoldenKey& add(T const& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Key fields must be plain data");
+            return addBytes(&value, sizeof(T));
+        }
+
+        template <typename T>
+        GoldenKey& add(std::vector<T> const& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Key fields must be plain data");
+            add(values.size());
+            return addBytes(values.data(), values.size() * sizeof(T));
+        }
+
+        GoldenKey& add(std::string const& value);
+
+        uint64_t value() const;
+
+        std::vector<unsigned char> const& bytes() const;
+
+    private:
+        GoldenKey& addBytes(void const* data, std::size_t bytes);
+
+        uint64_t                   mHash;
+        std::vector<unsigned char> mBytes;
+    };
+
+    // Read-only mapping of one cache entry, unmapped on destruction
+    class GoldenResult
+    {
+    public:
+        GoldenResult() = default;
+        GoldenResult(GoldenResult&& other);
+        GoldenResult& operator=(GoldenResult&& other);
+        ~GoldenResult();
+
+        explicit    operator bool() const;
+        void const* data() const;
+        std::size_t size() const;
+
+    private:
+        friend class GoldenCache;
+
+        void*       mMapping      = nullptr;
+        std::size_t mMappingBytes = 0;
+        std::size_t mDataBytes    = 0;
+    };
+
+    class GoldenCache : public LazySingleton<GoldenCache>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<GoldenCache> std::make_unique<GoldenCache>();
+
+        bool enabled() const;
+
+        // Maps the entry of key into memory. Empty on a miss, if the entry was stored
+        // for other key bytes with the same hash, or if it does not hold exactly bytes
+        // of data.
+        GoldenResult find(GoldenKey const& key, std::size_t bytes) const;
+
+        // Writes the entry of key. Entries are written to a temporary file and renamed,
+        // so concurrent test processes never observe partial entries.
+        bool store(GoldenKey const& key, void const* data, std::size_t bytes) const;
+
+        // Fills dst with the entry of key, or runs compute() to fill it and stores
+        // the result on a miss. Returns true on a hit.
+        template <typename Compute>
+        bool fetch(GoldenKey const& key, void* dst, std::size_t bytes, Compute&& compute) const;
+
+    private:
+        GoldenCache();
+
+        std::string path(GoldenKey const& key) const;
+
+        std::string mDirectory;
+    };
+
+    // D = alpha * acc + beta * C from an unscaled accumulation, so that scalar variants
+    // of a test share one cached reference. C is only read if beta is non-zero.
+    template <typename DataType>
+    void applyGoldenScalars(DataType*                   d,
+                            DataType const*             acc,
+                            DataType const*             c,
+                            std::size_t                 elements,
+                            std::complex<double> const& alpha,
+                            std::complex<double> const& beta);
+
+} // namespace hiptensor
+
+#include "golden_cache_impl.hpp"
+
+#endif // HIPTENSOR_TEST_GOLDEN_CACHE_HPP
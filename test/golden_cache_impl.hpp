@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_TEST_GOLDEN_CACHE_IMPL_HPP
+#define HIPTENSOR_TEST_GOLDEN_CACHE_IMPL_HPP
+
+#include <cstring>
+
+#include "golden_cache.hpp"
+
+namespace hiptensor
+{
+    template <typename Compute>
+    bool GoldenCache::fetch(GoldenKey const& key,
+                            void*            dst,
+                            std::size_t      bytes,
+                            Compute&&        compute) const
+    {
+        if(enabled())
+        {
+            if(auto cached = find(key, bytes))
+            {
+                std::memcpy(dst, cached.data(), bytes);
+                return true;
+            }
+        }
+
+        compute();
+
+        if(enabled())
+        {
+            store(key, dst, bytes);
+        }
+        return false;
+    }
+
+    template <typename DataType>
+    void applyGoldenScalars(DataType*                   d,
+                            DataType const*             acc,
+                            DataType const*             c,
+                            std::size_t                 elements,
+                            std::complex<double> const& alpha,
+                            std::complex<double> const& beta)
+    {
+        constexpr bool IsComplex = std::is_same_v<DataType, hipFloatComplex>
+                                   || std::is_same_v<DataType, hipDoubleComplex>;
+        bool const     hasC      = beta != 0.0;
+
+        ThreadPool::instance()->parallelForRange(
+            elements, 4096, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; i++)
+                {
+                    if constexpr(IsComplex)
+                    {
+                        using Real = decltype(acc[i].x);
+
+                        auto value = alpha * std::complex<double>(acc[i].x, acc[i].y);
+                        if(hasC)
+                        {
+                            value += beta * std::complex<double>(c[i].x, c[i].y);
+                        }
+                        d[i].x = static_cast<Real>(value.real());
+                        d[i].y = static_cast<Real>(value.imag());
+                    }
+                    else
+                    {
+                        auto value = alpha.real() * static_cast<double>(acc[i]);
+                        if(hasC)
+                        {
+                            value += beta.real() * static_cast<double>(c[i]);
+                        }
+                        d[i] = static_cast<DataType>(value);
+                    }
+                }
+            });
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_TEST_GOLDEN_CACHE_IMPL_HPP
@@ -61,6 +61,12 @@ llvm::cl::opt<int32_t> hiptensorColdRuns(
     llvm::cl::init(0),
     llvm::cl::cat(HiptensorCategory));
 
+llvm::cl::opt<std::string> hiptensorGoldenCacheDir(
+    "golden_cache",
+    llvm::cl::desc("Specify a directory caching the validation reference results across runs"),
+    llvm::cl::value_desc("directory"),
+    llvm::cl::cat(HiptensorCategory));
+
 llvm::cl::opt<int32_t>
     hiptensorOmitMask("omit",
                       llvm::cl::desc("Output verbosity omission\n 0x1 - Skipped Result\n 0x2 - "
@@ -94,6 +100,12 @@ namespace hiptensor
         options->setHotRuns(hiptensorHotRuns);
         options->setColdRuns(hiptensorColdRuns);
 
+        // The command line takes precedence over HIPTENSOR_GOLDEN_CACHE_DIR
+        if(!hiptensorGoldenCacheDir.empty())
+        {
+            options->setGoldenCacheDir(hiptensorGoldenCacheDir);
+        }
+
         // Load testing params from YAML file if present
         if(!options->inputFilename().empty())
         {
@@ -33,6 +33,7 @@
 #include "01_contraction/contraction_test_params.hpp"
 #include "02_permutation/permutation_test_params.hpp"
 #include "03_reduction/reduction_test_params.hpp"
+#include "04_elementwise/elementwise_test_params.hpp"
 #include "common.hpp"
 #include "yaml_parser_impl.hpp"
 
@@ -332,6 +333,11 @@ namespace llvm
                 io.mapRequired("Lengths", doc.problemLengths());
                 io.mapRequired("Permuted Dims", doc.permutedDims());
                 io.mapRequired("Operators", (doc.operators()));
+
+                // Packed tensors unless padded
+                io.mapOptional("Padding",
+                               doc.paddings(),
+                               std::vector<hiptensor::PermutationTestParams::PaddingT>{{0, 0}});
             }
 
             // Additional validation for input / output of the config
@@ -358,6 +364,13 @@ namespace llvm
                     return "Error: Empty Operators";
                 }
 
+                if(std::any_of(doc.paddings().cbegin(), doc.paddings().cend(), [](auto&& padding) {
+                       return padding.size() != 2;
+                   }))
+                {
+                    return "Error: Padding must have a value for A and B";
+                }
+
                 return std::string{};
             }
         };
@@ -415,14 +428,73 @@ namespace llvm
             }
         };
 
+        ///
+        // Mapping of the test param elements of ElementwiseTestParams for reading / writing.
+        ///
+        template <>
+        struct MappingTraits<hiptensor::ElementwiseTestParams>
+        {
+            static void mapping(IO& io, hiptensor::ElementwiseTestParams& doc)
+            {
+                // Logging bitfield
+                io.mapRequired("Log Level", doc.logLevelMask());
+
+                // Sequences of combinatorial fields
+                io.mapRequired("Tensor Data Types", doc.dataTypes());
+                io.mapRequired("Lengths", doc.problemLengths());
+                io.mapRequired("Permuted Dims", doc.permutedDims());
+                io.mapRequired("Scalars", doc.scalars());
+                io.mapRequired("Unary Operators", doc.unaryOperators());
+                io.mapRequired("Binary Operators", doc.binaryOperators());
+            }
+
+            // Additional validation for input / output of the config
+            static std::string validate(IO& io, hiptensor::ElementwiseTestParams& doc)
+            {
+                if(doc.problemLengths().size() == 0)
+                {
+                    return "Error: Empty Lengths";
+                }
+
+                if(doc.permutedDims().size() == 0)
+                {
+                    return "Error: Empty Permuted Dims";
+                }
+
+                if(std::any_of(doc.scalars().cbegin(), doc.scalars().cend(), [](auto&& scalars) {
+                       return scalars.size() != 3;
+                   }))
+                {
+                    return "Error: Scalars must have a value for alpha, beta and gamma";
+                }
+
+                if(std::any_of(doc.unaryOperators().cbegin(),
+                               doc.unaryOperators().cend(),
+                               [](auto&& ops) { return ops.size() != 3; }))
+                {
+                    return "Error: Unary Operators must have an operator for A, B and C";
+                }
+
+                if(std::any_of(doc.binaryOperators().cbegin(),
+                               doc.binaryOperators().cend(),
+                               [](auto&& ops) { return ops.size() != 1 && ops.size() != 2; }))
+                {
+                    return "Error: Binary Operators must be [opAC] or [opAB, opABC]";
+                }
+
+                return std::string{};
+            }
+        };
+
     } // namespace yaml
 
 } // namespace llvm
 
-// Instantiate the yaml loader for the ContractionTestParams and PermutationTestParams
+// Instantiate the yaml loader for the test params of each suite
 namespace hiptensor
 {
     template struct YamlConfigLoader<ContractionTestParams>;
     template struct YamlConfigLoader<PermutationTestParams>;
     template struct YamlConfigLoader<ReductionTestParams>;
+    template struct YamlConfigLoader<ElementwiseTestParams>;
 }
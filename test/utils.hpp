@@ -28,12 +28,15 @@
 #define HIPTENSOR_TEST_UTILS_HPP
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iterator>
 #include <math.h>
 #include <mutex>
 #include <numeric>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 
@@ -45,6 +48,7 @@
 
 #include "device/common.hpp"
 #include "hip_resource.hpp"
+#include "thread_pool.hpp"
 
 #define HIPTENSOR_FREE_DEVICE(ptr)     \
     if(ptr != nullptr)                 \
@@ -163,228 +167,349 @@ auto getProduct(const Container&               container,
                            std::multiplies<typename Container::value_type>{});
 }
 
-// fill kernel for 'elementSize' elements
+// Grid of the grid-stride fill kernels for 'work' items
+__host__ static inline dim3 fillGridDim(uint64_t work, dim3 blockDim)
+{
+    constexpr uint64_t MaxBlocks = 1u << 16;
+    return dim3(static_cast<uint32_t>(std::min(ceilDiv(work, blockDim.x), MaxBlocks)), 1, 1);
+}
+
+// fill kernel for 'elementSize' elements, see InitParams for the distributions
 template <typename DataType>
-__host__ static inline void fillLaunchKernel(DataType* data, uint32_t elementSize, uint32_t seed)
+__host__ static inline void fillLaunchKernel(DataType*  data,
+                                             uint64_t   elementSize,
+                                             uint64_t   seed,
+                                             InitParams params = {})
 {
-    auto blockDim = dim3(1024, 1, 1);
-    auto gridDim  = dim3(ceilDiv(elementSize, blockDim.x), 1, 1);
-    hipLaunchKernelGGL((fillKernel<DataType>), gridDim, blockDim, 0, 0, data, elementSize, seed);
+    auto scalarCount = elementSize * InitScalarType<DataType>::Components;
+    auto blockDim    = dim3(256, 1, 1);
+    hipLaunchKernelGGL((fillKernel<DataType>),
+                       fillGridDim(ceilDiv(scalarCount, InitScalarsPerBlock), blockDim),
+                       blockDim,
+                       0,
+                       0,
+                       data,
+                       elementSize,
+                       seed,
+                       params);
 }
 
 // fill kernel wrapper for 'elementSize' elements with a specific value
 template <typename DataType>
 __host__ static inline void
-    fillValLaunchKernel(DataType* data, uint32_t elementSize, DataType value)
+    fillValLaunchKernel(DataType* data, uint64_t elementSize, DataType value)
 {
-    auto blockDim = dim3(1024, 1, 1);
-    auto gridDim  = dim3(ceilDiv(elementSize, blockDim.x), 1, 1);
-    hipLaunchKernelGGL(
-        (fillValKernel<DataType>), gridDim, blockDim, 0, 0, data, elementSize, value);
+    auto blockDim = dim3(256, 1, 1);
+    hipLaunchKernelGGL((fillValKernel<DataType>),
+                       fillGridDim(elementSize, blockDim),
+                       blockDim,
+                       0,
+                       0,
+                       data,
+                       elementSize,
+                       value);
 }
 
-template <typename DDataType>
-std::pair<bool, double> compareEqual(DDataType const*       deviceD,
-                                     DDataType const*       hostD,
-                                     std::size_t            elementsD,
-                                     hiptensorComputeType_t computeType,
-                                     double                 tolerance = 0.0)
+// Host fill with the same values as fillLaunchKernel, on the shared host thread pool
+template <typename DataType>
+static inline void
+    fillHost(DataType* data, uint64_t elementSize, uint64_t seed, InitParams params = {})
 {
-    bool   retval             = true;
-    double max_relative_error = 0.0;
-
-    auto toDouble
-        = [](DDataType const& val) { return static_cast<double>(static_cast<float>(val)); };
+    auto scalarCount = elementSize * InitScalarType<DataType>::Components;
+    auto blocks      = ceilDiv(scalarCount, InitScalarsPerBlock);
 
-    bool       isInf = false;
-    bool       isNaN = false;
-    std::mutex writeMutex;
-
-#pragma omp parallel for
-    for(int i = 0; i < elementsD; ++i)
-    {
-        auto valDevice = deviceD[i];
-        auto valHost   = hostD[i];
-
-        auto numerator = fabs(toDouble(valDevice) - toDouble(valHost));
-        auto divisor   = fabs(toDouble(valDevice)) + fabs(toDouble(valHost)) + 1.0;
-
-        if(std::isinf(numerator) || std::isinf(divisor))
-        {
-#pragma omp atomic
-            isInf |= true;
-        }
-        else
-        {
-            auto relative_error = numerator / divisor;
-            if(std::isnan(relative_error))
+    hiptensor::ThreadPool::instance()->parallelForRange(
+        blocks, 1u << 12, [&](std::size_t begin, std::size_t end) {
+            for(auto block = begin; block < end; ++block)
             {
-#pragma omp atomic
-                isNaN |= true;
+                initStoreBlock(data, scalarCount, seed, block, params);
             }
-            else if(relative_error > max_relative_error)
-            {
-                const std::lock_guard<std::mutex> guard(writeMutex);
-                // Double check in case of stall
-                if(relative_error > max_relative_error)
-                {
-                    max_relative_error = relative_error;
-                }
-            }
-        }
+        });
+}
 
-        if(isInf || isNaN)
-        {
-            i = elementsD;
-        }
-    }
+template <typename DataType>
+static inline void fillValHost(DataType* data, uint64_t elementSize, DataType value)
+{
+    hiptensor::ThreadPool::instance()->parallelForRange(
+        elementSize, 1u << 16, [&](std::size_t begin, std::size_t end) {
+            std::fill(data + begin, data + end, value);
+        });
+}
 
-    if(tolerance == 0.0)
-    {
-        // use the same default tolerance value as CK
-        if(computeType == HIPTENSOR_COMPUTE_16BF
-           || std::is_same_v<DDataType, hiptensor::bfloat16_t>)
-        {
-            const double epsilon = std::pow(2, -7);
-            tolerance            = epsilon * 2;
-        }
-        else if(computeType == HIPTENSOR_COMPUTE_16F
-                || std::is_same_v<DDataType, hiptensor::float16_t>)
-        {
-            const double epsilon = std::pow(2, -10);
-            tolerance            = epsilon * 2;
-        }
-        else
-        {
-            tolerance = 1e-5;
-        }
-    }
+// Summary of one validation pass of D against its reference
+struct ValidationStats
+{
+    bool        mPassed;
+    double      mTolerance;
+    double      mMaxRelativeError; /*!< inf or NaN if any error is not finite */
+    double      mRmsError; /*!< Root mean square of the absolute errors */
+    std::size_t mElements;
+    std::size_t mWorstOffset; /*!< Flat offset of the first non-finite or max relative error */
+    std::size_t mInfCount;
+    std::size_t mNaNCount;
+    std::array<std::size_t, ValidationUlpBins> mUlpHistogram; /*!< See ValidationUlpBins */
+};
 
-    if(isInf)
+template <typename DDataType>
+double defaultTolerance(hiptensorComputeType_t computeType)
+{
+    // use the same default tolerance value as CK
+    if(computeType == HIPTENSOR_COMPUTE_16BF || std::is_same_v<DDataType, hiptensor::bfloat16_t>)
     {
-        retval             = false;
-        max_relative_error = std::numeric_limits<DDataType>::infinity();
+        const double epsilon = std::pow(2, -7);
+        return epsilon * 2;
     }
-    else if(isNaN)
+    else if(computeType == HIPTENSOR_COMPUTE_16F
+            || std::is_same_v<DDataType, hiptensor::float16_t>)
     {
-        retval             = false;
-        max_relative_error = std::numeric_limits<DDataType>::signaling_NaN();
+        const double epsilon = std::pow(2, -10);
+        return epsilon * 2;
     }
-    else if(max_relative_error > tolerance)
+    else
     {
-        retval = false;
+        return 1e-5;
     }
-
-    return std::make_pair(retval, max_relative_error);
 }
 
 template <typename DDataType>
-std::pair<bool, double> compareEqualLaunchKernel(DDataType*             deviceD,
-                                                 DDataType*             hostD,
-                                                 std::size_t            elementsD,
-                                                 hiptensorComputeType_t computeType,
-                                                 double                 tolerance = 0.0)
+ValidationStats finalizeValidation(ValidationPartial const& partial,
+                                   std::size_t              elementsD,
+                                   hiptensorComputeType_t   computeType,
+                                   double                   tolerance)
 {
-    static hiptensor::HipResource::DevicePtrT relativeErrorPtr;
-    static std::size_t                        relativeErrorSize = 0;
+    ValidationStats stats;
+    stats.mTolerance = tolerance == 0.0 ? defaultTolerance<DDataType>(computeType) : tolerance;
+    stats.mMaxRelativeError = partial.mMaxRelativeError;
+    stats.mRmsError    = elementsD > 0 ? std::sqrt(partial.mSumSquaredError / elementsD) : 0.0;
+    stats.mElements    = elementsD;
+    stats.mWorstOffset = partial.mWorstOffset;
+    stats.mInfCount    = partial.mInfCount;
+    stats.mNaNCount    = partial.mNaNCount;
+    std::copy(std::begin(partial.mUlpHistogram),
+              std::end(partial.mUlpHistogram),
+              stats.mUlpHistogram.begin());
+
+    if(partial.mInfCount > 0 || partial.mNaNCount > 0)
+    {
+        stats.mPassed           = false;
+        stats.mWorstOffset      = partial.mFirstNonFiniteOffset;
+        stats.mMaxRelativeError = partial.mInfCount > 0
+                                      ? std::numeric_limits<double>::infinity()
+                                      : std::numeric_limits<double>::signaling_NaN();
+    }
+    else
+    {
+        stats.mPassed = stats.mMaxRelativeError <= stats.mTolerance;
+    }
 
-    auto blockDim = dim3(1024, 1, 1);
-    auto gridDim  = dim3(ceilDiv(elementsD, blockDim.x), 1, 1);
+    return stats;
+}
 
-    double maxRelativeError;
+// Fused single pass over host D and reference on the shared host thread pool
+template <typename DDataType>
+ValidationStats compareEqualStats(DDataType const*       deviceD,
+                                  DDataType const*       hostD,
+                                  std::size_t            elementsD,
+                                  hiptensorComputeType_t computeType,
+                                  double                 tolerance = 0.0)
+{
+    // Per-chunk partials, merged afterwards in chunk order so that
+    // no lock is taken per element and the result is deterministic.
+    constexpr std::size_t Grain    = 1u << 16;
+    auto                  chunks   = (elementsD + Grain - 1) / Grain;
+    auto                  partials = std::vector<ValidationPartial>(chunks);
+
+    hiptensor::ThreadPool::instance()->parallelForRange(
+        elementsD, Grain, [&](std::size_t begin, std::size_t end) {
+            auto& partial = partials[begin / Grain];
+            validationReset(partial);
+            for(auto i = begin; i < end; ++i)
+            {
+                auto bin = validationAccumulate(partial, deviceD[i], hostD[i], i);
+                if(bin < ValidationUlpBins)
+                {
+                    partial.mUlpHistogram[bin]++;
+                }
+            }
+        });
 
-    std::size_t requiredErrorSize = elementsD * sizeof(double);
-    if(requiredErrorSize > relativeErrorSize)
+    ValidationPartial result;
+    validationReset(result);
+    for(auto const& partial : partials)
     {
-        hiptensor::HipResource::reallocDevice(relativeErrorPtr, requiredErrorSize);
-        relativeErrorSize = requiredErrorSize;
+        validationMerge(result, partial);
     }
 
-    hipEvent_t syncEvent;
-    CHECK_HIP_ERROR(hipEventCreate(&syncEvent));
+    return finalizeValidation<DDataType>(result, elementsD, computeType, tolerance);
+}
 
-    // Calculate the relative error for each element of Tensor D
-    hipLaunchKernelGGL((compareEqualKernel<DDataType>),
-                       gridDim,
-                       blockDim,
-                       0,
+template <typename DDataType>
+std::pair<bool, double> compareEqual(DDataType const*       deviceD,
+                                     DDataType const*       hostD,
+                                     std::size_t            elementsD,
+                                     hiptensorComputeType_t computeType,
+                                     double                 tolerance = 0.0)
+{
+    auto stats = compareEqualStats(deviceD, hostD, elementsD, computeType, tolerance);
+    return std::make_pair(stats.mPassed, stats.mMaxRelativeError);
+}
+
+// Device partials of the blocked validation kernel, reused across calls
+inline ValidationPartial* validationDevicePartials()
+{
+    static auto partialsPtr = hiptensor::HipResource::allocDevice(ValidationGridSize
+                                                                  * sizeof(ValidationPartial));
+    return static_cast<ValidationPartial*>(partialsPtr.get());
+}
+
+template <typename DDataType>
+void compareEqualBlockedLaunchKernel(DDataType const* deviceD,
+                                     DDataType const* reference,
+                                     std::size_t      elements,
+                                     std::size_t      baseOffset,
+                                     bool             accumulate,
+                                     hipStream_t      stream)
+{
+    // The full grid is always launched so that every partial is written
+    hipLaunchKernelGGL((compareEqualBlockedKernel<DDataType>),
+                       dim3(ValidationGridSize, 1, 1),
+                       dim3(ValidationBlockSize, 1, 1),
                        0,
+                       stream,
                        deviceD,
-                       hostD,
-                       static_cast<double*>(relativeErrorPtr.get()),
-                       elementsD);
-    CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-    CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-
-    // Determine the maximum relative error
-    blockDim             = dim3(512, 1, 1);
-    uint32_t maxElements = 1024;
-    uint32_t offset      = 1;
-
-    for(uint32_t i = elementsD; i > 1; i = ceilDiv(i, maxElements))
+                       reference,
+                       static_cast<unsigned long long>(elements),
+                       static_cast<unsigned long long>(baseOffset),
+                       validationDevicePartials(),
+                       accumulate);
+}
+
+template <typename DDataType>
+ValidationStats reduceValidationPartials(std::size_t            elementsD,
+                                         hiptensorComputeType_t computeType,
+                                         double                 tolerance)
+{
+    auto partials = std::vector<ValidationPartial>(ValidationGridSize);
+    CHECK_HIP_ERROR(hipMemcpy(partials.data(),
+                              validationDevicePartials(),
+                              partials.size() * sizeof(ValidationPartial),
+                              hipMemcpyDeviceToHost));
+
+    ValidationPartial result;
+    validationReset(result);
+    for(auto const& partial : partials)
     {
-        gridDim       = dim3(ceilDiv(i, maxElements), 1, 1);
-        auto elements = i > maxElements ? maxElements : i;
-
-        hipLaunchKernelGGL((maxReduceKernel),
-                           gridDim,
-                           blockDim,
-                           0,
-                           0,
-                           static_cast<double*>(relativeErrorPtr.get()),
-                           elements,
-                           offset,
-                           elementsD);
-
-        CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-        CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-        offset = offset * maxElements;
+        validationMerge(result, partial);
     }
-    CHECK_HIP_ERROR(hipEventDestroy(syncEvent));
 
-    CHECK_HIP_ERROR(hipMemcpy(&maxRelativeError,
-                              static_cast<double*>(relativeErrorPtr.get()),
-                              sizeof(double),
-                              hipMemcpyDeviceToHost));
+    return finalizeValidation<DDataType>(result, elementsD, computeType, tolerance);
+}
 
-    bool retval = true;
-    bool isNaN  = std::isnan(maxRelativeError);
+// Fused single pass over D and the reference, both on the device. Only the
+// per-block partials are allocated, independent of the size of D.
+template <typename DDataType>
+ValidationStats compareEqualDeviceStats(DDataType const*       deviceD,
+                                        DDataType const*       deviceReference,
+                                        std::size_t            elementsD,
+                                        hiptensorComputeType_t computeType,
+                                        double                 tolerance = 0.0)
+{
+    compareEqualBlockedLaunchKernel(deviceD, deviceReference, elementsD, 0, false, 0);
+    return reduceValidationPartials<DDataType>(elementsD, computeType, tolerance);
+}
 
-    auto toDouble
-        = [](DDataType const& val) { return static_cast<double>(static_cast<float>(val)); };
+// Pinned host and device staging buffers for streaming references to the device
+struct ValidationStaging
+{
+    static constexpr std::size_t ChunkBytes = std::size_t(32) << 20;
 
-    if(tolerance == 0.0)
+    static ValidationStaging& instance()
     {
-        // use the same default tolerance value as CK
-        if(computeType == HIPTENSOR_COMPUTE_16BF
-           || std::is_same_v<DDataType, hiptensor::bfloat16_t>)
-        {
-            const double epsilon = std::pow(2, -7);
-            tolerance            = epsilon * 2;
-        }
-        else if(computeType == HIPTENSOR_COMPUTE_16F
-                || std::is_same_v<DDataType, hiptensor::float16_t>)
-        {
-            const double epsilon = std::pow(2, -10);
-            tolerance            = epsilon * 2;
-        }
-        else
+        static ValidationStaging staging;
+        return staging;
+    }
+
+    ~ValidationStaging()
+    {
+        for(int i = 0; i < 2; i++)
         {
-            tolerance = 1e-5;
+            HIPTENSOR_FREE_HOST(mHost[i]);
+            HIPTENSOR_FREE_DEVICE(mDevice[i]);
+            CHECK_HIP_ERROR(hipEventDestroy(mDone[i]));
         }
+        CHECK_HIP_ERROR(hipStreamDestroy(mStream));
     }
 
-    if(isNaN)
+    void*       mHost[2];
+    void*       mDevice[2];
+    hipEvent_t  mDone[2];
+    hipStream_t mStream;
+
+private:
+    ValidationStaging()
     {
-        retval           = false;
-        maxRelativeError = std::numeric_limits<DDataType>::signaling_NaN();
+        for(int i = 0; i < 2; i++)
+        {
+            CHECK_HIP_ERROR(hipHostMalloc(&mHost[i], ChunkBytes, 0));
+            CHECK_HIP_ERROR(hipMalloc(&mDevice[i], ChunkBytes));
+            CHECK_HIP_ERROR(hipEventCreate(&mDone[i]));
+        }
+        CHECK_HIP_ERROR(hipStreamCreate(&mStream));
     }
-    else if(maxRelativeError > (tolerance))
+};
+
+// Fused single pass over D on the device and the reference on the host. The reference
+// is streamed to the device in chunks through two pinned staging buffers, so that
+// the copy of one chunk overlaps the validation of the previous one and no device
+// copy of the full reference is needed.
+template <typename DDataType>
+ValidationStats compareEqualStreamLaunchKernel(DDataType const*       deviceD,
+                                               DDataType const*       hostReference,
+                                               std::size_t            elementsD,
+                                               hiptensorComputeType_t computeType,
+                                               double                 tolerance = 0.0)
+{
+    constexpr std::size_t ChunkElements = ValidationStaging::ChunkBytes / sizeof(DDataType);
+
+    auto& staging = ValidationStaging::instance();
+
+    for(std::size_t offset = 0, chunk = 0; offset < elementsD || chunk == 0;
+        offset += ChunkElements, chunk++)
     {
-        retval = false;
+        auto slot     = chunk % 2;
+        auto elements = std::min(ChunkElements, elementsD - offset);
+
+        // Wait until the previous chunk in this slot has been validated
+        CHECK_HIP_ERROR(hipEventSynchronize(staging.mDone[slot]));
+        std::memcpy(staging.mHost[slot], hostReference + offset, elements * sizeof(DDataType));
+
+        CHECK_HIP_ERROR(hipMemcpyAsync(staging.mDevice[slot],
+                                       staging.mHost[slot],
+                                       elements * sizeof(DDataType),
+                                       hipMemcpyHostToDevice,
+                                       staging.mStream));
+        compareEqualBlockedLaunchKernel(deviceD + offset,
+                                        static_cast<DDataType const*>(staging.mDevice[slot]),
+                                        elements,
+                                        offset,
+                                        chunk > 0,
+                                        staging.mStream);
+        CHECK_HIP_ERROR(hipEventRecord(staging.mDone[slot], staging.mStream));
     }
+    CHECK_HIP_ERROR(hipStreamSynchronize(staging.mStream));
 
-    return std::make_pair(retval, maxRelativeError);
+    return reduceValidationPartials<DDataType>(elementsD, computeType, tolerance);
+}
+
+template <typename DDataType>
+std::pair<bool, double> compareEqualLaunchKernel(DDataType*             deviceD,
+                                                 DDataType*             hostD,
+                                                 std::size_t            elementsD,
+                                                 hiptensorComputeType_t computeType,
+                                                 double                 tolerance = 0.0)
+{
+    auto stats = compareEqualDeviceStats(deviceD, hostD, elementsD, computeType, tolerance);
+    return std::make_pair(stats.mPassed, stats.mMaxRelativeError);
 }
 
 namespace std
@@ -410,4 +535,61 @@ namespace std
     }
 }
 
+// Decodes a flat offset into D into its multi-index, ordered like the lengths. 'components'
+// is the number of compared scalars per element, e.g. 2 for complex data compared as reals.
+template <typename IntT>
+std::vector<IntT> offsetToMultiIndex(std::size_t              offset,
+                                     std::vector<IntT> const& lengths,
+                                     std::vector<IntT> const& strides,
+                                     std::size_t              components = 1)
+{
+    auto order = std::vector<std::size_t>(lengths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&strides](auto lhs, auto rhs) {
+        return strides[lhs] > strides[rhs];
+    });
+
+    auto index = std::vector<IntT>(lengths.size(), 0);
+    offset /= components;
+    for(auto dim : order)
+    {
+        // Unit lengths may share their stride with another mode
+        if(lengths[dim] > 1 && strides[dim] > 0)
+        {
+            index[dim] = static_cast<IntT>(offset / strides[dim]);
+            offset %= strides[dim];
+        }
+    }
+
+    return index;
+}
+
+template <typename IntT>
+std::string validationReport(ValidationStats const&   stats,
+                             std::vector<IntT> const& lengths,
+                             std::vector<IntT> const& strides,
+                             std::size_t              components = 1)
+{
+    std::stringstream report;
+    report << "Max relative error: " << stats.mMaxRelativeError
+           << " (tolerance: " << stats.mTolerance << ") at "
+           << offsetToMultiIndex(stats.mWorstOffset, lengths, strides, components);
+    if(components > 1)
+    {
+        report << " component " << stats.mWorstOffset % components;
+    }
+    report << ", RMS error: " << stats.mRmsError << ", inf: " << stats.mInfCount
+           << ", NaN: " << stats.mNaNCount << ", ulp histogram: ";
+
+    auto last = stats.mUlpHistogram.size();
+    while(last > 1 && stats.mUlpHistogram[last - 1] == 0)
+    {
+        last--;
+    }
+    report << std::vector<std::size_t>(stats.mUlpHistogram.begin(),
+                                       stats.mUlpHistogram.begin() + last);
+
+    return report.str();
+}
+
 #endif // HIPTENSOR_TEST_UTILS_HPP